@@ -57,6 +57,12 @@ bool EverCrypt_AutoConfig2_has_rdrand(void);
 
 bool EverCrypt_AutoConfig2_has_avx512(void);
 
+/**
+True when the CPU supports the VAES extension (AES round instructions on 256- and 512-bit
+vectors) and AVX-512 is usable; never true without `EverCrypt_AutoConfig2_has_avx512`.
+*/
+bool EverCrypt_AutoConfig2_has_vaes(void);
+
 void EverCrypt_AutoConfig2_recall(void);
 
 void EverCrypt_AutoConfig2_init(void);
@@ -85,6 +91,8 @@ void EverCrypt_AutoConfig2_disable_rdrand(void);
 
 void EverCrypt_AutoConfig2_disable_avx512(void);
 
+void EverCrypt_AutoConfig2_disable_vaes(void);
+
 bool EverCrypt_AutoConfig2_has_vec128(void);
 
 bool EverCrypt_AutoConfig2_has_vec256(void);
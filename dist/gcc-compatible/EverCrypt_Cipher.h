@@ -35,6 +35,24 @@ extern "C" {
 #include "krml/lowstar_endianness.h"
 #include "krml/internal/target.h"
 
+#include "Hacl_Spec.h"
+#include "Hacl_Chacha20_Vec512.h"
+#include "Hacl_Chacha20_Vec256.h"
+#include "Hacl_Chacha20_Vec128.h"
+#include "Hacl_AES_CTR_NI.h"
+#include "EverCrypt_Error.h"
+#include "EverCrypt_AutoConfig2.h"
+
+/**
+ChaCha20 (RFC 8439) keystream XOR, dispatched to the widest available vector implementation.
+
+@param len Number of bytes to process.
+@param dst Pointer to `len` bytes of memory where the result is written to.
+@param src Pointer to `len` bytes of memory where the input is read from.
+@param key Pointer to 32 bytes of memory where the key is read from.
+@param iv Pointer to 12 bytes of memory where the nonce is read from.
+@param ctr Initial 32-bit block counter.
+*/
 void
 EverCrypt_Cipher_chacha20(
   uint32_t len,
@@ -45,6 +63,115 @@ EverCrypt_Cipher_chacha20(
   uint32_t ctr
 );
 
+/**
+Same as `EverCrypt_Cipher_chacha20`, but starting at byte `offset` of the keystream that begins
+at block `ctr`. The 32-bit block counter must not wrap, i.e. `ctr + (offset + len) / 64` must
+be below 2^32.
+*/
+void
+EverCrypt_Cipher_chacha20_seek(
+  uint32_t len,
+  uint8_t *dst,
+  uint8_t *src,
+  uint8_t *key,
+  uint8_t *iv,
+  uint32_t ctr,
+  uint64_t offset
+);
+
+/**
+ChaCha20 with the original 64-bit block counter and 64-bit nonce (words 12-13 hold the counter,
+words 14-15 the nonce). The counter carries across the 32-bit boundary, so a single
+(key, nonce) pair covers streams of up to 2^70 bytes.
+
+@param len Number of bytes to process.
+@param dst Pointer to `len` bytes of memory where the result is written to.
+@param src Pointer to `len` bytes of memory where the input is read from.
+@param key Pointer to 32 bytes of memory where the key is read from.
+@param nonce Pointer to 8 bytes of memory where the nonce is read from.
+@param ctr Initial 64-bit block counter.
+*/
+void
+EverCrypt_Cipher_chacha20_ctr64(
+  uint32_t len,
+  uint8_t *dst,
+  uint8_t *src,
+  uint8_t *key,
+  uint8_t *nonce,
+  uint64_t ctr
+);
+
+/**
+Same as `EverCrypt_Cipher_chacha20_ctr64`, but starting at byte `offset` of the keystream that
+begins at block `ctr`.
+*/
+void
+EverCrypt_Cipher_chacha20_ctr64_seek(
+  uint32_t len,
+  uint8_t *dst,
+  uint8_t *src,
+  uint8_t *key,
+  uint8_t *nonce,
+  uint64_t ctr,
+  uint64_t offset
+);
+
+/**
+AES-CTR requires a state that holds the expanded key.
+The state may be reused as many times as desired.
+*/
+typedef struct EverCrypt_Cipher_aes_ctr_state_s_s EverCrypt_Cipher_aes_ctr_state_s;
+
+/**
+Create an AES-CTR state, expanding the key with the Vale AES-NI key schedule.
+
+Note: The caller must free the state by calling `EverCrypt_Cipher_aes_ctr_free`.
+
+@param a The argument `a` must be either of:
+  * `Spec_Agile_Cipher_AES128` (KEY_LEN=16), or
+  * `Spec_Agile_Cipher_AES256` (KEY_LEN=32).
+@param dst Pointer to a pointer where the address of the allocated state will be written to.
+@param k Pointer to `KEY_LEN` bytes of memory where the key is read from.
+
+@return The function returns `EverCrypt_Error_Success` on success or
+  `EverCrypt_Error_UnsupportedAlgorithm` in case of a bad algorithm identifier or if the
+  CPU does not support AES-NI.
+*/
+EverCrypt_Error_error_code
+EverCrypt_Cipher_aes_ctr_create_in(
+  Spec_Agile_Cipher_cipher_alg a,
+  EverCrypt_Cipher_aes_ctr_state_s **dst,
+  uint8_t *k
+);
+
+/**
+AES-CTR keystream XOR starting at byte `offset` of the keystream. The 16-byte counter block
+`iv` is incremented as a 128-bit big-endian integer, so seeking costs O(1) for any offset.
+
+@param s The state created by `EverCrypt_Cipher_aes_ctr_create_in`.
+@param len Number of bytes to process.
+@param dst Pointer to `len` bytes of memory where the result is written to.
+@param src Pointer to `len` bytes of memory where the input is read from.
+@param iv Pointer to 16 bytes of memory where the initial counter block is read from.
+@param offset Byte offset into the keystream.
+*/
+void
+EverCrypt_Cipher_aes_ctr(
+  EverCrypt_Cipher_aes_ctr_state_s *s,
+  uint32_t len,
+  uint8_t *dst,
+  uint8_t *src,
+  uint8_t *iv,
+  uint64_t offset
+);
+
+/**
+Cleanup and free the AES-CTR state, zeroing the expanded key.
+
+@param s State of the AES-CTR algorithm.
+*/
+void EverCrypt_Cipher_aes_ctr_free(EverCrypt_Cipher_aes_ctr_state_s *s);
+
 #if defined(__cplusplus)
 }
 #endif
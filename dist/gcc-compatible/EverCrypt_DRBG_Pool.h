@@ -0,0 +1,72 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __EverCrypt_DRBG_Pool_H
+#define __EverCrypt_DRBG_Pool_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "Lib_RandomBuffer_System.h"
+#include "Hacl_HMAC_DRBG.h"
+#include "EverCrypt_DRBG.h"
+
+/**
+Generate random bytes from the calling thread's own HMAC-DRBG (SHA2-256).
+
+The DRBG is instantiated lazily, on the first call made by each thread, with fresh system
+entropy. It is reseeded from system entropy every `EverCrypt_DRBG_reseed_interval` generate
+requests. After a `fork`, the child re-instantiates its DRBG on the next call, so parent and
+child never share a stream. Once a thread's DRBG exists, this function takes no lock and
+performs no atomic operation.
+
+@param output Pointer to `n` bytes of memory where random output is written to.
+@param n Length of desired output. It may exceed `EverCrypt_DRBG_max_output_length`.
+
+@return True if and only if generate was successful. It fails only if the system entropy
+  source fails.
+*/
+bool EverCrypt_DRBG_Pool_generate(uint8_t *output, uint32_t n);
+
+/**
+Uninstantiate and free the calling thread's DRBG, if any.
+
+On POSIX systems, this happens automatically when the thread exits. On Windows, threads that
+called `EverCrypt_DRBG_Pool_generate` should call this function before exiting.
+*/
+void EverCrypt_DRBG_Pool_thread_free(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_DRBG_Pool_H_DEFINED
+#endif
@@ -36,6 +36,7 @@ extern "C" {
 #include "krml/internal/target.h"
 
 #include "Hacl_Ed25519.h"
+#include "EverCrypt_AutoConfig2.h"
 
 void EverCrypt_Ed25519_secret_to_public(uint8_t *public_key, uint8_t *private_key);
 
@@ -65,6 +66,19 @@ EverCrypt_Ed25519_verify(
   uint8_t *signature
 );
 
+/**
+Same as `Hacl_Ed25519_sign_batch`, but hashes four messages at once with the four-way
+SHA-512 on CPUs with AVX2.
+*/
+void
+EverCrypt_Ed25519_sign_batch(
+  uint8_t *expanded_keys,
+  uint32_t n,
+  uint8_t **msgs,
+  uint32_t *msg_lens,
+  uint8_t **signatures
+);
+
 #if defined(__cplusplus)
 }
 #endif
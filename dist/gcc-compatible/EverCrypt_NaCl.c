@@ -0,0 +1,711 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "EverCrypt_NaCl.h"
+
+#include "internal/Hacl_NaCl.h"
+#include "lib_memzero0.h"
+#include "Lib_RandomBuffer_System.h"
+#include "config.h"
+
+#include <stdlib.h>
+#if (defined(_WIN32) || defined(_WIN64))
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+/* Width of the Salsa20 and Poly1305 code used by `Hacl_NaCl_secretbox_detached` and
+   `Hacl_NaCl_secretbox_open_detached`. */
+static uint32_t vec_width(void)
+{
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  bool vec128 = EverCrypt_AutoConfig2_has_vec128();
+  KRML_MAYBE_UNUSED_VAR(vec256);
+  KRML_MAYBE_UNUSED_VAR(vec128);
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    return 256U;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (vec128)
+  {
+    return 128U;
+  }
+  #endif
+  return 32U;
+}
+
+/**
+Same as `Hacl_NaCl_crypto_secretbox_detached`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_secretbox_detached(
+  uint8_t *c,
+  uint8_t *tag,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *k
+)
+{
+  Hacl_NaCl_secretbox_detached(vec_width(), mlen, c, tag, k, n, m);
+  return 0U;
+}
+
+/**
+Same as `Hacl_NaCl_crypto_secretbox_open_detached`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_secretbox_open_detached(
+  uint8_t *m,
+  uint8_t *c,
+  uint8_t *tag,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *k
+)
+{
+  return Hacl_NaCl_secretbox_open_detached(vec_width(), mlen, m, k, n, c, tag);
+}
+
+/**
+Same as `Hacl_NaCl_crypto_secretbox_easy`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_secretbox_easy(uint8_t *c, uint8_t *m, uint32_t mlen, uint8_t *n, uint8_t *k)
+{
+  Hacl_NaCl_secretbox_detached(vec_width(), mlen, c + 16U, c, k, n, m);
+  return 0U;
+}
+
+/**
+Same as `Hacl_NaCl_crypto_secretbox_open_easy`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_secretbox_open_easy(
+  uint8_t *m,
+  uint8_t *c,
+  uint32_t clen,
+  uint8_t *n,
+  uint8_t *k
+)
+{
+  return Hacl_NaCl_secretbox_open_detached(vec_width(), clen - 16U, m, k, n, c + 16U, c);
+}
+
+/**
+Same as `Hacl_NaCl_crypto_box_detached_afternm`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_detached_afternm(
+  uint8_t *c,
+  uint8_t *tag,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *k
+)
+{
+  Hacl_NaCl_secretbox_detached(vec_width(), mlen, c, tag, k, n, m);
+  return 0U;
+}
+
+/**
+Same as `Hacl_NaCl_crypto_box_detached`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_detached(
+  uint8_t *c,
+  uint8_t *tag,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *pk,
+  uint8_t *sk
+)
+{
+  uint8_t k[32U] = { 0U };
+  uint32_t r = Hacl_NaCl_crypto_box_beforenm(k, pk, sk);
+  if (r == 0U)
+  {
+    Hacl_NaCl_secretbox_detached(vec_width(), mlen, c, tag, k, n, m);
+  }
+  Lib_Memzero0_memzero(k, 32U, uint8_t, void *);
+  return r;
+}
+
+/**
+Same as `Hacl_NaCl_crypto_box_open_detached_afternm`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_open_detached_afternm(
+  uint8_t *m,
+  uint8_t *c,
+  uint8_t *tag,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *k
+)
+{
+  return Hacl_NaCl_secretbox_open_detached(vec_width(), mlen, m, k, n, c, tag);
+}
+
+/**
+Same as `Hacl_NaCl_crypto_box_open_detached`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_open_detached(
+  uint8_t *m,
+  uint8_t *c,
+  uint8_t *tag,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *pk,
+  uint8_t *sk
+)
+{
+  uint8_t k[32U] = { 0U };
+  uint32_t r = Hacl_NaCl_crypto_box_beforenm(k, pk, sk);
+  if (r == 0U)
+  {
+    r = Hacl_NaCl_secretbox_open_detached(vec_width(), mlen, m, k, n, c, tag);
+  }
+  Lib_Memzero0_memzero(k, 32U, uint8_t, void *);
+  return r;
+}
+
+/**
+Same as `Hacl_NaCl_crypto_box_easy_afternm`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_easy_afternm(
+  uint8_t *c,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *k
+)
+{
+  Hacl_NaCl_secretbox_detached(vec_width(), mlen, c + 16U, c, k, n, m);
+  return 0U;
+}
+
+/**
+Same as `Hacl_NaCl_crypto_box_easy`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_easy(
+  uint8_t *c,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *pk,
+  uint8_t *sk
+)
+{
+  uint8_t k[32U] = { 0U };
+  uint32_t r = Hacl_NaCl_crypto_box_beforenm(k, pk, sk);
+  if (r == 0U)
+  {
+    Hacl_NaCl_secretbox_detached(vec_width(), mlen, c + 16U, c, k, n, m);
+  }
+  Lib_Memzero0_memzero(k, 32U, uint8_t, void *);
+  return r;
+}
+
+/**
+Same as `Hacl_NaCl_crypto_box_open_easy_afternm`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_open_easy_afternm(
+  uint8_t *m,
+  uint8_t *c,
+  uint32_t clen,
+  uint8_t *n,
+  uint8_t *k
+)
+{
+  return Hacl_NaCl_secretbox_open_detached(vec_width(), clen - 16U, m, k, n, c + 16U, c);
+}
+
+/**
+Same as `Hacl_NaCl_crypto_box_open_easy`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_open_easy(
+  uint8_t *m,
+  uint8_t *c,
+  uint32_t clen,
+  uint8_t *n,
+  uint8_t *pk,
+  uint8_t *sk
+)
+{
+  uint8_t k[32U] = { 0U };
+  uint32_t r = Hacl_NaCl_crypto_box_beforenm(k, pk, sk);
+  if (r == 0U)
+  {
+    r = Hacl_NaCl_secretbox_open_detached(vec_width(), clen - 16U, m, k, n, c + 16U, c);
+  }
+  Lib_Memzero0_memzero(k, 32U, uint8_t, void *);
+  return r;
+}
+
+/* Index of no entry, ending bucket chains and the LRU list. */
+#define BOX_CACHE_NIL 0xFFFFFFFFU
+
+typedef struct box_cache_entry_s
+{
+  uint64_t hash;
+  uint64_t sk_id;
+  uint32_t bucket_next;
+  uint32_t lru_prev;
+  uint32_t lru_next;
+  uint8_t pk[32U];
+  uint8_t k[32U];
+}
+box_cache_entry;
+
+/* A shard owns `capacity` entries, a hash index of `bucket_mask + 1` chains and an LRU list
+   running from `lru_head` (most recently used) to `lru_tail`; entries `0 .. len - 1` are in
+   use. */
+typedef struct box_cache_shard_s
+{
+#if (defined(_WIN32) || defined(_WIN64))
+  SRWLOCK lock;
+#else
+  pthread_mutex_t lock;
+#endif
+  uint32_t capacity;
+  uint32_t len;
+  uint32_t bucket_mask;
+  uint32_t lru_head;
+  uint32_t lru_tail;
+  uint32_t *buckets;
+  box_cache_entry *entries;
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t evictions;
+}
+box_cache_shard;
+
+struct EverCrypt_NaCl_box_cache_s
+{
+  uint64_t hash_key[2U];
+  uint32_t shard_mask;
+  box_cache_shard *shards;
+};
+
+static void box_cache_lock(box_cache_shard *shard)
+{
+#if (defined(_WIN32) || defined(_WIN64))
+  AcquireSRWLockExclusive(&shard->lock);
+#else
+  pthread_mutex_lock(&shard->lock);
+#endif
+}
+
+static void box_cache_unlock(box_cache_shard *shard)
+{
+#if (defined(_WIN32) || defined(_WIN64))
+  ReleaseSRWLockExclusive(&shard->lock);
+#else
+  pthread_mutex_unlock(&shard->lock);
+#endif
+}
+
+static inline uint64_t rotl64(uint64_t x, uint32_t r)
+{
+  return x << r | x >> (64U - r);
+}
+
+static inline void sipround(uint64_t *v)
+{
+  v[0U] = v[0U] + v[1U];
+  v[1U] = rotl64(v[1U], 13U) ^ v[0U];
+  v[0U] = rotl64(v[0U], 32U);
+  v[2U] = v[2U] + v[3U];
+  v[3U] = rotl64(v[3U], 16U) ^ v[2U];
+  v[0U] = v[0U] + v[3U];
+  v[3U] = rotl64(v[3U], 21U) ^ v[0U];
+  v[2U] = v[2U] + v[1U];
+  v[1U] = rotl64(v[1U], 17U) ^ v[2U];
+  v[2U] = rotl64(v[2U], 32U);
+}
+
+/* SipHash-1-3 of the 40 bytes `sk_id || pk` under the secret key of the cache, so that peers
+   cannot choose public keys that all land in one chain. */
+static uint64_t box_cache_hash(EverCrypt_NaCl_box_cache *cache, uint64_t sk_id, uint8_t *pk)
+{
+  uint64_t k0 = cache->hash_key[0U];
+  uint64_t k1 = cache->hash_key[1U];
+  uint64_t
+  v[4U] =
+    {
+      k0 ^ 0x736f6d6570736575ULL, k1 ^ 0x646f72616e646f6dULL, k0 ^ 0x6c7967656e657261ULL,
+      k1 ^ 0x7465646279746573ULL
+    };
+  uint64_t m[6U] = { 0U };
+  m[0U] = sk_id;
+  KRML_MAYBE_FOR4(i, 0U, 4U, 1U, m[i + 1U] = load64_le(pk + i * 8U););
+  m[5U] = (uint64_t)40U << 56U;
+  for (uint32_t i = 0U; i < 6U; i++)
+  {
+    v[3U] = v[3U] ^ m[i];
+    sipround(v);
+    v[0U] = v[0U] ^ m[i];
+  }
+  v[2U] = v[2U] ^ 0xffULL;
+  KRML_MAYBE_FOR3(i, 0U, 3U, 1U, sipround(v););
+  return v[0U] ^ v[1U] ^ v[2U] ^ v[3U];
+}
+
+static void box_cache_free_shards(box_cache_shard *shards, uint32_t n)
+{
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    box_cache_shard *shard = shards + i;
+    if (shard->entries != NULL)
+    {
+      Lib_Memzero0_memzero(shard->entries, shard->capacity, box_cache_entry, void *);
+    }
+    KRML_HOST_FREE(shard->entries);
+    KRML_HOST_FREE(shard->buckets);
+#if !(defined(_WIN32) || defined(_WIN64))
+    pthread_mutex_destroy(&shard->lock);
+#endif
+  }
+  KRML_HOST_FREE(shards);
+}
+
+EverCrypt_NaCl_box_cache *EverCrypt_NaCl_box_cache_create(uint32_t capacity)
+{
+  if (capacity == 0U)
+  {
+    return NULL;
+  }
+  /* At least 64 entries per shard and at most 16 shards, so that small caches keep an exact
+     LRU order and large ones spread concurrent lookups over independent locks. */
+  uint32_t n_shards = 1U;
+  while (n_shards < 16U && capacity / 128U >= n_shards)
+  {
+    n_shards = n_shards * 2U;
+  }
+  EverCrypt_NaCl_box_cache
+  *cache = (EverCrypt_NaCl_box_cache *)KRML_HOST_MALLOC(sizeof (EverCrypt_NaCl_box_cache));
+  if (cache == NULL)
+  {
+    return NULL;
+  }
+  uint8_t seed[16U] = { 0U };
+  Lib_RandomBuffer_System_crypto_random(seed, 16U);
+  cache->hash_key[0U] = load64_le(seed);
+  cache->hash_key[1U] = load64_le(seed + 8U);
+  Lib_Memzero0_memzero(seed, 16U, uint8_t, void *);
+  cache->shard_mask = n_shards - 1U;
+  box_cache_shard
+  *shards = (box_cache_shard *)KRML_HOST_CALLOC(n_shards, sizeof (box_cache_shard));
+  if (shards == NULL)
+  {
+    KRML_HOST_FREE(cache);
+    return NULL;
+  }
+  for (uint32_t i = 0U; i < n_shards; i++)
+  {
+    box_cache_shard *shard = shards + i;
+    uint32_t cap = capacity / n_shards;
+    if (i < capacity % n_shards)
+    {
+      cap = cap + 1U;
+    }
+    uint32_t n_buckets = 1U;
+    while (n_buckets < cap && n_buckets < 0x80000000U)
+    {
+      n_buckets = n_buckets * 2U;
+    }
+    shard->entries = (box_cache_entry *)KRML_HOST_CALLOC(cap, sizeof (box_cache_entry));
+    shard->buckets = (uint32_t *)KRML_HOST_MALLOC((size_t)n_buckets * sizeof (uint32_t));
+    bool ok = shard->entries != NULL && shard->buckets != NULL;
+#if (defined(_WIN32) || defined(_WIN64))
+    InitializeSRWLock(&shard->lock);
+#else
+    ok = ok && pthread_mutex_init(&shard->lock, NULL) == 0;
+#endif
+    if (!ok)
+    {
+      KRML_HOST_FREE(shard->entries);
+      KRML_HOST_FREE(shard->buckets);
+      box_cache_free_shards(shards, i);
+      KRML_HOST_FREE(cache);
+      return NULL;
+    }
+    memset(shard->buckets, 0xff, (size_t)n_buckets * sizeof (uint32_t));
+    shard->capacity = cap;
+    shard->len = 0U;
+    shard->bucket_mask = n_buckets - 1U;
+    shard->lru_head = BOX_CACHE_NIL;
+    shard->lru_tail = BOX_CACHE_NIL;
+    shard->hits = 0ULL;
+    shard->misses = 0ULL;
+    shard->evictions = 0ULL;
+  }
+  cache->shards = shards;
+  return cache;
+}
+
+void EverCrypt_NaCl_box_cache_free(EverCrypt_NaCl_box_cache *cache)
+{
+  box_cache_free_shards(cache->shards, cache->shard_mask + 1U);
+  KRML_HOST_FREE(cache);
+}
+
+void
+EverCrypt_NaCl_box_cache_stats(
+  EverCrypt_NaCl_box_cache *cache,
+  uint64_t *hits,
+  uint64_t *misses,
+  uint64_t *evictions
+)
+{
+  uint64_t h = 0ULL;
+  uint64_t m = 0ULL;
+  uint64_t e = 0ULL;
+  for (uint32_t i = 0U; i <= cache->shard_mask; i++)
+  {
+    box_cache_shard *shard = cache->shards + i;
+    box_cache_lock(shard);
+    h = h + shard->hits;
+    m = m + shard->misses;
+    e = e + shard->evictions;
+    box_cache_unlock(shard);
+  }
+  *hits = h;
+  *misses = m;
+  *evictions = e;
+}
+
+static inline box_cache_shard *box_cache_shard_of(EverCrypt_NaCl_box_cache *cache, uint64_t hash)
+{
+  return cache->shards + ((uint32_t)(hash >> 32U) & cache->shard_mask);
+}
+
+/* The functions below must be called with the lock of `shard` held. */
+
+static uint32_t
+box_cache_find(box_cache_shard *shard, uint64_t hash, uint64_t sk_id, uint8_t *pk)
+{
+  uint32_t i = shard->buckets[(uint32_t)hash & shard->bucket_mask];
+  while (i != BOX_CACHE_NIL)
+  {
+    box_cache_entry *e = shard->entries + i;
+    if (e->hash == hash && e->sk_id == sk_id && memcmp(e->pk, pk, 32U) == 0)
+    {
+      return i;
+    }
+    i = e->bucket_next;
+  }
+  return BOX_CACHE_NIL;
+}
+
+static void box_cache_lru_unlink(box_cache_shard *shard, uint32_t i)
+{
+  box_cache_entry *e = shard->entries + i;
+  if (e->lru_prev == BOX_CACHE_NIL)
+  {
+    shard->lru_head = e->lru_next;
+  }
+  else
+  {
+    shard->entries[e->lru_prev].lru_next = e->lru_next;
+  }
+  if (e->lru_next == BOX_CACHE_NIL)
+  {
+    shard->lru_tail = e->lru_prev;
+  }
+  else
+  {
+    shard->entries[e->lru_next].lru_prev = e->lru_prev;
+  }
+}
+
+static void box_cache_lru_push_front(box_cache_shard *shard, uint32_t i)
+{
+  box_cache_entry *e = shard->entries + i;
+  e->lru_prev = BOX_CACHE_NIL;
+  e->lru_next = shard->lru_head;
+  if (shard->lru_head == BOX_CACHE_NIL)
+  {
+    shard->lru_tail = i;
+  }
+  else
+  {
+    shard->entries[shard->lru_head].lru_prev = i;
+  }
+  shard->lru_head = i;
+}
+
+static void box_cache_bucket_remove(box_cache_shard *shard, uint32_t i)
+{
+  uint32_t *link = shard->buckets + ((uint32_t)shard->entries[i].hash & shard->bucket_mask);
+  while (*link != i)
+  {
+    link = &shard->entries[*link].bucket_next;
+  }
+  *link = shard->entries[i].bucket_next;
+}
+
+uint32_t
+EverCrypt_NaCl_box_cache_beforenm(
+  EverCrypt_NaCl_box_cache *cache,
+  uint8_t *k,
+  uint64_t sk_id,
+  uint8_t *pk,
+  uint8_t *sk
+)
+{
+  uint64_t hash = box_cache_hash(cache, sk_id, pk);
+  box_cache_shard *shard = box_cache_shard_of(cache, hash);
+  box_cache_lock(shard);
+  uint32_t i = box_cache_find(shard, hash, sk_id, pk);
+  if (i != BOX_CACHE_NIL)
+  {
+    box_cache_lru_unlink(shard, i);
+    box_cache_lru_push_front(shard, i);
+    memcpy(k, shard->entries[i].k, 32U * sizeof (uint8_t));
+    shard->hits = shard->hits + 1ULL;
+    box_cache_unlock(shard);
+    return 0U;
+  }
+  shard->misses = shard->misses + 1ULL;
+  box_cache_unlock(shard);
+  /* The scalar multiplication runs without the lock, so that misses on different threads proceed
+     in parallel; a concurrent miss on the same key may insert it first, in which case this result
+     is simply not stored. */
+  uint32_t res = Hacl_NaCl_crypto_box_beforenm(k, pk, sk);
+  if (res != 0U)
+  {
+    return res;
+  }
+  box_cache_lock(shard);
+  if (box_cache_find(shard, hash, sk_id, pk) == BOX_CACHE_NIL)
+  {
+    uint32_t j;
+    if (shard->len < shard->capacity)
+    {
+      j = shard->len;
+      shard->len = shard->len + 1U;
+    }
+    else
+    {
+      j = shard->lru_tail;
+      box_cache_lru_unlink(shard, j);
+      box_cache_bucket_remove(shard, j);
+      Lib_Memzero0_memzero(shard->entries + j, 1U, box_cache_entry, void *);
+      shard->evictions = shard->evictions + 1ULL;
+    }
+    box_cache_entry *e = shard->entries + j;
+    uint32_t *bucket = shard->buckets + ((uint32_t)hash & shard->bucket_mask);
+    e->hash = hash;
+    e->sk_id = sk_id;
+    memcpy(e->pk, pk, 32U * sizeof (uint8_t));
+    memcpy(e->k, k, 32U * sizeof (uint8_t));
+    e->bucket_next = *bucket;
+    *bucket = j;
+    box_cache_lru_push_front(shard, j);
+  }
+  box_cache_unlock(shard);
+  return 0U;
+}
+
+/**
+Same as `EverCrypt_NaCl_crypto_box_easy`, but the shared secret is taken from (or added to)
+`cache`.
+
+See `EverCrypt_NaCl_box_cache_beforenm` for the meaning of `sk_id`.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_easy_cached(
+  EverCrypt_NaCl_box_cache *cache,
+  uint8_t *c,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint64_t sk_id,
+  uint8_t *pk,
+  uint8_t *sk
+)
+{
+  uint8_t k[32U] = { 0U };
+  uint32_t r = EverCrypt_NaCl_box_cache_beforenm(cache, k, sk_id, pk, sk);
+  if (r == 0U)
+  {
+    Hacl_NaCl_secretbox_detached(vec_width(), mlen, c + 16U, c, k, n, m);
+  }
+  Lib_Memzero0_memzero(k, 32U, uint8_t, void *);
+  return r;
+}
+
+/**
+Same as `EverCrypt_NaCl_crypto_box_open_easy`, but the shared secret is taken from (or added to)
+`cache`.
+
+See `EverCrypt_NaCl_box_cache_beforenm` for the meaning of `sk_id`.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_open_easy_cached(
+  EverCrypt_NaCl_box_cache *cache,
+  uint8_t *m,
+  uint8_t *c,
+  uint32_t clen,
+  uint8_t *n,
+  uint64_t sk_id,
+  uint8_t *pk,
+  uint8_t *sk
+)
+{
+  uint8_t k[32U] = { 0U };
+  uint32_t r = EverCrypt_NaCl_box_cache_beforenm(cache, k, sk_id, pk, sk);
+  if (r == 0U)
+  {
+    r = Hacl_NaCl_secretbox_open_detached(vec_width(), clen - 16U, m, k, n, c + 16U, c);
+  }
+  Lib_Memzero0_memzero(k, 32U, uint8_t, void *);
+  return r;
+}
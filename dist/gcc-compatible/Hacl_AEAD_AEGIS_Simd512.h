@@ -0,0 +1,107 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_AEAD_AEGIS_Simd512_H
+#define __Hacl_AEAD_AEGIS_Simd512_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "Hacl_AEAD_AEGIS_NI.h"
+
+/**
+Encrypt `len` independent packets with AEGIS-128L, four at a time.
+
+Each 512-bit register holds the same state block of four packets (one 128-bit lane per packet),
+so one VAES instruction advances four packets. Packets may have different lengths.
+The result is identical to calling `Hacl_AEAD_AEGIS_NI_aegis128l_encrypt` on each packet.
+
+@param len Number of packets.
+@param packets Pointer to `len` packet descriptors.
+
+This function must only be called on CPUs supporting AVX-512 and VAES.
+*/
+void
+Hacl_AEAD_AEGIS_Simd512_aegis128l_encrypt_batch(
+  uint32_t len,
+  Hacl_AEAD_AEGIS_NI_packet *packets
+);
+
+/**
+Decrypt `len` independent packets with AEGIS-128L, four at a time.
+
+Each packet is authenticated on its own: `res[i]` receives the result of decrypting `packets[i]`
+(0 on success, 1 on failure, in which case `packets[i].output` is zeroed).
+
+@param len Number of packets.
+@param packets Pointer to `len` packet descriptors.
+@param res Pointer to `len` result codes.
+
+@returns The number of packets that failed to authenticate.
+
+This function must only be called on CPUs supporting AVX-512 and VAES.
+*/
+uint32_t
+Hacl_AEAD_AEGIS_Simd512_aegis128l_decrypt_batch(
+  uint32_t len,
+  Hacl_AEAD_AEGIS_NI_packet *packets,
+  uint32_t *res
+);
+
+/**
+Encrypt `len` independent packets with AEGIS-256, four at a time.
+
+Same as `Hacl_AEAD_AEGIS_Simd512_aegis128l_encrypt_batch`, for AEGIS-256.
+*/
+void
+Hacl_AEAD_AEGIS_Simd512_aegis256_encrypt_batch(
+  uint32_t len,
+  Hacl_AEAD_AEGIS_NI_packet *packets
+);
+
+/**
+Decrypt `len` independent packets with AEGIS-256, four at a time.
+
+Same as `Hacl_AEAD_AEGIS_Simd512_aegis128l_decrypt_batch`, for AEGIS-256.
+*/
+uint32_t
+Hacl_AEAD_AEGIS_Simd512_aegis256_decrypt_batch(
+  uint32_t len,
+  Hacl_AEAD_AEGIS_NI_packet *packets,
+  uint32_t *res
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_AEAD_AEGIS_Simd512_H_DEFINED
+#endif
@@ -27,6 +27,7 @@
 
 #include "internal/Hacl_MAC_Poly1305_Simd256.h"
 #include "internal/Hacl_Krmllib.h"
+#include "internal/Hacl_Chacha20.h"
 #include "libintvector.h"
 
 static inline void
@@ -1154,3 +1155,561 @@ Hacl_AEAD_Chacha20Poly1305_Simd256_decrypt(
   return 1U;
 }
 
+
+static inline void
+quarter_round_x8(
+  Lib_IntVector_Intrinsics_vec256 *st,
+  uint32_t a,
+  uint32_t b,
+  uint32_t c,
+  uint32_t d
+)
+{
+  st[a] = Lib_IntVector_Intrinsics_vec256_add32(st[a], st[b]);
+  st[d] =
+    Lib_IntVector_Intrinsics_vec256_rotate_left32(Lib_IntVector_Intrinsics_vec256_xor(st[d], st[a]),
+      16U);
+  st[c] = Lib_IntVector_Intrinsics_vec256_add32(st[c], st[d]);
+  st[b] =
+    Lib_IntVector_Intrinsics_vec256_rotate_left32(Lib_IntVector_Intrinsics_vec256_xor(st[b], st[c]),
+      12U);
+  st[a] = Lib_IntVector_Intrinsics_vec256_add32(st[a], st[b]);
+  st[d] =
+    Lib_IntVector_Intrinsics_vec256_rotate_left32(Lib_IntVector_Intrinsics_vec256_xor(st[d], st[a]),
+      8U);
+  st[c] = Lib_IntVector_Intrinsics_vec256_add32(st[c], st[d]);
+  st[b] =
+    Lib_IntVector_Intrinsics_vec256_rotate_left32(Lib_IntVector_Intrinsics_vec256_xor(st[b], st[c]),
+      7U);
+}
+
+/* One ChaCha20 block for each of eight independent (key, nonce) lanes, all
+   at block counter `ctr`; the result is transposed so that `ks + 64 * i`
+   holds the keystream block of lane i. */
+static inline void
+chacha20_block_x8(uint8_t *ks, Lib_IntVector_Intrinsics_vec256 *ctx, uint32_t ctr)
+{
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 k[16U] KRML_POST_ALIGN(32) = { 0U };
+  memcpy(k, ctx, 16U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  Lib_IntVector_Intrinsics_vec256 cv = Lib_IntVector_Intrinsics_vec256_load32(ctr);
+  k[12U] = cv;
+  for (uint32_t i = 0U; i < 10U; i++)
+  {
+    quarter_round_x8(k, 0U, 4U, 8U, 12U);
+    quarter_round_x8(k, 1U, 5U, 9U, 13U);
+    quarter_round_x8(k, 2U, 6U, 10U, 14U);
+    quarter_round_x8(k, 3U, 7U, 11U, 15U);
+    quarter_round_x8(k, 0U, 5U, 10U, 15U);
+    quarter_round_x8(k, 1U, 6U, 11U, 12U);
+    quarter_round_x8(k, 2U, 7U, 8U, 13U);
+    quarter_round_x8(k, 3U, 4U, 9U, 14U);
+  }
+  KRML_MAYBE_FOR16(i,
+    0U,
+    16U,
+    1U,
+    k[i] = Lib_IntVector_Intrinsics_vec256_add32(k[i], ctx[i]););
+  k[12U] = Lib_IntVector_Intrinsics_vec256_add32(k[12U], cv);
+  KRML_MAYBE_FOR2(h,
+    0U,
+    2U,
+    1U,
+    Lib_IntVector_Intrinsics_vec256 *a = k + 8U * h;
+    Lib_IntVector_Intrinsics_vec256
+    v0_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(a[0U], a[1U]);
+    Lib_IntVector_Intrinsics_vec256
+    v1_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(a[0U], a[1U]);
+    Lib_IntVector_Intrinsics_vec256
+    v2_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(a[2U], a[3U]);
+    Lib_IntVector_Intrinsics_vec256
+    v3_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(a[2U], a[3U]);
+    Lib_IntVector_Intrinsics_vec256
+    v4_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(a[4U], a[5U]);
+    Lib_IntVector_Intrinsics_vec256
+    v5_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(a[4U], a[5U]);
+    Lib_IntVector_Intrinsics_vec256
+    v6_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(a[6U], a[7U]);
+    Lib_IntVector_Intrinsics_vec256
+    v7_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(a[6U], a[7U]);
+    Lib_IntVector_Intrinsics_vec256
+    v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_, v2_);
+    Lib_IntVector_Intrinsics_vec256
+    v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_, v2_);
+    Lib_IntVector_Intrinsics_vec256
+    v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v1_, v3_);
+    Lib_IntVector_Intrinsics_vec256
+    v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v1_, v3_);
+    Lib_IntVector_Intrinsics_vec256
+    v4_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v4_, v6_);
+    Lib_IntVector_Intrinsics_vec256
+    v6_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v4_, v6_);
+    Lib_IntVector_Intrinsics_vec256
+    v5_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v5_, v7_);
+    Lib_IntVector_Intrinsics_vec256
+    v7_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v5_, v7_);
+    uint8_t *o = ks + 32U * h;
+    Lib_IntVector_Intrinsics_vec256_store32_le(o,
+      Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_1, v4_1));
+    Lib_IntVector_Intrinsics_vec256_store32_le(o + 64U,
+      Lib_IntVector_Intrinsics_vec256_interleave_low128(v2_1, v6_1));
+    Lib_IntVector_Intrinsics_vec256_store32_le(o + 128U,
+      Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_1, v5_1));
+    Lib_IntVector_Intrinsics_vec256_store32_le(o + 192U,
+      Lib_IntVector_Intrinsics_vec256_interleave_low128(v3_1, v7_1));
+    Lib_IntVector_Intrinsics_vec256_store32_le(o + 256U,
+      Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_1, v4_1));
+    Lib_IntVector_Intrinsics_vec256_store32_le(o + 320U,
+      Lib_IntVector_Intrinsics_vec256_interleave_high128(v2_1, v6_1));
+    Lib_IntVector_Intrinsics_vec256_store32_le(o + 384U,
+      Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_1, v5_1));
+    Lib_IntVector_Intrinsics_vec256_store32_le(o + 448U,
+      Lib_IntVector_Intrinsics_vec256_interleave_high128(v3_1, v7_1)););
+}
+
+static inline void
+chacha20_init_x8(
+  Lib_IntVector_Intrinsics_vec256 *ctx,
+  Hacl_AEAD_Chacha20Poly1305_packet *p,
+  uint32_t n
+)
+{
+  uint32_t st[128U] = { 0U };
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    uint32_t *os = st + 16U * i;
+    KRML_MAYBE_FOR4(j,
+      0U,
+      4U,
+      1U,
+      os[j] = Hacl_Impl_Chacha20_Vec_chacha20_constants[j];);
+    KRML_MAYBE_FOR8(j, 0U, 8U, 1U, os[4U + j] = load32_le(p[i].key + j * 4U););
+    KRML_MAYBE_FOR3(j, 0U, 3U, 1U, os[13U + j] = load32_le(p[i].nonce + j * 4U););
+  }
+  KRML_MAYBE_FOR16(j,
+    0U,
+    16U,
+    1U,
+    ctx[j] =
+      Lib_IntVector_Intrinsics_vec256_load32s(st[j],
+        st[16U + j],
+        st[32U + j],
+        st[48U + j],
+        st[64U + j],
+        st[80U + j],
+        st[96U + j],
+        st[112U + j]););
+}
+
+static inline void
+fmul_r_x4(
+  Lib_IntVector_Intrinsics_vec256 *out,
+  Lib_IntVector_Intrinsics_vec256 *f1,
+  Lib_IntVector_Intrinsics_vec256 *r,
+  Lib_IntVector_Intrinsics_vec256 *r5
+)
+{
+  Lib_IntVector_Intrinsics_vec256 a0 = f1[0U];
+  Lib_IntVector_Intrinsics_vec256 a1 = f1[1U];
+  Lib_IntVector_Intrinsics_vec256 a2 = f1[2U];
+  Lib_IntVector_Intrinsics_vec256 a3 = f1[3U];
+  Lib_IntVector_Intrinsics_vec256 a4 = f1[4U];
+  Lib_IntVector_Intrinsics_vec256 t0 = Lib_IntVector_Intrinsics_vec256_mul64(r[0U], a0);
+  Lib_IntVector_Intrinsics_vec256 t1 = Lib_IntVector_Intrinsics_vec256_mul64(r[1U], a0);
+  Lib_IntVector_Intrinsics_vec256 t2 = Lib_IntVector_Intrinsics_vec256_mul64(r[2U], a0);
+  Lib_IntVector_Intrinsics_vec256 t3 = Lib_IntVector_Intrinsics_vec256_mul64(r[3U], a0);
+  Lib_IntVector_Intrinsics_vec256 t4 = Lib_IntVector_Intrinsics_vec256_mul64(r[4U], a0);
+  t0 = Lib_IntVector_Intrinsics_vec256_add64(t0, Lib_IntVector_Intrinsics_vec256_mul64(r5[4U], a1));
+  t1 = Lib_IntVector_Intrinsics_vec256_add64(t1, Lib_IntVector_Intrinsics_vec256_mul64(r[0U], a1));
+  t2 = Lib_IntVector_Intrinsics_vec256_add64(t2, Lib_IntVector_Intrinsics_vec256_mul64(r[1U], a1));
+  t3 = Lib_IntVector_Intrinsics_vec256_add64(t3, Lib_IntVector_Intrinsics_vec256_mul64(r[2U], a1));
+  t4 = Lib_IntVector_Intrinsics_vec256_add64(t4, Lib_IntVector_Intrinsics_vec256_mul64(r[3U], a1));
+  t0 = Lib_IntVector_Intrinsics_vec256_add64(t0, Lib_IntVector_Intrinsics_vec256_mul64(r5[3U], a2));
+  t1 = Lib_IntVector_Intrinsics_vec256_add64(t1, Lib_IntVector_Intrinsics_vec256_mul64(r5[4U], a2));
+  t2 = Lib_IntVector_Intrinsics_vec256_add64(t2, Lib_IntVector_Intrinsics_vec256_mul64(r[0U], a2));
+  t3 = Lib_IntVector_Intrinsics_vec256_add64(t3, Lib_IntVector_Intrinsics_vec256_mul64(r[1U], a2));
+  t4 = Lib_IntVector_Intrinsics_vec256_add64(t4, Lib_IntVector_Intrinsics_vec256_mul64(r[2U], a2));
+  t0 = Lib_IntVector_Intrinsics_vec256_add64(t0, Lib_IntVector_Intrinsics_vec256_mul64(r5[2U], a3));
+  t1 = Lib_IntVector_Intrinsics_vec256_add64(t1, Lib_IntVector_Intrinsics_vec256_mul64(r5[3U], a3));
+  t2 = Lib_IntVector_Intrinsics_vec256_add64(t2, Lib_IntVector_Intrinsics_vec256_mul64(r5[4U], a3));
+  t3 = Lib_IntVector_Intrinsics_vec256_add64(t3, Lib_IntVector_Intrinsics_vec256_mul64(r[0U], a3));
+  t4 = Lib_IntVector_Intrinsics_vec256_add64(t4, Lib_IntVector_Intrinsics_vec256_mul64(r[1U], a3));
+  t0 = Lib_IntVector_Intrinsics_vec256_add64(t0, Lib_IntVector_Intrinsics_vec256_mul64(r5[1U], a4));
+  t1 = Lib_IntVector_Intrinsics_vec256_add64(t1, Lib_IntVector_Intrinsics_vec256_mul64(r5[2U], a4));
+  t2 = Lib_IntVector_Intrinsics_vec256_add64(t2, Lib_IntVector_Intrinsics_vec256_mul64(r5[3U], a4));
+  t3 = Lib_IntVector_Intrinsics_vec256_add64(t3, Lib_IntVector_Intrinsics_vec256_mul64(r5[4U], a4));
+  t4 = Lib_IntVector_Intrinsics_vec256_add64(t4, Lib_IntVector_Intrinsics_vec256_mul64(r[0U], a4));
+  Lib_IntVector_Intrinsics_vec256 mask26 = Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL);
+  Lib_IntVector_Intrinsics_vec256 z0 = Lib_IntVector_Intrinsics_vec256_shift_right64(t0, 26U);
+  Lib_IntVector_Intrinsics_vec256 z1 = Lib_IntVector_Intrinsics_vec256_shift_right64(t3, 26U);
+  Lib_IntVector_Intrinsics_vec256 x0 = Lib_IntVector_Intrinsics_vec256_and(t0, mask26);
+  Lib_IntVector_Intrinsics_vec256 x3 = Lib_IntVector_Intrinsics_vec256_and(t3, mask26);
+  Lib_IntVector_Intrinsics_vec256 x1 = Lib_IntVector_Intrinsics_vec256_add64(t1, z0);
+  Lib_IntVector_Intrinsics_vec256 x4 = Lib_IntVector_Intrinsics_vec256_add64(t4, z1);
+  Lib_IntVector_Intrinsics_vec256 z01 = Lib_IntVector_Intrinsics_vec256_shift_right64(x1, 26U);
+  Lib_IntVector_Intrinsics_vec256 z11 = Lib_IntVector_Intrinsics_vec256_shift_right64(x4, 26U);
+  Lib_IntVector_Intrinsics_vec256 t = Lib_IntVector_Intrinsics_vec256_shift_left64(z11, 2U);
+  Lib_IntVector_Intrinsics_vec256 z12 = Lib_IntVector_Intrinsics_vec256_add64(z11, t);
+  Lib_IntVector_Intrinsics_vec256 x11 = Lib_IntVector_Intrinsics_vec256_and(x1, mask26);
+  Lib_IntVector_Intrinsics_vec256 x41 = Lib_IntVector_Intrinsics_vec256_and(x4, mask26);
+  Lib_IntVector_Intrinsics_vec256 x2 = Lib_IntVector_Intrinsics_vec256_add64(t2, z01);
+  Lib_IntVector_Intrinsics_vec256 x01 = Lib_IntVector_Intrinsics_vec256_add64(x0, z12);
+  Lib_IntVector_Intrinsics_vec256 z02 = Lib_IntVector_Intrinsics_vec256_shift_right64(x2, 26U);
+  Lib_IntVector_Intrinsics_vec256 z13 = Lib_IntVector_Intrinsics_vec256_shift_right64(x01, 26U);
+  Lib_IntVector_Intrinsics_vec256 x21 = Lib_IntVector_Intrinsics_vec256_and(x2, mask26);
+  Lib_IntVector_Intrinsics_vec256 x02 = Lib_IntVector_Intrinsics_vec256_and(x01, mask26);
+  Lib_IntVector_Intrinsics_vec256 x31 = Lib_IntVector_Intrinsics_vec256_add64(x3, z02);
+  Lib_IntVector_Intrinsics_vec256 x12 = Lib_IntVector_Intrinsics_vec256_add64(x11, z13);
+  Lib_IntVector_Intrinsics_vec256 z03 = Lib_IntVector_Intrinsics_vec256_shift_right64(x31, 26U);
+  Lib_IntVector_Intrinsics_vec256 x32 = Lib_IntVector_Intrinsics_vec256_and(x31, mask26);
+  Lib_IntVector_Intrinsics_vec256 x42 = Lib_IntVector_Intrinsics_vec256_add64(x41, z03);
+  out[0U] = x02;
+  out[1U] = x12;
+  out[2U] = x21;
+  out[3U] = x32;
+  out[4U] = x42;
+}
+
+static inline void carry_full_x4(Lib_IntVector_Intrinsics_vec256 *f)
+{
+  Lib_IntVector_Intrinsics_vec256 mask26 = Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL);
+  Lib_IntVector_Intrinsics_vec256 c = Lib_IntVector_Intrinsics_vec256_zero;
+  KRML_MAYBE_FOR5(i,
+    0U,
+    5U,
+    1U,
+    Lib_IntVector_Intrinsics_vec256 l = Lib_IntVector_Intrinsics_vec256_add64(f[i], c);
+    f[i] = Lib_IntVector_Intrinsics_vec256_and(l, mask26);
+    c = Lib_IntVector_Intrinsics_vec256_shift_right64(l, 26U););
+  f[0U] =
+    Lib_IntVector_Intrinsics_vec256_add64(f[0U],
+      Lib_IntVector_Intrinsics_vec256_smul64(c, 5ULL));
+}
+
+/* Block `j` of the Poly1305 input of an AEAD packet: the zero-padded
+   associated data, then the zero-padded ciphertext, then the lengths. */
+static inline void
+mac_block(uint8_t *b, uint8_t *aad, uint32_t aadlen, uint8_t *c, uint32_t clen, uint32_t j)
+{
+  uint32_t na = (aadlen + 15U) / 16U;
+  uint32_t nc = (clen + 15U) / 16U;
+  memset(b, 0U, 16U * sizeof (uint8_t));
+  if (j < na)
+  {
+    uint32_t l = aadlen - j * 16U;
+    memcpy(b, aad + j * 16U, (l < 16U ? l : 16U) * sizeof (uint8_t));
+  }
+  else if (j < na + nc)
+  {
+    uint32_t l = clen - (j - na) * 16U;
+    memcpy(b, c + (j - na) * 16U, (l < 16U ? l : 16U) * sizeof (uint8_t));
+  }
+  else
+  {
+    store64_le(b, (uint64_t)aadlen);
+    store64_le(b + 8U, (uint64_t)clen);
+  }
+}
+
+/* Computes the tags of up to four packets, one per 64-bit lane. Shorter
+   inputs are aligned to the end of the longest one: a lane that has not
+   started yet absorbs nothing, which keeps its accumulator at zero. */
+static void
+poly1305_x4(
+  uint8_t *tags,
+  uint8_t *keys,
+  Hacl_AEAD_Chacha20Poly1305_packet *p,
+  uint8_t **c,
+  uint32_t n
+)
+{
+  uint32_t nb[4U] = { 0U };
+  uint32_t max = 0U;
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    nb[i] = (p[i].data_len + 15U) / 16U + (p[i].input_len + 15U) / 16U + 1U;
+    if (nb[i] > max)
+    {
+      max = nb[i];
+    }
+  }
+  uint64_t rl[20U] = { 0U };
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    uint64_t lo = load64_le(keys + 64U * i) & 0x0ffffffc0fffffffULL;
+    uint64_t hi = load64_le(keys + 64U * i + 8U) & 0x0ffffffc0ffffffcULL;
+    rl[i] = lo & 0x3ffffffULL;
+    rl[4U + i] = lo >> 26U & 0x3ffffffULL;
+    rl[8U + i] = (lo >> 52U | (hi & 0x3fffULL) << 12U);
+    rl[12U + i] = hi >> 14U & 0x3ffffffULL;
+    rl[16U + i] = hi >> 40U;
+  }
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 acc[5U] KRML_POST_ALIGN(32) = { 0U };
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 r[5U] KRML_POST_ALIGN(32) = { 0U };
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 r5[5U] KRML_POST_ALIGN(32) = { 0U };
+  KRML_MAYBE_FOR5(i,
+    0U,
+    5U,
+    1U,
+    acc[i] = Lib_IntVector_Intrinsics_vec256_zero;
+    r[i] =
+      Lib_IntVector_Intrinsics_vec256_load64s(rl[4U * i],
+        rl[4U * i + 1U],
+        rl[4U * i + 2U],
+        rl[4U * i + 3U]);
+    r5[i] = Lib_IntVector_Intrinsics_vec256_smul64(r[i], 5ULL););
+  for (uint32_t t = 0U; t < max; t++)
+  {
+    uint8_t b[64U] = { 0U };
+    uint64_t hb[4U] = { 0U };
+    for (uint32_t i = 0U; i < n; i++)
+    {
+      uint32_t start = max - nb[i];
+      if (t >= start)
+      {
+        mac_block(b + 16U * i, p[i].data, p[i].data_len, c[i], p[i].input_len, t - start);
+        hb[i] = 0x1000000ULL;
+      }
+    }
+    Lib_IntVector_Intrinsics_vec256
+    lo =
+      Lib_IntVector_Intrinsics_vec256_load64s(load64_le(b),
+        load64_le(b + 16U),
+        load64_le(b + 32U),
+        load64_le(b + 48U));
+    Lib_IntVector_Intrinsics_vec256
+    hi =
+      Lib_IntVector_Intrinsics_vec256_load64s(load64_le(b + 8U),
+        load64_le(b + 24U),
+        load64_le(b + 40U),
+        load64_le(b + 56U));
+    Lib_IntVector_Intrinsics_vec256 mask26 = Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL);
+    KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 e[5U] KRML_POST_ALIGN(32) = { 0U };
+    e[0U] = Lib_IntVector_Intrinsics_vec256_and(lo, mask26);
+    e[1U] =
+      Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_shift_right64(lo, 26U),
+        mask26);
+    e[2U] =
+      Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_shift_right64(lo, 52U),
+        Lib_IntVector_Intrinsics_vec256_shift_left64(Lib_IntVector_Intrinsics_vec256_and(hi,
+            Lib_IntVector_Intrinsics_vec256_load64(0x3fffULL)),
+          12U));
+    e[3U] =
+      Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_shift_right64(hi, 14U),
+        mask26);
+    e[4U] =
+      Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_shift_right64(hi, 40U),
+        Lib_IntVector_Intrinsics_vec256_load64s(hb[0U], hb[1U], hb[2U], hb[3U]));
+    KRML_MAYBE_FOR5(i,
+      0U,
+      5U,
+      1U,
+      acc[i] = Lib_IntVector_Intrinsics_vec256_add64(acc[i], e[i]););
+    fmul_r_x4(acc, acc, r, r5);
+  }
+  carry_full_x4(acc);
+  carry_full_x4(acc);
+  Lib_IntVector_Intrinsics_vec256 mh = Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL);
+  Lib_IntVector_Intrinsics_vec256 ml = Lib_IntVector_Intrinsics_vec256_load64(0x3fffffbULL);
+  Lib_IntVector_Intrinsics_vec256
+  mask =
+    Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_eq64(acc[4U],
+          mh),
+        Lib_IntVector_Intrinsics_vec256_eq64(acc[3U], mh)),
+      Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_eq64(acc[2U], mh),
+        Lib_IntVector_Intrinsics_vec256_eq64(acc[1U], mh)));
+  Lib_IntVector_Intrinsics_vec256
+  mask1 =
+    Lib_IntVector_Intrinsics_vec256_and(mask,
+      Lib_IntVector_Intrinsics_vec256_lognot(Lib_IntVector_Intrinsics_vec256_gt64(ml, acc[0U])));
+  Lib_IntVector_Intrinsics_vec256 ph = Lib_IntVector_Intrinsics_vec256_and(mask1, mh);
+  Lib_IntVector_Intrinsics_vec256 pl = Lib_IntVector_Intrinsics_vec256_and(mask1, ml);
+  uint8_t f[160U] = { 0U };
+  Lib_IntVector_Intrinsics_vec256_store64_le(f, Lib_IntVector_Intrinsics_vec256_sub64(acc[0U], pl));
+  KRML_MAYBE_FOR4(i,
+    1U,
+    5U,
+    1U,
+    Lib_IntVector_Intrinsics_vec256_store64_le(f + 32U * i,
+      Lib_IntVector_Intrinsics_vec256_sub64(acc[i], ph)););
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    uint64_t f0 = load64_le(f + 8U * i);
+    uint64_t f1 = load64_le(f + 32U + 8U * i);
+    uint64_t f2 = load64_le(f + 64U + 8U * i);
+    uint64_t f3 = load64_le(f + 96U + 8U * i);
+    uint64_t f4 = load64_le(f + 128U + 8U * i);
+    uint64_t lo = (f0 | f1 << 26U) | f2 << 52U;
+    uint64_t hi = (f2 >> 12U | f3 << 14U) | f4 << 40U;
+    uint64_t s0 = load64_le(keys + 64U * i + 16U);
+    uint64_t s1 = load64_le(keys + 64U * i + 24U);
+    uint64_t r0 = lo + s0;
+    uint64_t r1 = hi + s1;
+    uint64_t c0 = (r0 ^ ((r0 ^ s0) | ((r0 - s0) ^ s0))) >> 63U;
+    store64_le(tags + 16U * i, r0);
+    store64_le(tags + 16U * i + 8U, r1 + c0);
+  }
+}
+
+static void
+chacha20_xor_x8(
+  Lib_IntVector_Intrinsics_vec256 *ctx,
+  uint8_t **out,
+  uint8_t **in,
+  uint32_t *len,
+  uint32_t n
+)
+{
+  uint32_t max = 0U;
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    if (len[i] > max)
+    {
+      max = len[i];
+    }
+  }
+  uint32_t nb = (max + 63U) / 64U;
+  for (uint32_t b = 0U; b < nb; b++)
+  {
+    uint8_t ks[512U] = { 0U };
+    chacha20_block_x8(ks, ctx, b + 1U);
+    for (uint32_t i = 0U; i < n; i++)
+    {
+      uint32_t off = b * 64U;
+      if (off < len[i])
+      {
+        uint32_t l = len[i] - off;
+        uint32_t l1 = l < 64U ? l : 64U;
+        for (uint32_t j = 0U; j < l1; j++)
+        {
+          out[i][off + j] = in[i][off + j] ^ ks[64U * i + j];
+        }
+      }
+    }
+  }
+}
+
+static void
+encrypt_x8(Hacl_AEAD_Chacha20Poly1305_packet *p, uint32_t n)
+{
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 ctx[16U] KRML_POST_ALIGN(32) = { 0U };
+  chacha20_init_x8(ctx, p, n);
+  uint8_t ks[512U] = { 0U };
+  chacha20_block_x8(ks, ctx, 0U);
+  uint8_t *out[8U] = { 0U };
+  uint8_t *in[8U] = { 0U };
+  uint32_t len[8U] = { 0U };
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    out[i] = p[i].output;
+    in[i] = p[i].input;
+    len[i] = p[i].input_len;
+  }
+  chacha20_xor_x8(ctx, out, in, len, n);
+  for (uint32_t i = 0U; i < n; i += 4U)
+  {
+    uint32_t m = n - i < 4U ? n - i : 4U;
+    uint8_t tags[64U] = { 0U };
+    poly1305_x4(tags, ks + 64U * i, p + i, out + i, m);
+    for (uint32_t j = 0U; j < m; j++)
+    {
+      memcpy(p[i + j].tag, tags + 16U * j, 16U * sizeof (uint8_t));
+    }
+  }
+}
+
+static uint32_t
+decrypt_x8(Hacl_AEAD_Chacha20Poly1305_packet *p, uint32_t n, uint32_t *res)
+{
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 ctx[16U] KRML_POST_ALIGN(32) = { 0U };
+  chacha20_init_x8(ctx, p, n);
+  uint8_t ks[512U] = { 0U };
+  chacha20_block_x8(ks, ctx, 0U);
+  uint8_t *out[8U] = { 0U };
+  uint8_t *in[8U] = { 0U };
+  uint32_t len[8U] = { 0U };
+  uint32_t failed = 0U;
+  for (uint32_t i = 0U; i < n; i += 4U)
+  {
+    uint32_t m = n - i < 4U ? n - i : 4U;
+    uint8_t tags[64U] = { 0U };
+    uint8_t *c[4U] = { 0U };
+    for (uint32_t j = 0U; j < m; j++)
+    {
+      c[j] = p[i + j].input;
+    }
+    poly1305_x4(tags, ks + 64U * i, p + i, c, m);
+    for (uint32_t j = 0U; j < m; j++)
+    {
+      uint8_t r = 255U;
+      KRML_MAYBE_FOR16(k,
+        0U,
+        16U,
+        1U,
+        uint8_t uu____0 = FStar_UInt8_eq_mask(tags[16U * j + k], p[i + j].tag[k]);
+        r = (uint32_t)uu____0 & (uint32_t)r;);
+      if (r == 255U)
+      {
+        res[i + j] = 0U;
+        out[i + j] = p[i + j].output;
+        in[i + j] = p[i + j].input;
+        len[i + j] = p[i + j].input_len;
+      }
+      else
+      {
+        res[i + j] = 1U;
+        failed++;
+      }
+    }
+  }
+  chacha20_xor_x8(ctx, out, in, len, n);
+  return failed;
+}
+
+/**
+Encrypt `len` independent packets, eight at a time.
+
+The ChaCha20 keystream of eight packets is produced in a single vector pass (one 32-bit lane per
+packet) and their Poly1305 tags are computed four at a time (one 64-bit lane per packet).
+The result is identical to calling `Hacl_AEAD_Chacha20Poly1305_Simd256_encrypt` on each packet.
+
+@param len Number of packets.
+@param packets Pointer to `len` packet descriptors.
+*/
+void
+Hacl_AEAD_Chacha20Poly1305_Simd256_encrypt_batch(
+  uint32_t len,
+  Hacl_AEAD_Chacha20Poly1305_packet *packets
+)
+{
+  for (uint32_t i = 0U; i < len; i += 8U)
+  {
+    encrypt_x8(packets + i, len - i < 8U ? len - i : 8U);
+  }
+}
+
+/**
+Decrypt `len` independent packets, eight at a time.
+
+Each packet is authenticated on its own: `res[i]` receives the result of decrypting `packets[i]`
+(0 on success, 1 on failure, in which case `packets[i].output` remains unchanged).
+
+@param len Number of packets.
+@param packets Pointer to `len` packet descriptors.
+@param res Pointer to `len` result codes.
+
+@returns The number of packets that failed to authenticate.
+*/
+uint32_t
+Hacl_AEAD_Chacha20Poly1305_Simd256_decrypt_batch(
+  uint32_t len,
+  Hacl_AEAD_Chacha20Poly1305_packet *packets,
+  uint32_t *res
+)
+{
+  uint32_t failed = 0U;
+  for (uint32_t i = 0U; i < len; i += 8U)
+  {
+    failed = failed + decrypt_x8(packets + i, len - i < 8U ? len - i : 8U, res + i);
+  }
+  return failed;
+}
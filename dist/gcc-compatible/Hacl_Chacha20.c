@@ -224,3 +224,39 @@ Hacl_Chacha20_chacha20_decrypt(
   Hacl_Impl_Chacha20_chacha20_update(ctx, len, out, cipher);
 }
 
+
+void Hacl_Chacha20_hchacha20(uint8_t *out, uint8_t *key, uint8_t *n)
+{
+  uint32_t st[16U] = { 0U };
+  KRML_MAYBE_FOR4(i,
+    0U,
+    4U,
+    1U,
+    uint32_t *os = st;
+    uint32_t x = chacha20_constants[i];
+    os[i] = x;);
+  KRML_MAYBE_FOR8(i,
+    0U,
+    8U,
+    1U,
+    uint32_t *os = st + 4U;
+    uint8_t *bj = key + i * 4U;
+    uint32_t u = load32_le(bj);
+    uint32_t r = u;
+    uint32_t x = r;
+    os[i] = x;);
+  KRML_MAYBE_FOR4(i,
+    0U,
+    4U,
+    1U,
+    uint32_t *os = st + 12U;
+    uint8_t *bj = n + i * 4U;
+    uint32_t u = load32_le(bj);
+    uint32_t r = u;
+    uint32_t x = r;
+    os[i] = x;);
+  rounds(st);
+  KRML_MAYBE_FOR4(i, 0U, 4U, 1U, store32_le(out + i * 4U, st[i]););
+  KRML_MAYBE_FOR4(i, 0U, 4U, 1U, store32_le(out + 16U + i * 4U, st[12U + i]););
+}
+
@@ -814,3 +814,65 @@ Hacl_Chacha20_Vec128_chacha20_decrypt_128(
   }
 }
 
+
+/**
+Derive `len` independent HChaCha20 subkeys, four at a time.
+
+@param len Number of subkeys.
+@param out Pointer to `32 * len` bytes of memory where the subkeys are written to.
+@param key Pointer to `32 * len` bytes of memory where the keys are read from.
+@param n Pointer to `16 * len` bytes of memory where the nonces are read from.
+*/
+void Hacl_Chacha20_Vec128_hchacha20_128(uint32_t len, uint8_t *out, uint8_t *key, uint8_t *n)
+{
+  for (uint32_t i0 = 0U; i0 < len; i0 += 4U)
+  {
+    uint32_t lanes = len - i0 < 4U ? len - i0 : 4U;
+    uint32_t st[64U] = { 0U };
+    for (uint32_t i = 0U; i < lanes; i++)
+    {
+      uint32_t *os = st + 16U * i;
+      KRML_MAYBE_FOR4(j, 0U, 4U, 1U, os[j] = Hacl_Impl_Chacha20_Vec_chacha20_constants[j];);
+      KRML_MAYBE_FOR8(j, 0U, 8U, 1U, os[4U + j] = load32_le(key + 32U * (i0 + i) + j * 4U););
+      KRML_MAYBE_FOR4(j, 0U, 4U, 1U, os[12U + j] = load32_le(n + 16U * (i0 + i) + j * 4U););
+    }
+    KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 k[16U] KRML_POST_ALIGN(16) = { 0U };
+    KRML_MAYBE_FOR16(j,
+      0U,
+      16U,
+      1U,
+      k[j] =
+        Lib_IntVector_Intrinsics_vec128_load32s(st[j],
+          st[16U + j],
+          st[32U + j],
+          st[48U + j]););
+    double_round_128(k);
+    double_round_128(k);
+    double_round_128(k);
+    double_round_128(k);
+    double_round_128(k);
+    double_round_128(k);
+    double_round_128(k);
+    double_round_128(k);
+    double_round_128(k);
+    double_round_128(k);
+    uint8_t b[128U] = { 0U };
+    KRML_MAYBE_FOR4(j,
+      0U,
+      4U,
+      1U,
+      Lib_IntVector_Intrinsics_vec128_store32_le(b + 16U * j, k[j]);
+      Lib_IntVector_Intrinsics_vec128_store32_le(b + 64U + 16U * j, k[12U + j]););
+    for (uint32_t i = 0U; i < lanes; i++)
+    {
+      uint8_t *o = out + 32U * (i0 + i);
+      KRML_MAYBE_FOR4(j,
+        0U,
+        4U,
+        1U,
+        memcpy(o + 4U * j, b + 16U * j + 4U * i, 4U * sizeof (uint8_t));
+        memcpy(o + 16U + 4U * j, b + 64U + 16U * j + 4U * i, 4U * sizeof (uint8_t)););
+    }
+  }
+}
+
@@ -0,0 +1,578 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#include "Hacl_Curve25519_Vec256.h"
+
+#include "libintvector.h"
+
+/* A field element holds four independent values, one per 64-bit lane, in ten limbs of
+   alternately 26 and 25 bits (radix 2^25.5). Limb i has weight 2^ceil(25.5 i). */
+
+static const uint32_t limb_offset[10U] = { 0U, 26U, 51U, 77U, 102U, 128U, 153U, 179U, 204U, 230U };
+
+static inline uint32_t limb_width(uint32_t i)
+{
+  return 26U - (i & 1U);
+}
+
+static inline void
+fadd(
+  Lib_IntVector_Intrinsics_vec256 *out,
+  Lib_IntVector_Intrinsics_vec256 *a,
+  Lib_IntVector_Intrinsics_vec256 *b
+)
+{
+  KRML_MAYBE_FOR10(i,
+    0U,
+    10U,
+    1U,
+    out[i] = Lib_IntVector_Intrinsics_vec256_add64(a[i], b[i]););
+}
+
+/* out = a + 2p - b; b must be the output of a multiplication or squaring. */
+static inline void
+fsub(
+  Lib_IntVector_Intrinsics_vec256 *out,
+  Lib_IntVector_Intrinsics_vec256 *a,
+  Lib_IntVector_Intrinsics_vec256 *b
+)
+{
+  Lib_IntVector_Intrinsics_vec256 p0 = Lib_IntVector_Intrinsics_vec256_load64(0x7ffffdaULL);
+  Lib_IntVector_Intrinsics_vec256 p_even = Lib_IntVector_Intrinsics_vec256_load64(0x7fffffeULL);
+  Lib_IntVector_Intrinsics_vec256 p_odd = Lib_IntVector_Intrinsics_vec256_load64(0x3fffffeULL);
+  KRML_MAYBE_FOR10(i,
+    0U,
+    10U,
+    1U,
+    Lib_IntVector_Intrinsics_vec256 two_p;
+    if (i == 0U)
+    {
+      two_p = p0;
+    }
+    else if ((i & 1U) == 0U)
+    {
+      two_p = p_even;
+    }
+    else
+    {
+      two_p = p_odd;
+    }
+    out[i] =
+      Lib_IntVector_Intrinsics_vec256_sub64(Lib_IntVector_Intrinsics_vec256_add64(a[i], two_p),
+        b[i]););
+}
+
+static inline void carry_step(Lib_IntVector_Intrinsics_vec256 *h, uint32_t i)
+{
+  uint32_t w = limb_width(i);
+  Lib_IntVector_Intrinsics_vec256 mask = Lib_IntVector_Intrinsics_vec256_load64((1ULL << w) - 1ULL);
+  Lib_IntVector_Intrinsics_vec256 c = Lib_IntVector_Intrinsics_vec256_shift_right64(h[i], w);
+  h[i] = Lib_IntVector_Intrinsics_vec256_and(h[i], mask);
+  if (i == 9U)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    c19 =
+      Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_shift_left64(c, 4U),
+        Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_shift_left64(c, 1U),
+          c));
+    h[0U] = Lib_IntVector_Intrinsics_vec256_add64(h[0U], c19);
+  }
+  else
+  {
+    h[i + 1U] = Lib_IntVector_Intrinsics_vec256_add64(h[i + 1U], c);
+  }
+}
+
+/* Brings every limb back under 2^26 (even) or 2^25 (odd), up to a small excess in limbs
+   1 and 5, interleaving two carry chains as in the ref10 code. */
+static inline void carry_wide(Lib_IntVector_Intrinsics_vec256 *h)
+{
+  carry_step(h, 0U);
+  carry_step(h, 4U);
+  carry_step(h, 1U);
+  carry_step(h, 5U);
+  carry_step(h, 2U);
+  carry_step(h, 6U);
+  carry_step(h, 3U);
+  carry_step(h, 7U);
+  carry_step(h, 4U);
+  carry_step(h, 8U);
+  carry_step(h, 9U);
+  carry_step(h, 0U);
+}
+
+/* Two independent carry chains, interleaved so that neither waits on its own latency. */
+static inline void
+carry_wide2(Lib_IntVector_Intrinsics_vec256 *h1, Lib_IntVector_Intrinsics_vec256 *h2)
+{
+  carry_step(h1, 0U);
+  carry_step(h2, 0U);
+  carry_step(h1, 4U);
+  carry_step(h2, 4U);
+  carry_step(h1, 1U);
+  carry_step(h2, 1U);
+  carry_step(h1, 5U);
+  carry_step(h2, 5U);
+  carry_step(h1, 2U);
+  carry_step(h2, 2U);
+  carry_step(h1, 6U);
+  carry_step(h2, 6U);
+  carry_step(h1, 3U);
+  carry_step(h2, 3U);
+  carry_step(h1, 7U);
+  carry_step(h2, 7U);
+  carry_step(h1, 4U);
+  carry_step(h2, 4U);
+  carry_step(h1, 8U);
+  carry_step(h2, 8U);
+  carry_step(h1, 9U);
+  carry_step(h2, 9U);
+  carry_step(h1, 0U);
+  carry_step(h2, 0U);
+}
+
+/* Inputs are sums or differences of carried values, so every limb is below 1.5 * 2^27
+   and 19 times it still fits the 32-bit multiplier inputs; all ten products of a column
+   sum to less than 2^63. The result is not carried. */
+static inline void
+fmul_wide(
+  Lib_IntVector_Intrinsics_vec256 *h,
+  Lib_IntVector_Intrinsics_vec256 *f,
+  Lib_IntVector_Intrinsics_vec256 *g
+)
+{
+  Lib_IntVector_Intrinsics_vec256 f2[10U];
+  Lib_IntVector_Intrinsics_vec256 g19[10U];
+  KRML_MAYBE_FOR10(i,
+    0U,
+    10U,
+    1U,
+    if ((i & 1U) == 1U)
+    {
+      f2[i] = Lib_IntVector_Intrinsics_vec256_add64(f[i], f[i]);
+    }
+    else
+    {
+      f2[i] = f[i];
+    }
+    g19[i] = Lib_IntVector_Intrinsics_vec256_smul64(g[i], 19ULL););
+  /* One column at a time, so that a single accumulator is live. */
+  KRML_MAYBE_FOR10(k,
+    0U,
+    10U,
+    1U,
+    Lib_IntVector_Intrinsics_vec256 acc = Lib_IntVector_Intrinsics_vec256_zero;
+    KRML_MAYBE_FOR10(i,
+      0U,
+      10U,
+      1U,
+      uint32_t j = (k + 10U - i) % 10U;
+      Lib_IntVector_Intrinsics_vec256 fi;
+      if ((j & 1U) == 1U)
+      {
+        fi = f2[i];
+      }
+      else
+      {
+        fi = f[i];
+      }
+      Lib_IntVector_Intrinsics_vec256 gj;
+      if (i > k)
+      {
+        gj = g19[j];
+      }
+      else
+      {
+        gj = g[j];
+      }
+      acc =
+        Lib_IntVector_Intrinsics_vec256_add64(acc,
+          Lib_IntVector_Intrinsics_vec256_mul64(fi, gj)););
+    h[k] = acc;);
+}
+
+/* Squaring shares the symmetric products: 55 multiplications instead of 100. */
+static inline void
+fsqr_wide(Lib_IntVector_Intrinsics_vec256 *h, Lib_IntVector_Intrinsics_vec256 *f)
+{
+  Lib_IntVector_Intrinsics_vec256 f2[10U];
+  Lib_IntVector_Intrinsics_vec256 f19[10U];
+  KRML_MAYBE_FOR10(i,
+    0U,
+    10U,
+    1U,
+    f2[i] = Lib_IntVector_Intrinsics_vec256_add64(f[i], f[i]);
+    f19[i] = Lib_IntVector_Intrinsics_vec256_smul64(f[i], 19ULL););
+  KRML_MAYBE_FOR10(k,
+    0U,
+    10U,
+    1U,
+    Lib_IntVector_Intrinsics_vec256 acc = Lib_IntVector_Intrinsics_vec256_zero;
+    KRML_MAYBE_FOR10(i,
+      0U,
+      10U,
+      1U,
+      uint32_t j = (k + 10U - i) % 10U;
+      if (j >= i)
+      {
+        /* f_i f_j appears twice unless i = j; a product of two odd limbs is doubled again. */
+        Lib_IntVector_Intrinsics_vec256 fi;
+        if (i == j)
+        {
+          fi = f[i];
+        }
+        else
+        {
+          fi = f2[i];
+        }
+        if ((i & 1U) == 1U && (j & 1U) == 1U)
+        {
+          fi = Lib_IntVector_Intrinsics_vec256_add64(fi, fi);
+        }
+        Lib_IntVector_Intrinsics_vec256 fj;
+        if (i > k)
+        {
+          fj = f19[j];
+        }
+        else
+        {
+          fj = f[j];
+        }
+        acc =
+          Lib_IntVector_Intrinsics_vec256_add64(acc,
+            Lib_IntVector_Intrinsics_vec256_mul64(fi, fj));
+      });
+    h[k] = acc;);
+}
+
+static inline void
+fmul(
+  Lib_IntVector_Intrinsics_vec256 *out,
+  Lib_IntVector_Intrinsics_vec256 *f,
+  Lib_IntVector_Intrinsics_vec256 *g
+)
+{
+  Lib_IntVector_Intrinsics_vec256 h[10U];
+  fmul_wide(h, f, g);
+  carry_wide(h);
+  memcpy(out, h, 10U * sizeof (Lib_IntVector_Intrinsics_vec256));
+}
+
+static inline void fsqr(Lib_IntVector_Intrinsics_vec256 *out, Lib_IntVector_Intrinsics_vec256 *f)
+{
+  Lib_IntVector_Intrinsics_vec256 h[10U];
+  fsqr_wide(h, f);
+  carry_wide(h);
+  memcpy(out, h, 10U * sizeof (Lib_IntVector_Intrinsics_vec256));
+}
+
+/* out1 = f1 * g1 and out2 = f2 * g2, with the two carry chains interleaved. */
+static void
+fmul2(
+  Lib_IntVector_Intrinsics_vec256 *out1,
+  Lib_IntVector_Intrinsics_vec256 *f1,
+  Lib_IntVector_Intrinsics_vec256 *g1,
+  Lib_IntVector_Intrinsics_vec256 *out2,
+  Lib_IntVector_Intrinsics_vec256 *f2,
+  Lib_IntVector_Intrinsics_vec256 *g2
+)
+{
+  Lib_IntVector_Intrinsics_vec256 h1[10U];
+  Lib_IntVector_Intrinsics_vec256 h2[10U];
+  fmul_wide(h1, f1, g1);
+  fmul_wide(h2, f2, g2);
+  carry_wide2(h1, h2);
+  memcpy(out1, h1, 10U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  memcpy(out2, h2, 10U * sizeof (Lib_IntVector_Intrinsics_vec256));
+}
+
+static void
+fsqr2(
+  Lib_IntVector_Intrinsics_vec256 *out1,
+  Lib_IntVector_Intrinsics_vec256 *f1,
+  Lib_IntVector_Intrinsics_vec256 *out2,
+  Lib_IntVector_Intrinsics_vec256 *f2
+)
+{
+  Lib_IntVector_Intrinsics_vec256 h1[10U];
+  Lib_IntVector_Intrinsics_vec256 h2[10U];
+  fsqr_wide(h1, f1);
+  fsqr_wide(h2, f2);
+  carry_wide2(h1, h2);
+  memcpy(out1, h1, 10U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  memcpy(out2, h2, 10U * sizeof (Lib_IntVector_Intrinsics_vec256));
+}
+
+static inline void
+fsqr_times(
+  Lib_IntVector_Intrinsics_vec256 *out,
+  Lib_IntVector_Intrinsics_vec256 *f,
+  uint32_t n
+)
+{
+  fsqr(out, f);
+  for (uint32_t i = 1U; i < n; i++)
+  {
+    fsqr(out, out);
+  }
+}
+
+static inline void
+fmul_a24(
+  Lib_IntVector_Intrinsics_vec256 *out,
+  Lib_IntVector_Intrinsics_vec256 *f
+)
+{
+  Lib_IntVector_Intrinsics_vec256 h[10U];
+  KRML_MAYBE_FOR10(i,
+    0U,
+    10U,
+    1U,
+    h[i] = Lib_IntVector_Intrinsics_vec256_smul64(f[i], 121665ULL););
+  carry_wide(h);
+  memcpy(out, h, 10U * sizeof (Lib_IntVector_Intrinsics_vec256));
+}
+
+/* out = f^(p - 2), with the addition chain of Hacl_Bignum25519_inverse. */
+static void finv(Lib_IntVector_Intrinsics_vec256 *out, Lib_IntVector_Intrinsics_vec256 *f)
+{
+  Lib_IntVector_Intrinsics_vec256 a[10U];
+  Lib_IntVector_Intrinsics_vec256 b[10U];
+  Lib_IntVector_Intrinsics_vec256 c[10U];
+  Lib_IntVector_Intrinsics_vec256 t0[10U];
+  fsqr(a, f);
+  fsqr_times(t0, a, 2U);
+  fmul(b, t0, f);
+  fmul(a, b, a);
+  fsqr(t0, a);
+  fmul(b, t0, b);
+  fsqr_times(t0, b, 5U);
+  fmul(b, t0, b);
+  fsqr_times(t0, b, 10U);
+  fmul(c, t0, b);
+  fsqr_times(t0, c, 20U);
+  fmul(t0, t0, c);
+  fsqr_times(t0, t0, 10U);
+  fmul(b, t0, b);
+  fsqr_times(t0, b, 50U);
+  fmul(c, t0, b);
+  fsqr_times(t0, c, 100U);
+  fmul(t0, t0, c);
+  fsqr_times(t0, t0, 50U);
+  fmul(t0, t0, b);
+  fsqr_times(t0, t0, 5U);
+  fmul(out, t0, a);
+}
+
+static inline void
+cswap(
+  Lib_IntVector_Intrinsics_vec256 mask,
+  Lib_IntVector_Intrinsics_vec256 *p,
+  Lib_IntVector_Intrinsics_vec256 *q
+)
+{
+  for (uint32_t i = 0U; i < 20U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    t = Lib_IntVector_Intrinsics_vec256_and(mask, Lib_IntVector_Intrinsics_vec256_xor(p[i], q[i]));
+    p[i] = Lib_IntVector_Intrinsics_vec256_xor(p[i], t);
+    q[i] = Lib_IntVector_Intrinsics_vec256_xor(q[i], t);
+  }
+}
+
+static void decode_point(Lib_IntVector_Intrinsics_vec256 *out, uint8_t *pub)
+{
+  uint64_t limbs[40U] = { 0U };
+  KRML_MAYBE_FOR4(k,
+    0U,
+    4U,
+    1U,
+    uint64_t w[4U] = { 0U };
+    KRML_MAYBE_FOR4(i, 0U, 4U, 1U, w[i] = load64_le(pub + k * 32U + i * 8U););
+    w[3U] = w[3U] & 0x7fffffffffffffffULL;
+    KRML_MAYBE_FOR10(i,
+      0U,
+      10U,
+      1U,
+      uint32_t off = limb_offset[i];
+      uint32_t sh = off % 64U;
+      uint64_t v = w[off / 64U] >> sh;
+      if (sh + limb_width(i) > 64U)
+      {
+        v = v | w[off / 64U + 1U] << (64U - sh);
+      }
+      limbs[4U * i + k] = v & ((1ULL << limb_width(i)) - 1ULL);););
+  KRML_MAYBE_FOR10(i,
+    0U,
+    10U,
+    1U,
+    out[i] =
+      Lib_IntVector_Intrinsics_vec256_load64s(limbs[4U * i],
+        limbs[4U * i + 1U],
+        limbs[4U * i + 2U],
+        limbs[4U * i + 3U]););
+}
+
+static inline uint64_t carry_pass(uint64_t *l)
+{
+  uint64_t c = 0ULL;
+  KRML_MAYBE_FOR10(i,
+    0U,
+    10U,
+    1U,
+    uint64_t v = l[i] + c;
+    l[i] = v & ((1ULL << limb_width(i)) - 1ULL);
+    c = v >> limb_width(i););
+  return c;
+}
+
+/* Fully reduces the value of one lane, in constant time, and writes it as 32 bytes. */
+static void encode_lane(uint8_t *out, uint64_t *l)
+{
+  KRML_MAYBE_FOR3(i, 0U, 3U, 1U, l[0U] = l[0U] + 19ULL * carry_pass(l););
+  /* Now l < 2^255; subtract p if l + 19 reaches 2^255. */
+  uint64_t t[10U] = { 0U };
+  memcpy(t, l, 10U * sizeof (uint64_t));
+  t[0U] = t[0U] + 19ULL;
+  uint64_t ge = carry_pass(t);
+  uint64_t mask = 0ULL - ge;
+  KRML_MAYBE_FOR10(i, 0U, 10U, 1U, l[i] = (t[i] & mask) | (l[i] & ~mask););
+  uint64_t w[4U] = { 0U };
+  KRML_MAYBE_FOR10(i,
+    0U,
+    10U,
+    1U,
+    uint32_t off = limb_offset[i];
+    uint32_t sh = off % 64U;
+    w[off / 64U] = w[off / 64U] | l[i] << sh;
+    if (sh + limb_width(i) > 64U)
+    {
+      w[off / 64U + 1U] = w[off / 64U + 1U] | l[i] >> (64U - sh);
+    });
+  KRML_MAYBE_FOR4(i, 0U, 4U, 1U, store64_le(out + i * 8U, w[i]););
+}
+
+/**
+Compute four independent X25519 scalar multiplications at once, one per 64-bit lane of
+AVX2 vectors, with the constant-time Montgomery ladder of RFC 7748.
+
+@param out Pointer to 4 * 32 bytes of memory where the resulting points are written to.
+@param priv Pointer to 4 * 32 bytes of memory where the secret/private keys are read from.
+@param pub Pointer to 4 * 32 bytes of memory where the public points are read from.
+
+Lane k reads `priv + 32 k` and `pub + 32 k` and writes `out + 32 k`; the results are the
+same as four calls to `Hacl_Curve25519_51_scalarmult`.
+*/
+void Hacl_Curve25519_Vec256_scalarmult4(uint8_t *out, uint8_t *priv, uint8_t *pub)
+{
+  uint8_t s[128U] = { 0U };
+  memcpy(s, priv, 128U * sizeof (uint8_t));
+  KRML_MAYBE_FOR4(k,
+    0U,
+    4U,
+    1U,
+    s[32U * k] = (uint32_t)s[32U * k] & 0xf8U;
+    s[32U * k + 31U] = ((uint32_t)s[32U * k + 31U] & 127U) | 64U;);
+  Lib_IntVector_Intrinsics_vec256 x1[10U];
+  /* p2 = (x2, z2) and p3 = (x3, z3), adjacent so that they swap as one block. */
+  Lib_IntVector_Intrinsics_vec256 p2[20U];
+  Lib_IntVector_Intrinsics_vec256 p3[20U];
+  decode_point(x1, pub);
+  KRML_MAYBE_FOR10(i,
+    0U,
+    10U,
+    1U,
+    p2[i] = Lib_IntVector_Intrinsics_vec256_zero;
+    p2[10U + i] = Lib_IntVector_Intrinsics_vec256_zero;
+    p3[i] = x1[i];
+    p3[10U + i] = Lib_IntVector_Intrinsics_vec256_zero;);
+  p2[0U] = Lib_IntVector_Intrinsics_vec256_load64(1ULL);
+  p3[10U] = Lib_IntVector_Intrinsics_vec256_load64(1ULL);
+  Lib_IntVector_Intrinsics_vec256 *x2 = p2;
+  Lib_IntVector_Intrinsics_vec256 *z2 = p2 + 10U;
+  Lib_IntVector_Intrinsics_vec256 *x3 = p3;
+  Lib_IntVector_Intrinsics_vec256 *z3 = p3 + 10U;
+  Lib_IntVector_Intrinsics_vec256 a[10U];
+  Lib_IntVector_Intrinsics_vec256 aa[10U];
+  Lib_IntVector_Intrinsics_vec256 b[10U];
+  Lib_IntVector_Intrinsics_vec256 bb[10U];
+  Lib_IntVector_Intrinsics_vec256 c[10U];
+  Lib_IntVector_Intrinsics_vec256 d[10U];
+  Lib_IntVector_Intrinsics_vec256 e[10U];
+  Lib_IntVector_Intrinsics_vec256 swap = Lib_IntVector_Intrinsics_vec256_zero;
+  for (uint32_t i0 = 0U; i0 < 255U; i0++)
+  {
+    uint32_t i = 254U - i0;
+    uint64_t bits[4U] = { 0U };
+    KRML_MAYBE_FOR4(k,
+      0U,
+      4U,
+      1U,
+      bits[k] = (uint64_t)((uint32_t)s[32U * k + i / 8U] >> i % 8U & 1U););
+    Lib_IntVector_Intrinsics_vec256
+    bit = Lib_IntVector_Intrinsics_vec256_load64s(bits[0U], bits[1U], bits[2U], bits[3U]);
+    swap = Lib_IntVector_Intrinsics_vec256_xor(swap, bit);
+    cswap(Lib_IntVector_Intrinsics_vec256_sub64(Lib_IntVector_Intrinsics_vec256_zero, swap),
+      p2,
+      p3);
+    swap = bit;
+    fadd(a, x2, z2);
+    fsub(b, x2, z2);
+    fadd(c, x3, z3);
+    fsub(d, x3, z3);
+    fsqr2(aa, a, bb, b);
+    fmul2(d, d, a, c, c, b);
+    fsub(e, aa, bb);
+    fadd(x3, d, c);
+    fsub(z3, d, c);
+    fsqr2(x3, x3, z3, z3);
+    fmul2(z3, z3, x1, x2, aa, bb);
+    fmul_a24(z2, e);
+    fadd(z2, z2, aa);
+    fmul(z2, z2, e);
+  }
+  cswap(Lib_IntVector_Intrinsics_vec256_sub64(Lib_IntVector_Intrinsics_vec256_zero, swap),
+    p2,
+    p3);
+  Lib_IntVector_Intrinsics_vec256 zinv[10U];
+  finv(zinv, z2);
+  fmul(x2, x2, zinv);
+  uint64_t lanes[40U] = { 0U };
+  KRML_MAYBE_FOR10(i,
+    0U,
+    10U,
+    1U,
+    Lib_IntVector_Intrinsics_vec256_store64_le((uint8_t *)(lanes + 4U * i), x2[i]););
+  KRML_MAYBE_FOR4(k,
+    0U,
+    4U,
+    1U,
+    uint64_t l[10U] = { 0U };
+    KRML_MAYBE_FOR10(i, 0U, 10U, 1U, l[i] = lanes[4U * i + k];);
+    encode_lane(out + 32U * k, l););
+}
+
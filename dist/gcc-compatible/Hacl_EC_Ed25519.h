@@ -257,6 +257,62 @@ Decompress a point in extended homogeneous coordinates from its compressed form.
 */
 bool Hacl_EC_Ed25519_point_decompress(uint8_t *s, uint64_t *out);
 
+/**
+Compress `n` points in extended homogeneous coordinates with a single field inversion
+per 64 points (Montgomery's simultaneous-inversion trick).
+
+  The argument `p` points to `n` points of 20 limbs each, i.e., uint64_t[20 * n].
+  The outparam `out` points to 32 * `n` bytes of valid memory, i.e., uint8_t[32 * n].
+
+  The result is the same as `n` calls to `Hacl_EC_Ed25519_point_compress`, and the
+  function is constant-time in the points. Each inversion is replaced by three field
+  multiplications.
+
+  Before calling this function, the caller will need to ensure that the following
+  preconditions are observed.
+  • `p` and `out` are disjoint
+  • every point has a non-zero `Z` coordinate, as all points produced by this module do
+*/
+void Hacl_EC_Ed25519_point_compress_batch(uint32_t n, uint64_t *p, uint8_t *out);
+
+/**
+Write `[scalar]p` in `out`, in variable time.
+
+  The argument `p` and the outparam `out` are meant to be 20 limbs in size, i.e., uint64_t[20].
+  The argument `scalar` is meant to be 32 bytes in size, i.e., uint8_t[32].
+
+  The result is the same as `Hacl_EC_Ed25519_point_mul`, with a sliding window over odd
+  multiples of `p`. The running time depends on `scalar`: use it only when the scalar is
+  public, e.g., when verifying.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • `scalar`, `p`, and `out` are pairwise disjoint
+*/
+void Hacl_EC_Ed25519_point_mul_vartime(uint8_t *scalar, uint64_t *p, uint64_t *out);
+
+/**
+Write `[scalars[0]]points[0] + ... + [scalars[n - 1]]points[n - 1]` in `out`, in variable
+time (multi-scalar multiplication).
+
+  The function returns `false`, leaving `out` untouched, if memory cannot be allocated,
+  and `true` otherwise.
+
+  The argument `scalars` points to `n` little-endian scalars of 32 bytes each, i.e., uint8_t[32 * n].
+  The argument `points` points to `n` points of 20 limbs each, i.e., uint64_t[20 * n].
+  The outparam `out` is meant to be 20 limbs in size, i.e., uint64_t[20].
+
+  The sum is computed with Pippenger's bucket method and signed digits, whose window
+  grows with `n`; for `n` in the hundreds it costs a small fraction of `n` calls to
+  `Hacl_EC_Ed25519_point_mul`. The running time depends on the scalars: use it only
+  when they are public.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • `out` is disjoint from `scalars` and `points`
+*/
+bool Hacl_EC_Ed25519_point_mul_multi(uint32_t n, uint8_t *scalars, uint64_t *points, uint64_t *out);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -35,7 +35,11 @@ extern "C" {
 #include "krml/lowstar_endianness.h"
 #include "krml/internal/target.h"
 
+#include "Hacl_Salsa20_Vec256.h"
+#include "Hacl_Salsa20_Vec128.h"
 #include "Hacl_Salsa20.h"
+#include "Hacl_MAC_Poly1305_Simd256.h"
+#include "Hacl_MAC_Poly1305_Simd128.h"
 #include "Hacl_MAC_Poly1305.h"
 #include "Hacl_Curve25519_51.h"
 
@@ -0,0 +1,243 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Salsa20_Vec128.h"
+
+#include "libintvector.h"
+
+static inline void
+quarter_round_128(
+  Lib_IntVector_Intrinsics_vec128 *st,
+  uint32_t a,
+  uint32_t b,
+  uint32_t c,
+  uint32_t d
+)
+{
+  Lib_IntVector_Intrinsics_vec128 t0 = Lib_IntVector_Intrinsics_vec128_add32(st[a], st[d]);
+  st[b] =
+    Lib_IntVector_Intrinsics_vec128_xor(st[b],
+      Lib_IntVector_Intrinsics_vec128_rotate_left32(t0, 7U));
+  Lib_IntVector_Intrinsics_vec128 t1 = Lib_IntVector_Intrinsics_vec128_add32(st[b], st[a]);
+  st[c] =
+    Lib_IntVector_Intrinsics_vec128_xor(st[c],
+      Lib_IntVector_Intrinsics_vec128_rotate_left32(t1, 9U));
+  Lib_IntVector_Intrinsics_vec128 t2 = Lib_IntVector_Intrinsics_vec128_add32(st[c], st[b]);
+  st[d] =
+    Lib_IntVector_Intrinsics_vec128_xor(st[d],
+      Lib_IntVector_Intrinsics_vec128_rotate_left32(t2, 13U));
+  Lib_IntVector_Intrinsics_vec128 t3 = Lib_IntVector_Intrinsics_vec128_add32(st[d], st[c]);
+  st[a] =
+    Lib_IntVector_Intrinsics_vec128_xor(st[a],
+      Lib_IntVector_Intrinsics_vec128_rotate_left32(t3, 18U));
+}
+
+static inline void double_round_128(Lib_IntVector_Intrinsics_vec128 *st)
+{
+  quarter_round_128(st, 0U, 4U, 8U, 12U);
+  quarter_round_128(st, 5U, 9U, 13U, 1U);
+  quarter_round_128(st, 10U, 14U, 2U, 6U);
+  quarter_round_128(st, 15U, 3U, 7U, 11U);
+  quarter_round_128(st, 0U, 1U, 2U, 3U);
+  quarter_round_128(st, 5U, 6U, 7U, 4U);
+  quarter_round_128(st, 10U, 11U, 8U, 9U);
+  quarter_round_128(st, 15U, 12U, 13U, 14U);
+}
+
+static inline void salsa20_core_128(
+  Lib_IntVector_Intrinsics_vec128 *k,
+  Lib_IntVector_Intrinsics_vec128 *ctx,
+  uint32_t ctr
+)
+{
+  memcpy(k, ctx, 16U * sizeof (Lib_IntVector_Intrinsics_vec128));
+  uint32_t ctr_u32 = 4U * ctr;
+  Lib_IntVector_Intrinsics_vec128 cv = Lib_IntVector_Intrinsics_vec128_load32(ctr_u32);
+  k[8U] = Lib_IntVector_Intrinsics_vec128_add32(k[8U], cv);
+  double_round_128(k);
+  double_round_128(k);
+  double_round_128(k);
+  double_round_128(k);
+  double_round_128(k);
+  double_round_128(k);
+  double_round_128(k);
+  double_round_128(k);
+  double_round_128(k);
+  double_round_128(k);
+  KRML_MAYBE_FOR16(i,
+    0U,
+    16U,
+    1U,
+    Lib_IntVector_Intrinsics_vec128 *os = k;
+    Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_add32(k[i], ctx[i]);
+    os[i] = x;);
+  k[8U] = Lib_IntVector_Intrinsics_vec128_add32(k[8U], cv);
+}
+
+static inline void
+salsa20_init_128(Lib_IntVector_Intrinsics_vec128 *ctx, uint8_t *k, uint8_t *n, uint32_t ctr)
+{
+  uint32_t ctx1[16U] = { 0U };
+  uint32_t k32[8U] = { 0U };
+  uint32_t n32[2U] = { 0U };
+  KRML_MAYBE_FOR8(i,
+    0U,
+    8U,
+    1U,
+    uint32_t *os = k32;
+    uint8_t *bj = k + i * 4U;
+    uint32_t u = load32_le(bj);
+    uint32_t r = u;
+    uint32_t x = r;
+    os[i] = x;);
+  KRML_MAYBE_FOR2(i,
+    0U,
+    2U,
+    1U,
+    uint32_t *os = n32;
+    uint8_t *bj = n + i * 4U;
+    uint32_t u = load32_le(bj);
+    uint32_t r = u;
+    uint32_t x = r;
+    os[i] = x;);
+  ctx1[0U] = 0x61707865U;
+  memcpy(ctx1 + 1U, k32, 4U * sizeof (uint32_t));
+  ctx1[5U] = 0x3320646eU;
+  memcpy(ctx1 + 6U, n32, 2U * sizeof (uint32_t));
+  ctx1[8U] = ctr;
+  ctx1[9U] = 0U;
+  ctx1[10U] = 0x79622d32U;
+  memcpy(ctx1 + 11U, k32 + 4U, 4U * sizeof (uint32_t));
+  ctx1[15U] = 0x6b206574U;
+  KRML_MAYBE_FOR16(i,
+    0U,
+    16U,
+    1U,
+    Lib_IntVector_Intrinsics_vec128 *os = ctx;
+    uint32_t x = ctx1[i];
+    Lib_IntVector_Intrinsics_vec128 x0 = Lib_IntVector_Intrinsics_vec128_load32(x);
+    os[i] = x0;);
+  Lib_IntVector_Intrinsics_vec128
+  ctr1 = Lib_IntVector_Intrinsics_vec128_load32s(0U, 1U, 2U, 3U);
+  Lib_IntVector_Intrinsics_vec128 c8 = ctx[8U];
+  ctx[8U] = Lib_IntVector_Intrinsics_vec128_add32(c8, ctr1);
+}
+
+/* Transposes the 4 interleaved Salsa20 blocks held in `k` (one 32-bit lane per block)
+   into 256 bytes of consecutive keystream. */
+static inline void salsa20_store_128(uint8_t *ks, Lib_IntVector_Intrinsics_vec128 *k)
+{
+  KRML_MAYBE_FOR4(g,
+    0U,
+    4U,
+    1U,
+    Lib_IntVector_Intrinsics_vec128 *a = k + 4U * g;
+    Lib_IntVector_Intrinsics_vec128
+    v0_ = Lib_IntVector_Intrinsics_vec128_interleave_low32(a[0U], a[1U]);
+    Lib_IntVector_Intrinsics_vec128
+    v1_ = Lib_IntVector_Intrinsics_vec128_interleave_high32(a[0U], a[1U]);
+    Lib_IntVector_Intrinsics_vec128
+    v2_ = Lib_IntVector_Intrinsics_vec128_interleave_low32(a[2U], a[3U]);
+    Lib_IntVector_Intrinsics_vec128
+    v3_ = Lib_IntVector_Intrinsics_vec128_interleave_high32(a[2U], a[3U]);
+    uint8_t *o = ks + 16U * g;
+    Lib_IntVector_Intrinsics_vec128_store32_le(o,
+      Lib_IntVector_Intrinsics_vec128_interleave_low64(v0_, v2_));
+    Lib_IntVector_Intrinsics_vec128_store32_le(o + 64U,
+      Lib_IntVector_Intrinsics_vec128_interleave_high64(v0_, v2_));
+    Lib_IntVector_Intrinsics_vec128_store32_le(o + 128U,
+      Lib_IntVector_Intrinsics_vec128_interleave_low64(v1_, v3_));
+    Lib_IntVector_Intrinsics_vec128_store32_le(o + 192U,
+      Lib_IntVector_Intrinsics_vec128_interleave_high64(v1_, v3_)););
+}
+
+static inline void
+salsa20_update_128(Lib_IntVector_Intrinsics_vec128 *ctx, uint32_t len, uint8_t *out, uint8_t *text)
+{
+  uint32_t rem = len % 256U;
+  uint32_t nb = len / 256U;
+  KRML_PRE_ALIGN(16) uint8_t ks[256U] KRML_POST_ALIGN(16) = { 0U };
+  for (uint32_t i = 0U; i < nb; i++)
+  {
+    uint8_t *uu____0 = out + i * 256U;
+    uint8_t *uu____1 = text + i * 256U;
+    KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 k[16U] KRML_POST_ALIGN(16) = { 0U };
+    salsa20_core_128(k, ctx, i);
+    salsa20_store_128(ks, k);
+    for (uint32_t j = 0U; j < 16U; j++)
+    {
+      Lib_IntVector_Intrinsics_vec128
+      x = Lib_IntVector_Intrinsics_vec128_load32_le(uu____1 + j * 16U);
+      Lib_IntVector_Intrinsics_vec128 y = Lib_IntVector_Intrinsics_vec128_load32_le(ks + j * 16U);
+      Lib_IntVector_Intrinsics_vec128_store32_le(uu____0 + j * 16U,
+        Lib_IntVector_Intrinsics_vec128_xor(x, y));
+    }
+  }
+  if (rem > 0U)
+  {
+    uint8_t *uu____2 = out + nb * 256U;
+    uint8_t plain[256U] = { 0U };
+    memcpy(plain, text + nb * 256U, rem * sizeof (uint8_t));
+    KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 k[16U] KRML_POST_ALIGN(16) = { 0U };
+    salsa20_core_128(k, ctx, nb);
+    salsa20_store_128(ks, k);
+    for (uint32_t j = 0U; j < rem; j++)
+    {
+      plain[j] = (uint32_t)plain[j] ^ (uint32_t)ks[j];
+    }
+    memcpy(uu____2, plain, rem * sizeof (uint8_t));
+  }
+}
+
+void
+Hacl_Salsa20_Vec128_salsa20_encrypt_128(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint8_t *key,
+  uint8_t *n,
+  uint32_t ctr
+)
+{
+  KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 ctx[16U] KRML_POST_ALIGN(16) = { 0U };
+  salsa20_init_128(ctx, key, n, ctr);
+  salsa20_update_128(ctx, len, out, text);
+}
+
+void
+Hacl_Salsa20_Vec128_salsa20_decrypt_128(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *cipher,
+  uint8_t *key,
+  uint8_t *n,
+  uint32_t ctr
+)
+{
+  KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 ctx[16U] KRML_POST_ALIGN(16) = { 0U };
+  salsa20_init_128(ctx, key, n, ctr);
+  salsa20_update_128(ctx, len, out, cipher);
+}
+
@@ -0,0 +1,9 @@
+#define TARGET_ARCHITECTURE TARGET_ARCHITECTURE_ID_X64
+#define HACL_CAN_COMPILE_INTRINSICS 1
+#define HACL_CAN_COMPILE_VALE 1
+#define HACL_CAN_COMPILE_INLINE_ASM 1
+#define HACL_CAN_COMPILE_VEC128 1
+#define HACL_CAN_COMPILE_VEC256 1
+#define HACL_CAN_COMPILE_VEC512 1
+#define HACL_CAN_COMPILE_VAES 1
+#define HACL_CAN_COMPILE_UINT128 1
@@ -51,6 +51,8 @@ void Hacl_Bignum25519_load_51(uint64_t *output, uint8_t *input);
 
 void Hacl_Bignum25519_store_51(uint8_t *output, uint64_t *input);
 
+bool Hacl_Bignum25519_sqrt_ratio_m1(uint64_t *out, uint64_t *u, uint64_t *v);
+
 void Hacl_Impl_Ed25519_PointDouble_point_double(uint64_t *out, uint64_t *p);
 
 void Hacl_Impl_Ed25519_PointAdd_point_add(uint64_t *out, uint64_t *p, uint64_t *q);
@@ -67,6 +69,16 @@ void Hacl_Impl_Ed25519_PointNegate_point_negate(uint64_t *p, uint64_t *out);
 
 void Hacl_Impl_Ed25519_Ladder_point_mul(uint64_t *out, uint8_t *scalar, uint64_t *q);
 
+void Hacl_Impl_Ed25519_Ladder_point_mul_vartime(uint64_t *out, uint8_t *scalar, uint64_t *q);
+
+bool
+Hacl_Impl_Ed25519_MultiScalarMul_point_mul_multi_vartime(
+  uint64_t *out,
+  uint32_t len,
+  uint64_t *scalars,
+  uint64_t *points
+);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -55,6 +55,18 @@ Hacl_Chacha20_chacha20_decrypt(
   uint32_t ctr
 );
 
+/**
+Derive a 256-bit subkey from a 256-bit key and a 128-bit nonce (HChaCha20).
+
+HChaCha20 is the ChaCha20 block function without the final feed-forward, keeping words 0..3 and
+12..15 of the state; it is the key derivation step of XChaCha20.
+
+@param out Pointer to 32 bytes of memory where the subkey is written to.
+@param key Pointer to 32 bytes of memory where the key is read from.
+@param n Pointer to 16 bytes of memory where the nonce is read from.
+*/
+void Hacl_Chacha20_hchacha20(uint8_t *out, uint8_t *key, uint8_t *n);
+
 #if defined(__cplusplus)
 }
 #endif
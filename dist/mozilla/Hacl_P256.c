@@ -992,8 +992,74 @@ static inline void precomp_get_consttime(const uint64_t *table, uint64_t bits_l,
       os[i] = x;););
 }
 
+/* Optional larger fixed-base tables, built once by `Hacl_P256_precomp_tables_init` and
+   never freed, so that a concurrent signer cannot see them go away. The
+   scalar is cut into `comb_teeth` chunks of 256 / comb_teeth bits; table j holds
+   d 2^(256 j / comb_teeth) G for every digit d of `comb_window` bits. */
+static uint64_t *comb_table = NULL;
+
+static uint32_t comb_teeth = 0U;
+
+static uint32_t comb_window = 0U;
+
+static inline void
+precomp_get_consttime_n(const uint64_t *table, uint32_t len, uint64_t bits_l, uint64_t *tmp)
+{
+  memcpy(tmp, (uint64_t *)table, 12U * sizeof (uint64_t));
+  for (uint32_t i0 = 1U; i0 < len; i0++)
+  {
+    uint64_t c = FStar_UInt64_eq_mask(bits_l, (uint64_t)i0);
+    const uint64_t *res_j = table + i0 * 12U;
+    KRML_MAYBE_FOR12(i,
+      0U,
+      12U,
+      1U,
+      uint64_t *os = tmp;
+      uint64_t x = (c & res_j[i]) | (~c & tmp[i]);
+      os[i] = x;);
+  }
+}
+
+/* The same comb as `point_mul_g`, with the selected number of tables and digit width:
+   256 / comb_teeth - comb_window doublings and 256 / comb_window table additions. */
+static void point_mul_g_comb(uint64_t *res, uint64_t *bscalar)
+{
+  uint32_t len = 1U << comb_window;
+  uint32_t chunk = 256U / comb_teeth;
+  uint64_t tmp[12U] = { 0U };
+  for (uint32_t i = 0U; i < chunk / comb_window; i++)
+  {
+    if (i > 0U)
+    {
+      for (uint32_t i0 = 0U; i0 < comb_window; i0++)
+      {
+        point_double(res, res);
+      }
+    }
+    uint32_t k = chunk - comb_window * (i + 1U);
+    for (uint32_t j = 0U; j < comb_teeth; j++)
+    {
+      uint64_t bits_l = Hacl_Bignum_Lib_bn_get_bits_u64(4U, bscalar, j * chunk + k, comb_window);
+      precomp_get_consttime_n(comb_table + j * len * 12U, len, bits_l, tmp);
+      if (i == 0U && j == 0U)
+      {
+        memcpy(res, tmp, 12U * sizeof (uint64_t));
+      }
+      else
+      {
+        point_add(res, res, tmp);
+      }
+    }
+  }
+}
+
 static inline void point_mul_g(uint64_t *res, uint64_t *scalar)
 {
+  if (comb_table != NULL)
+  {
+    point_mul_g_comb(res, scalar);
+    return;
+  }
   uint64_t q1[12U] = { 0U };
   make_base_point(q1);
   uint64_t
@@ -1776,3 +1842,65 @@ Hacl_P256_dh_responder(uint8_t *shared_secret, uint8_t *their_pubkey, uint8_t *p
   return Hacl_Impl_P256_DH_ecp256dh_r(shared_secret, their_pubkey, private_key);
 }
 
+/**
+Build larger fixed-base tables for signing and key generation, replacing the built-in 4-table comb
+with 4-bit digits.
+
+  @param teeth Number of tables; a power of two between 1 and 256.
+  @param window_bits Digit width; 1, 2, 4 or 8, and at most 256 / `teeth`.
+
+  @return Returns `false` if the tables were already built by an earlier call, the
+  parameters are out of range or memory cannot be allocated.
+
+  The tables take `teeth` * 2^`window_bits` * 96 bytes. A fixed-base scalar
+  multiplication then does 256 / `teeth` - `window_bits` doublings and 256 / `window_bits`
+  additions, each after a constant-time scan of 2^`window_bits` table entries. The built-in
+  comb corresponds to (4, 4); (32, 4) and (64, 4) leave almost only the additions and keep
+  the scans short.
+
+  The tables are global and are never freed, so only the first successful call takes
+  effect. Call this function before other threads use this module.
+*/
+bool Hacl_P256_precomp_tables_init(uint32_t teeth, uint32_t window_bits)
+{
+  if
+  (
+    comb_table != NULL
+    || teeth == 0U
+    || teeth > 256U
+    || (teeth & (teeth - 1U)) != 0U
+    || !(window_bits == 1U || window_bits == 2U || window_bits == 4U || window_bits == 8U)
+    || window_bits > 256U / teeth
+  )
+  {
+    return false;
+  }
+  uint32_t len = 1U << window_bits;
+  uint32_t chunk = 256U / teeth;
+  uint64_t *table = (uint64_t *)KRML_HOST_CALLOC(teeth * len * 12U, sizeof (uint64_t));
+  if (table == NULL)
+  {
+    return false;
+  }
+  uint64_t base[12U] = { 0U };
+  memcpy(base, Hacl_P256_PrecompTable_precomp_basepoint_table_w4 + 12U, 12U * sizeof (uint64_t));
+  for (uint32_t j = 0U; j < teeth; j++)
+  {
+    uint64_t *t = table + j * len * 12U;
+    make_point_at_inf(t);
+    memcpy(t + 12U, base, 12U * sizeof (uint64_t));
+    for (uint32_t d = 2U; d < len; d++)
+    {
+      point_add(t + d * 12U, t + (d - 1U) * 12U, base);
+    }
+    for (uint32_t i = 0U; i < chunk; i++)
+    {
+      point_double(base, base);
+    }
+  }
+  comb_teeth = teeth;
+  comb_window = window_bits;
+  comb_table = table;
+  return true;
+}
+
@@ -27,7 +27,11 @@
 
 #include "internal/Vale.h"
 #include "internal/Hacl_Spec.h"
+#include "internal/EverCrypt_Chacha20Poly1305.h"
 #include "config.h"
+#include "Hacl_AEAD_AEGIS_NI.h"
+#include "Hacl_AEAD_AEGIS_Simd512.h"
+#include "Hacl_AEAD_AES_GCM_SIV_NI.h"
 
 /**
 Both encryption and decryption require a state that holds the key.
@@ -75,6 +79,22 @@ Spec_Agile_AEAD_alg EverCrypt_AEAD_alg_of_state(EverCrypt_AEAD_state_s *s)
       {
         return Spec_Agile_AEAD_AES256_GCM;
       }
+    case Spec_Cipher_Expansion_Hacl_AEGIS128L:
+      {
+        return Spec_Agile_AEAD_AEGIS128L;
+      }
+    case Spec_Cipher_Expansion_Hacl_AEGIS256:
+      {
+        return Spec_Agile_AEAD_AEGIS256;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES128_GCM_SIV:
+      {
+        return Spec_Agile_AEAD_AES128_GCM_SIV;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256_GCM_SIV:
+      {
+        return Spec_Agile_AEAD_AES256_GCM_SIV;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -83,76 +103,175 @@ Spec_Agile_AEAD_alg EverCrypt_AEAD_alg_of_state(EverCrypt_AEAD_state_s *s)
   }
 }
 
+/**
+Select the implementation of `a`, checking that the CPU supports it.
+*/
 static EverCrypt_Error_error_code
-create_in_chacha20_poly1305(EverCrypt_AEAD_state_s **dst, uint8_t *k)
-{
-  uint8_t *ek = (uint8_t *)KRML_HOST_CALLOC(32U, sizeof (uint8_t));
-  EverCrypt_AEAD_state_s
-  *p = (EverCrypt_AEAD_state_s *)KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
-  p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_CHACHA20, .ek = ek });
-  memcpy(ek, k, 32U * sizeof (uint8_t));
-  dst[0U] = p;
-  return EverCrypt_Error_Success;
-}
-
-static EverCrypt_Error_error_code
-create_in_aes128_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
+impl_of_alg(Spec_Agile_AEAD_alg a, Spec_Cipher_Expansion_impl *impl)
 {
-  KRML_MAYBE_UNUSED_VAR(dst);
-  KRML_MAYBE_UNUSED_VAR(k);
   #if HACL_CAN_COMPILE_VALE
   bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
   bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
   bool has_avx = EverCrypt_AutoConfig2_has_avx();
   bool has_sse = EverCrypt_AutoConfig2_has_sse();
   bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
-  {
-    uint8_t *ek = (uint8_t *)KRML_HOST_CALLOC(480U, sizeof (uint8_t));
-    uint8_t *keys_b = ek;
-    uint8_t *hkeys_b = ek + 176U;
-    aes128_key_expansion(k, keys_b);
-    aes128_keyhash_init(keys_b, hkeys_b);
-    EverCrypt_AEAD_state_s
-    *p = (EverCrypt_AEAD_state_s *)KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
-    p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Vale_AES128, .ek = ek });
-    *dst = p;
-    return EverCrypt_Error_Success;
-  }
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  bool has_gcm = has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe;
+  bool has_gcm_siv = has_aesni && has_pclmulqdq && has_avx;
   #else
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  bool has_aesni = false;
+  bool has_gcm = false;
+  bool has_gcm_siv = false;
   #endif
+  switch (a)
+  {
+    case Spec_Agile_AEAD_AES128_GCM:
+      {
+        *impl = Spec_Cipher_Expansion_Vale_AES128;
+        return has_gcm ? EverCrypt_Error_Success : EverCrypt_Error_UnsupportedAlgorithm;
+      }
+    case Spec_Agile_AEAD_AES256_GCM:
+      {
+        *impl = Spec_Cipher_Expansion_Vale_AES256;
+        return has_gcm ? EverCrypt_Error_Success : EverCrypt_Error_UnsupportedAlgorithm;
+      }
+    case Spec_Agile_AEAD_CHACHA20_POLY1305:
+      {
+        *impl = Spec_Cipher_Expansion_Hacl_CHACHA20;
+        return EverCrypt_Error_Success;
+      }
+    case Spec_Agile_AEAD_AEGIS128L:
+      {
+        *impl = Spec_Cipher_Expansion_Hacl_AEGIS128L;
+        return has_aesni ? EverCrypt_Error_Success : EverCrypt_Error_UnsupportedAlgorithm;
+      }
+    case Spec_Agile_AEAD_AEGIS256:
+      {
+        *impl = Spec_Cipher_Expansion_Hacl_AEGIS256;
+        return has_aesni ? EverCrypt_Error_Success : EverCrypt_Error_UnsupportedAlgorithm;
+      }
+    case Spec_Agile_AEAD_AES128_GCM_SIV:
+      {
+        *impl = Spec_Cipher_Expansion_Hacl_AES128_GCM_SIV;
+        return has_gcm_siv ? EverCrypt_Error_Success : EverCrypt_Error_UnsupportedAlgorithm;
+      }
+    case Spec_Agile_AEAD_AES256_GCM_SIV:
+      {
+        *impl = Spec_Cipher_Expansion_Hacl_AES256_GCM_SIV;
+        return has_gcm_siv ? EverCrypt_Error_Success : EverCrypt_Error_UnsupportedAlgorithm;
+      }
+    default:
+      {
+        return EverCrypt_Error_UnsupportedAlgorithm;
+      }
+  }
 }
 
-static EverCrypt_Error_error_code
-create_in_aes256_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
+/**
+Size of the expanded key held in the `ek` field of the state.
+
+For AES-GCM, this is the AES round keys (176 or 240 bytes), the GHASH key
+table (128 bytes) and the scratch space used by the Vale code (176 bytes).
+*/
+static uint32_t ek_len(Spec_Cipher_Expansion_impl impl)
 {
-  KRML_MAYBE_UNUSED_VAR(dst);
-  KRML_MAYBE_UNUSED_VAR(k);
-  #if HACL_CAN_COMPILE_VALE
-  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
-  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
-  bool has_avx = EverCrypt_AutoConfig2_has_avx();
-  bool has_sse = EverCrypt_AutoConfig2_has_sse();
-  bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  switch (impl)
   {
-    uint8_t *ek = (uint8_t *)KRML_HOST_CALLOC(544U, sizeof (uint8_t));
-    uint8_t *keys_b = ek;
-    uint8_t *hkeys_b = ek + 240U;
-    aes256_key_expansion(k, keys_b);
-    aes256_keyhash_init(keys_b, hkeys_b);
-    EverCrypt_AEAD_state_s
-    *p = (EverCrypt_AEAD_state_s *)KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
-    p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Vale_AES256, .ek = ek });
-    *dst = p;
-    return EverCrypt_Error_Success;
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        return 32U;
+      }
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        return 480U;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        return 544U;
+      }
+    case Spec_Cipher_Expansion_Hacl_AEGIS128L:
+      {
+        return 16U;
+      }
+    case Spec_Cipher_Expansion_Hacl_AEGIS256:
+      {
+        return 32U;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES128_GCM_SIV:
+      {
+        return 176U;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256_GCM_SIV:
+      {
+        return 240U;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
   }
-  return EverCrypt_Error_UnsupportedAlgorithm;
-  #else
-  return EverCrypt_Error_UnsupportedAlgorithm;
-  #endif
+}
+
+/**
+Expand `k` into `ek`, which holds `ek_len impl` bytes. Overwrites any previous key.
+*/
+static void expand_key(Spec_Cipher_Expansion_impl impl, uint8_t *ek, uint8_t *k)
+{
+  switch (impl)
+  {
+    #if HACL_CAN_COMPILE_VALE
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        uint8_t *keys_b = ek;
+        uint8_t *hkeys_b = ek + 176U;
+        aes128_key_expansion(k, keys_b);
+        aes128_keyhash_init(keys_b, hkeys_b);
+        break;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        uint8_t *keys_b = ek;
+        uint8_t *hkeys_b = ek + 240U;
+        aes256_key_expansion(k, keys_b);
+        aes256_keyhash_init(keys_b, hkeys_b);
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES128_GCM_SIV:
+      {
+        aes128_key_expansion(k, ek);
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256_GCM_SIV:
+      {
+        aes256_key_expansion(k, ek);
+        break;
+      }
+    #endif
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+    case Spec_Cipher_Expansion_Hacl_AEGIS128L:
+    case Spec_Cipher_Expansion_Hacl_AEGIS256:
+      {
+        memcpy(ek, k, ek_len(impl) * sizeof (uint8_t));
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
+          __FILE__,
+          __LINE__,
+          "statically unreachable");
+        KRML_HOST_EXIT(255U);
+      }
+  }
+}
+
+/**
+Offset of `ek` from the start of a state created by `EverCrypt_AEAD_create_in_place`.
+The expanded key starts on the next 16-byte boundary after the state.
+*/
+static uint32_t in_place_ek_offset(void)
+{
+  return ((uint32_t)sizeof (EverCrypt_AEAD_state_s) + 15U) & ~15U;
 }
 
 /**
@@ -162,8 +281,12 @@ Note: The caller must free the AEAD state by calling `EverCrypt_AEAD_free`.
 
 @param a The argument `a` must be either of:
   * `Spec_Agile_AEAD_AES128_GCM` (KEY_LEN=16),
-  * `Spec_Agile_AEAD_AES256_GCM` (KEY_LEN=32), or
-  * `Spec_Agile_AEAD_CHACHA20_POLY1305` (KEY_LEN=32).
+  * `Spec_Agile_AEAD_AES256_GCM` (KEY_LEN=32),
+  * `Spec_Agile_AEAD_CHACHA20_POLY1305` (KEY_LEN=32),
+  * `Spec_Agile_AEAD_AEGIS128L` (KEY_LEN=16),
+  * `Spec_Agile_AEAD_AEGIS256` (KEY_LEN=32),
+  * `Spec_Agile_AEAD_AES128_GCM_SIV` (KEY_LEN=16), or
+  * `Spec_Agile_AEAD_AES256_GCM_SIV` (KEY_LEN=32).
 @param dst Pointer to a pointer where the address of the allocated AEAD state will be written to.
 @param k Pointer to `KEY_LEN` bytes of memory where the key is read from. The size depends on the used algorithm, see above.
 
@@ -174,25 +297,131 @@ Note: The caller must free the AEAD state by calling `EverCrypt_AEAD_free`.
 EverCrypt_Error_error_code
 EverCrypt_AEAD_create_in(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s **dst, uint8_t *k)
 {
+  Spec_Cipher_Expansion_impl impl = Spec_Cipher_Expansion_Hacl_CHACHA20;
+  EverCrypt_Error_error_code r = impl_of_alg(a, &impl);
+  if (r != EverCrypt_Error_Success)
+  {
+    return r;
+  }
+  uint8_t *ek = (uint8_t *)KRML_HOST_CALLOC(ek_len(impl), sizeof (uint8_t));
+  expand_key(impl, ek, k);
+  EverCrypt_AEAD_state_s
+  *p = (EverCrypt_AEAD_state_s *)KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+  p[0U] = ((EverCrypt_AEAD_state_s){ .impl = impl, .ek = ek });
+  *dst = p;
+  return EverCrypt_Error_Success;
+}
+
+/**
+Return the number of bytes of memory that `EverCrypt_AEAD_create_in_place` needs
+for algorithm `a`, or 0 if `a` is not an AEAD algorithm supported by `create_in`.
+
+The size does not depend on the CPU, so it can be used to lay out arenas statically.
+*/
+uint32_t EverCrypt_AEAD_state_size(Spec_Agile_AEAD_alg a)
+{
+  Spec_Cipher_Expansion_impl impl;
   switch (a)
   {
     case Spec_Agile_AEAD_AES128_GCM:
       {
-        return create_in_aes128_gcm(dst, k);
+        impl = Spec_Cipher_Expansion_Vale_AES128;
+        break;
       }
     case Spec_Agile_AEAD_AES256_GCM:
       {
-        return create_in_aes256_gcm(dst, k);
+        impl = Spec_Cipher_Expansion_Vale_AES256;
+        break;
       }
     case Spec_Agile_AEAD_CHACHA20_POLY1305:
       {
-        return create_in_chacha20_poly1305(dst, k);
+        impl = Spec_Cipher_Expansion_Hacl_CHACHA20;
+        break;
+      }
+    case Spec_Agile_AEAD_AEGIS128L:
+      {
+        impl = Spec_Cipher_Expansion_Hacl_AEGIS128L;
+        break;
+      }
+    case Spec_Agile_AEAD_AEGIS256:
+      {
+        impl = Spec_Cipher_Expansion_Hacl_AEGIS256;
+        break;
+      }
+    case Spec_Agile_AEAD_AES128_GCM_SIV:
+      {
+        impl = Spec_Cipher_Expansion_Hacl_AES128_GCM_SIV;
+        break;
+      }
+    case Spec_Agile_AEAD_AES256_GCM_SIV:
+      {
+        impl = Spec_Cipher_Expansion_Hacl_AES256_GCM_SIV;
+        break;
       }
     default:
       {
-        return EverCrypt_Error_UnsupportedAlgorithm;
+        return 0U;
       }
   }
+  return in_place_ek_offset() + ek_len(impl);
+}
+
+/**
+Create the AEAD state for the algorithm in caller-provided memory.
+
+This is the allocation-free counterpart of `EverCrypt_AEAD_create_in`: the state
+header and the expanded key are both written to `mem`, which can afterwards be used
+as an `EverCrypt_AEAD_state_s *` with all functions of this module except
+`EverCrypt_AEAD_free`. Releasing `mem` is up to the caller, who should clear it
+first since it holds key material.
+
+@param mem Pointer to `EverCrypt_AEAD_state_size(a)` bytes of memory, aligned on a
+  16-byte boundary.
+@param a Algorithm, as for `EverCrypt_AEAD_create_in`.
+@param k Pointer to `KEY_LEN` bytes of memory where the key is read from.
+
+@return The function returns `EverCrypt_Error_Success` on success or
+  `EverCrypt_Error_UnsupportedAlgorithm` in case of a bad algorithm identifier, in which
+  case `mem` is left untouched.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_create_in_place(uint8_t *mem, Spec_Agile_AEAD_alg a, uint8_t *k)
+{
+  Spec_Cipher_Expansion_impl impl = Spec_Cipher_Expansion_Hacl_CHACHA20;
+  EverCrypt_Error_error_code r = impl_of_alg(a, &impl);
+  if (r != EverCrypt_Error_Success)
+  {
+    return r;
+  }
+  uint8_t *ek = mem + in_place_ek_offset();
+  memset(ek, 0U, ek_len(impl) * sizeof (uint8_t));
+  expand_key(impl, ek, k);
+  EverCrypt_AEAD_state_s *p = (EverCrypt_AEAD_state_s *)mem;
+  p[0U] = ((EverCrypt_AEAD_state_s){ .impl = impl, .ek = ek });
+  return EverCrypt_Error_Success;
+}
+
+/**
+Replace the key held by an AEAD state, keeping its algorithm.
+
+The new key is expanded over the old one in the existing storage, so this neither
+allocates nor frees. It works for states from both `EverCrypt_AEAD_create_in` and
+`EverCrypt_AEAD_create_in_place`.
+
+@param s State of the AEAD algorithm.
+@param k Pointer to `KEY_LEN` bytes of memory where the new key is read from.
+
+@return The function returns `EverCrypt_Error_Success` on success or
+  `EverCrypt_Error_InvalidKey` if `s` is `NULL`.
+*/
+EverCrypt_Error_error_code EverCrypt_AEAD_rekey(EverCrypt_AEAD_state_s *s, uint8_t *k)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  expand_key((*s).impl, (*s).ek, k);
+  return EverCrypt_Error_Success;
 }
 
 static EverCrypt_Error_error_code
@@ -441,27 +670,8 @@ encrypt_aes256_gcm(
   #endif
 }
 
-/**
-Encrypt and authenticate a message (`plain`) with associated data (`ad`).
-
-@param s Pointer to the The AEAD state created by `EverCrypt_AEAD_create_in`. It already contains the encryption key.
-@param iv Pointer to `iv_len` bytes of memory where the nonce is read from.
-@param iv_len Length of the nonce. Note: ChaCha20Poly1305 requires a 12 byte nonce.
-@param ad Pointer to `ad_len` bytes of memory where the associated data is read from.
-@param ad_len Length of the associated data.
-@param plain Pointer to `plain_len` bytes of memory where the to-be-encrypted plaintext is read from.
-@param plain_len Length of the to-be-encrypted plaintext.
-@param cipher Pointer to `plain_len` bytes of memory where the ciphertext is written to.
-@param tag Pointer to `TAG_LEN` bytes of memory where the tag is written to.
-  The length of the `tag` must be of a suitable length for the chosen algorithm:
-  * `Spec_Agile_AEAD_AES128_GCM` (TAG_LEN=16)
-  * `Spec_Agile_AEAD_AES256_GCM` (TAG_LEN=16)
-  * `Spec_Agile_AEAD_CHACHA20_POLY1305` (TAG_LEN=16)
-
-@return `EverCrypt_AEAD_encrypt` may return either `EverCrypt_Error_Success` or `EverCrypt_Error_InvalidKey` (`EverCrypt_error.h`). The latter is returned if and only if the `s` parameter is `NULL`.
-*/
-EverCrypt_Error_error_code
-EverCrypt_AEAD_encrypt(
+static EverCrypt_Error_error_code
+encrypt_aegis(
   EverCrypt_AEAD_state_s *s,
   uint8_t *iv,
   uint32_t iv_len,
@@ -473,51 +683,49 @@ EverCrypt_AEAD_encrypt(
   uint8_t *tag
 )
 {
+  KRML_MAYBE_UNUSED_VAR(iv);
+  KRML_MAYBE_UNUSED_VAR(iv_len);
+  KRML_MAYBE_UNUSED_VAR(ad);
+  KRML_MAYBE_UNUSED_VAR(ad_len);
+  KRML_MAYBE_UNUSED_VAR(plain);
+  KRML_MAYBE_UNUSED_VAR(plain_len);
+  KRML_MAYBE_UNUSED_VAR(cipher);
+  KRML_MAYBE_UNUSED_VAR(tag);
   if (s == NULL)
   {
     return EverCrypt_Error_InvalidKey;
   }
+  #if HACL_CAN_COMPILE_VALE
   EverCrypt_AEAD_state_s scrut = *s;
   Spec_Cipher_Expansion_impl i = scrut.impl;
   uint8_t *ek = scrut.ek;
-  switch (i)
+  if (i == Spec_Cipher_Expansion_Hacl_AEGIS128L)
   {
-    case Spec_Cipher_Expansion_Vale_AES128:
-      {
-        return encrypt_aes128_gcm(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
-      }
-    case Spec_Cipher_Expansion_Vale_AES256:
-      {
-        return encrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
-      }
-    case Spec_Cipher_Expansion_Hacl_CHACHA20:
-      {
-        if (iv_len != 12U)
-        {
-          return EverCrypt_Error_InvalidIVLength;
-        }
-        EverCrypt_Chacha20Poly1305_aead_encrypt(ek, iv, ad_len, ad, plain_len, plain, cipher, tag);
-        return EverCrypt_Error_Success;
-      }
-    default:
-      {
-        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
-        KRML_HOST_EXIT(253U);
-      }
+    if (iv_len != 16U)
+    {
+      return EverCrypt_Error_InvalidIVLength;
+    }
+    Hacl_AEAD_AEGIS_NI_aegis128l_encrypt(cipher, tag, plain, plain_len, ad, ad_len, ek, iv);
+    return EverCrypt_Error_Success;
+  }
+  if (iv_len != 32U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
   }
+  Hacl_AEAD_AEGIS_NI_aegis256_encrypt(cipher, tag, plain, plain_len, ad, ad_len, ek, iv);
+  return EverCrypt_Error_Success;
+  #else
+  KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
 }
 
-/**
-WARNING: this function doesn't perform any dynamic
-  hardware check. You MUST make sure your hardware supports the
-  implementation of AESGCM. Besides, this function was not designed
-  for cross-compilation: if you compile it on a system which doesn't
-  support Vale, it will compile it to a function which makes the
-  program exit.
-*/
-EverCrypt_Error_error_code
-EverCrypt_AEAD_encrypt_expand_aes128_gcm_no_check(
-  uint8_t *k,
+static EverCrypt_Error_error_code
+encrypt_aes_gcm_siv(
+  EverCrypt_AEAD_state_s *s,
   uint8_t *iv,
   uint32_t iv_len,
   uint8_t *ad,
@@ -528,7 +736,145 @@ EverCrypt_AEAD_encrypt_expand_aes128_gcm_no_check(
   uint8_t *tag
 )
 {
-  KRML_MAYBE_UNUSED_VAR(k);
+  KRML_MAYBE_UNUSED_VAR(iv);
+  KRML_MAYBE_UNUSED_VAR(iv_len);
+  KRML_MAYBE_UNUSED_VAR(ad);
+  KRML_MAYBE_UNUSED_VAR(ad_len);
+  KRML_MAYBE_UNUSED_VAR(plain);
+  KRML_MAYBE_UNUSED_VAR(plain_len);
+  KRML_MAYBE_UNUSED_VAR(cipher);
+  KRML_MAYBE_UNUSED_VAR(tag);
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  #if HACL_CAN_COMPILE_VALE
+  if (iv_len != 12U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  uint32_t nr = scrut.impl == Spec_Cipher_Expansion_Hacl_AES128_GCM_SIV ? 10U : 14U;
+  Hacl_AEAD_AES_GCM_SIV_NI_encrypt(nr, scrut.ek, cipher, tag, plain, plain_len, ad, ad_len, iv);
+  return EverCrypt_Error_Success;
+  #else
+  KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+/**
+Encrypt and authenticate a message (`plain`) with associated data (`ad`).
+
+@param s Pointer to the The AEAD state created by `EverCrypt_AEAD_create_in`. It already contains the encryption key.
+@param iv Pointer to `iv_len` bytes of memory where the nonce is read from.
+@param iv_len Length of the nonce. Note: ChaCha20Poly1305 and AES-GCM-SIV require a 12 byte nonce,
+  AEGIS-128L a 16 byte nonce and AEGIS-256 a 32 byte nonce.
+@param ad Pointer to `ad_len` bytes of memory where the associated data is read from.
+@param ad_len Length of the associated data.
+@param plain Pointer to `plain_len` bytes of memory where the to-be-encrypted plaintext is read from.
+@param plain_len Length of the to-be-encrypted plaintext.
+@param cipher Pointer to `plain_len` bytes of memory where the ciphertext is written to.
+@param tag Pointer to `TAG_LEN` bytes of memory where the tag is written to.
+  The length of the `tag` must be of a suitable length for the chosen algorithm:
+  * `Spec_Agile_AEAD_AES128_GCM` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_AES256_GCM` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_CHACHA20_POLY1305` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_AEGIS128L` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_AEGIS256` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_AES128_GCM_SIV` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_AES256_GCM_SIV` (TAG_LEN=16)
+
+@return `EverCrypt_AEAD_encrypt` may return either `EverCrypt_Error_Success` or `EverCrypt_Error_InvalidKey` (`EverCrypt_error.h`). The latter is returned if and only if the `s` parameter is `NULL`.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl i = scrut.impl;
+  uint8_t *ek = scrut.ek;
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        return encrypt_aes128_gcm(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        return encrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+      }
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        if (iv_len != 12U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        EverCrypt_Chacha20Poly1305_aead_encrypt(ek, iv, ad_len, ad, plain_len, plain, cipher, tag);
+        return EverCrypt_Error_Success;
+      }
+    case Spec_Cipher_Expansion_Hacl_AEGIS128L:
+      {
+        return encrypt_aegis(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+      }
+    case Spec_Cipher_Expansion_Hacl_AEGIS256:
+      {
+        return encrypt_aegis(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+      }
+    case Spec_Cipher_Expansion_Hacl_AES128_GCM_SIV:
+      {
+        return encrypt_aes_gcm_siv(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256_GCM_SIV:
+      {
+        return encrypt_aes_gcm_siv(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+/**
+WARNING: this function doesn't perform any dynamic
+  hardware check. You MUST make sure your hardware supports the
+  implementation of AESGCM. Besides, this function was not designed
+  for cross-compilation: if you compile it on a system which doesn't
+  support Vale, it will compile it to a function which makes the
+  program exit.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_expand_aes128_gcm_no_check(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  KRML_MAYBE_UNUSED_VAR(k);
   KRML_MAYBE_UNUSED_VAR(iv);
   KRML_MAYBE_UNUSED_VAR(iv_len);
   KRML_MAYBE_UNUSED_VAR(ad);
@@ -1092,6 +1438,77 @@ EverCrypt_AEAD_encrypt_expand_chacha20_poly1305(
   return EverCrypt_Error_Success;
 }
 
+static EverCrypt_Error_error_code
+encrypt_expand_aegis(
+  Spec_Cipher_Expansion_impl impl,
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  if (has_aesni)
+  {
+    EverCrypt_AEAD_state_s p = { .impl = impl, .ek = k };
+    return encrypt_aegis(&p, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+  }
+  return EverCrypt_Error_UnsupportedAlgorithm;
+}
+
+static EverCrypt_Error_error_code
+encrypt_expand_aes_gcm_siv(
+  Spec_Cipher_Expansion_impl impl,
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  KRML_MAYBE_UNUSED_VAR(impl);
+  KRML_MAYBE_UNUSED_VAR(k);
+  KRML_MAYBE_UNUSED_VAR(iv);
+  KRML_MAYBE_UNUSED_VAR(iv_len);
+  KRML_MAYBE_UNUSED_VAR(ad);
+  KRML_MAYBE_UNUSED_VAR(ad_len);
+  KRML_MAYBE_UNUSED_VAR(plain);
+  KRML_MAYBE_UNUSED_VAR(plain_len);
+  KRML_MAYBE_UNUSED_VAR(cipher);
+  KRML_MAYBE_UNUSED_VAR(tag);
+  #if HACL_CAN_COMPILE_VALE
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+  bool has_avx = EverCrypt_AutoConfig2_has_avx();
+  if (has_aesni && has_pclmulqdq && has_avx)
+  {
+    uint8_t ek[240U] = { 0U };
+    if (impl == Spec_Cipher_Expansion_Hacl_AES128_GCM_SIV)
+    {
+      aes128_key_expansion(k, ek);
+    }
+    else
+    {
+      aes256_key_expansion(k, ek);
+    }
+    EverCrypt_AEAD_state_s p = { .impl = impl, .ek = ek };
+    return encrypt_aes_gcm_siv(&p, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+  }
+  return EverCrypt_Error_UnsupportedAlgorithm;
+  #else
+  return EverCrypt_Error_UnsupportedAlgorithm;
+  #endif
+}
+
 EverCrypt_Error_error_code
 EverCrypt_AEAD_encrypt_expand(
   Spec_Agile_AEAD_alg a,
@@ -1147,6 +1564,62 @@ EverCrypt_AEAD_encrypt_expand(
             cipher,
             tag);
       }
+    case Spec_Agile_AEAD_AEGIS128L:
+      {
+        return
+          encrypt_expand_aegis(Spec_Cipher_Expansion_Hacl_AEGIS128L,
+            k,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            plain,
+            plain_len,
+            cipher,
+            tag);
+      }
+    case Spec_Agile_AEAD_AEGIS256:
+      {
+        return
+          encrypt_expand_aegis(Spec_Cipher_Expansion_Hacl_AEGIS256,
+            k,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            plain,
+            plain_len,
+            cipher,
+            tag);
+      }
+    case Spec_Agile_AEAD_AES128_GCM_SIV:
+      {
+        return
+          encrypt_expand_aes_gcm_siv(Spec_Cipher_Expansion_Hacl_AES128_GCM_SIV,
+            k,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            plain,
+            plain_len,
+            cipher,
+            tag);
+      }
+    case Spec_Agile_AEAD_AES256_GCM_SIV:
+      {
+        return
+          encrypt_expand_aes_gcm_siv(Spec_Cipher_Expansion_Hacl_AES256_GCM_SIV,
+            k,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            plain,
+            plain_len,
+            cipher,
+            tag);
+      }
     default:
       {
         KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1456,39 +1929,8 @@ decrypt_chacha20_poly1305(
   return EverCrypt_Error_AuthenticationFailure;
 }
 
-/**
-Verify the authenticity of `ad` || `cipher` and decrypt `cipher` into `dst`.
-
-@param s Pointer to the The AEAD state created by `EverCrypt_AEAD_create_in`. It already contains the encryption key.
-@param iv Pointer to `iv_len` bytes of memory where the nonce is read from.
-@param iv_len Length of the nonce. Note: ChaCha20Poly1305 requires a 12 byte nonce.
-@param ad Pointer to `ad_len` bytes of memory where the associated data is read from.
-@param ad_len Length of the associated data.
-@param cipher Pointer to `cipher_len` bytes of memory where the ciphertext is read from.
-@param cipher_len Length of the ciphertext.
-@param tag Pointer to `TAG_LEN` bytes of memory where the tag is read from.
-  The length of the `tag` must be of a suitable length for the chosen algorithm:
-  * `Spec_Agile_AEAD_AES128_GCM` (TAG_LEN=16)
-  * `Spec_Agile_AEAD_AES256_GCM` (TAG_LEN=16)
-  * `Spec_Agile_AEAD_CHACHA20_POLY1305` (TAG_LEN=16)
-@param dst Pointer to `cipher_len` bytes of memory where the decrypted plaintext will be written to.
-
-@return `EverCrypt_AEAD_decrypt` returns ...
-
-  * `EverCrypt_Error_Success`
-
-  ... on success and either of ...
-
-  * `EverCrypt_Error_InvalidKey` (returned if and only if the `s` parameter is `NULL`),
-  * `EverCrypt_Error_InvalidIVLength` (see note about requirements on IV size above), or
-  * `EverCrypt_Error_AuthenticationFailure` (in case the ciphertext could not be authenticated, e.g., due to modifications)
-
-  ... on failure (`EverCrypt_error.h`).
-
-  Upon success, the plaintext will be written into `dst`.
-*/
-EverCrypt_Error_error_code
-EverCrypt_AEAD_decrypt(
+static EverCrypt_Error_error_code
+decrypt_aegis(
   EverCrypt_AEAD_state_s *s,
   uint8_t *iv,
   uint32_t iv_len,
@@ -1500,10 +1942,154 @@ EverCrypt_AEAD_decrypt(
   uint8_t *dst
 )
 {
-  if (s == NULL)
-  {
-    return EverCrypt_Error_InvalidKey;
-  }
+  KRML_MAYBE_UNUSED_VAR(iv);
+  KRML_MAYBE_UNUSED_VAR(iv_len);
+  KRML_MAYBE_UNUSED_VAR(ad);
+  KRML_MAYBE_UNUSED_VAR(ad_len);
+  KRML_MAYBE_UNUSED_VAR(cipher);
+  KRML_MAYBE_UNUSED_VAR(cipher_len);
+  KRML_MAYBE_UNUSED_VAR(tag);
+  KRML_MAYBE_UNUSED_VAR(dst);
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  #if HACL_CAN_COMPILE_VALE
+  EverCrypt_AEAD_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl i = scrut.impl;
+  uint8_t *ek = scrut.ek;
+  uint32_t r;
+  if (i == Spec_Cipher_Expansion_Hacl_AEGIS128L)
+  {
+    if (iv_len != 16U)
+    {
+      return EverCrypt_Error_InvalidIVLength;
+    }
+    r = Hacl_AEAD_AEGIS_NI_aegis128l_decrypt(dst, cipher, cipher_len, ad, ad_len, ek, iv, tag);
+  }
+  else
+  {
+    if (iv_len != 32U)
+    {
+      return EverCrypt_Error_InvalidIVLength;
+    }
+    r = Hacl_AEAD_AEGIS_NI_aegis256_decrypt(dst, cipher, cipher_len, ad, ad_len, ek, iv, tag);
+  }
+  if (r == 0U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  return EverCrypt_Error_AuthenticationFailure;
+  #else
+  KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+static EverCrypt_Error_error_code
+decrypt_aes_gcm_siv(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  KRML_MAYBE_UNUSED_VAR(iv);
+  KRML_MAYBE_UNUSED_VAR(iv_len);
+  KRML_MAYBE_UNUSED_VAR(ad);
+  KRML_MAYBE_UNUSED_VAR(ad_len);
+  KRML_MAYBE_UNUSED_VAR(cipher);
+  KRML_MAYBE_UNUSED_VAR(cipher_len);
+  KRML_MAYBE_UNUSED_VAR(tag);
+  KRML_MAYBE_UNUSED_VAR(dst);
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  #if HACL_CAN_COMPILE_VALE
+  if (iv_len != 12U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  uint32_t nr = scrut.impl == Spec_Cipher_Expansion_Hacl_AES128_GCM_SIV ? 10U : 14U;
+  uint32_t
+  r = Hacl_AEAD_AES_GCM_SIV_NI_decrypt(nr, scrut.ek, dst, cipher, cipher_len, ad, ad_len, iv, tag);
+  if (r == 0U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  return EverCrypt_Error_AuthenticationFailure;
+  #else
+  KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "statically unreachable");
+  KRML_HOST_EXIT(255U);
+  #endif
+}
+
+/**
+Verify the authenticity of `ad` || `cipher` and decrypt `cipher` into `dst`.
+
+@param s Pointer to the The AEAD state created by `EverCrypt_AEAD_create_in`. It already contains the encryption key.
+@param iv Pointer to `iv_len` bytes of memory where the nonce is read from.
+@param iv_len Length of the nonce. Note: ChaCha20Poly1305 and AES-GCM-SIV require a 12 byte nonce,
+  AEGIS-128L a 16 byte nonce and AEGIS-256 a 32 byte nonce.
+@param ad Pointer to `ad_len` bytes of memory where the associated data is read from.
+@param ad_len Length of the associated data.
+@param cipher Pointer to `cipher_len` bytes of memory where the ciphertext is read from.
+@param cipher_len Length of the ciphertext.
+@param tag Pointer to `TAG_LEN` bytes of memory where the tag is read from.
+  The length of the `tag` must be of a suitable length for the chosen algorithm:
+  * `Spec_Agile_AEAD_AES128_GCM` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_AES256_GCM` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_CHACHA20_POLY1305` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_AEGIS128L` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_AEGIS256` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_AES128_GCM_SIV` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_AES256_GCM_SIV` (TAG_LEN=16)
+@param dst Pointer to `cipher_len` bytes of memory where the decrypted plaintext will be written to.
+
+@return `EverCrypt_AEAD_decrypt` returns ...
+
+  * `EverCrypt_Error_Success`
+
+  ... on success and either of ...
+
+  * `EverCrypt_Error_InvalidKey` (returned if and only if the `s` parameter is `NULL`),
+  * `EverCrypt_Error_InvalidIVLength` (see note about requirements on IV size above), or
+  * `EverCrypt_Error_AuthenticationFailure` (in case the ciphertext could not be authenticated, e.g., due to modifications)
+
+  ... on failure (`EverCrypt_error.h`).
+
+  Upon success, the plaintext will be written into `dst`.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
   Spec_Cipher_Expansion_impl i = (*s).impl;
   switch (i)
   {
@@ -1519,6 +2105,22 @@ EverCrypt_AEAD_decrypt(
       {
         return decrypt_chacha20_poly1305(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
       }
+    case Spec_Cipher_Expansion_Hacl_AEGIS128L:
+      {
+        return decrypt_aegis(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+      }
+    case Spec_Cipher_Expansion_Hacl_AEGIS256:
+      {
+        return decrypt_aegis(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+      }
+    case Spec_Cipher_Expansion_Hacl_AES128_GCM_SIV:
+      {
+        return decrypt_aes_gcm_siv(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256_GCM_SIV:
+      {
+        return decrypt_aes_gcm_siv(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+      }
     default:
       {
         KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -2143,6 +2745,77 @@ EverCrypt_AEAD_decrypt_expand_chacha20_poly1305(
   return r;
 }
 
+static EverCrypt_Error_error_code
+decrypt_expand_aegis(
+  Spec_Cipher_Expansion_impl impl,
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  if (has_aesni)
+  {
+    EverCrypt_AEAD_state_s p = { .impl = impl, .ek = k };
+    return decrypt_aegis(&p, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+  }
+  return EverCrypt_Error_UnsupportedAlgorithm;
+}
+
+static EverCrypt_Error_error_code
+decrypt_expand_aes_gcm_siv(
+  Spec_Cipher_Expansion_impl impl,
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  KRML_MAYBE_UNUSED_VAR(impl);
+  KRML_MAYBE_UNUSED_VAR(k);
+  KRML_MAYBE_UNUSED_VAR(iv);
+  KRML_MAYBE_UNUSED_VAR(iv_len);
+  KRML_MAYBE_UNUSED_VAR(ad);
+  KRML_MAYBE_UNUSED_VAR(ad_len);
+  KRML_MAYBE_UNUSED_VAR(cipher);
+  KRML_MAYBE_UNUSED_VAR(cipher_len);
+  KRML_MAYBE_UNUSED_VAR(tag);
+  KRML_MAYBE_UNUSED_VAR(dst);
+  #if HACL_CAN_COMPILE_VALE
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+  bool has_avx = EverCrypt_AutoConfig2_has_avx();
+  if (has_aesni && has_pclmulqdq && has_avx)
+  {
+    uint8_t ek[240U] = { 0U };
+    if (impl == Spec_Cipher_Expansion_Hacl_AES128_GCM_SIV)
+    {
+      aes128_key_expansion(k, ek);
+    }
+    else
+    {
+      aes256_key_expansion(k, ek);
+    }
+    EverCrypt_AEAD_state_s p = { .impl = impl, .ek = ek };
+    return decrypt_aes_gcm_siv(&p, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+  }
+  return EverCrypt_Error_UnsupportedAlgorithm;
+  #else
+  return EverCrypt_Error_UnsupportedAlgorithm;
+  #endif
+}
+
 EverCrypt_Error_error_code
 EverCrypt_AEAD_decrypt_expand(
   Spec_Agile_AEAD_alg a,
@@ -2198,6 +2871,62 @@ EverCrypt_AEAD_decrypt_expand(
             tag,
             dst);
       }
+    case Spec_Agile_AEAD_AEGIS128L:
+      {
+        return
+          decrypt_expand_aegis(Spec_Cipher_Expansion_Hacl_AEGIS128L,
+            k,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            cipher,
+            cipher_len,
+            tag,
+            dst);
+      }
+    case Spec_Agile_AEAD_AEGIS256:
+      {
+        return
+          decrypt_expand_aegis(Spec_Cipher_Expansion_Hacl_AEGIS256,
+            k,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            cipher,
+            cipher_len,
+            tag,
+            dst);
+      }
+    case Spec_Agile_AEAD_AES128_GCM_SIV:
+      {
+        return
+          decrypt_expand_aes_gcm_siv(Spec_Cipher_Expansion_Hacl_AES128_GCM_SIV,
+            k,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            cipher,
+            cipher_len,
+            tag,
+            dst);
+      }
+    case Spec_Agile_AEAD_AES256_GCM_SIV:
+      {
+        return
+          decrypt_expand_aes_gcm_siv(Spec_Cipher_Expansion_Hacl_AES256_GCM_SIV,
+            k,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            cipher,
+            cipher_len,
+            tag,
+            dst);
+      }
     default:
       {
         KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -2206,6 +2935,444 @@ EverCrypt_AEAD_decrypt_expand(
   }
 }
 
+static void
+aegis_encrypt_batch_ni(Spec_Agile_AEAD_alg a, uint32_t len, Hacl_AEAD_AEGIS_NI_packet *packets)
+{
+  KRML_MAYBE_UNUSED_VAR(a);
+  KRML_MAYBE_UNUSED_VAR(len);
+  KRML_MAYBE_UNUSED_VAR(packets);
+  #if HACL_CAN_COMPILE_VALE
+  for (uint32_t i = 0U; i < len; i++)
+  {
+    Hacl_AEAD_AEGIS_NI_packet p = packets[i];
+    if (a == Spec_Agile_AEAD_AEGIS128L)
+    {
+      Hacl_AEAD_AEGIS_NI_aegis128l_encrypt(p.output,
+        p.tag,
+        p.input,
+        p.input_len,
+        p.data,
+        p.data_len,
+        p.key,
+        p.nonce);
+    }
+    else
+    {
+      Hacl_AEAD_AEGIS_NI_aegis256_encrypt(p.output,
+        p.tag,
+        p.input,
+        p.input_len,
+        p.data,
+        p.data_len,
+        p.key,
+        p.nonce);
+    }
+  }
+  #endif
+}
+
+static uint32_t
+aegis_decrypt_batch_ni(
+  Spec_Agile_AEAD_alg a,
+  uint32_t len,
+  Hacl_AEAD_AEGIS_NI_packet *packets,
+  uint32_t *res
+)
+{
+  KRML_MAYBE_UNUSED_VAR(a);
+  KRML_MAYBE_UNUSED_VAR(packets);
+  uint32_t failed = 0U;
+  for (uint32_t i = 0U; i < len; i++)
+  {
+    #if HACL_CAN_COMPILE_VALE
+    Hacl_AEAD_AEGIS_NI_packet p = packets[i];
+    uint32_t r;
+    if (a == Spec_Agile_AEAD_AEGIS128L)
+    {
+      r =
+        Hacl_AEAD_AEGIS_NI_aegis128l_decrypt(p.output,
+          p.input,
+          p.input_len,
+          p.data,
+          p.data_len,
+          p.key,
+          p.nonce,
+          p.tag);
+    }
+    else
+    {
+      r =
+        Hacl_AEAD_AEGIS_NI_aegis256_decrypt(p.output,
+          p.input,
+          p.input_len,
+          p.data,
+          p.data_len,
+          p.key,
+          p.nonce,
+          p.tag);
+    }
+    res[i] = r;
+    failed = failed + r;
+    #else
+    res[i] = 1U;
+    failed++;
+    #endif
+  }
+  return failed;
+}
+
+/**
+Encrypt `len` independent packets with AEGIS-128L or AEGIS-256.
+
+On CPUs with AVX-512 and VAES, four packets share each vector pass (one 128-bit lane per packet),
+which is faster than one `EverCrypt_AEAD_encrypt` call per packet when packets are short.
+
+@param a Either `Spec_Agile_AEAD_AEGIS128L` or `Spec_Agile_AEAD_AEGIS256`.
+@param len Number of packets.
+@param packets Pointer to `len` packet descriptors; keys and nonces are 16 bytes each for
+  AEGIS-128L and 32 bytes each for AEGIS-256.
+
+@return `EverCrypt_Error_Success`, or `EverCrypt_Error_UnsupportedAlgorithm` if `a` is not an
+  AEGIS algorithm or the CPU does not support AES-NI.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_aegis_encrypt_batch(
+  Spec_Agile_AEAD_alg a,
+  uint32_t len,
+  Hacl_AEAD_AEGIS_NI_packet *packets
+)
+{
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool vaes = EverCrypt_AutoConfig2_has_vaes();
+  if (!(a == Spec_Agile_AEAD_AEGIS128L || a == Spec_Agile_AEAD_AEGIS256) || !has_aesni)
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  #if HACL_CAN_COMPILE_VAES
+  if (vaes)
+  {
+    if (a == Spec_Agile_AEAD_AEGIS128L)
+    {
+      Hacl_AEAD_AEGIS_Simd512_aegis128l_encrypt_batch(len, packets);
+    }
+    else
+    {
+      Hacl_AEAD_AEGIS_Simd512_aegis256_encrypt_batch(len, packets);
+    }
+    return EverCrypt_Error_Success;
+  }
+  #endif
+  KRML_MAYBE_UNUSED_VAR(vaes);
+  aegis_encrypt_batch_ni(a, len, packets);
+  return EverCrypt_Error_Success;
+}
+
+/**
+Decrypt `len` independent packets with AEGIS-128L or AEGIS-256.
+
+@param a Either `Spec_Agile_AEAD_AEGIS128L` or `Spec_Agile_AEAD_AEGIS256`.
+@param len Number of packets.
+@param packets Pointer to `len` packet descriptors.
+@param res Pointer to `len` result codes: 0 on success, 1 on failure, in which case the output of
+  the corresponding packet is zeroed.
+
+@return `EverCrypt_Error_Success` if every packet authenticated,
+  `EverCrypt_Error_AuthenticationFailure` if at least one did not (see `res`), or
+  `EverCrypt_Error_UnsupportedAlgorithm` if `a` is not an AEGIS algorithm or the CPU does not
+  support AES-NI.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_aegis_decrypt_batch(
+  Spec_Agile_AEAD_alg a,
+  uint32_t len,
+  Hacl_AEAD_AEGIS_NI_packet *packets,
+  uint32_t *res
+)
+{
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool vaes = EverCrypt_AutoConfig2_has_vaes();
+  if (!(a == Spec_Agile_AEAD_AEGIS128L || a == Spec_Agile_AEAD_AEGIS256) || !has_aesni)
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  uint32_t failed;
+  #if HACL_CAN_COMPILE_VAES
+  if (vaes)
+  {
+    if (a == Spec_Agile_AEAD_AEGIS128L)
+    {
+      failed = Hacl_AEAD_AEGIS_Simd512_aegis128l_decrypt_batch(len, packets, res);
+    }
+    else
+    {
+      failed = Hacl_AEAD_AEGIS_Simd512_aegis256_decrypt_batch(len, packets, res);
+    }
+  }
+  else
+  {
+    failed = aegis_decrypt_batch_ni(a, len, packets, res);
+  }
+  #else
+  KRML_MAYBE_UNUSED_VAR(vaes);
+  failed = aegis_decrypt_batch_ni(a, len, packets, res);
+  #endif
+  if (failed == 0U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  return EverCrypt_Error_AuthenticationFailure;
+}
+
+/**
+The nonce of the next record: the static IV with the big-endian sequence number
+XORed into its last 8 bytes (RFC 8446, Section 5.3).
+*/
+static void record_nonce(EverCrypt_AEAD_RecordCtx *ctx, uint8_t *nonce)
+{
+  uint32_t nonce_len = (*ctx).nonce_len;
+  uint8_t *iv = nonce_len == 32U ? (*ctx).ek + 32U : (*ctx).nonce;
+  memcpy(nonce, iv, nonce_len * sizeof (uint8_t));
+  uint8_t seq[8U] = { 0U };
+  store64_be(seq, (*ctx).seq);
+  uint8_t *last = nonce + nonce_len - 8U;
+  KRML_MAYBE_FOR8(i, 0U, 8U, 1U, last[i] = (uint32_t)last[i] ^ (uint32_t)seq[i];);
+}
+
+/**
+Initialize a record-layer AEAD context.
+
+The context holds the expanded key, the static IV and a 64-bit sequence number that
+starts at 0. Each `EverCrypt_AEAD_RecordCtx_seal_next` or `EverCrypt_AEAD_RecordCtx_open_next`
+uses the IV with the sequence number XORed into it as nonce, as in TLS 1.3, QUIC and HPKE.
+The implementation is selected once, here, so that records skip the CPU feature checks.
+For ChaCha20-Poly1305 this fixes the widest SIMD width, and each record then picks
+its width by length (see `EverCrypt_Chacha20Poly1305_set_thresholds`).
+
+The context does not own any memory; to discard it, clear it with e.g. `memset`.
+
+@param ctx Pointer to the context to initialize. The sequence number, a 12- or 16-byte IV
+  and the first 32 bytes of the expanded key, which hold the whole key for
+  ChaCha20-Poly1305, AEGIS-128L and AEGIS-256, fit in the first 64 bytes. Placing the
+  context on a 64-byte boundary keeps them within one cache line. The 32-byte IV of
+  AEGIS-256 does not fit in the 16-byte IV field; it is stored right after the key, at
+  offset 64, and takes a second cache line.
+@param a Algorithm, as for `EverCrypt_AEAD_create_in`.
+@param k Pointer to `KEY_LEN` bytes of memory where the key is read from.
+@param iv Pointer to `iv_len` bytes of memory where the static IV is read from.
+@param iv_len Length of the IV, which must be the nonce length of the algorithm: 12 bytes,
+  except for AEGIS-128L (16 bytes) and AEGIS-256 (32 bytes).
+
+@return `EverCrypt_Error_Success`, `EverCrypt_Error_UnsupportedAlgorithm` if `a` is not
+  supported on this CPU, or `EverCrypt_Error_InvalidIVLength`.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_RecordCtx_init(
+  EverCrypt_AEAD_RecordCtx *ctx,
+  Spec_Agile_AEAD_alg a,
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len
+)
+{
+  Spec_Cipher_Expansion_impl impl = Spec_Cipher_Expansion_Hacl_CHACHA20;
+  EverCrypt_Error_error_code r = impl_of_alg(a, &impl);
+  if (r != EverCrypt_Error_Success)
+  {
+    return r;
+  }
+  uint32_t nonce_len = 12U;
+  if (impl == Spec_Cipher_Expansion_Hacl_AEGIS128L)
+  {
+    nonce_len = 16U;
+  }
+  else if (impl == Spec_Cipher_Expansion_Hacl_AEGIS256)
+  {
+    nonce_len = 32U;
+  }
+  if (iv_len != nonce_len)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  memset(ctx, 0U, sizeof (EverCrypt_AEAD_RecordCtx));
+  expand_key(impl, (*ctx).ek, k);
+  if (nonce_len == 32U)
+  {
+    memcpy((*ctx).ek + 32U, iv, nonce_len * sizeof (uint8_t));
+  }
+  else
+  {
+    memcpy((*ctx).nonce, iv, nonce_len * sizeof (uint8_t));
+  }
+  (*ctx).nonce_len = (uint8_t)nonce_len;
+  (*ctx).impl = impl;
+  if (impl == Spec_Cipher_Expansion_Hacl_CHACHA20)
+  {
+    (*ctx).chacha20_width = EverCrypt_Chacha20Poly1305_max_width();
+  }
+  return EverCrypt_Error_Success;
+}
+
+/**
+Encrypt and authenticate the next record, then advance the sequence number.
+
+@param ctx Context initialized by `EverCrypt_AEAD_RecordCtx_init`.
+@param ad Pointer to `ad_len` bytes of memory where the associated data is read from.
+@param ad_len Length of the associated data.
+@param plain Pointer to `plain_len` bytes of memory where the plaintext is read from.
+@param plain_len Length of the plaintext.
+@param cipher Pointer to `plain_len` bytes of memory where the ciphertext is written to.
+@param tag Pointer to 16 bytes of memory where the tag is written to.
+
+@return `EverCrypt_Error_Success`, or `EverCrypt_Error_MaximumLengthExceeded` once all
+  2^64 - 1 sequence numbers have been used, in which case nothing is written.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_RecordCtx_seal_next(
+  EverCrypt_AEAD_RecordCtx *ctx,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  if ((*ctx).seq == 0xFFFFFFFFFFFFFFFFULL)
+  {
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  uint8_t nonce[32U] = { 0U };
+  record_nonce(ctx, nonce);
+  uint32_t nonce_len = (*ctx).nonce_len;
+  uint8_t *ek = (*ctx).ek;
+  Spec_Cipher_Expansion_impl impl = (*ctx).impl;
+  EverCrypt_AEAD_state_s s = { .impl = impl, .ek = ek };
+  EverCrypt_Error_error_code r = EverCrypt_Error_Success;
+  switch (impl)
+  {
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        uint32_t width = EverCrypt_Chacha20Poly1305_select_width((*ctx).chacha20_width, plain_len);
+        EverCrypt_Chacha20Poly1305_encrypt_width(width, ek, nonce, ad_len, ad, plain_len, plain,
+          cipher, tag);
+        break;
+      }
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        r = encrypt_aes128_gcm(&s, nonce, nonce_len, ad, ad_len, plain, plain_len, cipher, tag);
+        break;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        r = encrypt_aes256_gcm(&s, nonce, nonce_len, ad, ad_len, plain, plain_len, cipher, tag);
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AEGIS128L:
+    case Spec_Cipher_Expansion_Hacl_AEGIS256:
+      {
+        r = encrypt_aegis(&s, nonce, nonce_len, ad, ad_len, plain, plain_len, cipher, tag);
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES128_GCM_SIV:
+    case Spec_Cipher_Expansion_Hacl_AES256_GCM_SIV:
+      {
+        r = encrypt_aes_gcm_siv(&s, nonce, nonce_len, ad, ad_len, plain, plain_len, cipher, tag);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+  (*ctx).seq = (*ctx).seq + 1ULL;
+  return r;
+}
+
+/**
+Verify and decrypt the next record. The sequence number advances only if the record
+is authentic, so that a forged record does not desynchronize the two ends.
+
+@param ctx Context initialized by `EverCrypt_AEAD_RecordCtx_init`.
+@param ad Pointer to `ad_len` bytes of memory where the associated data is read from.
+@param ad_len Length of the associated data.
+@param cipher Pointer to `cipher_len` bytes of memory where the ciphertext is read from.
+@param cipher_len Length of the ciphertext.
+@param tag Pointer to 16 bytes of memory where the tag is read from.
+@param dst Pointer to `cipher_len` bytes of memory where the plaintext is written to.
+
+@return `EverCrypt_Error_Success`, `EverCrypt_Error_AuthenticationFailure`, or
+  `EverCrypt_Error_MaximumLengthExceeded` once all 2^64 - 1 sequence numbers have been used.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_RecordCtx_open_next(
+  EverCrypt_AEAD_RecordCtx *ctx,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  if ((*ctx).seq == 0xFFFFFFFFFFFFFFFFULL)
+  {
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  uint8_t nonce[32U] = { 0U };
+  record_nonce(ctx, nonce);
+  uint32_t nonce_len = (*ctx).nonce_len;
+  uint8_t *ek = (*ctx).ek;
+  Spec_Cipher_Expansion_impl impl = (*ctx).impl;
+  EverCrypt_AEAD_state_s s = { .impl = impl, .ek = ek };
+  EverCrypt_Error_error_code r;
+  switch (impl)
+  {
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        uint32_t width = EverCrypt_Chacha20Poly1305_select_width((*ctx).chacha20_width, cipher_len);
+        uint32_t
+        failed =
+          EverCrypt_Chacha20Poly1305_decrypt_width(width, ek, nonce, ad_len, ad, cipher_len,
+            dst, cipher, tag);
+        r = failed == 0U ? EverCrypt_Error_Success : EverCrypt_Error_AuthenticationFailure;
+        break;
+      }
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        r = decrypt_aes128_gcm(&s, nonce, nonce_len, ad, ad_len, cipher, cipher_len, tag, dst);
+        break;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        r = decrypt_aes256_gcm(&s, nonce, nonce_len, ad, ad_len, cipher, cipher_len, tag, dst);
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AEGIS128L:
+    case Spec_Cipher_Expansion_Hacl_AEGIS256:
+      {
+        r = decrypt_aegis(&s, nonce, nonce_len, ad, ad_len, cipher, cipher_len, tag, dst);
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES128_GCM_SIV:
+    case Spec_Cipher_Expansion_Hacl_AES256_GCM_SIV:
+      {
+        r = decrypt_aes_gcm_siv(&s, nonce, nonce_len, ad, ad_len, cipher, cipher_len, tag, dst);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+  if (r == EverCrypt_Error_Success)
+  {
+    (*ctx).seq = (*ctx).seq + 1ULL;
+  }
+  return r;
+}
+
 /**
 Cleanup and free the AEAD state.
 
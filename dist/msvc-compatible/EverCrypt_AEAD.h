@@ -39,9 +39,31 @@ extern "C" {
 #include "EverCrypt_Error.h"
 #include "EverCrypt_Chacha20Poly1305.h"
 #include "EverCrypt_AutoConfig2.h"
+#include "Hacl_AEAD_AEGIS_NI.h"
+#include "evercrypt_aead_algs.h"
 
 typedef struct EverCrypt_AEAD_state_s_s EverCrypt_AEAD_state_s;
 
+/**
+Record-layer AEAD context: an expanded key, a static IV and the sequence number of
+the next record. See `EverCrypt_AEAD_RecordCtx_init`.
+
+The fields are set by `EverCrypt_AEAD_RecordCtx_init` and must not be modified,
+except that `seq` may be read (e.g. to trigger a key update). `impl` is the
+`Spec_Cipher_Expansion_impl` of the algorithm; for ChaCha20-Poly1305, `chacha20_width` is the
+widest SIMD width (32, 128, 256 or 512) the CPU supports, and it is 0 for other algorithms.
+*/
+typedef struct EverCrypt_AEAD_RecordCtx_s
+{
+  uint64_t seq;
+  uint32_t chacha20_width;
+  uint8_t impl;
+  uint8_t nonce_len;
+  uint8_t nonce[16U];
+  KRML_PRE_ALIGN(16) uint8_t ek[544U] KRML_POST_ALIGN(16);
+}
+EverCrypt_AEAD_RecordCtx;
+
 /**
 Both encryption and decryption require a state that holds the key.
 The state may be reused as many times as desired.
@@ -64,8 +86,12 @@ Note: The caller must free the AEAD state by calling `EverCrypt_AEAD_free`.
 
 @param a The argument `a` must be either of:
   * `Spec_Agile_AEAD_AES128_GCM` (KEY_LEN=16),
-  * `Spec_Agile_AEAD_AES256_GCM` (KEY_LEN=32), or
-  * `Spec_Agile_AEAD_CHACHA20_POLY1305` (KEY_LEN=32).
+  * `Spec_Agile_AEAD_AES256_GCM` (KEY_LEN=32),
+  * `Spec_Agile_AEAD_CHACHA20_POLY1305` (KEY_LEN=32),
+  * `Spec_Agile_AEAD_AEGIS128L` (KEY_LEN=16),
+  * `Spec_Agile_AEAD_AEGIS256` (KEY_LEN=32),
+  * `Spec_Agile_AEAD_AES128_GCM_SIV` (KEY_LEN=16), or
+  * `Spec_Agile_AEAD_AES256_GCM_SIV` (KEY_LEN=32).
 @param dst Pointer to a pointer where the address of the allocated AEAD state will be written to.
 @param k Pointer to `KEY_LEN` bytes of memory where the key is read from. The size depends on the used algorithm, see above.
 
@@ -76,12 +102,57 @@ Note: The caller must free the AEAD state by calling `EverCrypt_AEAD_free`.
 EverCrypt_Error_error_code
 EverCrypt_AEAD_create_in(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s **dst, uint8_t *k);
 
+/**
+Return the number of bytes of memory that `EverCrypt_AEAD_create_in_place` needs
+for algorithm `a`, or 0 if `a` is not an AEAD algorithm supported by `create_in`.
+
+The size does not depend on the CPU, so it can be used to lay out arenas statically.
+*/
+uint32_t EverCrypt_AEAD_state_size(Spec_Agile_AEAD_alg a);
+
+/**
+Create the AEAD state for the algorithm in caller-provided memory.
+
+This is the allocation-free counterpart of `EverCrypt_AEAD_create_in`: the state
+header and the expanded key are both written to `mem`, which can afterwards be used
+as an `EverCrypt_AEAD_state_s *` with all functions of this module except
+`EverCrypt_AEAD_free`. Releasing `mem` is up to the caller, who should clear it
+first since it holds key material.
+
+@param mem Pointer to `EverCrypt_AEAD_state_size(a)` bytes of memory, aligned on a
+  16-byte boundary.
+@param a Algorithm, as for `EverCrypt_AEAD_create_in`.
+@param k Pointer to `KEY_LEN` bytes of memory where the key is read from.
+
+@return The function returns `EverCrypt_Error_Success` on success or
+  `EverCrypt_Error_UnsupportedAlgorithm` in case of a bad algorithm identifier, in which
+  case `mem` is left untouched.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_create_in_place(uint8_t *mem, Spec_Agile_AEAD_alg a, uint8_t *k);
+
+/**
+Replace the key held by an AEAD state, keeping its algorithm.
+
+The new key is expanded over the old one in the existing storage, so this neither
+allocates nor frees. It works for states from both `EverCrypt_AEAD_create_in` and
+`EverCrypt_AEAD_create_in_place`.
+
+@param s State of the AEAD algorithm.
+@param k Pointer to `KEY_LEN` bytes of memory where the new key is read from.
+
+@return The function returns `EverCrypt_Error_Success` on success or
+  `EverCrypt_Error_InvalidKey` if `s` is `NULL`.
+*/
+EverCrypt_Error_error_code EverCrypt_AEAD_rekey(EverCrypt_AEAD_state_s *s, uint8_t *k);
+
 /**
 Encrypt and authenticate a message (`plain`) with associated data (`ad`).
 
 @param s Pointer to the The AEAD state created by `EverCrypt_AEAD_create_in`. It already contains the encryption key.
 @param iv Pointer to `iv_len` bytes of memory where the nonce is read from.
-@param iv_len Length of the nonce. Note: ChaCha20Poly1305 requires a 12 byte nonce.
+@param iv_len Length of the nonce. Note: ChaCha20Poly1305 and AES-GCM-SIV require a 12 byte nonce,
+  AEGIS-128L a 16 byte nonce and AEGIS-256 a 32 byte nonce.
 @param ad Pointer to `ad_len` bytes of memory where the associated data is read from.
 @param ad_len Length of the associated data.
 @param plain Pointer to `plain_len` bytes of memory where the to-be-encrypted plaintext is read from.
@@ -92,6 +163,10 @@ Encrypt and authenticate a message (`plain`) with associated data (`ad`).
   * `Spec_Agile_AEAD_AES128_GCM` (TAG_LEN=16)
   * `Spec_Agile_AEAD_AES256_GCM` (TAG_LEN=16)
   * `Spec_Agile_AEAD_CHACHA20_POLY1305` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_AEGIS128L` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_AEGIS256` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_AES128_GCM_SIV` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_AES256_GCM_SIV` (TAG_LEN=16)
 
 @return `EverCrypt_AEAD_encrypt` may return either `EverCrypt_Error_Success` or `EverCrypt_Error_InvalidKey` (`EverCrypt_error.h`). The latter is returned if and only if the `s` parameter is `NULL`.
 */
@@ -208,7 +283,8 @@ Verify the authenticity of `ad` || `cipher` and decrypt `cipher` into `dst`.
 
 @param s Pointer to the The AEAD state created by `EverCrypt_AEAD_create_in`. It already contains the encryption key.
 @param iv Pointer to `iv_len` bytes of memory where the nonce is read from.
-@param iv_len Length of the nonce. Note: ChaCha20Poly1305 requires a 12 byte nonce.
+@param iv_len Length of the nonce. Note: ChaCha20Poly1305 and AES-GCM-SIV require a 12 byte nonce,
+  AEGIS-128L a 16 byte nonce and AEGIS-256 a 32 byte nonce.
 @param ad Pointer to `ad_len` bytes of memory where the associated data is read from.
 @param ad_len Length of the associated data.
 @param cipher Pointer to `cipher_len` bytes of memory where the ciphertext is read from.
@@ -218,6 +294,10 @@ Verify the authenticity of `ad` || `cipher` and decrypt `cipher` into `dst`.
   * `Spec_Agile_AEAD_AES128_GCM` (TAG_LEN=16)
   * `Spec_Agile_AEAD_AES256_GCM` (TAG_LEN=16)
   * `Spec_Agile_AEAD_CHACHA20_POLY1305` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_AEGIS128L` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_AEGIS256` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_AES128_GCM_SIV` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_AES256_GCM_SIV` (TAG_LEN=16)
 @param dst Pointer to `cipher_len` bytes of memory where the decrypted plaintext will be written to.
 
 @return `EverCrypt_AEAD_decrypt` returns ...
@@ -342,6 +422,136 @@ EverCrypt_AEAD_decrypt_expand(
   uint8_t *dst
 );
 
+/**
+Encrypt `len` independent packets with AEGIS-128L or AEGIS-256.
+
+On CPUs with AVX-512 and VAES, four packets share each vector pass (one 128-bit lane per packet),
+which is faster than one `EverCrypt_AEAD_encrypt` call per packet when packets are short.
+
+@param a Either `Spec_Agile_AEAD_AEGIS128L` or `Spec_Agile_AEAD_AEGIS256`.
+@param len Number of packets.
+@param packets Pointer to `len` packet descriptors; keys and nonces are 16 bytes each for
+  AEGIS-128L and 32 bytes each for AEGIS-256.
+
+@return `EverCrypt_Error_Success`, or `EverCrypt_Error_UnsupportedAlgorithm` if `a` is not an
+  AEGIS algorithm or the CPU does not support AES-NI.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_aegis_encrypt_batch(
+  Spec_Agile_AEAD_alg a,
+  uint32_t len,
+  Hacl_AEAD_AEGIS_NI_packet *packets
+);
+
+/**
+Decrypt `len` independent packets with AEGIS-128L or AEGIS-256.
+
+@param a Either `Spec_Agile_AEAD_AEGIS128L` or `Spec_Agile_AEAD_AEGIS256`.
+@param len Number of packets.
+@param packets Pointer to `len` packet descriptors.
+@param res Pointer to `len` result codes: 0 on success, 1 on failure, in which case the output of
+  the corresponding packet is zeroed.
+
+@return `EverCrypt_Error_Success` if every packet authenticated,
+  `EverCrypt_Error_AuthenticationFailure` if at least one did not (see `res`), or
+  `EverCrypt_Error_UnsupportedAlgorithm` if `a` is not an AEGIS algorithm or the CPU does not
+  support AES-NI.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_aegis_decrypt_batch(
+  Spec_Agile_AEAD_alg a,
+  uint32_t len,
+  Hacl_AEAD_AEGIS_NI_packet *packets,
+  uint32_t *res
+);
+
+/**
+Initialize a record-layer AEAD context.
+
+The context holds the expanded key, the static IV and a 64-bit sequence number that
+starts at 0. Each `EverCrypt_AEAD_RecordCtx_seal_next` or `EverCrypt_AEAD_RecordCtx_open_next`
+uses the IV with the sequence number XORed into it as nonce, as in TLS 1.3, QUIC and HPKE.
+The implementation is selected once, here, so that records skip the CPU feature checks.
+For ChaCha20-Poly1305 this fixes the widest SIMD width, and each record then picks
+its width by length (see `EverCrypt_Chacha20Poly1305_set_thresholds`).
+
+The context does not own any memory; to discard it, clear it with e.g. `memset`.
+
+@param ctx Pointer to the context to initialize. The sequence number, a 12- or 16-byte IV
+  and the first 32 bytes of the expanded key, which hold the whole key for
+  ChaCha20-Poly1305, AEGIS-128L and AEGIS-256, fit in the first 64 bytes. Placing the
+  context on a 64-byte boundary keeps them within one cache line. The 32-byte IV of
+  AEGIS-256 does not fit in the 16-byte IV field; it is stored right after the key, at
+  offset 64, and takes a second cache line.
+@param a Algorithm, as for `EverCrypt_AEAD_create_in`.
+@param k Pointer to `KEY_LEN` bytes of memory where the key is read from.
+@param iv Pointer to `iv_len` bytes of memory where the static IV is read from.
+@param iv_len Length of the IV, which must be the nonce length of the algorithm: 12 bytes,
+  except for AEGIS-128L (16 bytes) and AEGIS-256 (32 bytes).
+
+@return `EverCrypt_Error_Success`, `EverCrypt_Error_UnsupportedAlgorithm` if `a` is not
+  supported on this CPU, or `EverCrypt_Error_InvalidIVLength`.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_RecordCtx_init(
+  EverCrypt_AEAD_RecordCtx *ctx,
+  Spec_Agile_AEAD_alg a,
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len
+);
+
+/**
+Encrypt and authenticate the next record, then advance the sequence number.
+
+@param ctx Context initialized by `EverCrypt_AEAD_RecordCtx_init`.
+@param ad Pointer to `ad_len` bytes of memory where the associated data is read from.
+@param ad_len Length of the associated data.
+@param plain Pointer to `plain_len` bytes of memory where the plaintext is read from.
+@param plain_len Length of the plaintext.
+@param cipher Pointer to `plain_len` bytes of memory where the ciphertext is written to.
+@param tag Pointer to 16 bytes of memory where the tag is written to.
+
+@return `EverCrypt_Error_Success`, or `EverCrypt_Error_MaximumLengthExceeded` once all
+  2^64 - 1 sequence numbers have been used, in which case nothing is written.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_RecordCtx_seal_next(
+  EverCrypt_AEAD_RecordCtx *ctx,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+);
+
+/**
+Verify and decrypt the next record. The sequence number advances only if the record
+is authentic, so that a forged record does not desynchronize the two ends.
+
+@param ctx Context initialized by `EverCrypt_AEAD_RecordCtx_init`.
+@param ad Pointer to `ad_len` bytes of memory where the associated data is read from.
+@param ad_len Length of the associated data.
+@param cipher Pointer to `cipher_len` bytes of memory where the ciphertext is read from.
+@param cipher_len Length of the ciphertext.
+@param tag Pointer to 16 bytes of memory where the tag is read from.
+@param dst Pointer to `cipher_len` bytes of memory where the plaintext is written to.
+
+@return `EverCrypt_Error_Success`, `EverCrypt_Error_AuthenticationFailure`, or
+  `EverCrypt_Error_MaximumLengthExceeded` once all 2^64 - 1 sequence numbers have been used.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_RecordCtx_open_next(
+  EverCrypt_AEAD_RecordCtx *ctx,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+);
+
 /**
 Cleanup and free the AEAD state.
 
@@ -50,6 +50,8 @@ static bool cpu_has_rdrand[1U] = { false };
 
 static bool cpu_has_avx512[1U] = { false };
 
+static bool cpu_has_vaes[1U] = { false };
+
 bool EverCrypt_AutoConfig2_has_shaext(void)
 {
   return cpu_has_shaext[0U];
@@ -105,6 +107,11 @@ bool EverCrypt_AutoConfig2_has_avx512(void)
   return cpu_has_avx512[0U];
 }
 
+bool EverCrypt_AutoConfig2_has_vaes(void)
+{
+  return cpu_has_vaes[0U];
+}
+
 void EverCrypt_AutoConfig2_recall(void)
 {
 
@@ -168,6 +175,7 @@ void EverCrypt_AutoConfig2_init(void)
         if (check_avx512_xcr0() != 0ULL)
         {
           cpu_has_avx512[0U] = true;
+          cpu_has_vaes[0U] = has_vaes_cpuid();
           return;
         }
         return;
@@ -234,6 +242,11 @@ void EverCrypt_AutoConfig2_disable_avx512(void)
   cpu_has_avx512[0U] = false;
 }
 
+void EverCrypt_AutoConfig2_disable_vaes(void)
+{
+  cpu_has_vaes[0U] = false;
+}
+
 bool EverCrypt_AutoConfig2_has_vec128(void)
 {
   bool avx = EverCrypt_AutoConfig2_has_avx();
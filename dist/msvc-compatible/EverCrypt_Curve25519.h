@@ -37,6 +37,7 @@ extern "C" {
 
 #include "Hacl_Curve25519_64.h"
 #include "Hacl_Curve25519_51.h"
+#include "Hacl_Curve25519_Vec256.h"
 #include "EverCrypt_AutoConfig2.h"
 
 /**
@@ -67,6 +68,28 @@ Execute the diffie-hellmann key exchange.
 */
 bool EverCrypt_Curve25519_ecdh(uint8_t *shared, uint8_t *my_priv, uint8_t *their_pub);
 
+/**
+Execute many independent diffie-hellmann key exchanges.
+
+@param n Number of key exchanges.
+@param shared Pointer to n * 32 bytes of memory where the resulting points are written to.
+@param my_priv Pointer to n * 32 bytes of memory where **our** secret/private keys are read from.
+@param their_pub Pointer to n * 32 bytes of memory where **their** public points are read from.
+@param results Pointer to n booleans, each set as `EverCrypt_Curve25519_ecdh` would return it.
+
+On CPUs with AVX2, groups of four exchanges run in the lanes of
+`Hacl_Curve25519_Vec256_scalarmult4`; the rest go through `EverCrypt_Curve25519_scalarmult`.
+Returns `true` if every exchange succeeded.
+*/
+bool
+EverCrypt_Curve25519_ecdh_batch(
+  uint32_t n,
+  uint8_t *shared,
+  uint8_t *my_priv,
+  uint8_t *their_pub,
+  bool *results
+);
+
 #if defined(__cplusplus)
 }
 #endif
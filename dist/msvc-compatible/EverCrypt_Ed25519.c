@@ -25,6 +25,8 @@
 
 #include "EverCrypt_Ed25519.h"
 
+#include "config.h"
+
 void EverCrypt_Ed25519_secret_to_public(uint8_t *public_key, uint8_t *private_key)
 {
   Hacl_Ed25519_secret_to_public(public_key, private_key);
@@ -68,3 +70,25 @@ EverCrypt_Ed25519_verify(
   return Hacl_Ed25519_verify(public_key, msg_len, msg, signature);
 }
 
+/**
+Same as `Hacl_Ed25519_sign_batch`, but hashes four messages at once with the four-way
+SHA-512 on CPUs with AVX2.
+*/
+void
+EverCrypt_Ed25519_sign_batch(
+  uint8_t *expanded_keys,
+  uint32_t n,
+  uint8_t **msgs,
+  uint32_t *msg_lens,
+  uint8_t **signatures
+)
+{
+  uint32_t sha512_lanes = 1U;
+  #if HACL_CAN_COMPILE_VEC256
+  if (EverCrypt_AutoConfig2_has_avx2())
+  {
+    sha512_lanes = 4U;
+  }
+  #endif
+  Hacl_Ed25519_sign_batch_lanes(sha512_lanes, expanded_keys, n, msgs, msg_lens, signatures);
+}
@@ -35,11 +35,23 @@ extern "C" {
 #include "krml/lowstar_endianness.h"
 #include "krml/internal/target.h"
 
+#include "Hacl_MAC_Poly1305_Simd512.h"
 #include "Hacl_MAC_Poly1305_Simd256.h"
 #include "Hacl_MAC_Poly1305_Simd128.h"
 #include "Hacl_MAC_Poly1305.h"
 #include "EverCrypt_AutoConfig2.h"
 
+/**
+Set the message lengths from which `EverCrypt_Poly1305_mac` uses the 128-bit, 256-bit and
+512-bit implementations, when the CPU supports them, replacing the defaults for the detected
+feature level. Shorter messages use the scalar code, which is Vale's on x86-64. Passing
+`0xFFFFFFFFU` disables a width for all message lengths.
+
+Like the `EverCrypt_AutoConfig2_disable_*` functions, this is meant to be called once at
+startup, before other threads use the library.
+*/
+void EverCrypt_Poly1305_set_thresholds(uint32_t vec128, uint32_t vec256, uint32_t vec512);
+
 void EverCrypt_Poly1305_mac(uint8_t *output, uint8_t *input, uint32_t input_len, uint8_t *key);
 
 #if defined(__cplusplus)
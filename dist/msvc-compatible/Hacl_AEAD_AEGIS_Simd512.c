@@ -0,0 +1,762 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_AEAD_AEGIS_Simd512.h"
+
+#include "internal/Hacl_Krmllib.h"
+#include "libintvector.h"
+
+/* Four packets are processed together: every state block S_i is a 512-bit register whose
+   128-bit lane j belongs to packet j. Lanes whose text is exhausted keep their state by
+   blending the old and the updated registers with the mask of active lanes. */
+
+static const
+uint8_t
+aegis_c0[16U] =
+  {
+    0x00U, 0x01U, 0x01U, 0x02U, 0x03U, 0x05U, 0x08U, 0x0dU, 0x15U, 0x22U, 0x37U, 0x59U, 0x90U,
+    0xe9U, 0x79U, 0x62U
+  };
+
+static const
+uint8_t
+aegis_c1[16U] =
+  {
+    0xdbU, 0x3dU, 0x18U, 0x55U, 0x6dU, 0xc2U, 0x2fU, 0xf1U, 0x20U, 0x11U, 0x31U, 0x42U, 0x73U,
+    0xb5U, 0x28U, 0xddU
+  };
+
+static uint8_t zero_block[32U] = { 0U };
+
+static inline Lib_IntVector_Intrinsics_vec512 load_x4(uint8_t **b, uint32_t off)
+{
+  Lib_IntVector_Intrinsics_vec512 r = Lib_IntVector_Intrinsics_vec512_zero;
+  r =
+    Lib_IntVector_Intrinsics_vec512_insert128(r,
+      Lib_IntVector_Intrinsics_vec128_load32_le(b[0U] + off),
+      0);
+  r =
+    Lib_IntVector_Intrinsics_vec512_insert128(r,
+      Lib_IntVector_Intrinsics_vec128_load32_le(b[1U] + off),
+      1);
+  r =
+    Lib_IntVector_Intrinsics_vec512_insert128(r,
+      Lib_IntVector_Intrinsics_vec128_load32_le(b[2U] + off),
+      2);
+  r =
+    Lib_IntVector_Intrinsics_vec512_insert128(r,
+      Lib_IntVector_Intrinsics_vec128_load32_le(b[3U] + off),
+      3);
+  return r;
+}
+
+static inline Lib_IntVector_Intrinsics_vec512 load_const_x4(const uint8_t *c)
+{
+  uint8_t *b[4U] = { (uint8_t *)c, (uint8_t *)c, (uint8_t *)c, (uint8_t *)c };
+  return load_x4(b, 0U);
+}
+
+/**
+Point `dst[j]` at block `i` (of `bs` bytes) of each lane's text, zero-padding a final partial
+block into `pad`, and return the mask of lanes that still have a block at this position.
+*/
+static inline uint8_t
+block_x4(uint8_t **dst, uint8_t *pad, uint8_t **text, uint32_t *len, uint32_t bs, uint32_t i)
+{
+  uint8_t mask = 0U;
+  uint32_t off = i * bs;
+  KRML_MAYBE_FOR4(j,
+    0U,
+    4U,
+    1U,
+    if (off + bs <= len[j])
+    {
+      dst[j] = text[j] + off;
+      mask = (uint32_t)mask | 3U << 2U * j;
+    }
+    else if (off < len[j])
+    {
+      uint8_t *pj = pad + j * bs;
+      memset(pj, 0U, bs * sizeof (uint8_t));
+      memcpy(pj, text[j] + off, (len[j] - off) * sizeof (uint8_t));
+      dst[j] = pj;
+      mask = (uint32_t)mask | 3U << 2U * j;
+    }
+    else
+    {
+      dst[j] = zero_block;
+    });
+  return mask;
+}
+
+/**
+Write block `i` of each lane's output from `ob`, where vector `v` of lane `j` sits at
+`ob + 64 * v + 16 * j`; if `zero` is set, also clear the bytes of `ob` past the end of a partial
+block so that `ob` can be reloaded as padded plaintext.
+*/
+static inline void
+store_x4(uint8_t **text, uint32_t *len, uint32_t nv, uint32_t i, uint8_t *ob, bool zero)
+{
+  uint32_t off = i * nv * 16U;
+  for (uint32_t j = 0U; j < 4U; j++)
+  {
+    if (off < len[j])
+    {
+      uint32_t r = len[j] - off;
+      for (uint32_t v = 0U; v < nv; v++)
+      {
+        uint32_t start = r < 16U * v ? 0U : (r - 16U * v < 16U ? r - 16U * v : 16U);
+        uint8_t *ov = ob + 64U * v + 16U * j;
+        memcpy(text[j] + off + 16U * v, ov, start * sizeof (uint8_t));
+        if (zero)
+        {
+          memset(ov + start, 0U, (16U - start) * sizeof (uint8_t));
+        }
+      }
+    }
+  }
+}
+
+static inline void
+lengths_x4(uint8_t *dst, uint32_t *ad_len, uint32_t *msg_len)
+{
+  KRML_MAYBE_FOR4(j,
+    0U,
+    4U,
+    1U,
+    store64_le(dst + 16U * j, (uint64_t)ad_len[j] * 8ULL);
+    store64_le(dst + 16U * j + 8U, (uint64_t)msg_len[j] * 8ULL););
+}
+
+static inline uint32_t verify_tag(uint8_t *computed_tag, uint8_t *tag)
+{
+  uint8_t res = 255U;
+  KRML_MAYBE_FOR16(i,
+    0U,
+    16U,
+    1U,
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed_tag[i], tag[i]);
+    res = (uint32_t)uu____0 & (uint32_t)res;);
+  if (res == 255U)
+  {
+    return 0U;
+  }
+  return 1U;
+}
+
+typedef struct lanes_s
+{
+  uint8_t *key[4U];
+  uint8_t *nonce[4U];
+  uint8_t *data[4U];
+  uint32_t data_len[4U];
+  uint8_t *input[4U];
+  uint32_t input_len[4U];
+  uint8_t *output[4U];
+}
+lanes;
+
+static inline void lanes_of_packets(lanes *l, Hacl_AEAD_AEGIS_NI_packet *p, uint32_t n)
+{
+  for (uint32_t j = 0U; j < 4U; j++)
+  {
+    if (j < n)
+    {
+      l->key[j] = p[j].key;
+      l->nonce[j] = p[j].nonce;
+      l->data[j] = p[j].data;
+      l->data_len[j] = p[j].data_len;
+      l->input[j] = p[j].input;
+      l->input_len[j] = p[j].input_len;
+      l->output[j] = p[j].output;
+    }
+    else
+    {
+      l->key[j] = zero_block;
+      l->nonce[j] = zero_block;
+      l->data[j] = zero_block;
+      l->data_len[j] = 0U;
+      l->input[j] = zero_block;
+      l->input_len[j] = 0U;
+      l->output[j] = zero_block;
+    }
+  }
+}
+
+static inline uint32_t max_blocks(uint32_t *len, uint32_t bs)
+{
+  uint32_t r = 0U;
+  KRML_MAYBE_FOR4(j,
+    0U,
+    4U,
+    1U,
+    uint32_t b = (len[j] + bs - 1U) / bs;
+    if (b > r)
+    {
+      r = b;
+    });
+  return r;
+}
+
+/**
+Number of leading `bs`-byte blocks that are full in every packet of the group. Unused lanes
+(`j >= n`) do not constrain it; they read `zero_block` and write to `sink`, without advancing.
+*/
+static inline uint32_t
+full_blocks(
+  lanes *l,
+  uint32_t n,
+  uint32_t bs,
+  uint8_t **ip,
+  uint8_t **op,
+  uint32_t *step,
+  uint8_t *sink
+)
+{
+  uint32_t r = l->input_len[0U] / bs;
+  for (uint32_t j = 0U; j < 4U; j++)
+  {
+    if (j < n)
+    {
+      uint32_t b = l->input_len[j] / bs;
+      if (b < r)
+      {
+        r = b;
+      }
+      ip[j] = l->input[j];
+      op[j] = l->output[j];
+      step[j] = bs;
+    }
+    else
+    {
+      ip[j] = zero_block;
+      op[j] = sink;
+      step[j] = 0U;
+    }
+  }
+  return r;
+}
+
+static inline void
+update_128l_x4(
+  Lib_IntVector_Intrinsics_vec512 *st,
+  Lib_IntVector_Intrinsics_vec512 m0,
+  Lib_IntVector_Intrinsics_vec512 m1
+)
+{
+  Lib_IntVector_Intrinsics_vec512 s7 = st[7U];
+  st[7U] = Lib_IntVector_Intrinsics_vec512_aes_enc(st[6U], st[7U]);
+  st[6U] = Lib_IntVector_Intrinsics_vec512_aes_enc(st[5U], st[6U]);
+  st[5U] = Lib_IntVector_Intrinsics_vec512_aes_enc(st[4U], st[5U]);
+  st[4U] =
+    Lib_IntVector_Intrinsics_vec512_aes_enc(st[3U],
+      Lib_IntVector_Intrinsics_vec512_xor(st[4U], m1));
+  st[3U] = Lib_IntVector_Intrinsics_vec512_aes_enc(st[2U], st[3U]);
+  st[2U] = Lib_IntVector_Intrinsics_vec512_aes_enc(st[1U], st[2U]);
+  st[1U] = Lib_IntVector_Intrinsics_vec512_aes_enc(st[0U], st[1U]);
+  st[0U] =
+    Lib_IntVector_Intrinsics_vec512_aes_enc(s7,
+      Lib_IntVector_Intrinsics_vec512_xor(st[0U], m0));
+}
+
+static inline void
+update_128l_x4_masked(
+  Lib_IntVector_Intrinsics_vec512 *st,
+  Lib_IntVector_Intrinsics_vec512 m0,
+  Lib_IntVector_Intrinsics_vec512 m1,
+  uint8_t mask
+)
+{
+  if (mask == 0xffU)
+  {
+    update_128l_x4(st, m0, m1);
+    return;
+  }
+  Lib_IntVector_Intrinsics_vec512 old[8U];
+  memcpy(old, st, 8U * sizeof (Lib_IntVector_Intrinsics_vec512));
+  update_128l_x4(st, m0, m1);
+  KRML_MAYBE_FOR8(i,
+    0U,
+    8U,
+    1U,
+    st[i] = Lib_IntVector_Intrinsics_vec512_blend64(old[i], st[i], mask););
+}
+
+static inline void init_128l_x4(Lib_IntVector_Intrinsics_vec512 *st, lanes *l)
+{
+  Lib_IntVector_Intrinsics_vec512 c0 = load_const_x4(aegis_c0);
+  Lib_IntVector_Intrinsics_vec512 c1 = load_const_x4(aegis_c1);
+  Lib_IntVector_Intrinsics_vec512 k = load_x4(l->key, 0U);
+  Lib_IntVector_Intrinsics_vec512 n = load_x4(l->nonce, 0U);
+  Lib_IntVector_Intrinsics_vec512 kn = Lib_IntVector_Intrinsics_vec512_xor(k, n);
+  st[0U] = kn;
+  st[1U] = c1;
+  st[2U] = c0;
+  st[3U] = c1;
+  st[4U] = kn;
+  st[5U] = Lib_IntVector_Intrinsics_vec512_xor(k, c0);
+  st[6U] = Lib_IntVector_Intrinsics_vec512_xor(k, c1);
+  st[7U] = Lib_IntVector_Intrinsics_vec512_xor(k, c0);
+  KRML_MAYBE_FOR10(i, 0U, 10U, 1U, update_128l_x4(st, n, k););
+  uint32_t nb = max_blocks(l->data_len, 32U);
+  uint8_t pad[128U] = { 0U };
+  uint8_t *b[4U] = { 0U };
+  for (uint32_t i = 0U; i < nb; i++)
+  {
+    uint8_t mask = block_x4(b, pad, l->data, l->data_len, 32U, i);
+    update_128l_x4_masked(st, load_x4(b, 0U), load_x4(b, 16U), mask);
+  }
+}
+
+static inline void
+crypt_128l_x4(Lib_IntVector_Intrinsics_vec512 *st, lanes *l, uint32_t n, bool decrypt)
+{
+  uint8_t ob[128U] = { 0U };
+  uint8_t sink[32U] = { 0U };
+  uint8_t *ip[4U] = { 0U };
+  uint8_t *op[4U] = { 0U };
+  uint32_t step[4U] = { 0U };
+  uint32_t nf = full_blocks(l, n, 32U, ip, op, step, sink);
+  for (uint32_t i = 0U; i < nf; i++)
+  {
+    Lib_IntVector_Intrinsics_vec512 x0 = load_x4(ip, 0U);
+    Lib_IntVector_Intrinsics_vec512 x1 = load_x4(ip, 16U);
+    Lib_IntVector_Intrinsics_vec512
+    z0 =
+      Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_xor(st[6U], st[1U]),
+        Lib_IntVector_Intrinsics_vec512_and(st[2U], st[3U]));
+    Lib_IntVector_Intrinsics_vec512
+    z1 =
+      Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_xor(st[2U], st[5U]),
+        Lib_IntVector_Intrinsics_vec512_and(st[6U], st[7U]));
+    Lib_IntVector_Intrinsics_vec512 y0 = Lib_IntVector_Intrinsics_vec512_xor(x0, z0);
+    Lib_IntVector_Intrinsics_vec512 y1 = Lib_IntVector_Intrinsics_vec512_xor(x1, z1);
+    Lib_IntVector_Intrinsics_vec512_store32_le(ob, y0);
+    Lib_IntVector_Intrinsics_vec512_store32_le(ob + 64U, y1);
+    KRML_MAYBE_FOR4(j,
+      0U,
+      4U,
+      1U,
+      Lib_IntVector_Intrinsics_vec128_store32_le(op[j],
+        Lib_IntVector_Intrinsics_vec128_load32_le(ob + 16U * j));
+      Lib_IntVector_Intrinsics_vec128_store32_le(op[j] + 16U,
+        Lib_IntVector_Intrinsics_vec128_load32_le(ob + 64U + 16U * j));
+      ip[j] = ip[j] + step[j];
+      op[j] = op[j] + step[j];);
+    if (decrypt)
+    {
+      update_128l_x4(st, y0, y1);
+    }
+    else
+    {
+      update_128l_x4(st, x0, x1);
+    }
+  }
+  uint32_t nb = max_blocks(l->input_len, 32U);
+  uint8_t pad[128U] = { 0U };
+  uint8_t *b[4U] = { 0U };
+  for (uint32_t i = nf; i < nb; i++)
+  {
+    uint8_t mask = block_x4(b, pad, l->input, l->input_len, 32U, i);
+    Lib_IntVector_Intrinsics_vec512 x0 = load_x4(b, 0U);
+    Lib_IntVector_Intrinsics_vec512 x1 = load_x4(b, 16U);
+    Lib_IntVector_Intrinsics_vec512
+    z0 =
+      Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_xor(st[6U], st[1U]),
+        Lib_IntVector_Intrinsics_vec512_and(st[2U], st[3U]));
+    Lib_IntVector_Intrinsics_vec512
+    z1 =
+      Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_xor(st[2U], st[5U]),
+        Lib_IntVector_Intrinsics_vec512_and(st[6U], st[7U]));
+    Lib_IntVector_Intrinsics_vec512 y0 = Lib_IntVector_Intrinsics_vec512_xor(x0, z0);
+    Lib_IntVector_Intrinsics_vec512 y1 = Lib_IntVector_Intrinsics_vec512_xor(x1, z1);
+    Lib_IntVector_Intrinsics_vec512_store32_le(ob, y0);
+    Lib_IntVector_Intrinsics_vec512_store32_le(ob + 64U, y1);
+    store_x4(l->output, l->input_len, 2U, i, ob, decrypt);
+    if (decrypt)
+    {
+      x0 = Lib_IntVector_Intrinsics_vec512_load32_le(ob);
+      x1 = Lib_IntVector_Intrinsics_vec512_load32_le(ob + 64U);
+    }
+    update_128l_x4_masked(st, x0, x1, mask);
+  }
+}
+
+static inline void finish_128l_x4(Lib_IntVector_Intrinsics_vec512 *st, lanes *l, uint8_t *tags)
+{
+  uint8_t lens[64U] = { 0U };
+  lengths_x4(lens, l->data_len, l->input_len);
+  Lib_IntVector_Intrinsics_vec512
+  t = Lib_IntVector_Intrinsics_vec512_xor(st[2U], Lib_IntVector_Intrinsics_vec512_load32_le(lens));
+  KRML_MAYBE_FOR7(i, 0U, 7U, 1U, update_128l_x4(st, t, t););
+  Lib_IntVector_Intrinsics_vec512 acc = st[0U];
+  KRML_MAYBE_FOR6(i, 1U, 7U, 1U, acc = Lib_IntVector_Intrinsics_vec512_xor(acc, st[i]););
+  Lib_IntVector_Intrinsics_vec512_store32_le(tags, acc);
+}
+
+static KRML_NOINLINE void
+crypt_tags_128l_x4(Hacl_AEAD_AEGIS_NI_packet *p, uint32_t n, bool decrypt, uint8_t *tags)
+{
+  lanes l;
+  lanes_of_packets(&l, p, n);
+  Lib_IntVector_Intrinsics_vec512 st[8U];
+  init_128l_x4(st, &l);
+  crypt_128l_x4(st, &l, n, decrypt);
+  finish_128l_x4(st, &l, tags);
+}
+
+static void aegis128l_encrypt_x4(Hacl_AEAD_AEGIS_NI_packet *p, uint32_t n)
+{
+  uint8_t tags[64U] = { 0U };
+  crypt_tags_128l_x4(p, n, false, tags);
+  for (uint32_t j = 0U; j < n; j++)
+  {
+    memcpy(p[j].tag, tags + 16U * j, 16U * sizeof (uint8_t));
+  }
+}
+
+static uint32_t aegis128l_decrypt_x4(Hacl_AEAD_AEGIS_NI_packet *p, uint32_t n, uint32_t *res)
+{
+  uint8_t tags[64U] = { 0U };
+  crypt_tags_128l_x4(p, n, true, tags);
+  uint32_t failed = 0U;
+  for (uint32_t j = 0U; j < n; j++)
+  {
+    uint32_t r = verify_tag(tags + 16U * j, p[j].tag);
+    if (r != 0U)
+    {
+      memset(p[j].output, 0U, p[j].input_len * sizeof (uint8_t));
+    }
+    res[j] = r;
+    failed = failed + r;
+  }
+  return failed;
+}
+
+static inline void
+update_256_x4(Lib_IntVector_Intrinsics_vec512 *st, Lib_IntVector_Intrinsics_vec512 m)
+{
+  Lib_IntVector_Intrinsics_vec512 s5 = st[5U];
+  st[5U] = Lib_IntVector_Intrinsics_vec512_aes_enc(st[4U], st[5U]);
+  st[4U] = Lib_IntVector_Intrinsics_vec512_aes_enc(st[3U], st[4U]);
+  st[3U] = Lib_IntVector_Intrinsics_vec512_aes_enc(st[2U], st[3U]);
+  st[2U] = Lib_IntVector_Intrinsics_vec512_aes_enc(st[1U], st[2U]);
+  st[1U] = Lib_IntVector_Intrinsics_vec512_aes_enc(st[0U], st[1U]);
+  st[0U] =
+    Lib_IntVector_Intrinsics_vec512_aes_enc(s5,
+      Lib_IntVector_Intrinsics_vec512_xor(st[0U], m));
+}
+
+static inline void
+update_256_x4_masked(
+  Lib_IntVector_Intrinsics_vec512 *st,
+  Lib_IntVector_Intrinsics_vec512 m,
+  uint8_t mask
+)
+{
+  if (mask == 0xffU)
+  {
+    update_256_x4(st, m);
+    return;
+  }
+  Lib_IntVector_Intrinsics_vec512 old[6U];
+  memcpy(old, st, 6U * sizeof (Lib_IntVector_Intrinsics_vec512));
+  update_256_x4(st, m);
+  KRML_MAYBE_FOR6(i,
+    0U,
+    6U,
+    1U,
+    st[i] = Lib_IntVector_Intrinsics_vec512_blend64(old[i], st[i], mask););
+}
+
+static inline void init_256_x4(Lib_IntVector_Intrinsics_vec512 *st, lanes *l)
+{
+  Lib_IntVector_Intrinsics_vec512 c0 = load_const_x4(aegis_c0);
+  Lib_IntVector_Intrinsics_vec512 c1 = load_const_x4(aegis_c1);
+  Lib_IntVector_Intrinsics_vec512 k0 = load_x4(l->key, 0U);
+  Lib_IntVector_Intrinsics_vec512 k1 = load_x4(l->key, 16U);
+  Lib_IntVector_Intrinsics_vec512 n0 = load_x4(l->nonce, 0U);
+  Lib_IntVector_Intrinsics_vec512 n1 = load_x4(l->nonce, 16U);
+  Lib_IntVector_Intrinsics_vec512 k0n0 = Lib_IntVector_Intrinsics_vec512_xor(k0, n0);
+  Lib_IntVector_Intrinsics_vec512 k1n1 = Lib_IntVector_Intrinsics_vec512_xor(k1, n1);
+  st[0U] = k0n0;
+  st[1U] = k1n1;
+  st[2U] = c1;
+  st[3U] = c0;
+  st[4U] = Lib_IntVector_Intrinsics_vec512_xor(k0, c0);
+  st[5U] = Lib_IntVector_Intrinsics_vec512_xor(k1, c1);
+  KRML_MAYBE_FOR4(i,
+    0U,
+    4U,
+    1U,
+    update_256_x4(st, k0);
+    update_256_x4(st, k1);
+    update_256_x4(st, k0n0);
+    update_256_x4(st, k1n1););
+  uint32_t nb = max_blocks(l->data_len, 16U);
+  uint8_t pad[64U] = { 0U };
+  uint8_t *b[4U] = { 0U };
+  for (uint32_t i = 0U; i < nb; i++)
+  {
+    uint8_t mask = block_x4(b, pad, l->data, l->data_len, 16U, i);
+    update_256_x4_masked(st, load_x4(b, 0U), mask);
+  }
+}
+
+static inline void
+crypt_256_x4(Lib_IntVector_Intrinsics_vec512 *st, lanes *l, uint32_t n, bool decrypt)
+{
+  uint8_t ob[64U] = { 0U };
+  uint8_t sink[16U] = { 0U };
+  uint8_t *ip[4U] = { 0U };
+  uint8_t *op[4U] = { 0U };
+  uint32_t step[4U] = { 0U };
+  uint32_t nf = full_blocks(l, n, 16U, ip, op, step, sink);
+  for (uint32_t i = 0U; i < nf; i++)
+  {
+    Lib_IntVector_Intrinsics_vec512 x = load_x4(ip, 0U);
+    Lib_IntVector_Intrinsics_vec512
+    z =
+      Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_xor(st[1U],
+          Lib_IntVector_Intrinsics_vec512_xor(st[4U], st[5U])),
+        Lib_IntVector_Intrinsics_vec512_and(st[2U], st[3U]));
+    Lib_IntVector_Intrinsics_vec512 y = Lib_IntVector_Intrinsics_vec512_xor(x, z);
+    Lib_IntVector_Intrinsics_vec512_store32_le(ob, y);
+    KRML_MAYBE_FOR4(j,
+      0U,
+      4U,
+      1U,
+      Lib_IntVector_Intrinsics_vec128_store32_le(op[j],
+        Lib_IntVector_Intrinsics_vec128_load32_le(ob + 16U * j));
+      ip[j] = ip[j] + step[j];
+      op[j] = op[j] + step[j];);
+    if (decrypt)
+    {
+      update_256_x4(st, y);
+    }
+    else
+    {
+      update_256_x4(st, x);
+    }
+  }
+  uint32_t nb = max_blocks(l->input_len, 16U);
+  uint8_t pad[64U] = { 0U };
+  uint8_t *b[4U] = { 0U };
+  for (uint32_t i = nf; i < nb; i++)
+  {
+    uint8_t mask = block_x4(b, pad, l->input, l->input_len, 16U, i);
+    Lib_IntVector_Intrinsics_vec512 x = load_x4(b, 0U);
+    Lib_IntVector_Intrinsics_vec512
+    z =
+      Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_xor(st[1U],
+          Lib_IntVector_Intrinsics_vec512_xor(st[4U], st[5U])),
+        Lib_IntVector_Intrinsics_vec512_and(st[2U], st[3U]));
+    Lib_IntVector_Intrinsics_vec512_store32_le(ob, Lib_IntVector_Intrinsics_vec512_xor(x, z));
+    store_x4(l->output, l->input_len, 1U, i, ob, decrypt);
+    if (decrypt)
+    {
+      x = Lib_IntVector_Intrinsics_vec512_load32_le(ob);
+    }
+    update_256_x4_masked(st, x, mask);
+  }
+}
+
+static inline void finish_256_x4(Lib_IntVector_Intrinsics_vec512 *st, lanes *l, uint8_t *tags)
+{
+  uint8_t lens[64U] = { 0U };
+  lengths_x4(lens, l->data_len, l->input_len);
+  Lib_IntVector_Intrinsics_vec512
+  t = Lib_IntVector_Intrinsics_vec512_xor(st[3U], Lib_IntVector_Intrinsics_vec512_load32_le(lens));
+  KRML_MAYBE_FOR7(i, 0U, 7U, 1U, update_256_x4(st, t););
+  Lib_IntVector_Intrinsics_vec512 acc = st[0U];
+  KRML_MAYBE_FOR5(i, 1U, 6U, 1U, acc = Lib_IntVector_Intrinsics_vec512_xor(acc, st[i]););
+  Lib_IntVector_Intrinsics_vec512_store32_le(tags, acc);
+}
+
+static KRML_NOINLINE void
+crypt_tags_256_x4(Hacl_AEAD_AEGIS_NI_packet *p, uint32_t n, bool decrypt, uint8_t *tags)
+{
+  lanes l;
+  lanes_of_packets(&l, p, n);
+  Lib_IntVector_Intrinsics_vec512 st[6U];
+  init_256_x4(st, &l);
+  crypt_256_x4(st, &l, n, decrypt);
+  finish_256_x4(st, &l, tags);
+}
+
+static void aegis256_encrypt_x4(Hacl_AEAD_AEGIS_NI_packet *p, uint32_t n)
+{
+  uint8_t tags[64U] = { 0U };
+  crypt_tags_256_x4(p, n, false, tags);
+  for (uint32_t j = 0U; j < n; j++)
+  {
+    memcpy(p[j].tag, tags + 16U * j, 16U * sizeof (uint8_t));
+  }
+}
+
+static uint32_t aegis256_decrypt_x4(Hacl_AEAD_AEGIS_NI_packet *p, uint32_t n, uint32_t *res)
+{
+  uint8_t tags[64U] = { 0U };
+  crypt_tags_256_x4(p, n, true, tags);
+  uint32_t failed = 0U;
+  for (uint32_t j = 0U; j < n; j++)
+  {
+    uint32_t r = verify_tag(tags + 16U * j, p[j].tag);
+    if (r != 0U)
+    {
+      memset(p[j].output, 0U, p[j].input_len * sizeof (uint8_t));
+    }
+    res[j] = r;
+    failed = failed + r;
+  }
+  return failed;
+}
+
+void
+Hacl_AEAD_AEGIS_Simd512_aegis128l_encrypt_batch(
+  uint32_t len,
+  Hacl_AEAD_AEGIS_NI_packet *packets
+)
+{
+  for (uint32_t i = 0U; i < len; i += 4U)
+  {
+    uint32_t n = len - i < 4U ? len - i : 4U;
+    if (n == 1U)
+    {
+      Hacl_AEAD_AEGIS_NI_packet p = packets[i];
+      Hacl_AEAD_AEGIS_NI_aegis128l_encrypt(p.output,
+        p.tag,
+        p.input,
+        p.input_len,
+        p.data,
+        p.data_len,
+        p.key,
+        p.nonce);
+    }
+    else
+    {
+      aegis128l_encrypt_x4(packets + i, n);
+    }
+  }
+}
+
+uint32_t
+Hacl_AEAD_AEGIS_Simd512_aegis128l_decrypt_batch(
+  uint32_t len,
+  Hacl_AEAD_AEGIS_NI_packet *packets,
+  uint32_t *res
+)
+{
+  uint32_t failed = 0U;
+  for (uint32_t i = 0U; i < len; i += 4U)
+  {
+    uint32_t n = len - i < 4U ? len - i : 4U;
+    if (n == 1U)
+    {
+      Hacl_AEAD_AEGIS_NI_packet p = packets[i];
+      uint32_t
+      r =
+        Hacl_AEAD_AEGIS_NI_aegis128l_decrypt(p.output,
+          p.input,
+          p.input_len,
+          p.data,
+          p.data_len,
+          p.key,
+          p.nonce,
+          p.tag);
+      res[i] = r;
+      failed = failed + r;
+    }
+    else
+    {
+      failed = failed + aegis128l_decrypt_x4(packets + i, n, res + i);
+    }
+  }
+  return failed;
+}
+
+void
+Hacl_AEAD_AEGIS_Simd512_aegis256_encrypt_batch(
+  uint32_t len,
+  Hacl_AEAD_AEGIS_NI_packet *packets
+)
+{
+  for (uint32_t i = 0U; i < len; i += 4U)
+  {
+    uint32_t n = len - i < 4U ? len - i : 4U;
+    if (n == 1U)
+    {
+      Hacl_AEAD_AEGIS_NI_packet p = packets[i];
+      Hacl_AEAD_AEGIS_NI_aegis256_encrypt(p.output,
+        p.tag,
+        p.input,
+        p.input_len,
+        p.data,
+        p.data_len,
+        p.key,
+        p.nonce);
+    }
+    else
+    {
+      aegis256_encrypt_x4(packets + i, n);
+    }
+  }
+}
+
+uint32_t
+Hacl_AEAD_AEGIS_Simd512_aegis256_decrypt_batch(
+  uint32_t len,
+  Hacl_AEAD_AEGIS_NI_packet *packets,
+  uint32_t *res
+)
+{
+  uint32_t failed = 0U;
+  for (uint32_t i = 0U; i < len; i += 4U)
+  {
+    uint32_t n = len - i < 4U ? len - i : 4U;
+    if (n == 1U)
+    {
+      Hacl_AEAD_AEGIS_NI_packet p = packets[i];
+      uint32_t
+      r =
+        Hacl_AEAD_AEGIS_NI_aegis256_decrypt(p.output,
+          p.input,
+          p.input_len,
+          p.data,
+          p.data_len,
+          p.key,
+          p.nonce,
+          p.tag);
+      res[i] = r;
+      failed = failed + r;
+    }
+    else
+    {
+      failed = failed + aegis256_decrypt_x4(packets + i, n, res + i);
+    }
+  }
+  return failed;
+}
+
@@ -0,0 +1,477 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_AEAD_AES_GCM_SIV_NI.h"
+
+#include "internal/Hacl_Krmllib.h"
+#include "libintvector.h"
+
+static inline Lib_IntVector_Intrinsics_vec128
+aes_enc_block(uint32_t nr, Lib_IntVector_Intrinsics_vec128 *k, Lib_IntVector_Intrinsics_vec128 b)
+{
+  Lib_IntVector_Intrinsics_vec128 st = Lib_IntVector_Intrinsics_vec128_xor(b, k[0U]);
+  for (uint32_t i = 1U; i < nr; i++)
+  {
+    st = Lib_IntVector_Intrinsics_ni_aes_enc(st, k[i]);
+  }
+  return Lib_IntVector_Intrinsics_ni_aes_enc_last(st, k[nr]);
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+key_expansion_step(Lib_IntVector_Intrinsics_vec128 k, Lib_IntVector_Intrinsics_vec128 t)
+{
+  Lib_IntVector_Intrinsics_vec128
+  k1 = Lib_IntVector_Intrinsics_vec128_xor(k, Lib_IntVector_Intrinsics_vec128_shift_left(k, 32U));
+  Lib_IntVector_Intrinsics_vec128
+  k2 = Lib_IntVector_Intrinsics_vec128_xor(k1, Lib_IntVector_Intrinsics_vec128_shift_left(k1, 32U));
+  Lib_IntVector_Intrinsics_vec128
+  k3 = Lib_IntVector_Intrinsics_vec128_xor(k2, Lib_IntVector_Intrinsics_vec128_shift_left(k2, 32U));
+  return Lib_IntVector_Intrinsics_vec128_xor(k3, t);
+}
+
+/* `a` is the output of AESKEYGENASSIST: the rounds that use the round constant take its last
+   word, the odd rounds of the AES-256 schedule take its third word. */
+static inline Lib_IntVector_Intrinsics_vec128
+key_expansion_hi(Lib_IntVector_Intrinsics_vec128 k, Lib_IntVector_Intrinsics_vec128 a)
+{
+  return key_expansion_step(k, Lib_IntVector_Intrinsics_vec128_shuffle32(a, 3U, 3U, 3U, 3U));
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+key_expansion_lo(Lib_IntVector_Intrinsics_vec128 k, Lib_IntVector_Intrinsics_vec128 a)
+{
+  return key_expansion_step(k, Lib_IntVector_Intrinsics_vec128_shuffle32(a, 2U, 2U, 2U, 2U));
+}
+
+static void expand_key128(Lib_IntVector_Intrinsics_vec128 *k, uint8_t *key)
+{
+  k[0U] = Lib_IntVector_Intrinsics_vec128_load32_le(key);
+  k[1U] = key_expansion_hi(k[0U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[0U], 0x01U));
+  k[2U] = key_expansion_hi(k[1U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[1U], 0x02U));
+  k[3U] = key_expansion_hi(k[2U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[2U], 0x04U));
+  k[4U] = key_expansion_hi(k[3U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[3U], 0x08U));
+  k[5U] = key_expansion_hi(k[4U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[4U], 0x10U));
+  k[6U] = key_expansion_hi(k[5U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[5U], 0x20U));
+  k[7U] = key_expansion_hi(k[6U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[6U], 0x40U));
+  k[8U] = key_expansion_hi(k[7U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[7U], 0x80U));
+  k[9U] = key_expansion_hi(k[8U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[8U], 0x1bU));
+  k[10U] = key_expansion_hi(k[9U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[9U], 0x36U));
+}
+
+static void expand_key256(Lib_IntVector_Intrinsics_vec128 *k, uint8_t *key)
+{
+  k[0U] = Lib_IntVector_Intrinsics_vec128_load32_le(key);
+  k[1U] = Lib_IntVector_Intrinsics_vec128_load32_le(key + 16U);
+  k[2U] = key_expansion_hi(k[0U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[1U], 0x01U));
+  k[3U] = key_expansion_lo(k[1U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[2U], 0U));
+  k[4U] = key_expansion_hi(k[2U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[3U], 0x02U));
+  k[5U] = key_expansion_lo(k[3U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[4U], 0U));
+  k[6U] = key_expansion_hi(k[4U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[5U], 0x04U));
+  k[7U] = key_expansion_lo(k[5U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[6U], 0U));
+  k[8U] = key_expansion_hi(k[6U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[7U], 0x08U));
+  k[9U] = key_expansion_lo(k[7U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[8U], 0U));
+  k[10U] = key_expansion_hi(k[8U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[9U], 0x10U));
+  k[11U] = key_expansion_lo(k[9U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[10U], 0U));
+  k[12U] = key_expansion_hi(k[10U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[11U], 0x20U));
+  k[13U] = key_expansion_lo(k[11U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[12U], 0U));
+  k[14U] = key_expansion_hi(k[12U], Lib_IntVector_Intrinsics_ni_aes_keygen_assist(k[13U], 0x40U));
+}
+
+/* Carry-less 128x128 product, accumulated without reduction. The middle term is kept separate
+   so that eight products can share a single fold and reduction. */
+static inline void
+clmul_acc(
+  Lib_IntVector_Intrinsics_vec128 a,
+  Lib_IntVector_Intrinsics_vec128 b,
+  Lib_IntVector_Intrinsics_vec128 *lo,
+  Lib_IntVector_Intrinsics_vec128 *hi,
+  Lib_IntVector_Intrinsics_vec128 *mid
+)
+{
+  Lib_IntVector_Intrinsics_vec128 l = Lib_IntVector_Intrinsics_ni_clmul(a, b, 0x00U);
+  Lib_IntVector_Intrinsics_vec128 h = Lib_IntVector_Intrinsics_ni_clmul(a, b, 0x11U);
+  Lib_IntVector_Intrinsics_vec128 m0 = Lib_IntVector_Intrinsics_ni_clmul(a, b, 0x01U);
+  Lib_IntVector_Intrinsics_vec128 m1 = Lib_IntVector_Intrinsics_ni_clmul(a, b, 0x10U);
+  lo[0U] = Lib_IntVector_Intrinsics_vec128_xor(lo[0U], l);
+  hi[0U] = Lib_IntVector_Intrinsics_vec128_xor(hi[0U], h);
+  Lib_IntVector_Intrinsics_vec128 m = Lib_IntVector_Intrinsics_vec128_xor(m0, m1);
+  mid[0U] = Lib_IntVector_Intrinsics_vec128_xor(mid[0U], m);
+}
+
+/* Montgomery reduction by x^128 modulo x^128 + x^127 + x^126 + x^121 + 1, i.e. the POLYVAL
+   dot product of RFC 8452 Section 3. */
+static inline Lib_IntVector_Intrinsics_vec128
+gf_reduce(
+  Lib_IntVector_Intrinsics_vec128 lo,
+  Lib_IntVector_Intrinsics_vec128 hi,
+  Lib_IntVector_Intrinsics_vec128 mid
+)
+{
+  Lib_IntVector_Intrinsics_vec128
+  poly = Lib_IntVector_Intrinsics_vec128_load64s(1ULL, 0xc200000000000000ULL);
+  Lib_IntVector_Intrinsics_vec128 ml = Lib_IntVector_Intrinsics_vec128_shift_left(mid, 64U);
+  Lib_IntVector_Intrinsics_vec128 mh = Lib_IntVector_Intrinsics_vec128_shift_right(mid, 64U);
+  Lib_IntVector_Intrinsics_vec128 l = Lib_IntVector_Intrinsics_vec128_xor(lo, ml);
+  Lib_IntVector_Intrinsics_vec128 h = Lib_IntVector_Intrinsics_vec128_xor(hi, mh);
+  Lib_IntVector_Intrinsics_vec128 r0 = Lib_IntVector_Intrinsics_vec128_rotate_right_lanes32(l, 2U);
+  Lib_IntVector_Intrinsics_vec128 p0 = Lib_IntVector_Intrinsics_ni_clmul(l, poly, 0x10U);
+  Lib_IntVector_Intrinsics_vec128 t0 = Lib_IntVector_Intrinsics_vec128_xor(r0, p0);
+  Lib_IntVector_Intrinsics_vec128 r1 = Lib_IntVector_Intrinsics_vec128_rotate_right_lanes32(t0, 2U);
+  Lib_IntVector_Intrinsics_vec128 p1 = Lib_IntVector_Intrinsics_ni_clmul(t0, poly, 0x10U);
+  Lib_IntVector_Intrinsics_vec128 t1 = Lib_IntVector_Intrinsics_vec128_xor(r1, p1);
+  return Lib_IntVector_Intrinsics_vec128_xor(h, t1);
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+gf_mul(Lib_IntVector_Intrinsics_vec128 a, Lib_IntVector_Intrinsics_vec128 b)
+{
+  Lib_IntVector_Intrinsics_vec128 lo = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 hi = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 mid = Lib_IntVector_Intrinsics_vec128_zero;
+  clmul_acc(a, b, &lo, &hi, &mid);
+  return gf_reduce(lo, hi, mid);
+}
+
+/* h[i] = H^(i+1) in the Montgomery domain, so that eight blocks can be absorbed at once as
+   (acc + b0) * h[7] + b1 * h[6] + ... + b7 * h[0]. */
+static void polyval_init(Lib_IntVector_Intrinsics_vec128 *h, uint8_t *auth_key)
+{
+  h[0U] = Lib_IntVector_Intrinsics_vec128_load32_le(auth_key);
+  for (uint32_t i = 1U; i < 8U; i++)
+  {
+    h[i] = gf_mul(h[i - 1U], h[0U]);
+  }
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+polyval8(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  Lib_IntVector_Intrinsics_vec128 *b
+)
+{
+  Lib_IntVector_Intrinsics_vec128 lo = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 hi = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 mid = Lib_IntVector_Intrinsics_vec128_zero;
+  clmul_acc(Lib_IntVector_Intrinsics_vec128_xor(acc, b[0U]), h[7U], &lo, &hi, &mid);
+  KRML_MAYBE_FOR7(i, 1U, 8U, 1U, clmul_acc(b[i], h[7U - i], &lo, &hi, &mid););
+  return gf_reduce(lo, hi, mid);
+}
+
+static Lib_IntVector_Intrinsics_vec128
+polyval_update(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint8_t *text,
+  uint32_t len
+)
+{
+  Lib_IntVector_Intrinsics_vec128 r = acc;
+  uint32_t nb = len / 128U;
+  for (uint32_t i0 = 0U; i0 < nb; i0++)
+  {
+    uint8_t *ib = text + i0 * 128U;
+    Lib_IntVector_Intrinsics_vec128 b[8U];
+    KRML_MAYBE_FOR8(i,
+      0U,
+      8U,
+      1U,
+      b[i] = Lib_IntVector_Intrinsics_vec128_load32_le(ib + i * 16U););
+    r = polyval8(h, r, b);
+  }
+  uint32_t rem = len % 128U;
+  uint8_t *ib = text + nb * 128U;
+  for (uint32_t i = 0U; i < rem / 16U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128 b = Lib_IntVector_Intrinsics_vec128_load32_le(ib + i * 16U);
+    r = gf_mul(Lib_IntVector_Intrinsics_vec128_xor(r, b), h[0U]);
+  }
+  uint32_t last = rem % 16U;
+  if (last > 0U)
+  {
+    uint8_t tmp[16U] = { 0U };
+    memcpy(tmp, ib + rem - last, last * sizeof (uint8_t));
+    Lib_IntVector_Intrinsics_vec128 b = Lib_IntVector_Intrinsics_vec128_load32_le(tmp);
+    r = gf_mul(Lib_IntVector_Intrinsics_vec128_xor(r, b), h[0U]);
+  }
+  return r;
+}
+
+/* RFC 8452 Section 4: the message authentication key is keys[0..16] and the message encryption
+   key is keys[16..32] (AES-128) or keys[16..48] (AES-256). */
+static void
+derive_keys(uint32_t nr, Lib_IntVector_Intrinsics_vec128 *k, uint8_t *nonce, uint8_t *keys)
+{
+  uint32_t nb = nr == 10U ? 4U : 6U;
+  uint8_t blk[16U] = { 0U };
+  memcpy(blk + 4U, nonce, 12U * sizeof (uint8_t));
+  Lib_IntVector_Intrinsics_vec128 st[6U];
+  for (uint32_t i = 0U; i < nb; i++)
+  {
+    store32_le(blk, i);
+    Lib_IntVector_Intrinsics_vec128 b = Lib_IntVector_Intrinsics_vec128_load32_le(blk);
+    st[i] = Lib_IntVector_Intrinsics_vec128_xor(b, k[0U]);
+  }
+  for (uint32_t j = 1U; j < nr; j++)
+  {
+    for (uint32_t i = 0U; i < nb; i++)
+    {
+      st[i] = Lib_IntVector_Intrinsics_ni_aes_enc(st[i], k[j]);
+    }
+  }
+  for (uint32_t i = 0U; i < nb; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128_store32_le(blk,
+      Lib_IntVector_Intrinsics_ni_aes_enc_last(st[i], k[nr]));
+    memcpy(keys + i * 8U, blk, 8U * sizeof (uint8_t));
+  }
+}
+
+static void
+setup(
+  uint32_t nr,
+  uint8_t *rk,
+  uint8_t *nonce,
+  Lib_IntVector_Intrinsics_vec128 *ek,
+  Lib_IntVector_Intrinsics_vec128 *h
+)
+{
+  KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 k[15U] KRML_POST_ALIGN(16) = { 0U };
+  for (uint32_t i = 0U; i <= nr; i++)
+  {
+    k[i] = Lib_IntVector_Intrinsics_vec128_load32_le(rk + i * 16U);
+  }
+  uint8_t keys[48U] = { 0U };
+  derive_keys(nr, k, nonce, keys);
+  if (nr == 10U)
+  {
+    expand_key128(ek, keys + 16U);
+  }
+  else
+  {
+    expand_key256(ek, keys + 16U);
+  }
+  polyval_init(h, keys);
+}
+
+static void
+compute_tag(
+  uint32_t nr,
+  Lib_IntVector_Intrinsics_vec128 *ek,
+  Lib_IntVector_Intrinsics_vec128 *h,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t data_len,
+  uint32_t len,
+  uint8_t *nonce,
+  uint8_t *tag
+)
+{
+  Lib_IntVector_Intrinsics_vec128
+  lb = Lib_IntVector_Intrinsics_vec128_load64s((uint64_t)data_len * 8ULL, (uint64_t)len * 8ULL);
+  Lib_IntVector_Intrinsics_vec128 s = gf_mul(Lib_IntVector_Intrinsics_vec128_xor(acc, lb), h[0U]);
+  uint8_t tmp[16U] = { 0U };
+  memcpy(tmp, nonce, 12U * sizeof (uint8_t));
+  Lib_IntVector_Intrinsics_vec128_store32_le(tmp,
+    Lib_IntVector_Intrinsics_vec128_xor(s, Lib_IntVector_Intrinsics_vec128_load32_le(tmp)));
+  tmp[15U] = (uint32_t)tmp[15U] & 0x7fU;
+  Lib_IntVector_Intrinsics_vec128_store32_le(tag,
+    aes_enc_block(nr, ek, Lib_IntVector_Intrinsics_vec128_load32_le(tmp)));
+}
+
+/* The initial counter block is the tag with its most significant bit set; only its first 32 bits
+   (little-endian) are incremented, modulo 2^32. */
+static inline Lib_IntVector_Intrinsics_vec128 counter_block(uint8_t *tag)
+{
+  uint8_t tmp[16U] = { 0U };
+  memcpy(tmp, tag, 16U * sizeof (uint8_t));
+  tmp[15U] = (uint32_t)tmp[15U] | 0x80U;
+  return Lib_IntVector_Intrinsics_vec128_load32_le(tmp);
+}
+
+static inline void
+keystream8(
+  uint32_t nr,
+  Lib_IntVector_Intrinsics_vec128 *k,
+  Lib_IntVector_Intrinsics_vec128 cb,
+  Lib_IntVector_Intrinsics_vec128 *st
+)
+{
+  KRML_MAYBE_FOR8(i,
+    0U,
+    8U,
+    1U,
+    Lib_IntVector_Intrinsics_vec128 di = Lib_IntVector_Intrinsics_vec128_load32s(i, 0U, 0U, 0U);
+    Lib_IntVector_Intrinsics_vec128 ci = Lib_IntVector_Intrinsics_vec128_add32(cb, di);
+    st[i] = Lib_IntVector_Intrinsics_vec128_xor(ci, k[0U]););
+  for (uint32_t j = 1U; j < nr; j++)
+  {
+    KRML_MAYBE_FOR8(i, 0U, 8U, 1U, st[i] = Lib_IntVector_Intrinsics_ni_aes_enc(st[i], k[j]););
+  }
+  KRML_MAYBE_FOR8(i, 0U, 8U, 1U, st[i] = Lib_IntVector_Intrinsics_ni_aes_enc_last(st[i], k[nr]););
+}
+
+/* Less than 128 bytes of CTR mode, one block at a time. */
+static void
+ctr_tail(
+  uint32_t nr,
+  Lib_IntVector_Intrinsics_vec128 *k,
+  Lib_IntVector_Intrinsics_vec128 cb,
+  uint8_t *out,
+  uint8_t *text,
+  uint32_t len
+)
+{
+  Lib_IntVector_Intrinsics_vec128 one = Lib_IntVector_Intrinsics_vec128_load32s(1U, 0U, 0U, 0U);
+  Lib_IntVector_Intrinsics_vec128 c = cb;
+  for (uint32_t i = 0U; i < len / 16U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128 ks = aes_enc_block(nr, k, c);
+    c = Lib_IntVector_Intrinsics_vec128_add32(c, one);
+    Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_load32_le(text + i * 16U);
+    Lib_IntVector_Intrinsics_vec128_store32_le(out + i * 16U,
+      Lib_IntVector_Intrinsics_vec128_xor(x, ks));
+  }
+  uint32_t last = len % 16U;
+  if (last > 0U)
+  {
+    uint8_t tmp[16U] = { 0U };
+    memcpy(tmp, text + len - last, last * sizeof (uint8_t));
+    Lib_IntVector_Intrinsics_vec128 ks = aes_enc_block(nr, k, c);
+    Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_load32_le(tmp);
+    Lib_IntVector_Intrinsics_vec128_store32_le(tmp, Lib_IntVector_Intrinsics_vec128_xor(x, ks));
+    memcpy(out + len - last, tmp, last * sizeof (uint8_t));
+  }
+}
+
+static inline uint32_t verify_tag(uint8_t *computed_tag, uint8_t *tag)
+{
+  uint8_t res = 255U;
+  KRML_MAYBE_FOR16(i,
+    0U,
+    16U,
+    1U,
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed_tag[i], tag[i]);
+    res = (uint32_t)uu____0 & (uint32_t)res;);
+  if (res == 255U)
+  {
+    return 0U;
+  }
+  return 1U;
+}
+
+void
+Hacl_AEAD_AES_GCM_SIV_NI_encrypt(
+  uint32_t nr,
+  uint8_t *rk,
+  uint8_t *output,
+  uint8_t *tag,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *nonce
+)
+{
+  KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 ek[15U] KRML_POST_ALIGN(16) = { 0U };
+  KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 h[8U] KRML_POST_ALIGN(16) = { 0U };
+  setup(nr, rk, nonce, ek, h);
+  Lib_IntVector_Intrinsics_vec128
+  acc0 = polyval_update(h, Lib_IntVector_Intrinsics_vec128_zero, data, data_len);
+  Lib_IntVector_Intrinsics_vec128 acc = polyval_update(h, acc0, input, input_len);
+  uint8_t t[16U] = { 0U };
+  compute_tag(nr, ek, h, acc, data_len, input_len, nonce, t);
+  Lib_IntVector_Intrinsics_vec128 cb = counter_block(t);
+  Lib_IntVector_Intrinsics_vec128 eight = Lib_IntVector_Intrinsics_vec128_load32s(8U, 0U, 0U, 0U);
+  uint32_t nb = input_len / 128U;
+  for (uint32_t i0 = 0U; i0 < nb; i0++)
+  {
+    uint8_t *ib = input + i0 * 128U;
+    uint8_t *ob = output + i0 * 128U;
+    Lib_IntVector_Intrinsics_vec128 st[8U];
+    keystream8(nr, ek, cb, st);
+    cb = Lib_IntVector_Intrinsics_vec128_add32(cb, eight);
+    KRML_MAYBE_FOR8(i,
+      0U,
+      8U,
+      1U,
+      Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_load32_le(ib + i * 16U);
+      Lib_IntVector_Intrinsics_vec128_store32_le(ob + i * 16U,
+        Lib_IntVector_Intrinsics_vec128_xor(x, st[i])););
+  }
+  ctr_tail(nr, ek, cb, output + nb * 128U, input + nb * 128U, input_len % 128U);
+  memcpy(tag, t, 16U * sizeof (uint8_t));
+}
+
+uint32_t
+Hacl_AEAD_AES_GCM_SIV_NI_decrypt(
+  uint32_t nr,
+  uint8_t *rk,
+  uint8_t *output,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *nonce,
+  uint8_t *tag
+)
+{
+  KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 ek[15U] KRML_POST_ALIGN(16) = { 0U };
+  KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 h[8U] KRML_POST_ALIGN(16) = { 0U };
+  setup(nr, rk, nonce, ek, h);
+  Lib_IntVector_Intrinsics_vec128
+  acc = polyval_update(h, Lib_IntVector_Intrinsics_vec128_zero, data, data_len);
+  Lib_IntVector_Intrinsics_vec128 cb = counter_block(tag);
+  Lib_IntVector_Intrinsics_vec128 eight = Lib_IntVector_Intrinsics_vec128_load32s(8U, 0U, 0U, 0U);
+  /* Decryption and authentication of the recovered plaintext share a single pass. */
+  uint32_t nb = input_len / 128U;
+  for (uint32_t i0 = 0U; i0 < nb; i0++)
+  {
+    uint8_t *ib = input + i0 * 128U;
+    uint8_t *ob = output + i0 * 128U;
+    Lib_IntVector_Intrinsics_vec128 st[8U];
+    keystream8(nr, ek, cb, st);
+    cb = Lib_IntVector_Intrinsics_vec128_add32(cb, eight);
+    KRML_MAYBE_FOR8(i,
+      0U,
+      8U,
+      1U,
+      Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_load32_le(ib + i * 16U);
+      st[i] = Lib_IntVector_Intrinsics_vec128_xor(x, st[i]);
+      Lib_IntVector_Intrinsics_vec128_store32_le(ob + i * 16U, st[i]););
+    acc = polyval8(h, acc, st);
+  }
+  uint32_t rem = input_len % 128U;
+  ctr_tail(nr, ek, cb, output + nb * 128U, input + nb * 128U, rem);
+  acc = polyval_update(h, acc, output + nb * 128U, rem);
+  uint8_t computed_tag[16U] = { 0U };
+  compute_tag(nr, ek, h, acc, data_len, input_len, nonce, computed_tag);
+  uint32_t r = verify_tag(computed_tag, tag);
+  if (r != 0U)
+  {
+    memset(output, 0U, input_len * sizeof (uint8_t));
+  }
+  return r;
+}
+
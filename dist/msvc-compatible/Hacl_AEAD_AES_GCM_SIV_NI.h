@@ -0,0 +1,113 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_AEAD_AES_GCM_SIV_NI_H
+#define __Hacl_AEAD_AES_GCM_SIV_NI_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+/**
+Encrypt a message `input` using AES-GCM-SIV (RFC 8452).
+
+The key-generating key is passed already expanded: `rk` holds the `nr + 1` round keys of
+AES-128 (`nr` = 10, AES-128-GCM-SIV) or AES-256 (`nr` = 14, AES-256-GCM-SIV), in the layout
+produced by the Vale `aes128_key_expansion` and `aes256_key_expansion` routines.
+The per-message authentication and encryption keys are derived from it and the nonce.
+Note: Encryption and decryption can be executed in-place, i.e., `output` and `input` can point to the same memory.
+
+@param nr Number of AES rounds of the key-generating key, 10 or 14.
+@param rk Pointer to `16 * (nr + 1)` bytes of memory where the expanded key-generating key is read from.
+@param output Pointer to `input_len` bytes of memory where the ciphertext is written to.
+@param tag Pointer to 16 bytes of memory where the mac is written to.
+@param input Pointer to `input_len` bytes of memory where the message is read from.
+@param input_len Length of the message.
+@param data Pointer to `data_len` bytes of memory where the associated data is read from.
+@param data_len Length of the associated data.
+@param nonce Pointer to 12 bytes of memory where the AEAD nonce is read from.
+
+This function must only be called on CPUs supporting AES-NI and PCLMULQDQ.
+*/
+void
+Hacl_AEAD_AES_GCM_SIV_NI_encrypt(
+  uint32_t nr,
+  uint8_t *rk,
+  uint8_t *output,
+  uint8_t *tag,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *nonce
+);
+
+/**
+Decrypt a ciphertext `input` using AES-GCM-SIV (RFC 8452).
+
+The arguments `nr`, `rk`, `nonce`, `data`, and `data_len` are same in encryption/decryption.
+Note: Encryption and decryption can be executed in-place, i.e., `output` and `input` can point to the same memory.
+
+If decryption succeeds, the resulting plaintext is stored in `output` and the function returns the success code 0.
+If decryption fails, the array `output` is zeroed and the function returns the error code 1.
+
+@param nr Number of AES rounds of the key-generating key, 10 or 14.
+@param rk Pointer to `16 * (nr + 1)` bytes of memory where the expanded key-generating key is read from.
+@param output Pointer to `input_len` bytes of memory where the message is written to.
+@param input Pointer to `input_len` bytes of memory where the ciphertext is read from.
+@param input_len Length of the ciphertext.
+@param data Pointer to `data_len` bytes of memory where the associated data is read from.
+@param data_len Length of the associated data.
+@param nonce Pointer to 12 bytes of memory where the AEAD nonce is read from.
+@param tag Pointer to 16 bytes of memory where the mac is read from.
+
+@returns 0 on succeess; 1 on failure.
+
+This function must only be called on CPUs supporting AES-NI and PCLMULQDQ.
+*/
+uint32_t
+Hacl_AEAD_AES_GCM_SIV_NI_decrypt(
+  uint32_t nr,
+  uint8_t *rk,
+  uint8_t *output,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *nonce,
+  uint8_t *tag
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_AEAD_AES_GCM_SIV_NI_H_DEFINED
+#endif
@@ -637,3 +637,49 @@ Hacl_AEAD_Chacha20Poly1305_decrypt(
   return 1U;
 }
 
+void
+Hacl_AEAD_Chacha20Poly1305_encrypt_batch(
+  uint32_t len,
+  Hacl_AEAD_Chacha20Poly1305_packet *packets
+)
+{
+  for (uint32_t i = 0U; i < len; i++)
+  {
+    Hacl_AEAD_Chacha20Poly1305_packet p = packets[i];
+    Hacl_AEAD_Chacha20Poly1305_encrypt(p.output,
+      p.tag,
+      p.input,
+      p.input_len,
+      p.data,
+      p.data_len,
+      p.key,
+      p.nonce);
+  }
+}
+
+uint32_t
+Hacl_AEAD_Chacha20Poly1305_decrypt_batch(
+  uint32_t len,
+  Hacl_AEAD_Chacha20Poly1305_packet *packets,
+  uint32_t *res
+)
+{
+  uint32_t failed = 0U;
+  for (uint32_t i = 0U; i < len; i++)
+  {
+    Hacl_AEAD_Chacha20Poly1305_packet p = packets[i];
+    uint32_t
+    r =
+      Hacl_AEAD_Chacha20Poly1305_decrypt(p.output,
+        p.input,
+        p.input_len,
+        p.data,
+        p.data_len,
+        p.key,
+        p.nonce,
+        p.tag);
+    res[i] = r;
+    failed = failed + r;
+  }
+  return failed;
+}
@@ -37,6 +37,26 @@ extern "C" {
 
 #include "Hacl_Chacha20.h"
 
+/**
+One independent ChaCha20-Poly1305 job of a batch call.
+
+For encryption, `input` is the message, `output` receives the ciphertext and `tag` receives the mac.
+For decryption, `input` is the ciphertext, `output` receives the message and `tag` holds the expected mac.
+The `key` (32 bytes), `nonce` (12 bytes), `data` and `data_len` fields have the same meaning as for the single-packet functions.
+*/
+typedef struct Hacl_AEAD_Chacha20Poly1305_packet_s
+{
+  uint8_t *key;
+  uint8_t *nonce;
+  uint8_t *data;
+  uint32_t data_len;
+  uint8_t *input;
+  uint32_t input_len;
+  uint8_t *output;
+  uint8_t *tag;
+}
+Hacl_AEAD_Chacha20Poly1305_packet;
+
 /**
 Encrypt a message `input` with key `key`.
 
@@ -96,6 +116,37 @@ Hacl_AEAD_Chacha20Poly1305_decrypt(
   uint8_t *tag
 );
 
+/**
+Encrypt `len` independent packets, one after the other.
+
+@param len Number of packets.
+@param packets Pointer to `len` packet descriptors.
+*/
+void
+Hacl_AEAD_Chacha20Poly1305_encrypt_batch(
+  uint32_t len,
+  Hacl_AEAD_Chacha20Poly1305_packet *packets
+);
+
+/**
+Decrypt `len` independent packets, one after the other.
+
+Each packet is authenticated on its own: `res[i]` receives the result of decrypting `packets[i]`
+(0 on success, 1 on failure, in which case `packets[i].output` remains unchanged).
+
+@param len Number of packets.
+@param packets Pointer to `len` packet descriptors.
+@param res Pointer to `len` result codes.
+
+@returns The number of packets that failed to authenticate.
+*/
+uint32_t
+Hacl_AEAD_Chacha20Poly1305_decrypt_batch(
+  uint32_t len,
+  Hacl_AEAD_Chacha20Poly1305_packet *packets,
+  uint32_t *res
+);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -0,0 +1,68 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_AES_CTR_NI_H
+#define __Hacl_AES_CTR_NI_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+/**
+AES-CTR keystream XOR over an already expanded key, using AES-NI.
+
+@param nr Number of AES rounds: 10 for AES-128 (176-byte `rk`), 14 for AES-256 (240-byte `rk`).
+@param rk Round keys, as produced by the Vale `aes128_key_expansion`/`aes256_key_expansion`.
+@param len Number of bytes to process.
+@param out Pointer to `len` bytes of memory where the result is written to.
+@param text Pointer to `len` bytes of memory where the input is read from.
+@param iv Pointer to 16 bytes of memory holding the initial counter block.
+@param ctr Number of blocks to skip: the first block uses `iv + ctr`.
+
+The counter block is incremented as a 128-bit big-endian integer (NIST SP 800-38A).
+This function must only be called on CPUs supporting AES-NI.
+*/
+void
+Hacl_AES_CTR_NI_aes_ctr(
+  uint32_t nr,
+  uint8_t *rk,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint8_t *iv,
+  uint64_t ctr
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_AES_CTR_NI_H_DEFINED
+#endif
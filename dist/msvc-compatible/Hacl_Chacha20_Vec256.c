@@ -1199,3 +1199,69 @@ Hacl_Chacha20_Vec256_chacha20_decrypt_256(
   }
 }
 
+
+/**
+Derive `len` independent HChaCha20 subkeys, eight at a time.
+
+@param len Number of subkeys.
+@param out Pointer to `32 * len` bytes of memory where the subkeys are written to.
+@param key Pointer to `32 * len` bytes of memory where the keys are read from.
+@param n Pointer to `16 * len` bytes of memory where the nonces are read from.
+*/
+void Hacl_Chacha20_Vec256_hchacha20_256(uint32_t len, uint8_t *out, uint8_t *key, uint8_t *n)
+{
+  for (uint32_t i0 = 0U; i0 < len; i0 += 8U)
+  {
+    uint32_t lanes = len - i0 < 8U ? len - i0 : 8U;
+    uint32_t st[128U] = { 0U };
+    for (uint32_t i = 0U; i < lanes; i++)
+    {
+      uint32_t *os = st + 16U * i;
+      KRML_MAYBE_FOR4(j, 0U, 4U, 1U, os[j] = Hacl_Impl_Chacha20_Vec_chacha20_constants[j];);
+      KRML_MAYBE_FOR8(j, 0U, 8U, 1U, os[4U + j] = load32_le(key + 32U * (i0 + i) + j * 4U););
+      KRML_MAYBE_FOR4(j, 0U, 4U, 1U, os[12U + j] = load32_le(n + 16U * (i0 + i) + j * 4U););
+    }
+    KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 k[16U] KRML_POST_ALIGN(32) = { 0U };
+    KRML_MAYBE_FOR16(j,
+      0U,
+      16U,
+      1U,
+      k[j] =
+        Lib_IntVector_Intrinsics_vec256_load32s(st[j],
+          st[16U + j],
+          st[32U + j],
+          st[48U + j],
+          st[64U + j],
+          st[80U + j],
+          st[96U + j],
+          st[112U + j]););
+    double_round_256(k);
+    double_round_256(k);
+    double_round_256(k);
+    double_round_256(k);
+    double_round_256(k);
+    double_round_256(k);
+    double_round_256(k);
+    double_round_256(k);
+    double_round_256(k);
+    double_round_256(k);
+    uint8_t b[256U] = { 0U };
+    KRML_MAYBE_FOR4(j,
+      0U,
+      4U,
+      1U,
+      Lib_IntVector_Intrinsics_vec256_store32_le(b + 32U * j, k[j]);
+      Lib_IntVector_Intrinsics_vec256_store32_le(b + 128U + 32U * j, k[12U + j]););
+    for (uint32_t i = 0U; i < lanes; i++)
+    {
+      uint8_t *o = out + 32U * (i0 + i);
+      KRML_MAYBE_FOR4(j,
+        0U,
+        4U,
+        1U,
+        memcpy(o + 4U * j, b + 32U * j + 4U * i, 4U * sizeof (uint8_t));
+        memcpy(o + 16U + 4U * j, b + 128U + 32U * j + 4U * i, 4U * sizeof (uint8_t)););
+    }
+  }
+}
+
@@ -0,0 +1,262 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Chacha20_Vec512.h"
+
+#include "internal/Hacl_Chacha20.h"
+#include "libintvector.h"
+
+static inline void
+quarter_round_512(
+  Lib_IntVector_Intrinsics_vec512 *st,
+  uint32_t a,
+  uint32_t b,
+  uint32_t c,
+  uint32_t d
+)
+{
+  st[a] = Lib_IntVector_Intrinsics_vec512_add32(st[a], st[b]);
+  Lib_IntVector_Intrinsics_vec512 std = Lib_IntVector_Intrinsics_vec512_xor(st[d], st[a]);
+  st[d] = Lib_IntVector_Intrinsics_vec512_rotate_left32(std, 16U);
+  st[c] = Lib_IntVector_Intrinsics_vec512_add32(st[c], st[d]);
+  Lib_IntVector_Intrinsics_vec512 std0 = Lib_IntVector_Intrinsics_vec512_xor(st[b], st[c]);
+  st[b] = Lib_IntVector_Intrinsics_vec512_rotate_left32(std0, 12U);
+  st[a] = Lib_IntVector_Intrinsics_vec512_add32(st[a], st[b]);
+  Lib_IntVector_Intrinsics_vec512 std1 = Lib_IntVector_Intrinsics_vec512_xor(st[d], st[a]);
+  st[d] = Lib_IntVector_Intrinsics_vec512_rotate_left32(std1, 8U);
+  st[c] = Lib_IntVector_Intrinsics_vec512_add32(st[c], st[d]);
+  Lib_IntVector_Intrinsics_vec512 std2 = Lib_IntVector_Intrinsics_vec512_xor(st[b], st[c]);
+  st[b] = Lib_IntVector_Intrinsics_vec512_rotate_left32(std2, 7U);
+}
+
+static inline void double_round_512(Lib_IntVector_Intrinsics_vec512 *st)
+{
+  quarter_round_512(st, 0U, 4U, 8U, 12U);
+  quarter_round_512(st, 1U, 5U, 9U, 13U);
+  quarter_round_512(st, 2U, 6U, 10U, 14U);
+  quarter_round_512(st, 3U, 7U, 11U, 15U);
+  quarter_round_512(st, 0U, 5U, 10U, 15U);
+  quarter_round_512(st, 1U, 6U, 11U, 12U);
+  quarter_round_512(st, 2U, 7U, 8U, 13U);
+  quarter_round_512(st, 3U, 4U, 9U, 14U);
+}
+
+static inline void
+chacha20_core_512(
+  Lib_IntVector_Intrinsics_vec512 *k,
+  Lib_IntVector_Intrinsics_vec512 *ctx,
+  uint32_t ctr
+)
+{
+  memcpy(k, ctx, 16U * sizeof (Lib_IntVector_Intrinsics_vec512));
+  uint32_t ctr_u32 = 16U * ctr;
+  Lib_IntVector_Intrinsics_vec512 cv = Lib_IntVector_Intrinsics_vec512_load32(ctr_u32);
+  k[12U] = Lib_IntVector_Intrinsics_vec512_add32(k[12U], cv);
+  double_round_512(k);
+  double_round_512(k);
+  double_round_512(k);
+  double_round_512(k);
+  double_round_512(k);
+  double_round_512(k);
+  double_round_512(k);
+  double_round_512(k);
+  double_round_512(k);
+  double_round_512(k);
+  KRML_MAYBE_FOR16(i,
+    0U,
+    16U,
+    1U,
+    Lib_IntVector_Intrinsics_vec512 *os = k;
+    Lib_IntVector_Intrinsics_vec512 x = Lib_IntVector_Intrinsics_vec512_add32(k[i], ctx[i]);
+    os[i] = x;);
+  k[12U] = Lib_IntVector_Intrinsics_vec512_add32(k[12U], cv);
+}
+
+static inline void
+chacha20_init_512(Lib_IntVector_Intrinsics_vec512 *ctx, uint8_t *k, uint8_t *n, uint32_t ctr)
+{
+  uint32_t ctx1[16U] = { 0U };
+  KRML_MAYBE_FOR4(i,
+    0U,
+    4U,
+    1U,
+    uint32_t *os = ctx1;
+    uint32_t x = Hacl_Impl_Chacha20_Vec_chacha20_constants[i];
+    os[i] = x;);
+  KRML_MAYBE_FOR8(i,
+    0U,
+    8U,
+    1U,
+    uint32_t *os = ctx1 + 4U;
+    uint8_t *bj = k + i * 4U;
+    uint32_t u = load32_le(bj);
+    uint32_t r = u;
+    uint32_t x = r;
+    os[i] = x;);
+  ctx1[12U] = ctr;
+  KRML_MAYBE_FOR3(i,
+    0U,
+    3U,
+    1U,
+    uint32_t *os = ctx1 + 13U;
+    uint8_t *bj = n + i * 4U;
+    uint32_t u = load32_le(bj);
+    uint32_t r = u;
+    uint32_t x = r;
+    os[i] = x;);
+  KRML_MAYBE_FOR16(i,
+    0U,
+    16U,
+    1U,
+    Lib_IntVector_Intrinsics_vec512 *os = ctx;
+    uint32_t x = ctx1[i];
+    Lib_IntVector_Intrinsics_vec512 x0 = Lib_IntVector_Intrinsics_vec512_load32(x);
+    os[i] = x0;);
+  Lib_IntVector_Intrinsics_vec512
+  ctr1 =
+    Lib_IntVector_Intrinsics_vec512_load32s(0U,
+      1U,
+      2U,
+      3U,
+      4U,
+      5U,
+      6U,
+      7U,
+      8U,
+      9U,
+      10U,
+      11U,
+      12U,
+      13U,
+      14U,
+      15U);
+  Lib_IntVector_Intrinsics_vec512 c12 = ctx[12U];
+  ctx[12U] = Lib_IntVector_Intrinsics_vec512_add32(c12, ctr1);
+}
+
+/* Turns the 16 words x 16 lanes state into 16 consecutive keystream blocks:
+   after the 32- and 64-bit interleavings, 128-bit lane l of v[4g + c] holds
+   words 4g..4g+3 of block 4l + c; the 128- and 256-bit interleavings then
+   gather the four quarters of each block. */
+static inline void transpose16x16(Lib_IntVector_Intrinsics_vec512 *k)
+{
+  KRML_PRE_ALIGN(64) Lib_IntVector_Intrinsics_vec512 v[16U] KRML_POST_ALIGN(64) = { 0U };
+  KRML_MAYBE_FOR4(i,
+    0U,
+    4U,
+    1U,
+    Lib_IntVector_Intrinsics_vec512
+    t0 = Lib_IntVector_Intrinsics_vec512_interleave_low32(k[4U * i], k[4U * i + 1U]);
+    Lib_IntVector_Intrinsics_vec512
+    t1 = Lib_IntVector_Intrinsics_vec512_interleave_high32(k[4U * i], k[4U * i + 1U]);
+    Lib_IntVector_Intrinsics_vec512
+    t2 = Lib_IntVector_Intrinsics_vec512_interleave_low32(k[4U * i + 2U], k[4U * i + 3U]);
+    Lib_IntVector_Intrinsics_vec512
+    t3 = Lib_IntVector_Intrinsics_vec512_interleave_high32(k[4U * i + 2U], k[4U * i + 3U]);
+    v[4U * i] = Lib_IntVector_Intrinsics_vec512_interleave_low64(t0, t2);
+    v[4U * i + 1U] = Lib_IntVector_Intrinsics_vec512_interleave_high64(t0, t2);
+    v[4U * i + 2U] = Lib_IntVector_Intrinsics_vec512_interleave_low64(t1, t3);
+    v[4U * i + 3U] = Lib_IntVector_Intrinsics_vec512_interleave_high64(t1, t3););
+  KRML_MAYBE_FOR4(i,
+    0U,
+    4U,
+    1U,
+    Lib_IntVector_Intrinsics_vec512
+    y0 = Lib_IntVector_Intrinsics_vec512_interleave_low128(v[i], v[4U + i]);
+    Lib_IntVector_Intrinsics_vec512
+    y1 = Lib_IntVector_Intrinsics_vec512_interleave_high128(v[i], v[4U + i]);
+    Lib_IntVector_Intrinsics_vec512
+    y2 = Lib_IntVector_Intrinsics_vec512_interleave_low128(v[8U + i], v[12U + i]);
+    Lib_IntVector_Intrinsics_vec512
+    y3 = Lib_IntVector_Intrinsics_vec512_interleave_high128(v[8U + i], v[12U + i]);
+    k[i] = Lib_IntVector_Intrinsics_vec512_interleave_low256(y0, y2);
+    k[4U + i] = Lib_IntVector_Intrinsics_vec512_interleave_low256(y1, y3);
+    k[8U + i] = Lib_IntVector_Intrinsics_vec512_interleave_high256(y0, y2);
+    k[12U + i] = Lib_IntVector_Intrinsics_vec512_interleave_high256(y1, y3););
+}
+
+void
+Hacl_Chacha20_Vec512_chacha20_encrypt_512(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint8_t *key,
+  uint8_t *n,
+  uint32_t ctr
+)
+{
+  KRML_PRE_ALIGN(64) Lib_IntVector_Intrinsics_vec512 ctx[16U] KRML_POST_ALIGN(64) = { 0U };
+  chacha20_init_512(ctx, key, n, ctr);
+  uint32_t rem = len % 1024U;
+  uint32_t nb = len / 1024U;
+  uint32_t rem1 = len % 1024U;
+  for (uint32_t i = 0U; i < nb; i++)
+  {
+    uint8_t *uu____0 = out + i * 1024U;
+    uint8_t *uu____1 = text + i * 1024U;
+    KRML_PRE_ALIGN(64) Lib_IntVector_Intrinsics_vec512 k[16U] KRML_POST_ALIGN(64) = { 0U };
+    chacha20_core_512(k, ctx, i);
+    transpose16x16(k);
+    KRML_MAYBE_FOR16(i0,
+      0U,
+      16U,
+      1U,
+      Lib_IntVector_Intrinsics_vec512
+      x = Lib_IntVector_Intrinsics_vec512_load32_le(uu____1 + i0 * 64U);
+      Lib_IntVector_Intrinsics_vec512 y = Lib_IntVector_Intrinsics_vec512_xor(x, k[i0]);
+      Lib_IntVector_Intrinsics_vec512_store32_le(uu____0 + i0 * 64U, y););
+  }
+  if (rem1 > 0U)
+  {
+    uint8_t *uu____2 = out + nb * 1024U;
+    uint8_t plain[1024U] = { 0U };
+    memcpy(plain, text + nb * 1024U, rem * sizeof (uint8_t));
+    KRML_PRE_ALIGN(64) Lib_IntVector_Intrinsics_vec512 k[16U] KRML_POST_ALIGN(64) = { 0U };
+    chacha20_core_512(k, ctx, nb);
+    transpose16x16(k);
+    KRML_MAYBE_FOR16(i,
+      0U,
+      16U,
+      1U,
+      Lib_IntVector_Intrinsics_vec512
+      x = Lib_IntVector_Intrinsics_vec512_load32_le(plain + i * 64U);
+      Lib_IntVector_Intrinsics_vec512 y = Lib_IntVector_Intrinsics_vec512_xor(x, k[i]);
+      Lib_IntVector_Intrinsics_vec512_store32_le(plain + i * 64U, y););
+    memcpy(uu____2, plain, rem * sizeof (uint8_t));
+  }
+}
+
+void
+Hacl_Chacha20_Vec512_chacha20_decrypt_512(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *cipher,
+  uint8_t *key,
+  uint8_t *n,
+  uint32_t ctr
+)
+{
+  Hacl_Chacha20_Vec512_chacha20_encrypt_512(len, out, cipher, key, n, ctr);
+}
@@ -0,0 +1,456 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_HMAC_DRBG_Vec256.h"
+
+#include "lib_memzero0.h"
+
+/* dst[l] := HMAC-SHA2-256(key[l], msg[l]) for 8 lanes of 32-byte keys and len-byte messages,
+   using the 8 * (64 + len) bytes at ibuf as scratch. dst may alias key or msg. */
+static void
+hmac_sha2_256_8(uint8_t **dst, uint8_t **key, uint8_t **msg, uint32_t len, uint8_t *ibuf)
+{
+  uint32_t ilen = 64U + len;
+  uint8_t obuf[768U] = { 0U };
+  uint8_t ih[256U] = { 0U };
+  for (uint32_t l = 0U; l < 8U; l++)
+  {
+    uint8_t *ib = ibuf + l * ilen;
+    uint8_t *ob = obuf + l * 96U;
+    memset(ib, 0x36U, 64U * sizeof (uint8_t));
+    memset(ob, 0x5cU, 64U * sizeof (uint8_t));
+    for (uint32_t i = 0U; i < 32U; i++)
+    {
+      ib[i] = (uint32_t)ib[i] ^ (uint32_t)key[l][i];
+      ob[i] = (uint32_t)ob[i] ^ (uint32_t)key[l][i];
+    }
+    if (len > 0U)
+    {
+      memcpy(ib + 64U, msg[l], len * sizeof (uint8_t));
+    }
+  }
+  Hacl_SHA2_Vec256_sha256_8(ih,
+    ih + 32U,
+    ih + 64U,
+    ih + 96U,
+    ih + 128U,
+    ih + 160U,
+    ih + 192U,
+    ih + 224U,
+    ilen,
+    ibuf,
+    ibuf + ilen,
+    ibuf + 2U * ilen,
+    ibuf + 3U * ilen,
+    ibuf + 4U * ilen,
+    ibuf + 5U * ilen,
+    ibuf + 6U * ilen,
+    ibuf + 7U * ilen);
+  for (uint32_t l = 0U; l < 8U; l++)
+  {
+    memcpy(obuf + l * 96U + 64U, ih + l * 32U, 32U * sizeof (uint8_t));
+  }
+  Hacl_SHA2_Vec256_sha256_8(dst[0U],
+    dst[1U],
+    dst[2U],
+    dst[3U],
+    dst[4U],
+    dst[5U],
+    dst[6U],
+    dst[7U],
+    96U,
+    obuf,
+    obuf + 96U,
+    obuf + 192U,
+    obuf + 288U,
+    obuf + 384U,
+    obuf + 480U,
+    obuf + 576U,
+    obuf + 672U);
+  Lib_Memzero0_memzero(ibuf, 8U * ilen, uint8_t, void *);
+  Lib_Memzero0_memzero(obuf, 768U, uint8_t, void *);
+  Lib_Memzero0_memzero(ih, 256U, uint8_t, void *);
+}
+
+/* Bytes of scratch memory that update_8 needs for data_len-byte inputs: the 8 messages
+   V || b || data of update_step_8, followed by the inner-hash inputs of hmac_sha2_256_8 on
+   them. */
+static inline uint32_t update_scratch_len(uint32_t data_len)
+{
+  return 8U * (33U + data_len) + 8U * (97U + data_len);
+}
+
+/* update_scratch_len(64): inputs of up to 64 bytes are updated without a heap allocation. */
+#define STACK_SCRATCH_LEN 2064U
+
+/* Scratch memory of `len` bytes: `stack` (STACK_SCRATCH_LEN bytes) if it is large enough, a
+   new heap buffer otherwise. Returns NULL if the heap allocation fails. */
+static uint8_t *scratch_alloc(uint8_t *stack, uint32_t len)
+{
+  if (len <= STACK_SCRATCH_LEN)
+  {
+    return stack;
+  }
+  return (uint8_t *)KRML_HOST_CALLOC(len, sizeof (uint8_t));
+}
+
+static void scratch_free(uint8_t *scratch, uint8_t *stack, uint32_t len)
+{
+  if (scratch == NULL)
+  {
+    return;
+  }
+  Lib_Memzero0_memzero(scratch, len, uint8_t, void *);
+  if (scratch != stack)
+  {
+    KRML_HOST_FREE(scratch);
+  }
+}
+
+/* K := HMAC(K, V || b || data); V := HMAC(K, V), with update_scratch_len(data_len) bytes of
+   scratch memory. */
+static void
+update_step_8(
+  Hacl_HMAC_DRBG_state *st,
+  uint8_t b,
+  uint32_t data_len,
+  uint8_t **data,
+  uint8_t *scratch
+)
+{
+  uint32_t mlen = 33U + data_len;
+  uint8_t *mbuf = scratch;
+  uint8_t ibuf[768U] = { 0U };
+  uint8_t *msg[8U];
+  uint8_t *k[8U];
+  uint8_t *v[8U];
+  for (uint32_t l = 0U; l < 8U; l++)
+  {
+    msg[l] = mbuf + l * mlen;
+    k[l] = st[l].k;
+    v[l] = st[l].v;
+    memcpy(msg[l], st[l].v, 32U * sizeof (uint8_t));
+    msg[l][32U] = b;
+    if (data_len > 0U)
+    {
+      memcpy(msg[l] + 33U, data[l], data_len * sizeof (uint8_t));
+    }
+  }
+  hmac_sha2_256_8(k, k, msg, mlen, mbuf + 8U * mlen);
+  hmac_sha2_256_8(v, k, v, 32U, ibuf);
+  Lib_Memzero0_memzero(mbuf, 8U * mlen, uint8_t, void *);
+}
+
+/* HMAC_DRBG_Update (SP 800-90A, 10.1.2.2) */
+static void
+update_8(Hacl_HMAC_DRBG_state *st, uint32_t data_len, uint8_t **data, uint8_t *scratch)
+{
+  update_step_8(st, 0U, data_len, data, scratch);
+  if (data_len != 0U)
+  {
+    update_step_8(st, 1U, data_len, data, scratch);
+  }
+}
+
+/* Concatenate, per lane, a (len_a bytes) || b (len_b bytes) || c (len_c bytes). Returns the
+   buffer holding the 8 results, or NULL if it cannot be allocated. */
+static uint8_t
+*concat_8(
+  uint8_t **dst,
+  uint32_t len_a,
+  uint8_t **a,
+  uint32_t len_b,
+  uint8_t **b,
+  uint32_t len_c,
+  uint8_t **c
+)
+{
+  uint32_t len = len_a + len_b + len_c;
+  uint8_t *buf = (uint8_t *)KRML_HOST_CALLOC(8U * len + 1U, sizeof (uint8_t));
+  if (buf == NULL)
+  {
+    return NULL;
+  }
+  for (uint32_t l = 0U; l < 8U; l++)
+  {
+    dst[l] = buf + l * len;
+    if (len_a > 0U)
+    {
+      memcpy(dst[l], a[l], len_a * sizeof (uint8_t));
+    }
+    if (len_b > 0U)
+    {
+      memcpy(dst[l] + len_a, b[l], len_b * sizeof (uint8_t));
+    }
+    if (len_c > 0U)
+    {
+      memcpy(dst[l] + len_a + len_b, c[l], len_c * sizeof (uint8_t));
+    }
+  }
+  return buf;
+}
+
+/* Extend the `lanes` states of st to 8 states in st8. The extra lanes use the scratch buffers
+   k and v (8 * 32 bytes each) and ctr (8 counters), and their results are discarded. */
+static void
+pad_states(
+  uint32_t lanes,
+  Hacl_HMAC_DRBG_state *st,
+  Hacl_HMAC_DRBG_state *st8,
+  uint8_t *k,
+  uint8_t *v,
+  uint32_t *ctr
+)
+{
+  for (uint32_t l = 0U; l < 8U; l++)
+  {
+    if (l < lanes)
+    {
+      st8[l] = st[l];
+    }
+    else
+    {
+      st8[l] =
+        ((Hacl_HMAC_DRBG_state){ .k = k + l * 32U, .v = v + l * 32U, .reseed_counter = ctr + l });
+    }
+  }
+}
+
+/* Extend the `lanes` pointers of src to 8 pointers in dst; the extra lanes read the input of
+   lane 0. src may be NULL, in which case so is every lane of dst. */
+static void pad_inputs(uint32_t lanes, uint8_t **src, uint8_t **dst)
+{
+  for (uint32_t l = 0U; l < 8U; l++)
+  {
+    if (src == NULL)
+    {
+      dst[l] = NULL;
+    }
+    else if (l < lanes)
+    {
+      dst[l] = src[l];
+    }
+    else
+    {
+      dst[l] = src[0U];
+    }
+  }
+}
+
+bool
+Hacl_HMAC_DRBG_Vec256_instantiate_sha2_256_8(
+  uint32_t lanes,
+  Hacl_HMAC_DRBG_state *st,
+  uint32_t entropy_input_len,
+  uint8_t **entropy_input,
+  uint32_t nonce_len,
+  uint8_t **nonce,
+  uint32_t personalization_string_len,
+  uint8_t **personalization_string
+)
+{
+  if (lanes == 0U || lanes > 8U)
+  {
+    return false;
+  }
+  Hacl_HMAC_DRBG_state st8[8U];
+  uint8_t scratch_k[256U] = { 0U };
+  uint8_t scratch_v[256U] = { 0U };
+  uint32_t scratch_ctr[8U] = { 0U };
+  pad_states(lanes, st, st8, scratch_k, scratch_v, scratch_ctr);
+  uint8_t *entropy_input8[8U];
+  uint8_t *nonce8[8U];
+  uint8_t *personalization_string8[8U];
+  pad_inputs(lanes, entropy_input, entropy_input8);
+  pad_inputs(lanes, nonce, nonce8);
+  pad_inputs(lanes, personalization_string, personalization_string8);
+  uint8_t *seed[8U];
+  uint32_t len = entropy_input_len + nonce_len + personalization_string_len;
+  uint8_t
+  *buf =
+    concat_8(seed,
+      entropy_input_len,
+      entropy_input8,
+      nonce_len,
+      nonce8,
+      personalization_string_len,
+      personalization_string8);
+  uint8_t stack_scratch[STACK_SCRATCH_LEN] = { 0U };
+  uint8_t *scratch = scratch_alloc(stack_scratch, update_scratch_len(len));
+  bool ok = buf != NULL && scratch != NULL;
+  if (ok)
+  {
+    for (uint32_t l = 0U; l < 8U; l++)
+    {
+      memset(st8[l].k, 0U, 32U * sizeof (uint8_t));
+      memset(st8[l].v, 1U, 32U * sizeof (uint8_t));
+      st8[l].reseed_counter[0U] = 1U;
+    }
+    update_8(st8, len, seed, scratch);
+  }
+  scratch_free(scratch, stack_scratch, update_scratch_len(len));
+  if (buf != NULL)
+  {
+    Lib_Memzero0_memzero(buf, 8U * len, uint8_t, void *);
+    KRML_HOST_FREE(buf);
+  }
+  Lib_Memzero0_memzero(scratch_k, 256U, uint8_t, void *);
+  Lib_Memzero0_memzero(scratch_v, 256U, uint8_t, void *);
+  return ok;
+}
+
+bool
+Hacl_HMAC_DRBG_Vec256_reseed_sha2_256_8(
+  uint32_t lanes,
+  Hacl_HMAC_DRBG_state *st,
+  uint32_t entropy_input_len,
+  uint8_t **entropy_input,
+  uint32_t additional_input_len,
+  uint8_t **additional_input
+)
+{
+  if (lanes == 0U || lanes > 8U)
+  {
+    return false;
+  }
+  Hacl_HMAC_DRBG_state st8[8U];
+  uint8_t scratch_k[256U] = { 0U };
+  uint8_t scratch_v[256U] = { 0U };
+  uint32_t scratch_ctr[8U] = { 0U };
+  pad_states(lanes, st, st8, scratch_k, scratch_v, scratch_ctr);
+  uint8_t *entropy_input8[8U];
+  uint8_t *additional_input8[8U];
+  pad_inputs(lanes, entropy_input, entropy_input8);
+  pad_inputs(lanes, additional_input, additional_input8);
+  uint8_t *seed[8U];
+  uint32_t len = entropy_input_len + additional_input_len;
+  uint8_t
+  *buf =
+    concat_8(seed,
+      entropy_input_len,
+      entropy_input8,
+      additional_input_len,
+      additional_input8,
+      0U,
+      NULL);
+  uint8_t stack_scratch[STACK_SCRATCH_LEN] = { 0U };
+  uint8_t *scratch = scratch_alloc(stack_scratch, update_scratch_len(len));
+  bool ok = buf != NULL && scratch != NULL;
+  if (ok)
+  {
+    update_8(st8, len, seed, scratch);
+    for (uint32_t l = 0U; l < lanes; l++)
+    {
+      st[l].reseed_counter[0U] = 1U;
+    }
+  }
+  scratch_free(scratch, stack_scratch, update_scratch_len(len));
+  if (buf != NULL)
+  {
+    Lib_Memzero0_memzero(buf, 8U * len, uint8_t, void *);
+    KRML_HOST_FREE(buf);
+  }
+  Lib_Memzero0_memzero(scratch_k, 256U, uint8_t, void *);
+  Lib_Memzero0_memzero(scratch_v, 256U, uint8_t, void *);
+  return ok;
+}
+
+bool
+Hacl_HMAC_DRBG_Vec256_generate_sha2_256_8(
+  uint32_t lanes,
+  uint8_t **output,
+  Hacl_HMAC_DRBG_state *st,
+  uint32_t n,
+  uint32_t additional_input_len,
+  uint8_t **additional_input
+)
+{
+  if (lanes == 0U || lanes > 8U)
+  {
+    return false;
+  }
+  for (uint32_t l = 0U; l < lanes; l++)
+  {
+    if (st[l].reseed_counter[0U] > Hacl_HMAC_DRBG_reseed_interval)
+    {
+      return false;
+    }
+  }
+  /* Both updates below use this scratch memory, so that no allocation can fail once a state
+     has changed. */
+  uint8_t stack_scratch[STACK_SCRATCH_LEN] = { 0U };
+  uint8_t *scratch = scratch_alloc(stack_scratch, update_scratch_len(additional_input_len));
+  if (scratch == NULL)
+  {
+    return false;
+  }
+  Hacl_HMAC_DRBG_state st8[8U];
+  uint8_t scratch_k[256U] = { 0U };
+  uint8_t scratch_v[256U] = { 0U };
+  uint32_t scratch_ctr[8U] = { 0U };
+  pad_states(lanes, st, st8, scratch_k, scratch_v, scratch_ctr);
+  uint8_t *additional_input8[8U];
+  pad_inputs(lanes, additional_input, additional_input8);
+  if (additional_input_len > 0U)
+  {
+    update_8(st8, additional_input_len, additional_input8, scratch);
+  }
+  uint8_t *k[8U];
+  uint8_t *v[8U];
+  for (uint32_t l = 0U; l < 8U; l++)
+  {
+    k[l] = st8[l].k;
+    v[l] = st8[l].v;
+  }
+  uint8_t ibuf[768U] = { 0U };
+  uint32_t max = n / 32U;
+  for (uint32_t i = 0U; i < max; i++)
+  {
+    hmac_sha2_256_8(v, k, v, 32U, ibuf);
+    for (uint32_t l = 0U; l < lanes; l++)
+    {
+      memcpy(output[l] + i * 32U, v[l], 32U * sizeof (uint8_t));
+    }
+  }
+  if (max * 32U < n)
+  {
+    hmac_sha2_256_8(v, k, v, 32U, ibuf);
+    for (uint32_t l = 0U; l < lanes; l++)
+    {
+      memcpy(output[l] + max * 32U, v[l], (n - max * 32U) * sizeof (uint8_t));
+    }
+  }
+  update_8(st8, additional_input_len, additional_input8, scratch);
+  for (uint32_t l = 0U; l < lanes; l++)
+  {
+    st[l].reseed_counter[0U] = st[l].reseed_counter[0U] + 1U;
+  }
+  scratch_free(scratch, stack_scratch, update_scratch_len(additional_input_len));
+  Lib_Memzero0_memzero(ibuf, 768U, uint8_t, void *);
+  Lib_Memzero0_memzero(scratch_k, 256U, uint8_t, void *);
+  Lib_Memzero0_memzero(scratch_v, 256U, uint8_t, void *);
+  return true;
+}
+
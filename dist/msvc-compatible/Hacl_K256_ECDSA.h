@@ -354,6 +354,32 @@ Execute the diffie-hellmann key exchange.
 */
 bool Hacl_K256_ECDSA_ecdh(uint8_t *shared_secret, uint8_t *their_pubkey, uint8_t *private_key);
 
+
+/*********************/
+/* Fixed-base tables */
+/*********************/
+
+/**
+Build larger fixed-base tables for signing and key generation, replacing the built-in 4-table comb
+with 4-bit digits.
+
+  @param teeth Number of tables; a power of two between 1 and 256.
+  @param window_bits Digit width; 1, 2, 4 or 8, and at most 256 / `teeth`.
+
+  @return Returns `false` if the tables were already built by an earlier call, the
+  parameters are out of range or memory cannot be allocated.
+
+  The tables take `teeth` * 2^`window_bits` * 120 bytes. A fixed-base scalar
+  multiplication then does 256 / `teeth` - `window_bits` doublings and 256 / `window_bits`
+  additions, each after a constant-time scan of 2^`window_bits` table entries. The built-in
+  comb corresponds to (4, 4); (32, 4) and (64, 4) leave almost only the additions and keep
+  the scans short.
+
+  The tables are global and are never freed, so only the first successful call takes
+  effect. Call this function before other threads use this module.
+*/
+bool Hacl_K256_ECDSA_precomp_tables_init(uint32_t teeth, uint32_t window_bits);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -23,10 +23,63 @@
  */
 
 
-#include "Hacl_NaCl.h"
+#include "internal/Hacl_NaCl.h"
 
 #include "internal/Hacl_Krmllib.h"
 
+#include "config.h"
+
+/* See `Hacl_NaCl_secretbox_detached` for the meaning of `vec`. */
+static void
+salsa20_xor(
+  uint32_t vec,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint8_t *key,
+  uint8_t *n,
+  uint32_t ctr
+)
+{
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec == 256U)
+  {
+    Hacl_Salsa20_Vec256_salsa20_encrypt_256(len, out, text, key, n, ctr);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (vec == 128U)
+  {
+    Hacl_Salsa20_Vec128_salsa20_encrypt_128(len, out, text, key, n, ctr);
+    return;
+  }
+  #endif
+  KRML_MAYBE_UNUSED_VAR(vec);
+  Hacl_Salsa20_salsa20_encrypt(len, out, text, key, n, ctr);
+}
+
+static void
+poly1305_mac(uint32_t vec, uint8_t *output, uint8_t *input, uint32_t input_len, uint8_t *key)
+{
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec == 256U)
+  {
+    Hacl_MAC_Poly1305_Simd256_mac(output, input, input_len, key);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (vec == 128U)
+  {
+    Hacl_MAC_Poly1305_Simd128_mac(output, input, input_len, key);
+    return;
+  }
+  #endif
+  KRML_MAYBE_UNUSED_VAR(vec);
+  Hacl_MAC_Poly1305_mac(output, input, input_len, key);
+}
+
 static void secretbox_init(uint8_t *xkeys, uint8_t *k, uint8_t *n)
 {
   uint8_t *subkey = xkeys;
@@ -37,8 +90,16 @@ static void secretbox_init(uint8_t *xkeys, uint8_t *k, uint8_t *n)
   Hacl_Salsa20_salsa20_key_block0(aekey, subkey, n1);
 }
 
-static void
-secretbox_detached(uint32_t mlen, uint8_t *c, uint8_t *tag, uint8_t *k, uint8_t *n, uint8_t *m)
+void
+Hacl_NaCl_secretbox_detached(
+  uint32_t vec,
+  uint32_t mlen,
+  uint8_t *c,
+  uint8_t *tag,
+  uint8_t *k,
+  uint8_t *n,
+  uint8_t *m
+)
 {
   uint8_t xkeys[96U] = { 0U };
   secretbox_init(xkeys, k, n);
@@ -69,12 +130,13 @@ secretbox_detached(uint32_t mlen, uint8_t *c, uint8_t *tag, uint8_t *k, uint8_t
   uint8_t *c0 = c;
   uint8_t *c1 = c + mlen0;
   memcpy(c0, block0, mlen0 * sizeof (uint8_t));
-  Hacl_Salsa20_salsa20_encrypt(mlen1, c1, m1, subkey, n1, 1U);
-  Hacl_MAC_Poly1305_mac(tag, c, mlen, mkey);
+  salsa20_xor(vec, mlen1, c1, m1, subkey, n1, 1U);
+  poly1305_mac(vec, tag, c, mlen, mkey);
 }
 
-static uint32_t
-secretbox_open_detached(
+uint32_t
+Hacl_NaCl_secretbox_open_detached(
+  uint32_t vec,
   uint32_t mlen,
   uint8_t *m,
   uint8_t *k,
@@ -87,7 +149,7 @@ secretbox_open_detached(
   secretbox_init(xkeys, k, n);
   uint8_t *mkey = xkeys + 32U;
   uint8_t tag_[16U] = { 0U };
-  Hacl_MAC_Poly1305_mac(tag_, c, mlen, mkey);
+  poly1305_mac(vec, tag_, c, mlen, mkey);
   uint8_t res = 255U;
   KRML_MAYBE_FOR16(i,
     0U,
@@ -124,7 +186,7 @@ secretbox_open_detached(
     uint8_t *m0 = m;
     uint8_t *m1 = m + mlen0;
     memcpy(m0, block0, mlen0 * sizeof (uint8_t));
-    Hacl_Salsa20_salsa20_decrypt(mlen1, m1, c1, subkey, n1, 1U);
+    salsa20_xor(vec, mlen1, m1, c1, subkey, n1, 1U);
     return 0U;
   }
   return 0xffffffffU;
@@ -134,7 +196,7 @@ static void secretbox_easy(uint32_t mlen, uint8_t *c, uint8_t *k, uint8_t *n, ui
 {
   uint8_t *tag = c;
   uint8_t *cip = c + 16U;
-  secretbox_detached(mlen, cip, tag, k, n, m);
+  Hacl_NaCl_secretbox_detached(32U, mlen, cip, tag, k, n, m);
 }
 
 static uint32_t
@@ -142,7 +204,7 @@ secretbox_open_easy(uint32_t mlen, uint8_t *m, uint8_t *k, uint8_t *n, uint8_t *
 {
   uint8_t *tag = c;
   uint8_t *cip = c + 16U;
-  return secretbox_open_detached(mlen, m, k, n, cip, tag);
+  return Hacl_NaCl_secretbox_open_detached(32U, mlen, m, k, n, cip, tag);
 }
 
 static inline uint32_t box_beforenm(uint8_t *k, uint8_t *pk, uint8_t *sk)
@@ -167,7 +229,7 @@ box_detached_afternm(
   uint8_t *m
 )
 {
-  secretbox_detached(mlen, c, tag, k, n, m);
+  Hacl_NaCl_secretbox_detached(32U, mlen, c, tag, k, n, m);
   return 0U;
 }
 
@@ -201,7 +263,7 @@ box_open_detached_afternm(
   uint8_t *tag
 )
 {
-  return secretbox_open_detached(mlen, m, k, n, c, tag);
+  return Hacl_NaCl_secretbox_open_detached(32U, mlen, m, k, n, c, tag);
 }
 
 static inline uint32_t
@@ -280,7 +342,7 @@ Hacl_NaCl_crypto_secretbox_detached(
   uint8_t *k
 )
 {
-  secretbox_detached(mlen, c, tag, k, n, m);
+  Hacl_NaCl_secretbox_detached(32U, mlen, c, tag, k, n, m);
   return 0U;
 }
 
@@ -306,7 +368,7 @@ Hacl_NaCl_crypto_secretbox_open_detached(
   uint8_t *k
 )
 {
-  return secretbox_open_detached(mlen, m, k, n, c, tag);
+  return Hacl_NaCl_secretbox_open_detached(32U, mlen, m, k, n, c, tag);
 }
 
 /**
@@ -515,4 +577,3 @@ Hacl_NaCl_crypto_box_open_easy(
 {
   return box_open_easy(clen - 16U, m, pk, sk, n, c);
 }
-
@@ -447,6 +447,141 @@ typedef __m256i Lib_IntVector_Intrinsics_vec256;
 
 #endif /* HACL_CAN_COMPILE_VEC256 */
 
+#if defined(HACL_CAN_COMPILE_VEC512)
+
+#include <immintrin.h>
+
+typedef __m512i Lib_IntVector_Intrinsics_vec512;
+
+#define Lib_IntVector_Intrinsics_vec512_eq64(x0, x1) \
+  (_mm512_movm_epi64(_mm512_cmpeq_epi64_mask(x0, x1)))
+
+#define Lib_IntVector_Intrinsics_vec512_gt64(x0, x1) \
+  (_mm512_movm_epi64(_mm512_cmpgt_epi64_mask(x0, x1)))
+
+#define Lib_IntVector_Intrinsics_vec512_xor(x0, x1) \
+  (_mm512_xor_si512(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_or(x0, x1) \
+  (_mm512_or_si512(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_and(x0, x1) \
+  (_mm512_and_si512(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_lognot(x0) \
+  (_mm512_xor_si512(x0, _mm512_set1_epi32(-1)))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_left64(x0, x1) \
+  (_mm512_slli_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_right64(x0, x1) \
+  (_mm512_srli_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_left32(x0, x1) \
+  (_mm512_slli_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_right32(x0, x1) \
+  (_mm512_srli_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_rotate_left32(x0,x1)	\
+  (_mm512_rol_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_rotate_right32(x0,x1)	\
+  (_mm512_ror_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_rotate_left64(x0,x1)	\
+  (_mm512_rol_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_rotate_right64(x0,x1)	\
+  (_mm512_ror_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_load32_le(x0) \
+  (_mm512_loadu_si512((__m512i*)(x0)))
+
+#define Lib_IntVector_Intrinsics_vec512_load64_le(x0) \
+  (_mm512_loadu_si512((__m512i*)(x0)))
+
+#define Lib_IntVector_Intrinsics_vec512_store32_le(x0, x1) \
+  (_mm512_storeu_si512((__m512i*)(x0), x1))
+
+#define Lib_IntVector_Intrinsics_vec512_store64_le(x0, x1) \
+  (_mm512_storeu_si512((__m512i*)(x0), x1))
+
+#define Lib_IntVector_Intrinsics_vec512_extract64(x0, x1)	\
+  (_mm_extract_epi64(_mm512_extracti64x2_epi64(x0, (x1) / 2), (x1) % 2))
+
+#define Lib_IntVector_Intrinsics_vec512_zero  \
+  (_mm512_setzero_si512())
+
+#define Lib_IntVector_Intrinsics_vec512_add64(x0, x1) \
+  (_mm512_add_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_sub64(x0, x1)		\
+  (_mm512_sub_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_mul64(x0, x1) \
+  (_mm512_mul_epu32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_smul64(x0, x1) \
+  (_mm512_mul_epu32(x0, _mm512_set1_epi64(x1)))
+
+#define Lib_IntVector_Intrinsics_vec512_add32(x0, x1) \
+  (_mm512_add_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_sub32(x0, x1)		\
+  (_mm512_sub_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_load64(x1) \
+  (_mm512_set1_epi64(x1)) /* hi lo */
+
+#define Lib_IntVector_Intrinsics_vec512_load64s(x0, x1, x2, x3, x4, x5, x6, x7) \
+  (_mm512_set_epi64(x7, x6, x5, x4, x3, x2, x1, x0)) /* hi lo */
+
+#define Lib_IntVector_Intrinsics_vec512_load32(x) \
+  (_mm512_set1_epi32(x))
+
+#define Lib_IntVector_Intrinsics_vec512_load32s(x0,x1,x2,x3,x4,x5,x6,x7,x8,x9,x10,x11,x12,x13,x14,x15) \
+  (_mm512_set_epi32(x15,x14,x13,x12,x11,x10,x9,x8,x7,x6,x5,x4,x3,x2,x1,x0)) /* hi lo */
+
+#define Lib_IntVector_Intrinsics_vec512_horizontal_add64(x0) \
+  ((uint64_t)_mm512_reduce_add_epi64(x0))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_low32(x1, x2) \
+  (_mm512_unpacklo_epi32(x1, x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_high32(x1, x2) \
+  (_mm512_unpackhi_epi32(x1, x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_low64(x1, x2) \
+  (_mm512_unpacklo_epi64(x1, x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_high64(x1, x2) \
+  (_mm512_unpackhi_epi64(x1, x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_low128(x1, x2) \
+  (_mm512_permutex2var_epi64(x1, _mm512_set_epi64(13, 12, 5, 4, 9, 8, 1, 0), x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_high128(x1, x2) \
+  (_mm512_permutex2var_epi64(x1, _mm512_set_epi64(15, 14, 7, 6, 11, 10, 3, 2), x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_low256(x1, x2) \
+  (_mm512_shuffle_i64x2(x1, x2, 0x44))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_high256(x1, x2) \
+  (_mm512_shuffle_i64x2(x1, x2, 0xee))
+
+#define Lib_IntVector_Intrinsics_vec512_insert128(x0, x1, x2) \
+  (_mm512_inserti32x4(x0, x1, x2))
+
+#define Lib_IntVector_Intrinsics_vec512_blend64(x0, x1, x2) \
+  (_mm512_mask_blend_epi64(x2, x0, x1))
+
+/* Requires VAES: only use in files compiled with -mvaes. */
+#define Lib_IntVector_Intrinsics_vec512_aes_enc(x0, x1) \
+  (_mm512_aesenc_epi128(x0, x1))
+
+#endif /* HACL_CAN_COMPILE_VEC512 */
+
 #elif (defined(__aarch64__) || defined(_M_ARM64) || defined(__arm__) || defined(_M_ARM)) \
       && !defined(__ARM_32BIT_STATE)
 
@@ -94,6 +94,12 @@ static bool cpu_has_avx512[1U] = { false };
 
 /* SNIPPET_END: cpu_has_avx512 */
 
+/* SNIPPET_START: cpu_has_vaes */
+
+static bool cpu_has_vaes[1U] = { false };
+
+/* SNIPPET_END: cpu_has_vaes */
+
 /* SNIPPET_START: EverCrypt_AutoConfig2_has_shaext */
 
 bool EverCrypt_AutoConfig2_has_shaext(void)
@@ -193,6 +199,15 @@ bool EverCrypt_AutoConfig2_has_avx512(void)
 
 /* SNIPPET_END: EverCrypt_AutoConfig2_has_avx512 */
 
+/* SNIPPET_START: EverCrypt_AutoConfig2_has_vaes */
+
+bool EverCrypt_AutoConfig2_has_vaes(void)
+{
+  return cpu_has_vaes[0U];
+}
+
+/* SNIPPET_END: EverCrypt_AutoConfig2_has_vaes */
+
 /* SNIPPET_START: EverCrypt_AutoConfig2_recall */
 
 void EverCrypt_AutoConfig2_recall(void)
@@ -262,6 +277,7 @@ void EverCrypt_AutoConfig2_init(void)
         if (check_avx512_xcr0() != 0ULL)
         {
           cpu_has_avx512[0U] = true;
+          cpu_has_vaes[0U] = has_vaes_cpuid();
           return;
         }
         return;
@@ -374,6 +390,15 @@ void EverCrypt_AutoConfig2_disable_avx512(void)
 
 /* SNIPPET_END: EverCrypt_AutoConfig2_disable_avx512 */
 
+/* SNIPPET_START: EverCrypt_AutoConfig2_disable_vaes */
+
+void EverCrypt_AutoConfig2_disable_vaes(void)
+{
+  cpu_has_vaes[0U] = false;
+}
+
+/* SNIPPET_END: EverCrypt_AutoConfig2_disable_vaes */
+
 /* SNIPPET_START: EverCrypt_AutoConfig2_has_vec128 */
 
 bool EverCrypt_AutoConfig2_has_vec128(void)
@@ -101,6 +101,16 @@ bool EverCrypt_AutoConfig2_has_avx512(void);
 
 /* SNIPPET_END: EverCrypt_AutoConfig2_has_avx512 */
 
+/* SNIPPET_START: EverCrypt_AutoConfig2_has_vaes */
+
+/**
+True when the CPU supports the VAES extension (AES round instructions on 256- and 512-bit
+vectors) and AVX-512 is usable; never true without `EverCrypt_AutoConfig2_has_avx512`.
+*/
+bool EverCrypt_AutoConfig2_has_vaes(void);
+
+/* SNIPPET_END: EverCrypt_AutoConfig2_has_vaes */
+
 /* SNIPPET_START: EverCrypt_AutoConfig2_recall */
 
 void EverCrypt_AutoConfig2_recall(void);
@@ -185,6 +195,12 @@ void EverCrypt_AutoConfig2_disable_avx512(void);
 
 /* SNIPPET_END: EverCrypt_AutoConfig2_disable_avx512 */
 
+/* SNIPPET_START: EverCrypt_AutoConfig2_disable_vaes */
+
+void EverCrypt_AutoConfig2_disable_vaes(void);
+
+/* SNIPPET_END: EverCrypt_AutoConfig2_disable_vaes */
+
 /* SNIPPET_START: EverCrypt_AutoConfig2_has_vec128 */
 
 bool EverCrypt_AutoConfig2_has_vec128(void);
@@ -23,10 +23,211 @@
  */
 
 
-#include "EverCrypt_Chacha20Poly1305.h"
+#include "internal/EverCrypt_Chacha20Poly1305.h"
 
 #include "config.h"
 
+/* SNIPPET_START: default_min_len */
+
+/**
+Default shortest message, in bytes, for which the 128-bit, 256-bit and 512-bit implementations
+are used, one row per widest available implementation: 512, 256 and 128 bits. Below the first
+threshold the 32-bit code wins: the vector code always processes whole multi-block chunks. The
+crossovers follow from the chunk sizes, so they are the same at every feature level.
+*/
+static const
+uint32_t
+default_min_len[9U] =
+  { 128U, 257U, 513U, 128U, 257U, 0xFFFFFFFFU, 128U, 0xFFFFFFFFU, 0xFFFFFFFFU };
+
+/* SNIPPET_END: default_min_len */
+
+/* SNIPPET_START: min_len */
+
+/* Thresholds set by `EverCrypt_Chacha20Poly1305_set_thresholds`, used instead of the defaults
+   once `thresholds_set[0U]` holds. */
+static uint32_t min_len[3U] = { 0U };
+
+/* SNIPPET_END: min_len */
+
+/* SNIPPET_START: thresholds_set */
+
+static bool thresholds_set[1U] = { false };
+
+/* SNIPPET_END: thresholds_set */
+
+/* SNIPPET_START: EverCrypt_Chacha20Poly1305_set_thresholds */
+
+/**
+Set the message lengths from which `aead_encrypt` and `aead_decrypt` use the 128-bit, 256-bit
+and 512-bit implementations, when the CPU supports them, replacing the defaults for the
+detected feature level (128, 257 and 513 bytes, for each width the CPU has). A deployment may
+re-tune them at startup with its own benchmark. Passing `0xFFFFFFFFU` disables a width for all
+message lengths.
+
+Like the `EverCrypt_AutoConfig2_disable_*` functions, this is meant to be called once at
+startup, before other threads use the library.
+*/
+void
+EverCrypt_Chacha20Poly1305_set_thresholds(uint32_t vec128, uint32_t vec256, uint32_t vec512)
+{
+  min_len[0U] = vec128;
+  min_len[1U] = vec256;
+  min_len[2U] = vec512;
+  thresholds_set[0U] = true;
+}
+
+/* SNIPPET_END: EverCrypt_Chacha20Poly1305_set_thresholds */
+
+/* SNIPPET_START: EverCrypt_Chacha20Poly1305_max_width */
+
+uint32_t EverCrypt_Chacha20Poly1305_max_width(void)
+{
+  bool avx512 = EverCrypt_AutoConfig2_has_avx512();
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  bool vec128 = EverCrypt_AutoConfig2_has_vec128();
+  KRML_MAYBE_UNUSED_VAR(avx512);
+  KRML_MAYBE_UNUSED_VAR(vec256);
+  KRML_MAYBE_UNUSED_VAR(vec128);
+  #if HACL_CAN_COMPILE_VEC512
+  if (avx512)
+  {
+    return 512U;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    return 256U;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (vec128)
+  {
+    return 128U;
+  }
+  #endif
+  return 32U;
+}
+
+/* SNIPPET_END: EverCrypt_Chacha20Poly1305_max_width */
+
+/* SNIPPET_START: EverCrypt_Chacha20Poly1305_select_width */
+
+uint32_t EverCrypt_Chacha20Poly1305_select_width(uint32_t max_width, uint32_t len)
+{
+  uint32_t level = 2U;
+  if (max_width >= 512U)
+  {
+    level = 0U;
+  }
+  else if (max_width >= 256U)
+  {
+    level = 1U;
+  }
+  const uint32_t *thresholds = default_min_len + 3U * level;
+  if (thresholds_set[0U])
+  {
+    thresholds = min_len;
+  }
+  if (max_width >= 512U && len >= thresholds[2U])
+  {
+    return 512U;
+  }
+  if (max_width >= 256U && len >= thresholds[1U])
+  {
+    return 256U;
+  }
+  if (max_width >= 128U && len >= thresholds[0U])
+  {
+    return 128U;
+  }
+  return 32U;
+}
+
+/* SNIPPET_END: EverCrypt_Chacha20Poly1305_select_width */
+
+/* SNIPPET_START: EverCrypt_Chacha20Poly1305_encrypt_width */
+
+void
+EverCrypt_Chacha20Poly1305_encrypt_width(
+  uint32_t width,
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  #if HACL_CAN_COMPILE_VEC512
+  if (width == 512U)
+  {
+    Hacl_AEAD_Chacha20Poly1305_Simd512_encrypt(cipher, tag, m, mlen, aad, aadlen, k, n);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC256
+  if (width == 256U)
+  {
+    Hacl_AEAD_Chacha20Poly1305_Simd256_encrypt(cipher, tag, m, mlen, aad, aadlen, k, n);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (width == 128U)
+  {
+    Hacl_AEAD_Chacha20Poly1305_Simd128_encrypt(cipher, tag, m, mlen, aad, aadlen, k, n);
+    return;
+  }
+  #endif
+  KRML_MAYBE_UNUSED_VAR(width);
+  Hacl_AEAD_Chacha20Poly1305_encrypt(cipher, tag, m, mlen, aad, aadlen, k, n);
+}
+
+/* SNIPPET_END: EverCrypt_Chacha20Poly1305_encrypt_width */
+
+/* SNIPPET_START: EverCrypt_Chacha20Poly1305_decrypt_width */
+
+uint32_t
+EverCrypt_Chacha20Poly1305_decrypt_width(
+  uint32_t width,
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  #if HACL_CAN_COMPILE_VEC512
+  if (width == 512U)
+  {
+    return Hacl_AEAD_Chacha20Poly1305_Simd512_decrypt(m, cipher, mlen, aad, aadlen, k, n, tag);
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC256
+  if (width == 256U)
+  {
+    return Hacl_AEAD_Chacha20Poly1305_Simd256_decrypt(m, cipher, mlen, aad, aadlen, k, n, tag);
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (width == 128U)
+  {
+    return Hacl_AEAD_Chacha20Poly1305_Simd128_decrypt(m, cipher, mlen, aad, aadlen, k, n, tag);
+  }
+  #endif
+  KRML_MAYBE_UNUSED_VAR(width);
+  return Hacl_AEAD_Chacha20Poly1305_decrypt(m, cipher, mlen, aad, aadlen, k, n, tag);
+}
+
+/* SNIPPET_END: EverCrypt_Chacha20Poly1305_decrypt_width */
+
 /* SNIPPET_START: EverCrypt_Chacha20Poly1305_aead_encrypt */
 
 void
@@ -40,6 +241,48 @@ EverCrypt_Chacha20Poly1305_aead_encrypt(
   uint8_t *cipher,
   uint8_t *tag
 )
+{
+  uint32_t max_width = EverCrypt_Chacha20Poly1305_max_width();
+  uint32_t width = EverCrypt_Chacha20Poly1305_select_width(max_width, mlen);
+  EverCrypt_Chacha20Poly1305_encrypt_width(width, k, n, aadlen, aad, mlen, m, cipher, tag);
+}
+
+/* SNIPPET_END: EverCrypt_Chacha20Poly1305_aead_encrypt */
+
+/* SNIPPET_START: EverCrypt_Chacha20Poly1305_aead_decrypt */
+
+uint32_t
+EverCrypt_Chacha20Poly1305_aead_decrypt(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  uint32_t max_width = EverCrypt_Chacha20Poly1305_max_width();
+  uint32_t width = EverCrypt_Chacha20Poly1305_select_width(max_width, mlen);
+  return EverCrypt_Chacha20Poly1305_decrypt_width(width, k, n, aadlen, aad, mlen, m, cipher, tag);
+}
+
+/* SNIPPET_END: EverCrypt_Chacha20Poly1305_aead_decrypt */
+
+/* SNIPPET_START: EverCrypt_Chacha20Poly1305_xaead_encrypt */
+
+void
+EverCrypt_Chacha20Poly1305_xaead_encrypt(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *tag
+)
 {
   bool vec256 = EverCrypt_AutoConfig2_has_vec256();
   bool vec128 = EverCrypt_AutoConfig2_has_vec128();
@@ -47,7 +290,7 @@ EverCrypt_Chacha20Poly1305_aead_encrypt(
   if (vec256)
   {
     KRML_MAYBE_UNUSED_VAR(vec128);
-    Hacl_AEAD_Chacha20Poly1305_Simd256_encrypt(cipher, tag, m, mlen, aad, aadlen, k, n);
+    Hacl_AEAD_XChacha20Poly1305_Simd256_encrypt(cipher, tag, m, mlen, aad, aadlen, k, n);
     return;
   }
   #endif
@@ -55,21 +298,21 @@ EverCrypt_Chacha20Poly1305_aead_encrypt(
   if (vec128)
   {
     KRML_MAYBE_UNUSED_VAR(vec256);
-    Hacl_AEAD_Chacha20Poly1305_Simd128_encrypt(cipher, tag, m, mlen, aad, aadlen, k, n);
+    Hacl_AEAD_XChacha20Poly1305_Simd128_encrypt(cipher, tag, m, mlen, aad, aadlen, k, n);
     return;
   }
   #endif
   KRML_MAYBE_UNUSED_VAR(vec128);
   KRML_MAYBE_UNUSED_VAR(vec256);
-  Hacl_AEAD_Chacha20Poly1305_encrypt(cipher, tag, m, mlen, aad, aadlen, k, n);
+  Hacl_AEAD_XChacha20Poly1305_encrypt(cipher, tag, m, mlen, aad, aadlen, k, n);
 }
 
-/* SNIPPET_END: EverCrypt_Chacha20Poly1305_aead_encrypt */
+/* SNIPPET_END: EverCrypt_Chacha20Poly1305_xaead_encrypt */
 
-/* SNIPPET_START: EverCrypt_Chacha20Poly1305_aead_decrypt */
+/* SNIPPET_START: EverCrypt_Chacha20Poly1305_xaead_decrypt */
 
 uint32_t
-EverCrypt_Chacha20Poly1305_aead_decrypt(
+EverCrypt_Chacha20Poly1305_xaead_decrypt(
   uint8_t *k,
   uint8_t *n,
   uint32_t aadlen,
@@ -86,20 +329,92 @@ EverCrypt_Chacha20Poly1305_aead_decrypt(
   if (vec256)
   {
     KRML_MAYBE_UNUSED_VAR(vec128);
-    return Hacl_AEAD_Chacha20Poly1305_Simd256_decrypt(m, cipher, mlen, aad, aadlen, k, n, tag);
+    return Hacl_AEAD_XChacha20Poly1305_Simd256_decrypt(m, cipher, mlen, aad, aadlen, k, n, tag);
   }
   #endif
   #if HACL_CAN_COMPILE_VEC128
   if (vec128)
   {
     KRML_MAYBE_UNUSED_VAR(vec256);
-    return Hacl_AEAD_Chacha20Poly1305_Simd128_decrypt(m, cipher, mlen, aad, aadlen, k, n, tag);
+    return Hacl_AEAD_XChacha20Poly1305_Simd128_decrypt(m, cipher, mlen, aad, aadlen, k, n, tag);
   }
   #endif
   KRML_MAYBE_UNUSED_VAR(vec128);
   KRML_MAYBE_UNUSED_VAR(vec256);
-  return Hacl_AEAD_Chacha20Poly1305_decrypt(m, cipher, mlen, aad, aadlen, k, n, tag);
+  return Hacl_AEAD_XChacha20Poly1305_decrypt(m, cipher, mlen, aad, aadlen, k, n, tag);
 }
 
-/* SNIPPET_END: EverCrypt_Chacha20Poly1305_aead_decrypt */
+/* SNIPPET_END: EverCrypt_Chacha20Poly1305_xaead_decrypt */
+
+/* SNIPPET_START: EverCrypt_Chacha20Poly1305_encrypt_batch */
+
+void
+EverCrypt_Chacha20Poly1305_encrypt_batch(
+  uint32_t len,
+  Hacl_AEAD_Chacha20Poly1305_packet *packets
+)
+{
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    Hacl_AEAD_Chacha20Poly1305_Simd256_encrypt_batch(len, packets);
+    return;
+  }
+  #endif
+  KRML_MAYBE_UNUSED_VAR(vec256);
+  for (uint32_t i = 0U; i < len; i++)
+  {
+    Hacl_AEAD_Chacha20Poly1305_packet p = packets[i];
+    EverCrypt_Chacha20Poly1305_aead_encrypt(p.key,
+      p.nonce,
+      p.data_len,
+      p.data,
+      p.input_len,
+      p.input,
+      p.output,
+      p.tag);
+  }
+}
+
+/* SNIPPET_END: EverCrypt_Chacha20Poly1305_encrypt_batch */
+
+/* SNIPPET_START: EverCrypt_Chacha20Poly1305_decrypt_batch */
+
+uint32_t
+EverCrypt_Chacha20Poly1305_decrypt_batch(
+  uint32_t len,
+  Hacl_AEAD_Chacha20Poly1305_packet *packets,
+  uint32_t *res
+)
+{
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    return Hacl_AEAD_Chacha20Poly1305_Simd256_decrypt_batch(len, packets, res);
+  }
+  #endif
+  KRML_MAYBE_UNUSED_VAR(vec256);
+  uint32_t failed = 0U;
+  for (uint32_t i = 0U; i < len; i++)
+  {
+    Hacl_AEAD_Chacha20Poly1305_packet p = packets[i];
+    uint32_t
+    r =
+      EverCrypt_Chacha20Poly1305_aead_decrypt(p.key,
+        p.nonce,
+        p.data_len,
+        p.data,
+        p.input_len,
+        p.output,
+        p.input,
+        p.tag);
+    res[i] = r;
+    failed = failed + r;
+  }
+  return failed;
+}
+
+/* SNIPPET_END: EverCrypt_Chacha20Poly1305_decrypt_batch */
 
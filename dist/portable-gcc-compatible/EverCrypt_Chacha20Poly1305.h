@@ -35,11 +35,32 @@ extern "C" {
 #include "krml/lowstar_endianness.h"
 #include "krml/internal/target.h"
 
+#include "Hacl_AEAD_Chacha20Poly1305_Simd512.h"
 #include "Hacl_AEAD_Chacha20Poly1305_Simd256.h"
 #include "Hacl_AEAD_Chacha20Poly1305_Simd128.h"
 #include "Hacl_AEAD_Chacha20Poly1305.h"
+#include "Hacl_AEAD_XChacha20Poly1305_Simd256.h"
+#include "Hacl_AEAD_XChacha20Poly1305_Simd128.h"
+#include "Hacl_AEAD_XChacha20Poly1305.h"
 #include "EverCrypt_AutoConfig2.h"
 
+/* SNIPPET_START: EverCrypt_Chacha20Poly1305_set_thresholds */
+
+/**
+Set the message lengths from which `aead_encrypt` and `aead_decrypt` use the 128-bit, 256-bit
+and 512-bit implementations, when the CPU supports them, replacing the defaults for the
+detected feature level (128, 257 and 513 bytes, for each width the CPU has). A deployment may
+re-tune them at startup with its own benchmark. Passing `0xFFFFFFFFU` disables a width for all
+message lengths.
+
+Like the `EverCrypt_AutoConfig2_disable_*` functions, this is meant to be called once at
+startup, before other threads use the library.
+*/
+void
+EverCrypt_Chacha20Poly1305_set_thresholds(uint32_t vec128, uint32_t vec256, uint32_t vec512);
+
+/* SNIPPET_END: EverCrypt_Chacha20Poly1305_set_thresholds */
+
 /* SNIPPET_START: EverCrypt_Chacha20Poly1305_aead_encrypt */
 
 void
@@ -72,6 +93,91 @@ EverCrypt_Chacha20Poly1305_aead_decrypt(
 
 /* SNIPPET_END: EverCrypt_Chacha20Poly1305_aead_decrypt */
 
+/* SNIPPET_START: EverCrypt_Chacha20Poly1305_xaead_encrypt */
+
+/**
+Encrypt a message with XChaCha20-Poly1305, i.e. with a 24-byte nonce.
+
+The argument order is the same as for `EverCrypt_Chacha20Poly1305_aead_encrypt`.
+*/
+void
+EverCrypt_Chacha20Poly1305_xaead_encrypt(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *tag
+);
+
+/* SNIPPET_END: EverCrypt_Chacha20Poly1305_xaead_encrypt */
+
+/* SNIPPET_START: EverCrypt_Chacha20Poly1305_xaead_decrypt */
+
+/**
+Decrypt a ciphertext with XChaCha20-Poly1305, i.e. with a 24-byte nonce.
+
+The argument order is the same as for `EverCrypt_Chacha20Poly1305_aead_decrypt`.
+
+@returns 0 on succeess; 1 on failure.
+*/
+uint32_t
+EverCrypt_Chacha20Poly1305_xaead_decrypt(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *tag
+);
+
+/* SNIPPET_END: EverCrypt_Chacha20Poly1305_xaead_decrypt */
+
+/* SNIPPET_START: EverCrypt_Chacha20Poly1305_encrypt_batch */
+
+/**
+Encrypt `len` independent packets.
+
+On AVX2-capable machines several packets share each vector pass, both for the ChaCha20 keystream
+and for the Poly1305 tags, which is faster than one `aead_encrypt` call per packet when packets are
+short.
+
+@param len Number of packets.
+@param packets Pointer to `len` packet descriptors.
+*/
+void
+EverCrypt_Chacha20Poly1305_encrypt_batch(
+  uint32_t len,
+  Hacl_AEAD_Chacha20Poly1305_packet *packets
+);
+
+/* SNIPPET_END: EverCrypt_Chacha20Poly1305_encrypt_batch */
+
+/* SNIPPET_START: EverCrypt_Chacha20Poly1305_decrypt_batch */
+
+/**
+Decrypt `len` independent packets.
+
+@param len Number of packets.
+@param packets Pointer to `len` packet descriptors.
+@param res Pointer to `len` result codes: 0 on success, 1 on failure, in which case the output of
+  the corresponding packet remains unchanged.
+
+@returns The number of packets that failed to authenticate.
+*/
+uint32_t
+EverCrypt_Chacha20Poly1305_decrypt_batch(
+  uint32_t len,
+  Hacl_AEAD_Chacha20Poly1305_packet *packets,
+  uint32_t *res
+);
+
+/* SNIPPET_END: EverCrypt_Chacha20Poly1305_decrypt_batch */
+
 #if defined(__cplusplus)
 }
 #endif
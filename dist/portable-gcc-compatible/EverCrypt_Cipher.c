@@ -25,7 +25,25 @@
 
 #include "EverCrypt_Cipher.h"
 
+#include "internal/Vale.h"
 #include "internal/Hacl_Chacha20.h"
+#include "lib_memzero0.h"
+#include "config.h"
+
+/* SNIPPET_START: EverCrypt_Cipher_aes_ctr_state_s */
+
+/**
+AES-CTR requires a state that holds the expanded key.
+The state may be reused as many times as desired.
+*/
+typedef struct EverCrypt_Cipher_aes_ctr_state_s_s
+{
+  Spec_Agile_Cipher_cipher_alg alg;
+  uint8_t *ek;
+}
+EverCrypt_Cipher_aes_ctr_state_s;
+
+/* SNIPPET_END: EverCrypt_Cipher_aes_ctr_state_s */
 
 /* SNIPPET_START: EverCrypt_Cipher_chacha20 */
 
@@ -39,6 +57,39 @@ EverCrypt_Cipher_chacha20(
   uint32_t ctr
 )
 {
+  bool avx512 = EverCrypt_AutoConfig2_has_avx512();
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  bool vec128 = EverCrypt_AutoConfig2_has_vec128();
+  #if HACL_CAN_COMPILE_VEC512
+  if (avx512)
+  {
+    KRML_MAYBE_UNUSED_VAR(vec256);
+    KRML_MAYBE_UNUSED_VAR(vec128);
+    Hacl_Chacha20_Vec512_chacha20_encrypt_512(len, dst, src, key, iv, ctr);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    KRML_MAYBE_UNUSED_VAR(avx512);
+    KRML_MAYBE_UNUSED_VAR(vec128);
+    Hacl_Chacha20_Vec256_chacha20_encrypt_256(len, dst, src, key, iv, ctr);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (vec128)
+  {
+    KRML_MAYBE_UNUSED_VAR(avx512);
+    KRML_MAYBE_UNUSED_VAR(vec256);
+    Hacl_Chacha20_Vec128_chacha20_encrypt_128(len, dst, src, key, iv, ctr);
+    return;
+  }
+  #endif
+  KRML_MAYBE_UNUSED_VAR(avx512);
+  KRML_MAYBE_UNUSED_VAR(vec128);
+  KRML_MAYBE_UNUSED_VAR(vec256);
   uint32_t ctx[16U] = { 0U };
   Hacl_Impl_Chacha20_chacha20_init(ctx, key, iv, ctr);
   Hacl_Impl_Chacha20_chacha20_update(ctx, len, dst, src);
@@ -46,3 +97,244 @@ EverCrypt_Cipher_chacha20(
 
 /* SNIPPET_END: EverCrypt_Cipher_chacha20 */
 
+/* SNIPPET_START: EverCrypt_Cipher_chacha20_seek */
+
+void
+EverCrypt_Cipher_chacha20_seek(
+  uint32_t len,
+  uint8_t *dst,
+  uint8_t *src,
+  uint8_t *key,
+  uint8_t *iv,
+  uint32_t ctr,
+  uint64_t offset
+)
+{
+  uint32_t c = ctr + (uint32_t)(offset / 64ULL);
+  uint32_t r = (uint32_t)(offset % 64ULL);
+  if (r > 0U && len > 0U)
+  {
+    uint32_t n0 = 64U - r;
+    if (len < n0)
+    {
+      n0 = len;
+    }
+    uint8_t tmp[64U] = { 0U };
+    memcpy(tmp + r, src, n0 * sizeof (uint8_t));
+    EverCrypt_Cipher_chacha20(64U, tmp, tmp, key, iv, c);
+    memcpy(dst, tmp + r, n0 * sizeof (uint8_t));
+    EverCrypt_Cipher_chacha20(len - n0, dst + n0, src + n0, key, iv, c + 1U);
+    return;
+  }
+  EverCrypt_Cipher_chacha20(len, dst, src, key, iv, c);
+}
+
+/* SNIPPET_END: EverCrypt_Cipher_chacha20_seek */
+
+/* SNIPPET_START: EverCrypt_Cipher_chacha20_ctr64 */
+
+/* The 64-bit counter layout (ctr_lo, ctr_hi, nonce) coincides with the RFC 8439 layout
+   (ctr32, nonce96) for nonce96 = le32(ctr_hi) || nonce, as long as ctr_lo does not wrap. We
+   therefore split the input at 2^32-block boundaries and run the vectorized 32-bit core on
+   each segment. */
+void
+EverCrypt_Cipher_chacha20_ctr64(
+  uint32_t len,
+  uint8_t *dst,
+  uint8_t *src,
+  uint8_t *key,
+  uint8_t *nonce,
+  uint64_t ctr
+)
+{
+  uint8_t n[12U] = { 0U };
+  memcpy(n + 4U, nonce, 8U * sizeof (uint8_t));
+  uint32_t rem = len;
+  uint8_t *d = dst;
+  uint8_t *s = src;
+  uint64_t c = ctr;
+  while (rem > 0U)
+  {
+    uint32_t lo = (uint32_t)c;
+    uint64_t left = (0x100000000ULL - (uint64_t)lo) * 64ULL;
+    uint32_t seg = rem;
+    if ((uint64_t)rem > left)
+    {
+      seg = (uint32_t)left;
+    }
+    store32_le(n, (uint32_t)(c >> 32U));
+    EverCrypt_Cipher_chacha20(seg, d, s, key, n, lo);
+    rem = rem - seg;
+    d = d + seg;
+    s = s + seg;
+    c = c + (uint64_t)(seg / 64U);
+  }
+}
+
+/* SNIPPET_END: EverCrypt_Cipher_chacha20_ctr64 */
+
+/* SNIPPET_START: EverCrypt_Cipher_chacha20_ctr64_seek */
+
+void
+EverCrypt_Cipher_chacha20_ctr64_seek(
+  uint32_t len,
+  uint8_t *dst,
+  uint8_t *src,
+  uint8_t *key,
+  uint8_t *nonce,
+  uint64_t ctr,
+  uint64_t offset
+)
+{
+  uint64_t c = ctr + offset / 64ULL;
+  uint32_t r = (uint32_t)(offset % 64ULL);
+  if (r > 0U && len > 0U)
+  {
+    uint32_t n0 = 64U - r;
+    if (len < n0)
+    {
+      n0 = len;
+    }
+    uint8_t tmp[64U] = { 0U };
+    memcpy(tmp + r, src, n0 * sizeof (uint8_t));
+    EverCrypt_Cipher_chacha20_ctr64(64U, tmp, tmp, key, nonce, c);
+    memcpy(dst, tmp + r, n0 * sizeof (uint8_t));
+    EverCrypt_Cipher_chacha20_ctr64(len - n0, dst + n0, src + n0, key, nonce, c + 1ULL);
+    return;
+  }
+  EverCrypt_Cipher_chacha20_ctr64(len, dst, src, key, nonce, c);
+}
+
+/* SNIPPET_END: EverCrypt_Cipher_chacha20_ctr64_seek */
+
+/* SNIPPET_START: EverCrypt_Cipher_aes_ctr_create_in */
+
+EverCrypt_Error_error_code
+EverCrypt_Cipher_aes_ctr_create_in(
+  Spec_Agile_Cipher_cipher_alg a,
+  EverCrypt_Cipher_aes_ctr_state_s **dst,
+  uint8_t *k
+)
+{
+  KRML_MAYBE_UNUSED_VAR(dst);
+  KRML_MAYBE_UNUSED_VAR(k);
+  #if HACL_CAN_COMPILE_VALE
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+  bool has_avx = EverCrypt_AutoConfig2_has_avx();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse)
+  {
+    switch (a)
+    {
+      case Spec_Agile_Cipher_AES128:
+        {
+          uint8_t *ek = (uint8_t *)KRML_HOST_CALLOC(176U, sizeof (uint8_t));
+          aes128_key_expansion(k, ek);
+          EverCrypt_Cipher_aes_ctr_state_s
+          *p =
+            (EverCrypt_Cipher_aes_ctr_state_s *)KRML_HOST_MALLOC(sizeof (
+                EverCrypt_Cipher_aes_ctr_state_s
+              ));
+          p[0U] = ((EverCrypt_Cipher_aes_ctr_state_s){ .alg = a, .ek = ek });
+          *dst = p;
+          return EverCrypt_Error_Success;
+        }
+      case Spec_Agile_Cipher_AES256:
+        {
+          uint8_t *ek = (uint8_t *)KRML_HOST_CALLOC(240U, sizeof (uint8_t));
+          aes256_key_expansion(k, ek);
+          EverCrypt_Cipher_aes_ctr_state_s
+          *p =
+            (EverCrypt_Cipher_aes_ctr_state_s *)KRML_HOST_MALLOC(sizeof (
+                EverCrypt_Cipher_aes_ctr_state_s
+              ));
+          p[0U] = ((EverCrypt_Cipher_aes_ctr_state_s){ .alg = a, .ek = ek });
+          *dst = p;
+          return EverCrypt_Error_Success;
+        }
+      default:
+        {
+          return EverCrypt_Error_UnsupportedAlgorithm;
+        }
+    }
+  }
+  return EverCrypt_Error_UnsupportedAlgorithm;
+  #else
+  KRML_MAYBE_UNUSED_VAR(a);
+  return EverCrypt_Error_UnsupportedAlgorithm;
+  #endif
+}
+
+/* SNIPPET_END: EverCrypt_Cipher_aes_ctr_create_in */
+
+/* SNIPPET_START: EverCrypt_Cipher_aes_ctr */
+
+void
+EverCrypt_Cipher_aes_ctr(
+  EverCrypt_Cipher_aes_ctr_state_s *s,
+  uint32_t len,
+  uint8_t *dst,
+  uint8_t *src,
+  uint8_t *iv,
+  uint64_t offset
+)
+{
+  KRML_MAYBE_UNUSED_VAR(s);
+  KRML_MAYBE_UNUSED_VAR(len);
+  KRML_MAYBE_UNUSED_VAR(dst);
+  KRML_MAYBE_UNUSED_VAR(src);
+  KRML_MAYBE_UNUSED_VAR(iv);
+  KRML_MAYBE_UNUSED_VAR(offset);
+  #if HACL_CAN_COMPILE_VALE
+  uint32_t nr;
+  if (s->alg == Spec_Agile_Cipher_AES128)
+  {
+    nr = 10U;
+  }
+  else
+  {
+    nr = 14U;
+  }
+  uint64_t c = offset / 16ULL;
+  uint32_t r = (uint32_t)(offset % 16ULL);
+  if (r > 0U && len > 0U)
+  {
+    uint32_t n0 = 16U - r;
+    if (len < n0)
+    {
+      n0 = len;
+    }
+    uint8_t tmp[16U] = { 0U };
+    memcpy(tmp + r, src, n0 * sizeof (uint8_t));
+    Hacl_AES_CTR_NI_aes_ctr(nr, s->ek, 16U, tmp, tmp, iv, c);
+    memcpy(dst, tmp + r, n0 * sizeof (uint8_t));
+    Hacl_AES_CTR_NI_aes_ctr(nr, s->ek, len - n0, dst + n0, src + n0, iv, c + 1ULL);
+    return;
+  }
+  Hacl_AES_CTR_NI_aes_ctr(nr, s->ek, len, dst, src, iv, c);
+  #endif
+}
+
+/* SNIPPET_END: EverCrypt_Cipher_aes_ctr */
+
+/* SNIPPET_START: EverCrypt_Cipher_aes_ctr_free */
+
+void EverCrypt_Cipher_aes_ctr_free(EverCrypt_Cipher_aes_ctr_state_s *s)
+{
+  uint32_t ek_len;
+  if (s->alg == Spec_Agile_Cipher_AES128)
+  {
+    ek_len = 176U;
+  }
+  else
+  {
+    ek_len = 240U;
+  }
+  Lib_Memzero0_memzero(s->ek, ek_len, uint8_t, void *);
+  KRML_HOST_FREE(s->ek);
+  KRML_HOST_FREE(s);
+}
+
+/* SNIPPET_END: EverCrypt_Cipher_aes_ctr_free */
+
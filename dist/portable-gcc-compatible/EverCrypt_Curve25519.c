@@ -108,3 +108,58 @@ bool EverCrypt_Curve25519_ecdh(uint8_t *shared, uint8_t *my_priv, uint8_t *their
 
 /* SNIPPET_END: EverCrypt_Curve25519_ecdh */
 
+/* SNIPPET_START: EverCrypt_Curve25519_ecdh_batch */
+
+/**
+Execute many independent diffie-hellmann key exchanges.
+
+@param n Number of key exchanges.
+@param shared Pointer to n * 32 bytes of memory where the resulting points are written to.
+@param my_priv Pointer to n * 32 bytes of memory where **our** secret/private keys are read from.
+@param their_pub Pointer to n * 32 bytes of memory where **their** public points are read from.
+@param results Pointer to n booleans, each set as `EverCrypt_Curve25519_ecdh` would return it.
+
+On CPUs with AVX2, groups of four exchanges run in the lanes of
+`Hacl_Curve25519_Vec256_scalarmult4`; the rest go through `EverCrypt_Curve25519_scalarmult`.
+Returns `true` if every exchange succeeded.
+*/
+bool
+EverCrypt_Curve25519_ecdh_batch(
+  uint32_t n,
+  uint8_t *shared,
+  uint8_t *my_priv,
+  uint8_t *their_pub,
+  bool *results
+)
+{
+  uint32_t i = 0U;
+  #if HACL_CAN_COMPILE_VEC256
+  if (EverCrypt_AutoConfig2_has_avx2())
+  {
+    for (; n - i >= 4U; i = i + 4U)
+    {
+      Hacl_Curve25519_Vec256_scalarmult4(shared + 32U * i, my_priv + 32U * i, their_pub + 32U * i);
+    }
+  }
+  #endif
+  for (; i < n; i++)
+  {
+    EverCrypt_Curve25519_scalarmult(shared + 32U * i, my_priv + 32U * i, their_pub + 32U * i);
+  }
+  bool all = true;
+  for (uint32_t j = 0U; j < n; j++)
+  {
+    uint8_t res = 255U;
+    for (uint32_t k = 0U; k < 32U; k++)
+    {
+      uint8_t uu____0 = FStar_UInt8_eq_mask(shared[32U * j + k], 0U);
+      res = (uint32_t)uu____0 & (uint32_t)res;
+    }
+    results[j] = res != 255U;
+    all = all && results[j];
+  }
+  return all;
+}
+
+/* SNIPPET_END: EverCrypt_Curve25519_ecdh_batch */
+
@@ -23,10 +23,12 @@
  */
 
 
-#include "EverCrypt_DRBG.h"
+#include "internal/EverCrypt_DRBG.h"
 
 #include "internal/EverCrypt_HMAC.h"
+#include "internal/Vale.h"
 #include "lib_memzero0.h"
+#include "config.h"
 
 /* SNIPPET_START: EverCrypt_DRBG_reseed_interval */
 
@@ -96,11 +98,34 @@ uint32_t EverCrypt_DRBG_min_length(Spec_Hash_Definitions_hash_alg a)
 #define SHA2_256_s 1
 #define SHA2_384_s 2
 #define SHA2_512_s 3
+#define CTR_AES256_s 4
+#define CHACHA20_s 5
 
 /* SNIPPET_END: state_s_tags */
 
 typedef uint8_t state_s_tags;
 
+/* SNIPPET_START: ctr_drbg_state */
+
+/* SP 800-90A CTR_DRBG state: Key, V and the expanded AES-256 key schedule of Key. */
+typedef struct ctr_drbg_state_s
+{
+  uint8_t k[32U];
+  uint8_t v[16U];
+  uint8_t ek[240U];
+  uint32_t reseed_counter;
+}
+ctr_drbg_state;
+
+/* SNIPPET_END: ctr_drbg_state */
+
+/* SNIPPET_START: chacha20_drbg_state */
+
+/* ChaCha20 DRBG state: a single key, replaced after every request (fast key erasure). */
+typedef struct chacha20_drbg_state_s { uint8_t k[32U]; } chacha20_drbg_state;
+
+/* SNIPPET_END: chacha20_drbg_state */
+
 /* SNIPPET_START: EverCrypt_DRBG_state_s */
 
 typedef struct EverCrypt_DRBG_state_s_s
@@ -111,6 +136,8 @@ typedef struct EverCrypt_DRBG_state_s_s
     Hacl_HMAC_DRBG_state case_SHA2_256_s;
     Hacl_HMAC_DRBG_state case_SHA2_384_s;
     Hacl_HMAC_DRBG_state case_SHA2_512_s;
+    ctr_drbg_state case_CTR_AES256_s;
+    chacha20_drbg_state case_CHACHA20_s;
   }
   ;
 }
@@ -291,6 +318,53 @@ EverCrypt_DRBG_state_s *EverCrypt_DRBG_create(Spec_Hash_Definitions_hash_alg a)
 
 /* SNIPPET_END: EverCrypt_DRBG_create */
 
+/* SNIPPET_START: EverCrypt_DRBG_create_ctr_aes256 */
+
+/**
+Create a CTR_DRBG state: SP 800-90A CTR_DRBG with AES-256 and no derivation function.
+Instantiation fails on CPUs without AES-NI.
+
+@return DRBG state, or NULL if allocation fails. Needs to be freed via
+  `EverCrypt_DRBG_uninstantiate`.
+*/
+EverCrypt_DRBG_state_s *EverCrypt_DRBG_create_ctr_aes256(void)
+{
+  EverCrypt_DRBG_state_s
+  *st = (EverCrypt_DRBG_state_s *)KRML_HOST_CALLOC(1U, sizeof (EverCrypt_DRBG_state_s));
+  if (st == NULL)
+  {
+    return NULL;
+  }
+  st->tag = CTR_AES256_s;
+  st->case_CTR_AES256_s.reseed_counter = 1U;
+  return st;
+}
+
+/* SNIPPET_END: EverCrypt_DRBG_create_ctr_aes256 */
+
+/* SNIPPET_START: EverCrypt_DRBG_create_chacha20 */
+
+/**
+Create a ChaCha20 DRBG state: a ChaCha20 keystream generator whose key is replaced after every
+request.
+
+@return DRBG state, or NULL if allocation fails. Needs to be freed via
+  `EverCrypt_DRBG_uninstantiate`.
+*/
+EverCrypt_DRBG_state_s *EverCrypt_DRBG_create_chacha20(void)
+{
+  EverCrypt_DRBG_state_s
+  *st = (EverCrypt_DRBG_state_s *)KRML_HOST_CALLOC(1U, sizeof (EverCrypt_DRBG_state_s));
+  if (st == NULL)
+  {
+    return NULL;
+  }
+  st->tag = CHACHA20_s;
+  return st;
+}
+
+/* SNIPPET_END: EverCrypt_DRBG_create_chacha20 */
+
 /* SNIPPET_START: instantiate_sha1 */
 
 static bool
@@ -1971,6 +2045,671 @@ static void uninstantiate_sha2_512(EverCrypt_DRBG_state_s *st)
 
 /* SNIPPET_END: uninstantiate_sha2_512 */
 
+/* SNIPPET_START: ctr_aes256_supported */
+
+static bool ctr_aes256_supported(void)
+{
+  #if HACL_CAN_COMPILE_VALE
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+  bool has_avx = EverCrypt_AutoConfig2_has_avx();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  return has_aesni && has_pclmulqdq && has_avx && has_sse;
+  #else
+  return false;
+  #endif
+}
+
+/* SNIPPET_END: ctr_aes256_supported */
+
+/* SNIPPET_START: ctr_drbg_increment */
+
+/* V := V + n, as a 128-bit big-endian integer. */
+static void ctr_drbg_increment(uint8_t *v, uint64_t n)
+{
+  uint64_t hi = load64_be(v);
+  uint64_t lo = load64_be(v + 8U);
+  uint64_t lo1 = lo + n;
+  if (lo1 < lo)
+  {
+    hi++;
+  }
+  store64_be(v, hi);
+  store64_be(v + 8U, lo1);
+}
+
+/* SNIPPET_END: ctr_drbg_increment */
+
+/* SNIPPET_START: ctr_drbg_update */
+
+/* CTR_DRBG_Update (SP 800-90A, 10.2.1.2) with seedlen = 48 bytes. */
+static void ctr_drbg_update(ctr_drbg_state *s, uint8_t *provided_data)
+{
+  #if HACL_CAN_COMPILE_VALE
+  uint8_t temp[48U] = { 0U };
+  Hacl_AES_CTR_NI_aes_ctr(14U, s->ek, 48U, temp, temp, s->v, 1ULL);
+  for (uint32_t i = 0U; i < 48U; i++)
+  {
+    temp[i] ^= provided_data[i];
+  }
+  memcpy(s->k, temp, 32U);
+  memcpy(s->v, temp + 32U, 16U);
+  aes256_key_expansion(s->k, s->ek);
+  Lib_Memzero0_memzero(temp, 48U, uint8_t, void *);
+  #else
+  KRML_MAYBE_UNUSED_VAR(s);
+  KRML_MAYBE_UNUSED_VAR(provided_data);
+  #endif
+}
+
+/* SNIPPET_END: ctr_drbg_update */
+
+/* SNIPPET_START: ctr_drbg_seed */
+
+/* seed_material := entropy XOR input, where input is at most 48 bytes; this is the
+   no-derivation-function variant of CTR_DRBG, which requires exactly 48 bytes of entropy. */
+static bool
+ctr_drbg_seed(
+  uint8_t *seed_material,
+  uint8_t *entropy,
+  uint32_t entropy_len,
+  uint8_t *input,
+  uint32_t input_len
+)
+{
+  if (entropy_len != 48U || input_len > 48U || !ctr_aes256_supported())
+  {
+    return false;
+  }
+  memcpy(seed_material, entropy, 48U);
+  for (uint32_t i = 0U; i < input_len; i++)
+  {
+    seed_material[i] ^= input[i];
+  }
+  return true;
+}
+
+/* SNIPPET_END: ctr_drbg_seed */
+
+/* SNIPPET_START: ctr_drbg_instantiate */
+
+static bool
+ctr_drbg_instantiate(
+  ctr_drbg_state *s,
+  uint8_t *entropy,
+  uint32_t entropy_len,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+)
+{
+  uint8_t seed_material[48U] = { 0U };
+  if
+  (
+    !ctr_drbg_seed(seed_material,
+      entropy,
+      entropy_len,
+      personalization_string,
+      personalization_string_len)
+  )
+  {
+    return false;
+  }
+  memset(s->k, 0U, 32U);
+  memset(s->v, 0U, 16U);
+  #if HACL_CAN_COMPILE_VALE
+  aes256_key_expansion(s->k, s->ek);
+  #endif
+  ctr_drbg_update(s, seed_material);
+  s->reseed_counter = 1U;
+  Lib_Memzero0_memzero(seed_material, 48U, uint8_t, void *);
+  return true;
+}
+
+/* SNIPPET_END: ctr_drbg_instantiate */
+
+/* SNIPPET_START: ctr_drbg_reseed */
+
+static bool
+ctr_drbg_reseed(
+  ctr_drbg_state *s,
+  uint8_t *entropy,
+  uint32_t entropy_len,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  uint8_t seed_material[48U] = { 0U };
+  if (!ctr_drbg_seed(seed_material, entropy, entropy_len, additional_input, additional_input_len))
+  {
+    return false;
+  }
+  ctr_drbg_update(s, seed_material);
+  s->reseed_counter = 1U;
+  Lib_Memzero0_memzero(seed_material, 48U, uint8_t, void *);
+  return true;
+}
+
+/* SNIPPET_END: ctr_drbg_reseed */
+
+/* SNIPPET_START: ctr_drbg_generate */
+
+/* CTR_DRBG_Generate (SP 800-90A, 10.2.1.5.1) for a single request of at most
+   `EverCrypt_DRBG_max_output_length` bytes. */
+static bool
+ctr_drbg_generate(
+  ctr_drbg_state *s,
+  uint8_t *output,
+  uint32_t n,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  if
+  (
+    n
+    > EverCrypt_DRBG_max_output_length
+    || additional_input_len > 48U
+    || s->reseed_counter > EverCrypt_DRBG_reseed_interval
+    || !ctr_aes256_supported()
+  )
+  {
+    return false;
+  }
+  uint8_t additional[48U] = { 0U };
+  if (additional_input_len > 0U)
+  {
+    memcpy(additional, additional_input, additional_input_len);
+    ctr_drbg_update(s, additional);
+  }
+  memset(output, 0U, n);
+  #if HACL_CAN_COMPILE_VALE
+  Hacl_AES_CTR_NI_aes_ctr(14U, s->ek, n, output, output, s->v, 1ULL);
+  #endif
+  ctr_drbg_increment(s->v, (uint64_t)((n + 15U) / 16U));
+  ctr_drbg_update(s, additional);
+  s->reseed_counter++;
+  Lib_Memzero0_memzero(additional, 48U, uint8_t, void *);
+  return true;
+}
+
+/* SNIPPET_END: ctr_drbg_generate */
+
+/* SNIPPET_START: ctr_drbg_reseed_system */
+
+/* Reseed `s` from the system source. */
+static bool
+ctr_drbg_reseed_system(ctr_drbg_state *s, uint8_t *additional_input, uint32_t additional_input_len)
+{
+  uint8_t entropy[48U] = { 0U };
+  if (!Lib_RandomBuffer_System_randombytes(entropy, 48U))
+  {
+    return false;
+  }
+  bool ok = ctr_drbg_reseed(s, entropy, 48U, additional_input, additional_input_len);
+  Lib_Memzero0_memzero(entropy, 48U, uint8_t, void *);
+  return ok;
+}
+
+/* SNIPPET_END: ctr_drbg_reseed_system */
+
+/* SNIPPET_START: instantiate_ctr_aes256 */
+
+static bool
+instantiate_ctr_aes256(
+  EverCrypt_DRBG_state_s *st,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+)
+{
+  uint8_t entropy[48U] = { 0U };
+  if (!Lib_RandomBuffer_System_randombytes(entropy, 48U))
+  {
+    return false;
+  }
+  bool
+  ok =
+    ctr_drbg_instantiate(&st->case_CTR_AES256_s,
+      entropy,
+      48U,
+      personalization_string,
+      personalization_string_len);
+  Lib_Memzero0_memzero(entropy, 48U, uint8_t, void *);
+  return ok;
+}
+
+/* SNIPPET_END: instantiate_ctr_aes256 */
+
+/* SNIPPET_START: reseed_ctr_aes256 */
+
+static bool
+reseed_ctr_aes256(
+  EverCrypt_DRBG_state_s *st,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  return ctr_drbg_reseed_system(&st->case_CTR_AES256_s, additional_input, additional_input_len);
+}
+
+/* SNIPPET_END: reseed_ctr_aes256 */
+
+/* SNIPPET_START: generate_ctr_aes256 */
+
+/* Requests longer than `EverCrypt_DRBG_max_output_length` are split, reseeding whenever the
+   reseed interval is reached. */
+static bool
+generate_ctr_aes256(
+  uint8_t *output,
+  EverCrypt_DRBG_state_s *st,
+  uint32_t n,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  ctr_drbg_state *s = &st->case_CTR_AES256_s;
+  if (!ctr_drbg_reseed_system(s, additional_input, additional_input_len))
+  {
+    return false;
+  }
+  while (n > 0U)
+  {
+    if (s->reseed_counter > EverCrypt_DRBG_reseed_interval && !ctr_drbg_reseed_system(s, NULL, 0U))
+    {
+      return false;
+    }
+    uint32_t len = n;
+    if (len > EverCrypt_DRBG_max_output_length)
+    {
+      len = EverCrypt_DRBG_max_output_length;
+    }
+    if (!ctr_drbg_generate(s, output, len, NULL, 0U))
+    {
+      return false;
+    }
+    n -= len;
+    output += len;
+  }
+  return true;
+}
+
+/* SNIPPET_END: generate_ctr_aes256 */
+
+/* SNIPPET_START: uninstantiate_ctr_aes256 */
+
+static void uninstantiate_ctr_aes256(EverCrypt_DRBG_state_s *st)
+{
+  Lib_Memzero0_memzero(&st->case_CTR_AES256_s, 1U, ctr_drbg_state, void *);
+  KRML_HOST_FREE(st);
+}
+
+/* SNIPPET_END: uninstantiate_ctr_aes256 */
+
+/* SNIPPET_START: chacha20_drbg_mix */
+
+/* k := HMAC-SHA2-256(seed, k || data). Returns false if `k || data` does not fit on the stack
+   and cannot be allocated. */
+static bool
+chacha20_drbg_mix(
+  uint8_t *k,
+  uint8_t *seed,
+  uint32_t seed_len,
+  uint8_t *data,
+  uint32_t data_len
+)
+{
+  uint8_t buf[128U];
+  uint32_t input_len = 32U + data_len;
+  uint8_t *input = buf;
+  if (input_len > sizeof (buf))
+  {
+    input = (uint8_t *)KRML_HOST_MALLOC(input_len);
+    if (input == NULL)
+    {
+      return false;
+    }
+  }
+  memcpy(input, k, 32U);
+  if (data_len > 0U)
+  {
+    memcpy(input + 32U, data, data_len);
+  }
+  EverCrypt_HMAC_compute_sha2_256(k, seed, seed_len, input, input_len);
+  Lib_Memzero0_memzero(input, input_len, uint8_t, void *);
+  if (input != buf)
+  {
+    KRML_HOST_FREE(input);
+  }
+  return true;
+}
+
+/* SNIPPET_END: chacha20_drbg_mix */
+
+/* SNIPPET_START: chacha20_drbg_instantiate */
+
+static bool
+chacha20_drbg_instantiate(
+  chacha20_drbg_state *s,
+  uint8_t *entropy,
+  uint32_t entropy_len,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+)
+{
+  if
+  (
+    entropy_len
+    < 32U
+    || personalization_string_len > EverCrypt_DRBG_max_personalization_string_length
+  )
+  {
+    return false;
+  }
+  memset(s->k, 0U, 32U);
+  return
+    chacha20_drbg_mix(s->k,
+      entropy,
+      entropy_len,
+      personalization_string,
+      personalization_string_len);
+}
+
+/* SNIPPET_END: chacha20_drbg_instantiate */
+
+/* SNIPPET_START: chacha20_drbg_reseed */
+
+static bool
+chacha20_drbg_reseed(
+  chacha20_drbg_state *s,
+  uint8_t *entropy,
+  uint32_t entropy_len,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  if (entropy_len < 32U || additional_input_len > EverCrypt_DRBG_max_additional_input_length)
+  {
+    return false;
+  }
+  return chacha20_drbg_mix(s->k, entropy, entropy_len, additional_input, additional_input_len);
+}
+
+/* SNIPPET_END: chacha20_drbg_reseed */
+
+/* SNIPPET_START: chacha20_drbg_generate */
+
+/* The ChaCha20 DRBG only absorbs additional input when reseeding, so none is accepted
+   here. */
+static bool
+chacha20_drbg_generate(
+  chacha20_drbg_state *s,
+  uint8_t *output,
+  uint32_t n,
+  uint32_t additional_input_len
+)
+{
+  if (additional_input_len > 0U)
+  {
+    return false;
+  }
+  uint8_t nonce[12U] = { 0U };
+  uint8_t next[32U] = { 0U };
+  /* Block 0 becomes the next key; the output starts at block 1. */
+  EverCrypt_Cipher_chacha20(32U, next, next, s->k, nonce, 0U);
+  memset(output, 0U, n);
+  EverCrypt_Cipher_chacha20(n, output, output, s->k, nonce, 1U);
+  memcpy(s->k, next, 32U);
+  Lib_Memzero0_memzero(next, 32U, uint8_t, void *);
+  return true;
+}
+
+/* SNIPPET_END: chacha20_drbg_generate */
+
+/* SNIPPET_START: chacha20_drbg_reseed_system */
+
+/* Reseed `s` from the system source. */
+static bool
+chacha20_drbg_reseed_system(
+  chacha20_drbg_state *s,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  uint8_t entropy[32U] = { 0U };
+  if (!Lib_RandomBuffer_System_randombytes(entropy, 32U))
+  {
+    return false;
+  }
+  bool ok = chacha20_drbg_reseed(s, entropy, 32U, additional_input, additional_input_len);
+  Lib_Memzero0_memzero(entropy, 32U, uint8_t, void *);
+  return ok;
+}
+
+/* SNIPPET_END: chacha20_drbg_reseed_system */
+
+/* SNIPPET_START: instantiate_chacha20 */
+
+static bool
+instantiate_chacha20(
+  EverCrypt_DRBG_state_s *st,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+)
+{
+  uint8_t entropy[48U] = { 0U };
+  if (!Lib_RandomBuffer_System_randombytes(entropy, 48U))
+  {
+    return false;
+  }
+  bool
+  ok =
+    chacha20_drbg_instantiate(&st->case_CHACHA20_s,
+      entropy,
+      48U,
+      personalization_string,
+      personalization_string_len);
+  Lib_Memzero0_memzero(entropy, 48U, uint8_t, void *);
+  return ok;
+}
+
+/* SNIPPET_END: instantiate_chacha20 */
+
+/* SNIPPET_START: reseed_chacha20 */
+
+static bool
+reseed_chacha20(
+  EverCrypt_DRBG_state_s *st,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  return chacha20_drbg_reseed_system(&st->case_CHACHA20_s, additional_input, additional_input_len);
+}
+
+/* SNIPPET_END: reseed_chacha20 */
+
+/* SNIPPET_START: generate_chacha20 */
+
+static bool
+generate_chacha20(
+  uint8_t *output,
+  EverCrypt_DRBG_state_s *st,
+  uint32_t n,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  chacha20_drbg_state *s = &st->case_CHACHA20_s;
+  if (!chacha20_drbg_reseed_system(s, additional_input, additional_input_len))
+  {
+    return false;
+  }
+  return chacha20_drbg_generate(s, output, n, 0U);
+}
+
+/* SNIPPET_END: generate_chacha20 */
+
+/* SNIPPET_START: uninstantiate_chacha20 */
+
+static void uninstantiate_chacha20(EverCrypt_DRBG_state_s *st)
+{
+  Lib_Memzero0_memzero(&st->case_CHACHA20_s, 1U, chacha20_drbg_state, void *);
+  KRML_HOST_FREE(st);
+}
+
+/* SNIPPET_END: uninstantiate_chacha20 */
+
+/* SNIPPET_START: EverCrypt_DRBG_instantiate_with_entropy */
+
+/**
+Instantiate the DRBG from caller-supplied entropy instead of the system source.
+
+@param st Pointer to a CTR_DRBG or ChaCha20 DRBG state.
+@param entropy Pointer to `entropy_len` bytes of entropy input.
+@param entropy_len Length of entropy input: exactly 48 bytes for CTR_DRBG, at least 32 for ChaCha20.
+@param personalization_string Pointer to `personalization_string_len` bytes of memory where personalization string is read from.
+@param personalization_string_len Length of personalization string.
+
+@return True if and only if instantiation was successful. Always false for HMAC_DRBG states.
+*/
+bool
+EverCrypt_DRBG_instantiate_with_entropy(
+  EverCrypt_DRBG_state_s *st,
+  uint8_t *entropy,
+  uint32_t entropy_len,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+)
+{
+  switch (st->tag)
+  {
+    case CTR_AES256_s:
+      {
+        return
+          ctr_drbg_instantiate(&st->case_CTR_AES256_s,
+            entropy,
+            entropy_len,
+            personalization_string,
+            personalization_string_len);
+      }
+    case CHACHA20_s:
+      {
+        return
+          chacha20_drbg_instantiate(&st->case_CHACHA20_s,
+            entropy,
+            entropy_len,
+            personalization_string,
+            personalization_string_len);
+      }
+    default:
+      {
+        return false;
+      }
+  }
+}
+
+/* SNIPPET_END: EverCrypt_DRBG_instantiate_with_entropy */
+
+/* SNIPPET_START: EverCrypt_DRBG_reseed_with_entropy */
+
+/**
+Reseed the DRBG from caller-supplied entropy instead of the system source.
+
+@param st Pointer to a CTR_DRBG or ChaCha20 DRBG state.
+@param entropy Pointer to `entropy_len` bytes of entropy input.
+@param entropy_len Length of entropy input: exactly 48 bytes for CTR_DRBG, at least 32 for ChaCha20.
+@param additional_input Pointer to `additional_input_len` bytes of memory where additional input is read from.
+@param additional_input_len Length of additional input.
+
+@return True if and only if reseed was successful. Always false for HMAC_DRBG states.
+*/
+bool
+EverCrypt_DRBG_reseed_with_entropy(
+  EverCrypt_DRBG_state_s *st,
+  uint8_t *entropy,
+  uint32_t entropy_len,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  switch (st->tag)
+  {
+    case CTR_AES256_s:
+      {
+        return
+          ctr_drbg_reseed(&st->case_CTR_AES256_s,
+            entropy,
+            entropy_len,
+            additional_input,
+            additional_input_len);
+      }
+    case CHACHA20_s:
+      {
+        return
+          chacha20_drbg_reseed(&st->case_CHACHA20_s,
+            entropy,
+            entropy_len,
+            additional_input,
+            additional_input_len);
+      }
+    default:
+      {
+        return false;
+      }
+  }
+}
+
+/* SNIPPET_END: EverCrypt_DRBG_reseed_with_entropy */
+
+/* SNIPPET_START: EverCrypt_DRBG_generate_no_reseed */
+
+/**
+Generate output without drawing fresh entropy. `EverCrypt_DRBG_generate` is a reseed from
+the system source followed by this function.
+
+@param output Pointer to `n` bytes of memory where random output is written to.
+@param st Pointer to a CTR_DRBG or ChaCha20 DRBG state.
+@param n Length of desired output.
+@param additional_input Pointer to `additional_input_len` bytes of memory where additional input is read from.
+@param additional_input_len Length of additional input.
+
+@return True if and only if generate was successful. Always false for HMAC_DRBG states.
+  CTR_DRBG states fail once the reseed interval is reached, and reject `n` above
+  `EverCrypt_DRBG_max_output_length` or more than 48 bytes of additional input.
+  ChaCha20 states reject any additional input.
+*/
+bool
+EverCrypt_DRBG_generate_no_reseed(
+  uint8_t *output,
+  EverCrypt_DRBG_state_s *st,
+  uint32_t n,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  switch (st->tag)
+  {
+    case CTR_AES256_s:
+      {
+        return
+          ctr_drbg_generate(&st->case_CTR_AES256_s,
+            output,
+            n,
+            additional_input,
+            additional_input_len);
+      }
+    case CHACHA20_s:
+      {
+        return chacha20_drbg_generate(&st->case_CHACHA20_s, output, n, additional_input_len);
+      }
+    default:
+      {
+        return false;
+      }
+  }
+}
+
+/* SNIPPET_END: EverCrypt_DRBG_generate_no_reseed */
+
 /* SNIPPET_START: EverCrypt_DRBG_instantiate */
 
 /**
@@ -1980,7 +2719,9 @@ Instantiate the DRBG.
 @param personalization_string Pointer to `personalization_string_len` bytes of memory where personalization string is read from.
 @param personalization_string_len Length of personalization string.
 
-@return True if and only if instantiation was successful.
+@return True if and only if instantiation was successful. For CTR_DRBG states, which
+  uses no derivation function, this also fails if the personalization string exceeds 48 bytes
+  or the CPU does not support AES-NI.
 */
 bool
 EverCrypt_DRBG_instantiate(
@@ -2006,6 +2747,14 @@ EverCrypt_DRBG_instantiate(
   {
     return instantiate_sha2_512(st, personalization_string, personalization_string_len);
   }
+  if (scrut.tag == CTR_AES256_s)
+  {
+    return instantiate_ctr_aes256(st, personalization_string, personalization_string_len);
+  }
+  if (scrut.tag == CHACHA20_s)
+  {
+    return instantiate_chacha20(st, personalization_string, personalization_string_len);
+  }
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -2050,6 +2799,14 @@ EverCrypt_DRBG_reseed(
   {
     return reseed_sha2_512(st, additional_input, additional_input_len);
   }
+  if (scrut.tag == CTR_AES256_s)
+  {
+    return reseed_ctr_aes256(st, additional_input, additional_input_len);
+  }
+  if (scrut.tag == CHACHA20_s)
+  {
+    return reseed_chacha20(st, additional_input, additional_input_len);
+  }
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -2070,7 +2827,9 @@ Generate output.
 @param additional_input_input Pointer to `additional_input_input_len` bytes of memory where additional input is read from.
 @param additional_input_input_len Length of additional input.
 
-@return True if and only if generate was successful.
+@return True if and only if generate was successful. HMAC_DRBG states reject `n` above
+  `EverCrypt_DRBG_max_output_length`; CTR_DRBG and ChaCha20 states accept any `n`.
+  For CTR_DRBG states, additional input is limited to 48 bytes.
 */
 bool
 EverCrypt_DRBG_generate(
@@ -2098,6 +2857,14 @@ EverCrypt_DRBG_generate(
   {
     return generate_sha2_512(output, st, n, additional_input, additional_input_len);
   }
+  if (scrut.tag == CTR_AES256_s)
+  {
+    return generate_ctr_aes256(output, st, n, additional_input, additional_input_len);
+  }
+  if (scrut.tag == CHACHA20_s)
+  {
+    return generate_chacha20(output, st, n, additional_input, additional_input_len);
+  }
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -2137,6 +2904,16 @@ void EverCrypt_DRBG_uninstantiate(EverCrypt_DRBG_state_s *st)
     uninstantiate_sha2_512(st);
     return;
   }
+  if (scrut.tag == CTR_AES256_s)
+  {
+    uninstantiate_ctr_aes256(st);
+    return;
+  }
+  if (scrut.tag == CHACHA20_s)
+  {
+    uninstantiate_chacha20(st);
+    return;
+  }
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
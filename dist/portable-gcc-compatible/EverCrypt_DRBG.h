@@ -38,6 +38,9 @@ extern "C" {
 #include "Lib_RandomBuffer_System.h"
 #include "Hacl_Streaming_Types.h"
 #include "Hacl_HMAC_DRBG.h"
+#include "Hacl_AES_CTR_NI.h"
+#include "EverCrypt_Cipher.h"
+#include "EverCrypt_AutoConfig2.h"
 
 /* SNIPPET_START: EverCrypt_DRBG_supported_alg */
 
@@ -150,6 +153,32 @@ EverCrypt_DRBG_state_s *EverCrypt_DRBG_create(Spec_Hash_Definitions_hash_alg a);
 
 /* SNIPPET_END: EverCrypt_DRBG_create */
 
+/* SNIPPET_START: EverCrypt_DRBG_create_ctr_aes256 */
+
+/**
+Create a CTR_DRBG state: SP 800-90A CTR_DRBG with AES-256 and no derivation function.
+Instantiation fails on CPUs without AES-NI.
+
+@return DRBG state, or NULL if allocation fails. Needs to be freed via
+  `EverCrypt_DRBG_uninstantiate`.
+*/
+EverCrypt_DRBG_state_s *EverCrypt_DRBG_create_ctr_aes256(void);
+
+/* SNIPPET_END: EverCrypt_DRBG_create_ctr_aes256 */
+
+/* SNIPPET_START: EverCrypt_DRBG_create_chacha20 */
+
+/**
+Create a ChaCha20 DRBG state: a ChaCha20 keystream generator whose key is replaced after every
+request.
+
+@return DRBG state, or NULL if allocation fails. Needs to be freed via
+  `EverCrypt_DRBG_uninstantiate`.
+*/
+EverCrypt_DRBG_state_s *EverCrypt_DRBG_create_chacha20(void);
+
+/* SNIPPET_END: EverCrypt_DRBG_create_chacha20 */
+
 /* SNIPPET_START: EverCrypt_DRBG_instantiate */
 
 /**
@@ -159,7 +188,9 @@ Instantiate the DRBG.
 @param personalization_string Pointer to `personalization_string_len` bytes of memory where personalization string is read from.
 @param personalization_string_len Length of personalization string.
 
-@return True if and only if instantiation was successful.
+@return True if and only if instantiation was successful. For CTR_DRBG states, which
+  uses no derivation function, this also fails if the personalization string exceeds 48 bytes
+  or the CPU does not support AES-NI.
 */
 bool
 EverCrypt_DRBG_instantiate(
@@ -201,7 +232,9 @@ Generate output.
 @param additional_input_input Pointer to `additional_input_input_len` bytes of memory where additional input is read from.
 @param additional_input_input_len Length of additional input.
 
-@return True if and only if generate was successful.
+@return True if and only if generate was successful. HMAC_DRBG states reject `n` above
+  `EverCrypt_DRBG_max_output_length`; CTR_DRBG and ChaCha20 states accept any `n`.
+  For CTR_DRBG states, additional input is limited to 48 bytes.
 */
 bool
 EverCrypt_DRBG_generate(
@@ -0,0 +1,268 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "EverCrypt_DRBG_Pool.h"
+
+#include "lib_memzero0.h"
+
+#if (defined(_WIN32) || defined(_WIN64))
+#include <windows.h>
+#define POOL_THREAD_LOCAL __declspec(thread)
+#else
+#include <pthread.h>
+#define POOL_THREAD_LOCAL _Thread_local
+#endif
+
+/* SNIPPET_START: POOL_ALG */
+
+#define POOL_ALG Spec_Hash_Definitions_SHA2_256
+
+/* SNIPPET_END: POOL_ALG */
+
+/* SNIPPET_START: POOL_HASH_LEN */
+
+#define POOL_HASH_LEN 32U
+
+/* SNIPPET_END: POOL_HASH_LEN */
+
+/* SNIPPET_START: pool_entry */
+
+/* Entropy (32 bytes) followed by the instantiation nonce (16 bytes). */
+#define POOL_SEED_LEN 48U
+
+/* SNIPPET_END: pool_entry */
+
+typedef struct pool_entry_s
+{
+  Hacl_HMAC_DRBG_state st;
+  uint64_t generation;
+  bool live;
+}
+pool_entry;
+
+/* SNIPPET_START: thread_entry */
+
+static POOL_THREAD_LOCAL pool_entry thread_entry;
+
+/* SNIPPET_END: thread_entry */
+
+/* SNIPPET_START: fork_generation */
+
+/* Bumped in the child after each fork. Written only while the child is single-threaded, so
+   plain reads on the hot path are race-free. */
+static uint64_t fork_generation = 0ULL;
+
+/* SNIPPET_END: fork_generation */
+
+/* SNIPPET_START: free_state */
+
+static void free_state(Hacl_HMAC_DRBG_state st)
+{
+  Lib_Memzero0_memzero(st.k, POOL_HASH_LEN, uint8_t, void *);
+  Lib_Memzero0_memzero(st.v, POOL_HASH_LEN, uint8_t, void *);
+  Hacl_HMAC_DRBG_free(POOL_ALG, st);
+}
+
+/* SNIPPET_END: free_state */
+
+#if (defined(_WIN32) || defined(_WIN64))
+
+/* SNIPPET_START: register_thread */
+
+static void register_thread(void)
+{
+}
+
+/* SNIPPET_END: register_thread */
+
+#else
+
+/* SNIPPET_START: pool_once */
+
+static pthread_once_t pool_once = PTHREAD_ONCE_INIT;
+
+/* SNIPPET_END: pool_once */
+
+/* SNIPPET_START: pool_key */
+
+static pthread_key_t pool_key;
+
+/* SNIPPET_END: pool_key */
+
+/* SNIPPET_START: on_fork_child */
+
+static void on_fork_child(void)
+{
+  fork_generation = fork_generation + 1ULL;
+}
+
+/* SNIPPET_END: on_fork_child */
+
+/* SNIPPET_START: on_thread_exit */
+
+static void on_thread_exit(void *e)
+{
+  pool_entry *p = (pool_entry *)e;
+  if (p->live)
+  {
+    free_state(p->st);
+    p->live = false;
+  }
+}
+
+/* SNIPPET_END: on_thread_exit */
+
+/* SNIPPET_START: pool_init */
+
+static void pool_init(void)
+{
+  pthread_key_create(&pool_key, on_thread_exit);
+  pthread_atfork(NULL, NULL, on_fork_child);
+}
+
+/* SNIPPET_END: pool_init */
+
+/* SNIPPET_START: register_thread */
+
+static void register_thread(void)
+{
+  pthread_once(&pool_once, pool_init);
+  pthread_setspecific(pool_key, &thread_entry);
+}
+
+/* SNIPPET_END: register_thread */
+
+#endif
+
+/* SNIPPET_START: instantiate */
+
+static bool instantiate(pool_entry *e)
+{
+  uint8_t seed[POOL_SEED_LEN] = { 0U };
+  if (!Lib_RandomBuffer_System_randombytes(seed, POOL_SEED_LEN))
+  {
+    return false;
+  }
+  if (e->live)
+  {
+    /* Inherited across a fork: drop the parent's state. */
+    free_state(e->st);
+    e->live = false;
+  }
+  else
+  {
+    register_thread();
+  }
+  uint8_t pers[16U] = { 0U };
+  store64_le(pers, (uint64_t)(uintptr_t)e);
+  store64_le(pers + 8U, fork_generation);
+  Hacl_HMAC_DRBG_state st = Hacl_HMAC_DRBG_create_in(POOL_ALG);
+  Hacl_HMAC_DRBG_instantiate(POOL_ALG,
+    st,
+    32U,
+    seed,
+    POOL_SEED_LEN - 32U,
+    seed + 32U,
+    16U,
+    pers);
+  Lib_Memzero0_memzero(seed, POOL_SEED_LEN, uint8_t, void *);
+  e->st = st;
+  e->generation = fork_generation;
+  e->live = true;
+  return true;
+}
+
+/* SNIPPET_END: instantiate */
+
+/* SNIPPET_START: reseed */
+
+static bool reseed(pool_entry *e)
+{
+  uint8_t entropy[32U] = { 0U };
+  if (!Lib_RandomBuffer_System_randombytes(entropy, 32U))
+  {
+    return false;
+  }
+  Hacl_HMAC_DRBG_reseed(POOL_ALG, e->st, 32U, entropy, 0U, NULL);
+  Lib_Memzero0_memzero(entropy, 32U, uint8_t, void *);
+  return true;
+}
+
+/* SNIPPET_END: reseed */
+
+/* SNIPPET_START: EverCrypt_DRBG_Pool_generate */
+
+bool EverCrypt_DRBG_Pool_generate(uint8_t *output, uint32_t n)
+{
+  pool_entry *e = &thread_entry;
+  if (!e->live || e->generation != fork_generation)
+  {
+    if (!instantiate(e))
+    {
+      return false;
+    }
+  }
+  uint32_t rem = n;
+  uint8_t *out = output;
+  while (rem > 0U)
+  {
+    if (e->st.reseed_counter[0U] >= EverCrypt_DRBG_reseed_interval)
+    {
+      if (!reseed(e))
+      {
+        return false;
+      }
+    }
+    uint32_t len = rem;
+    if (len > EverCrypt_DRBG_max_output_length)
+    {
+      len = EverCrypt_DRBG_max_output_length;
+    }
+    if (!Hacl_HMAC_DRBG_generate(POOL_ALG, out, e->st, len, 0U, NULL))
+    {
+      return false;
+    }
+    rem = rem - len;
+    out = out + len;
+  }
+  return true;
+}
+
+/* SNIPPET_END: EverCrypt_DRBG_Pool_generate */
+
+/* SNIPPET_START: EverCrypt_DRBG_Pool_thread_free */
+
+void EverCrypt_DRBG_Pool_thread_free(void)
+{
+  pool_entry *e = &thread_entry;
+  if (e->live)
+  {
+    free_state(e->st);
+    e->live = false;
+  }
+}
+
+/* SNIPPET_END: EverCrypt_DRBG_Pool_thread_free */
+
@@ -36,6 +36,7 @@ extern "C" {
 #include "krml/internal/target.h"
 
 #include "Hacl_Ed25519.h"
+#include "EverCrypt_AutoConfig2.h"
 
 /* SNIPPET_START: EverCrypt_Ed25519_secret_to_public */
 
@@ -85,6 +86,23 @@ EverCrypt_Ed25519_verify(
 
 /* SNIPPET_END: EverCrypt_Ed25519_verify */
 
+/* SNIPPET_START: EverCrypt_Ed25519_sign_batch */
+
+/**
+Same as `Hacl_Ed25519_sign_batch`, but hashes four messages at once with the four-way
+SHA-512 on CPUs with AVX2.
+*/
+void
+EverCrypt_Ed25519_sign_batch(
+  uint8_t *expanded_keys,
+  uint32_t n,
+  uint8_t **msgs,
+  uint32_t *msg_lens,
+  uint8_t **signatures
+);
+
+/* SNIPPET_END: EverCrypt_Ed25519_sign_batch */
+
 #if defined(__cplusplus)
 }
 #endif
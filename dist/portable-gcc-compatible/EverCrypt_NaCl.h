@@ -0,0 +1,376 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __EverCrypt_NaCl_H
+#define __EverCrypt_NaCl_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "Hacl_NaCl.h"
+#include "EverCrypt_AutoConfig2.h"
+
+/* SNIPPET_START: EverCrypt_NaCl_crypto_secretbox_detached */
+
+/**
+Same as `Hacl_NaCl_crypto_secretbox_detached`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_secretbox_detached(
+  uint8_t *c,
+  uint8_t *tag,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *k
+);
+
+/* SNIPPET_END: EverCrypt_NaCl_crypto_secretbox_detached */
+
+/* SNIPPET_START: EverCrypt_NaCl_crypto_secretbox_open_detached */
+
+/**
+Same as `Hacl_NaCl_crypto_secretbox_open_detached`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_secretbox_open_detached(
+  uint8_t *m,
+  uint8_t *c,
+  uint8_t *tag,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *k
+);
+
+/* SNIPPET_END: EverCrypt_NaCl_crypto_secretbox_open_detached */
+
+/* SNIPPET_START: EverCrypt_NaCl_crypto_secretbox_easy */
+
+/**
+Same as `Hacl_NaCl_crypto_secretbox_easy`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_secretbox_easy(uint8_t *c, uint8_t *m, uint32_t mlen, uint8_t *n, uint8_t *k);
+
+/* SNIPPET_END: EverCrypt_NaCl_crypto_secretbox_easy */
+
+/* SNIPPET_START: EverCrypt_NaCl_crypto_secretbox_open_easy */
+
+/**
+Same as `Hacl_NaCl_crypto_secretbox_open_easy`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_secretbox_open_easy(
+  uint8_t *m,
+  uint8_t *c,
+  uint32_t clen,
+  uint8_t *n,
+  uint8_t *k
+);
+
+/* SNIPPET_END: EverCrypt_NaCl_crypto_secretbox_open_easy */
+
+/* SNIPPET_START: EverCrypt_NaCl_crypto_box_detached_afternm */
+
+/**
+Same as `Hacl_NaCl_crypto_box_detached_afternm`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_detached_afternm(
+  uint8_t *c,
+  uint8_t *tag,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *k
+);
+
+/* SNIPPET_END: EverCrypt_NaCl_crypto_box_detached_afternm */
+
+/* SNIPPET_START: EverCrypt_NaCl_crypto_box_detached */
+
+/**
+Same as `Hacl_NaCl_crypto_box_detached`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_detached(
+  uint8_t *c,
+  uint8_t *tag,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *pk,
+  uint8_t *sk
+);
+
+/* SNIPPET_END: EverCrypt_NaCl_crypto_box_detached */
+
+/* SNIPPET_START: EverCrypt_NaCl_crypto_box_open_detached_afternm */
+
+/**
+Same as `Hacl_NaCl_crypto_box_open_detached_afternm`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_open_detached_afternm(
+  uint8_t *m,
+  uint8_t *c,
+  uint8_t *tag,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *k
+);
+
+/* SNIPPET_END: EverCrypt_NaCl_crypto_box_open_detached_afternm */
+
+/* SNIPPET_START: EverCrypt_NaCl_crypto_box_open_detached */
+
+/**
+Same as `Hacl_NaCl_crypto_box_open_detached`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_open_detached(
+  uint8_t *m,
+  uint8_t *c,
+  uint8_t *tag,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *pk,
+  uint8_t *sk
+);
+
+/* SNIPPET_END: EverCrypt_NaCl_crypto_box_open_detached */
+
+/* SNIPPET_START: EverCrypt_NaCl_crypto_box_easy_afternm */
+
+/**
+Same as `Hacl_NaCl_crypto_box_easy_afternm`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_easy_afternm(
+  uint8_t *c,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *k
+);
+
+/* SNIPPET_END: EverCrypt_NaCl_crypto_box_easy_afternm */
+
+/* SNIPPET_START: EverCrypt_NaCl_crypto_box_easy */
+
+/**
+Same as `Hacl_NaCl_crypto_box_easy`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_easy(
+  uint8_t *c,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *pk,
+  uint8_t *sk
+);
+
+/* SNIPPET_END: EverCrypt_NaCl_crypto_box_easy */
+
+/* SNIPPET_START: EverCrypt_NaCl_crypto_box_open_easy_afternm */
+
+/**
+Same as `Hacl_NaCl_crypto_box_open_easy_afternm`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_open_easy_afternm(
+  uint8_t *m,
+  uint8_t *c,
+  uint32_t clen,
+  uint8_t *n,
+  uint8_t *k
+);
+
+/* SNIPPET_END: EverCrypt_NaCl_crypto_box_open_easy_afternm */
+
+/* SNIPPET_START: EverCrypt_NaCl_crypto_box_open_easy */
+
+/**
+Same as `Hacl_NaCl_crypto_box_open_easy`, but uses the SIMD Salsa20 and
+Poly1305 code when the CPU supports it.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_open_easy(
+  uint8_t *m,
+  uint8_t *c,
+  uint32_t clen,
+  uint8_t *n,
+  uint8_t *pk,
+  uint8_t *sk
+);
+
+/* SNIPPET_END: EverCrypt_NaCl_crypto_box_open_easy */
+
+/* SNIPPET_START: EverCrypt_NaCl_box_cache */
+
+/**
+A bounded cache of `crypto_box_beforenm` results, keyed by (secret key id, public key).
+
+The cache holds at most `capacity` precomputed keys and evicts the least recently used one when
+full; evicted and freed entries are zeroized. All operations on a cache are thread-safe.
+
+Lookups hash (secret key id, public key) with a per-cache random key into a chained index, so
+they take constant time whatever the capacity. Caches of 128 entries or more are split into up
+to 16 shards, each with its own lock and LRU order, so that concurrent lookups rarely contend;
+the least recently used entry is then evicted from the shard of the key being inserted.
+*/
+typedef struct EverCrypt_NaCl_box_cache_s EverCrypt_NaCl_box_cache;
+
+/* SNIPPET_END: EverCrypt_NaCl_box_cache */
+
+/* SNIPPET_START: EverCrypt_NaCl_box_cache_create */
+
+/**
+Allocate a cache holding at most `capacity` precomputed keys.
+
+@returns A new cache, or NULL if `capacity` is zero or memory allocation fails.
+*/
+EverCrypt_NaCl_box_cache *EverCrypt_NaCl_box_cache_create(uint32_t capacity);
+
+/* SNIPPET_END: EverCrypt_NaCl_box_cache_create */
+
+/* SNIPPET_START: EverCrypt_NaCl_box_cache_free */
+
+/**
+Zeroize all cached keys and release the cache.
+*/
+void EverCrypt_NaCl_box_cache_free(EverCrypt_NaCl_box_cache *cache);
+
+/* SNIPPET_END: EverCrypt_NaCl_box_cache_free */
+
+/* SNIPPET_START: EverCrypt_NaCl_box_cache_stats */
+
+/**
+Read the number of lookups that found their key, the number that did not, and the number of
+entries evicted to make room for a new key, since the cache was created.
+*/
+void
+EverCrypt_NaCl_box_cache_stats(
+  EverCrypt_NaCl_box_cache *cache,
+  uint64_t *hits,
+  uint64_t *misses,
+  uint64_t *evictions
+);
+
+/* SNIPPET_END: EverCrypt_NaCl_box_cache_stats */
+
+/* SNIPPET_START: EverCrypt_NaCl_box_cache_beforenm */
+
+/**
+Like `Hacl_NaCl_crypto_box_beforenm`, but looks up and stores the result in `cache`.
+
+The caller chooses `sk_id` to identify its secret key `sk`: one `sk_id` must always be used with the same
+`sk`, otherwise a key computed for a different secret key may be returned.
+
+@param cache The cache, created with `EverCrypt_NaCl_box_cache_create`.
+@param k Pointer to 32 (`crypto_box_BEFORENMBYTES`) bytes of memory where the shared secret is written to.
+@param sk_id Identifier of the secret key `sk`.
+@param pk Pointer to 32 bytes of memory where **their** public key is read from.
+@param sk Pointer to 32 bytes of memory where **my** secret key is read from.
+*/
+uint32_t
+EverCrypt_NaCl_box_cache_beforenm(
+  EverCrypt_NaCl_box_cache *cache,
+  uint8_t *k,
+  uint64_t sk_id,
+  uint8_t *pk,
+  uint8_t *sk
+);
+
+/* SNIPPET_END: EverCrypt_NaCl_box_cache_beforenm */
+
+/* SNIPPET_START: EverCrypt_NaCl_crypto_box_easy_cached */
+
+/**
+Same as `EverCrypt_NaCl_crypto_box_easy`, but the shared secret is taken from (or added to)
+`cache`.
+
+See `EverCrypt_NaCl_box_cache_beforenm` for the meaning of `sk_id`.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_easy_cached(
+  EverCrypt_NaCl_box_cache *cache,
+  uint8_t *c,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint64_t sk_id,
+  uint8_t *pk,
+  uint8_t *sk
+);
+
+/* SNIPPET_END: EverCrypt_NaCl_crypto_box_easy_cached */
+
+/* SNIPPET_START: EverCrypt_NaCl_crypto_box_open_easy_cached */
+
+/**
+Same as `EverCrypt_NaCl_crypto_box_open_easy`, but the shared secret is taken from (or added to)
+`cache`.
+
+See `EverCrypt_NaCl_box_cache_beforenm` for the meaning of `sk_id`.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_open_easy_cached(
+  EverCrypt_NaCl_box_cache *cache,
+  uint8_t *m,
+  uint8_t *c,
+  uint32_t clen,
+  uint8_t *n,
+  uint64_t sk_id,
+  uint8_t *pk,
+  uint8_t *sk
+);
+
+/* SNIPPET_END: EverCrypt_NaCl_crypto_box_open_easy_cached */
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_NaCl_H_DEFINED
+#endif
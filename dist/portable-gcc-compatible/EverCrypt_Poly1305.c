@@ -62,30 +62,117 @@ poly1305_vale(uint8_t *dst, uint8_t *src, uint32_t len, uint8_t *key)
 
 /* SNIPPET_END: poly1305_vale */
 
+/* SNIPPET_START: default_min_len */
+
+/**
+Default shortest message, in bytes, for which the 128-bit, 256-bit and 512-bit implementations
+are used, one row per feature level: AVX-512, AVX2, and 128-bit vectors only. When Vale is
+available its scalar code beats the 128-bit implementation at every length and the wider
+ones up to about a kilobyte; the 256-bit code only catches up at 1536 bytes on cores that also
+run the 512-bit code. Without Vale the portable code only wins on short messages.
+*/
+#if HACL_CAN_COMPILE_VALE
+static const
+uint32_t
+default_min_len[9U] =
+  {
+    0xFFFFFFFFU, 1536U, 1024U, 0xFFFFFFFFU, 1024U, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU,
+    0xFFFFFFFFU
+  };
+#else
+static const
+uint32_t
+default_min_len[9U] =
+  { 128U, 256U, 1024U, 128U, 256U, 0xFFFFFFFFU, 128U, 0xFFFFFFFFU, 0xFFFFFFFFU };
+#endif
+
+/* SNIPPET_END: default_min_len */
+
+/* SNIPPET_START: min_len */
+
+/* Thresholds set by `EverCrypt_Poly1305_set_thresholds`, used instead of the defaults once
+   `thresholds_set[0U]` holds. */
+static uint32_t min_len[3U] = { 0U };
+
+/* SNIPPET_END: min_len */
+
+/* SNIPPET_START: thresholds_set */
+
+static bool thresholds_set[1U] = { false };
+
+/* SNIPPET_END: thresholds_set */
+
+/* SNIPPET_START: EverCrypt_Poly1305_set_thresholds */
+
+/**
+Set the message lengths from which `EverCrypt_Poly1305_mac` uses the 128-bit, 256-bit and
+512-bit implementations, when the CPU supports them, replacing the defaults for the detected
+feature level. Shorter messages use the scalar code, which is Vale's on x86-64. Passing
+`0xFFFFFFFFU` disables a width for all message lengths.
+
+Like the `EverCrypt_AutoConfig2_disable_*` functions, this is meant to be called once at
+startup, before other threads use the library.
+*/
+void EverCrypt_Poly1305_set_thresholds(uint32_t vec128, uint32_t vec256, uint32_t vec512)
+{
+  min_len[0U] = vec128;
+  min_len[1U] = vec256;
+  min_len[2U] = vec512;
+  thresholds_set[0U] = true;
+}
+
+/* SNIPPET_END: EverCrypt_Poly1305_set_thresholds */
+
 /* SNIPPET_START: EverCrypt_Poly1305_mac */
 
 void EverCrypt_Poly1305_mac(uint8_t *output, uint8_t *input, uint32_t input_len, uint8_t *key)
 {
+  bool avx512 = EverCrypt_AutoConfig2_has_avx512();
   bool vec256 = EverCrypt_AutoConfig2_has_vec256();
   bool vec128 = EverCrypt_AutoConfig2_has_vec128();
+  KRML_MAYBE_UNUSED_VAR(avx512);
+  KRML_MAYBE_UNUSED_VAR(vec256);
+  KRML_MAYBE_UNUSED_VAR(vec128);
+  uint32_t level = 2U;
   #if HACL_CAN_COMPILE_VEC256
   if (vec256)
   {
-    KRML_MAYBE_UNUSED_VAR(vec128);
+    level = 1U;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC512
+  if (avx512)
+  {
+    level = 0U;
+  }
+  #endif
+  const uint32_t *thresholds = default_min_len + 3U * level;
+  if (thresholds_set[0U])
+  {
+    thresholds = min_len;
+  }
+  KRML_MAYBE_UNUSED_VAR(thresholds);
+  #if HACL_CAN_COMPILE_VEC512
+  if (avx512 && input_len >= thresholds[2U])
+  {
+    Hacl_MAC_Poly1305_Simd512_mac(output, input, input_len, key);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256 && input_len >= thresholds[1U])
+  {
     Hacl_MAC_Poly1305_Simd256_mac(output, input, input_len, key);
     return;
   }
   #endif
   #if HACL_CAN_COMPILE_VEC128
-  if (vec128)
+  if (vec128 && input_len >= thresholds[0U])
   {
-    KRML_MAYBE_UNUSED_VAR(vec256);
     Hacl_MAC_Poly1305_Simd128_mac(output, input, input_len, key);
     return;
   }
   #endif
-  KRML_MAYBE_UNUSED_VAR(vec256);
-  KRML_MAYBE_UNUSED_VAR(vec128);
   #if HACL_CAN_COMPILE_VALE
   poly1305_vale(output, input, input_len, key);
   #else
@@ -0,0 +1,488 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_AEAD_AEGIS_NI.h"
+
+#include "internal/Hacl_Krmllib.h"
+#include "libintvector.h"
+
+/* SNIPPET_START: aegis_c0 */
+
+static const
+uint8_t
+aegis_c0[16U] =
+  {
+    0x00U, 0x01U, 0x01U, 0x02U, 0x03U, 0x05U, 0x08U, 0x0dU, 0x15U, 0x22U, 0x37U, 0x59U, 0x90U,
+    0xe9U, 0x79U, 0x62U
+  };
+
+/* SNIPPET_END: aegis_c0 */
+
+/* SNIPPET_START: aegis_c1 */
+
+static const
+uint8_t
+aegis_c1[16U] =
+  {
+    0xdbU, 0x3dU, 0x18U, 0x55U, 0x6dU, 0xc2U, 0x2fU, 0xf1U, 0x20U, 0x11U, 0x31U, 0x42U, 0x73U,
+    0xb5U, 0x28U, 0xddU
+  };
+
+/* SNIPPET_END: aegis_c1 */
+
+/* SNIPPET_START: update_128l */
+
+static inline void
+update_128l(
+  Lib_IntVector_Intrinsics_vec128 *st,
+  Lib_IntVector_Intrinsics_vec128 m0,
+  Lib_IntVector_Intrinsics_vec128 m1
+)
+{
+  Lib_IntVector_Intrinsics_vec128 s7 = st[7U];
+  st[7U] = Lib_IntVector_Intrinsics_ni_aes_enc(st[6U], st[7U]);
+  st[6U] = Lib_IntVector_Intrinsics_ni_aes_enc(st[5U], st[6U]);
+  st[5U] = Lib_IntVector_Intrinsics_ni_aes_enc(st[4U], st[5U]);
+  st[4U] =
+    Lib_IntVector_Intrinsics_ni_aes_enc(st[3U],
+      Lib_IntVector_Intrinsics_vec128_xor(st[4U], m1));
+  st[3U] = Lib_IntVector_Intrinsics_ni_aes_enc(st[2U], st[3U]);
+  st[2U] = Lib_IntVector_Intrinsics_ni_aes_enc(st[1U], st[2U]);
+  st[1U] = Lib_IntVector_Intrinsics_ni_aes_enc(st[0U], st[1U]);
+  st[0U] = Lib_IntVector_Intrinsics_ni_aes_enc(s7, Lib_IntVector_Intrinsics_vec128_xor(st[0U], m0));
+}
+
+/* SNIPPET_END: update_128l */
+
+/* SNIPPET_START: init_128l */
+
+static inline void init_128l(Lib_IntVector_Intrinsics_vec128 *st, uint8_t *key, uint8_t *nonce)
+{
+  Lib_IntVector_Intrinsics_vec128 c0 = Lib_IntVector_Intrinsics_vec128_load32_le(aegis_c0);
+  Lib_IntVector_Intrinsics_vec128 c1 = Lib_IntVector_Intrinsics_vec128_load32_le(aegis_c1);
+  Lib_IntVector_Intrinsics_vec128 k = Lib_IntVector_Intrinsics_vec128_load32_le(key);
+  Lib_IntVector_Intrinsics_vec128 n = Lib_IntVector_Intrinsics_vec128_load32_le(nonce);
+  Lib_IntVector_Intrinsics_vec128 kn = Lib_IntVector_Intrinsics_vec128_xor(k, n);
+  st[0U] = kn;
+  st[1U] = c1;
+  st[2U] = c0;
+  st[3U] = c1;
+  st[4U] = kn;
+  st[5U] = Lib_IntVector_Intrinsics_vec128_xor(k, c0);
+  st[6U] = Lib_IntVector_Intrinsics_vec128_xor(k, c1);
+  st[7U] = Lib_IntVector_Intrinsics_vec128_xor(k, c0);
+  KRML_MAYBE_FOR10(i, 0U, 10U, 1U, update_128l(st, n, k););
+}
+
+/* SNIPPET_END: init_128l */
+
+/* SNIPPET_START: absorb_128l */
+
+static inline void absorb_128l(Lib_IntVector_Intrinsics_vec128 *st, uint32_t len, uint8_t *text)
+{
+  uint32_t nb = len / 32U;
+  for (uint32_t i = 0U; i < nb; i++)
+  {
+    uint8_t *b = text + i * 32U;
+    update_128l(st,
+      Lib_IntVector_Intrinsics_vec128_load32_le(b),
+      Lib_IntVector_Intrinsics_vec128_load32_le(b + 16U));
+  }
+  uint32_t rem = len % 32U;
+  if (rem > 0U)
+  {
+    uint8_t tmp[32U] = { 0U };
+    memcpy(tmp, text + nb * 32U, rem * sizeof (uint8_t));
+    update_128l(st,
+      Lib_IntVector_Intrinsics_vec128_load32_le(tmp),
+      Lib_IntVector_Intrinsics_vec128_load32_le(tmp + 16U));
+  }
+}
+
+/* SNIPPET_END: absorb_128l */
+
+/* SNIPPET_START: keystream_128l_0 */
+
+static inline Lib_IntVector_Intrinsics_vec128
+keystream_128l_0(Lib_IntVector_Intrinsics_vec128 *st)
+{
+  return
+    Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_xor(st[6U], st[1U]),
+      Lib_IntVector_Intrinsics_vec128_and(st[2U], st[3U]));
+}
+
+/* SNIPPET_END: keystream_128l_0 */
+
+/* SNIPPET_START: keystream_128l_1 */
+
+static inline Lib_IntVector_Intrinsics_vec128
+keystream_128l_1(Lib_IntVector_Intrinsics_vec128 *st)
+{
+  return
+    Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_xor(st[2U], st[5U]),
+      Lib_IntVector_Intrinsics_vec128_and(st[6U], st[7U]));
+}
+
+/* SNIPPET_END: keystream_128l_1 */
+
+/* SNIPPET_START: finish_128l */
+
+static inline void
+finish_128l(Lib_IntVector_Intrinsics_vec128 *st, uint32_t ad_len, uint32_t msg_len, uint8_t *tag)
+{
+  Lib_IntVector_Intrinsics_vec128
+  lens =
+    Lib_IntVector_Intrinsics_vec128_load64s((uint64_t)ad_len * 8ULL,
+      (uint64_t)msg_len * 8ULL);
+  Lib_IntVector_Intrinsics_vec128 t = Lib_IntVector_Intrinsics_vec128_xor(st[2U], lens);
+  KRML_MAYBE_FOR7(i, 0U, 7U, 1U, update_128l(st, t, t););
+  Lib_IntVector_Intrinsics_vec128 acc = st[0U];
+  KRML_MAYBE_FOR6(i, 1U, 7U, 1U, acc = Lib_IntVector_Intrinsics_vec128_xor(acc, st[i]););
+  Lib_IntVector_Intrinsics_vec128_store32_le(tag, acc);
+}
+
+/* SNIPPET_END: finish_128l */
+
+/* SNIPPET_START: verify_tag */
+
+static inline uint32_t verify_tag(uint8_t *computed_tag, uint8_t *tag)
+{
+  uint8_t res = 255U;
+  KRML_MAYBE_FOR16(i,
+    0U,
+    16U,
+    1U,
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed_tag[i], tag[i]);
+    res = (uint32_t)uu____0 & (uint32_t)res;);
+  if (res == 255U)
+  {
+    return 0U;
+  }
+  return 1U;
+}
+
+/* SNIPPET_END: verify_tag */
+
+/* SNIPPET_START: Hacl_AEAD_AEGIS_NI_aegis128l_encrypt */
+
+void
+Hacl_AEAD_AEGIS_NI_aegis128l_encrypt(
+  uint8_t *output,
+  uint8_t *tag,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *key,
+  uint8_t *nonce
+)
+{
+  Lib_IntVector_Intrinsics_vec128 st[8U];
+  init_128l(st, key, nonce);
+  absorb_128l(st, data_len, data);
+  uint32_t nb = input_len / 32U;
+  for (uint32_t i = 0U; i < nb; i++)
+  {
+    uint8_t *ib = input + i * 32U;
+    uint8_t *ob = output + i * 32U;
+    Lib_IntVector_Intrinsics_vec128 m0 = Lib_IntVector_Intrinsics_vec128_load32_le(ib);
+    Lib_IntVector_Intrinsics_vec128 m1 = Lib_IntVector_Intrinsics_vec128_load32_le(ib + 16U);
+    Lib_IntVector_Intrinsics_vec128_store32_le(ob,
+      Lib_IntVector_Intrinsics_vec128_xor(m0, keystream_128l_0(st)));
+    Lib_IntVector_Intrinsics_vec128_store32_le(ob + 16U,
+      Lib_IntVector_Intrinsics_vec128_xor(m1, keystream_128l_1(st)));
+    update_128l(st, m0, m1);
+  }
+  uint32_t rem = input_len % 32U;
+  if (rem > 0U)
+  {
+    uint8_t tmp[32U] = { 0U };
+    memcpy(tmp, input + nb * 32U, rem * sizeof (uint8_t));
+    Lib_IntVector_Intrinsics_vec128 m0 = Lib_IntVector_Intrinsics_vec128_load32_le(tmp);
+    Lib_IntVector_Intrinsics_vec128 m1 = Lib_IntVector_Intrinsics_vec128_load32_le(tmp + 16U);
+    Lib_IntVector_Intrinsics_vec128_store32_le(tmp,
+      Lib_IntVector_Intrinsics_vec128_xor(m0, keystream_128l_0(st)));
+    Lib_IntVector_Intrinsics_vec128_store32_le(tmp + 16U,
+      Lib_IntVector_Intrinsics_vec128_xor(m1, keystream_128l_1(st)));
+    memcpy(output + nb * 32U, tmp, rem * sizeof (uint8_t));
+    update_128l(st, m0, m1);
+  }
+  finish_128l(st, data_len, input_len, tag);
+}
+
+/* SNIPPET_END: Hacl_AEAD_AEGIS_NI_aegis128l_encrypt */
+
+/* SNIPPET_START: Hacl_AEAD_AEGIS_NI_aegis128l_decrypt */
+
+uint32_t
+Hacl_AEAD_AEGIS_NI_aegis128l_decrypt(
+  uint8_t *output,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *key,
+  uint8_t *nonce,
+  uint8_t *tag
+)
+{
+  Lib_IntVector_Intrinsics_vec128 st[8U];
+  init_128l(st, key, nonce);
+  absorb_128l(st, data_len, data);
+  uint32_t nb = input_len / 32U;
+  for (uint32_t i = 0U; i < nb; i++)
+  {
+    uint8_t *ib = input + i * 32U;
+    uint8_t *ob = output + i * 32U;
+    Lib_IntVector_Intrinsics_vec128
+    m0 =
+      Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_load32_le(ib),
+        keystream_128l_0(st));
+    Lib_IntVector_Intrinsics_vec128
+    m1 =
+      Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_load32_le(ib + 16U),
+        keystream_128l_1(st));
+    Lib_IntVector_Intrinsics_vec128_store32_le(ob, m0);
+    Lib_IntVector_Intrinsics_vec128_store32_le(ob + 16U, m1);
+    update_128l(st, m0, m1);
+  }
+  uint32_t rem = input_len % 32U;
+  if (rem > 0U)
+  {
+    uint8_t tmp[32U] = { 0U };
+    memcpy(tmp, input + nb * 32U, rem * sizeof (uint8_t));
+    Lib_IntVector_Intrinsics_vec128 c0 = Lib_IntVector_Intrinsics_vec128_load32_le(tmp);
+    Lib_IntVector_Intrinsics_vec128 c1 = Lib_IntVector_Intrinsics_vec128_load32_le(tmp + 16U);
+    Lib_IntVector_Intrinsics_vec128_store32_le(tmp,
+      Lib_IntVector_Intrinsics_vec128_xor(c0, keystream_128l_0(st)));
+    Lib_IntVector_Intrinsics_vec128_store32_le(tmp + 16U,
+      Lib_IntVector_Intrinsics_vec128_xor(c1, keystream_128l_1(st)));
+    memset(tmp + rem, 0U, (32U - rem) * sizeof (uint8_t));
+    memcpy(output + nb * 32U, tmp, rem * sizeof (uint8_t));
+    update_128l(st,
+      Lib_IntVector_Intrinsics_vec128_load32_le(tmp),
+      Lib_IntVector_Intrinsics_vec128_load32_le(tmp + 16U));
+  }
+  uint8_t computed_tag[16U] = { 0U };
+  finish_128l(st, data_len, input_len, computed_tag);
+  uint32_t r = verify_tag(computed_tag, tag);
+  if (r != 0U)
+  {
+    memset(output, 0U, input_len * sizeof (uint8_t));
+  }
+  return r;
+}
+
+/* SNIPPET_END: Hacl_AEAD_AEGIS_NI_aegis128l_decrypt */
+
+/* SNIPPET_START: update_256 */
+
+static inline void
+update_256(Lib_IntVector_Intrinsics_vec128 *st, Lib_IntVector_Intrinsics_vec128 m)
+{
+  Lib_IntVector_Intrinsics_vec128 s5 = st[5U];
+  st[5U] = Lib_IntVector_Intrinsics_ni_aes_enc(st[4U], st[5U]);
+  st[4U] = Lib_IntVector_Intrinsics_ni_aes_enc(st[3U], st[4U]);
+  st[3U] = Lib_IntVector_Intrinsics_ni_aes_enc(st[2U], st[3U]);
+  st[2U] = Lib_IntVector_Intrinsics_ni_aes_enc(st[1U], st[2U]);
+  st[1U] = Lib_IntVector_Intrinsics_ni_aes_enc(st[0U], st[1U]);
+  st[0U] = Lib_IntVector_Intrinsics_ni_aes_enc(s5, Lib_IntVector_Intrinsics_vec128_xor(st[0U], m));
+}
+
+/* SNIPPET_END: update_256 */
+
+/* SNIPPET_START: init_256 */
+
+static inline void init_256(Lib_IntVector_Intrinsics_vec128 *st, uint8_t *key, uint8_t *nonce)
+{
+  Lib_IntVector_Intrinsics_vec128 c0 = Lib_IntVector_Intrinsics_vec128_load32_le(aegis_c0);
+  Lib_IntVector_Intrinsics_vec128 c1 = Lib_IntVector_Intrinsics_vec128_load32_le(aegis_c1);
+  Lib_IntVector_Intrinsics_vec128 k0 = Lib_IntVector_Intrinsics_vec128_load32_le(key);
+  Lib_IntVector_Intrinsics_vec128 k1 = Lib_IntVector_Intrinsics_vec128_load32_le(key + 16U);
+  Lib_IntVector_Intrinsics_vec128 n0 = Lib_IntVector_Intrinsics_vec128_load32_le(nonce);
+  Lib_IntVector_Intrinsics_vec128 n1 = Lib_IntVector_Intrinsics_vec128_load32_le(nonce + 16U);
+  Lib_IntVector_Intrinsics_vec128 k0n0 = Lib_IntVector_Intrinsics_vec128_xor(k0, n0);
+  Lib_IntVector_Intrinsics_vec128 k1n1 = Lib_IntVector_Intrinsics_vec128_xor(k1, n1);
+  st[0U] = k0n0;
+  st[1U] = k1n1;
+  st[2U] = c1;
+  st[3U] = c0;
+  st[4U] = Lib_IntVector_Intrinsics_vec128_xor(k0, c0);
+  st[5U] = Lib_IntVector_Intrinsics_vec128_xor(k1, c1);
+  KRML_MAYBE_FOR4(i,
+    0U,
+    4U,
+    1U,
+    update_256(st, k0);
+    update_256(st, k1);
+    update_256(st, k0n0);
+    update_256(st, k1n1););
+}
+
+/* SNIPPET_END: init_256 */
+
+/* SNIPPET_START: absorb_256 */
+
+static inline void absorb_256(Lib_IntVector_Intrinsics_vec128 *st, uint32_t len, uint8_t *text)
+{
+  uint32_t nb = len / 16U;
+  for (uint32_t i = 0U; i < nb; i++)
+  {
+    update_256(st, Lib_IntVector_Intrinsics_vec128_load32_le(text + i * 16U));
+  }
+  uint32_t rem = len % 16U;
+  if (rem > 0U)
+  {
+    uint8_t tmp[16U] = { 0U };
+    memcpy(tmp, text + nb * 16U, rem * sizeof (uint8_t));
+    update_256(st, Lib_IntVector_Intrinsics_vec128_load32_le(tmp));
+  }
+}
+
+/* SNIPPET_END: absorb_256 */
+
+/* SNIPPET_START: keystream_256 */
+
+static inline Lib_IntVector_Intrinsics_vec128 keystream_256(Lib_IntVector_Intrinsics_vec128 *st)
+{
+  return
+    Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_xor(st[1U],
+        Lib_IntVector_Intrinsics_vec128_xor(st[4U], st[5U])),
+      Lib_IntVector_Intrinsics_vec128_and(st[2U], st[3U]));
+}
+
+/* SNIPPET_END: keystream_256 */
+
+/* SNIPPET_START: finish_256 */
+
+static inline void
+finish_256(Lib_IntVector_Intrinsics_vec128 *st, uint32_t ad_len, uint32_t msg_len, uint8_t *tag)
+{
+  Lib_IntVector_Intrinsics_vec128
+  lens =
+    Lib_IntVector_Intrinsics_vec128_load64s((uint64_t)ad_len * 8ULL,
+      (uint64_t)msg_len * 8ULL);
+  Lib_IntVector_Intrinsics_vec128 t = Lib_IntVector_Intrinsics_vec128_xor(st[3U], lens);
+  KRML_MAYBE_FOR7(i, 0U, 7U, 1U, update_256(st, t););
+  Lib_IntVector_Intrinsics_vec128 acc = st[0U];
+  KRML_MAYBE_FOR5(i, 1U, 6U, 1U, acc = Lib_IntVector_Intrinsics_vec128_xor(acc, st[i]););
+  Lib_IntVector_Intrinsics_vec128_store32_le(tag, acc);
+}
+
+/* SNIPPET_END: finish_256 */
+
+/* SNIPPET_START: Hacl_AEAD_AEGIS_NI_aegis256_encrypt */
+
+void
+Hacl_AEAD_AEGIS_NI_aegis256_encrypt(
+  uint8_t *output,
+  uint8_t *tag,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *key,
+  uint8_t *nonce
+)
+{
+  Lib_IntVector_Intrinsics_vec128 st[6U];
+  init_256(st, key, nonce);
+  absorb_256(st, data_len, data);
+  uint32_t nb = input_len / 16U;
+  for (uint32_t i = 0U; i < nb; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128 m = Lib_IntVector_Intrinsics_vec128_load32_le(input + i * 16U);
+    Lib_IntVector_Intrinsics_vec128_store32_le(output + i * 16U,
+      Lib_IntVector_Intrinsics_vec128_xor(m, keystream_256(st)));
+    update_256(st, m);
+  }
+  uint32_t rem = input_len % 16U;
+  if (rem > 0U)
+  {
+    uint8_t tmp[16U] = { 0U };
+    memcpy(tmp, input + nb * 16U, rem * sizeof (uint8_t));
+    Lib_IntVector_Intrinsics_vec128 m = Lib_IntVector_Intrinsics_vec128_load32_le(tmp);
+    Lib_IntVector_Intrinsics_vec128_store32_le(tmp,
+      Lib_IntVector_Intrinsics_vec128_xor(m, keystream_256(st)));
+    memcpy(output + nb * 16U, tmp, rem * sizeof (uint8_t));
+    update_256(st, m);
+  }
+  finish_256(st, data_len, input_len, tag);
+}
+
+/* SNIPPET_END: Hacl_AEAD_AEGIS_NI_aegis256_encrypt */
+
+/* SNIPPET_START: Hacl_AEAD_AEGIS_NI_aegis256_decrypt */
+
+uint32_t
+Hacl_AEAD_AEGIS_NI_aegis256_decrypt(
+  uint8_t *output,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *key,
+  uint8_t *nonce,
+  uint8_t *tag
+)
+{
+  Lib_IntVector_Intrinsics_vec128 st[6U];
+  init_256(st, key, nonce);
+  absorb_256(st, data_len, data);
+  uint32_t nb = input_len / 16U;
+  for (uint32_t i = 0U; i < nb; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128
+    m =
+      Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_load32_le(input
+          + i * 16U),
+        keystream_256(st));
+    Lib_IntVector_Intrinsics_vec128_store32_le(output + i * 16U, m);
+    update_256(st, m);
+  }
+  uint32_t rem = input_len % 16U;
+  if (rem > 0U)
+  {
+    uint8_t tmp[16U] = { 0U };
+    memcpy(tmp, input + nb * 16U, rem * sizeof (uint8_t));
+    Lib_IntVector_Intrinsics_vec128 c = Lib_IntVector_Intrinsics_vec128_load32_le(tmp);
+    Lib_IntVector_Intrinsics_vec128_store32_le(tmp,
+      Lib_IntVector_Intrinsics_vec128_xor(c, keystream_256(st)));
+    memset(tmp + rem, 0U, (16U - rem) * sizeof (uint8_t));
+    memcpy(output + nb * 16U, tmp, rem * sizeof (uint8_t));
+    update_256(st, Lib_IntVector_Intrinsics_vec128_load32_le(tmp));
+  }
+  uint8_t computed_tag[16U] = { 0U };
+  finish_256(st, data_len, input_len, computed_tag);
+  uint32_t r = verify_tag(computed_tag, tag);
+  if (r != 0U)
+  {
+    memset(output, 0U, input_len * sizeof (uint8_t));
+  }
+  return r;
+}
+
+/* SNIPPET_END: Hacl_AEAD_AEGIS_NI_aegis256_decrypt */
+
@@ -0,0 +1,181 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_AEAD_AEGIS_NI_H
+#define __Hacl_AEAD_AEGIS_NI_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+/* SNIPPET_START: Hacl_AEAD_AEGIS_NI_packet */
+
+/**
+One independent AEGIS job of a batch call.
+
+For encryption, `input` is the message, `output` receives the ciphertext and `tag` receives the mac.
+For decryption, `input` is the ciphertext, `output` receives the message and `tag` holds the expected mac.
+The `key` and `nonce` (16 bytes each for AEGIS-128L, 32 bytes each for AEGIS-256), `data` and
+`data_len` fields have the same meaning as for the single-packet functions.
+*/
+typedef struct Hacl_AEAD_AEGIS_NI_packet_s
+{
+  uint8_t *key;
+  uint8_t *nonce;
+  uint8_t *data;
+  uint32_t data_len;
+  uint8_t *input;
+  uint32_t input_len;
+  uint8_t *output;
+  uint8_t *tag;
+}
+Hacl_AEAD_AEGIS_NI_packet;
+
+/* SNIPPET_END: Hacl_AEAD_AEGIS_NI_packet */
+
+/* SNIPPET_START: Hacl_AEAD_AEGIS_NI_aegis128l_encrypt */
+
+/**
+Encrypt a message `input` with key `key` using AEGIS-128L.
+
+The arguments `key`, `nonce`, `data`, and `data_len` are same in encryption/decryption.
+Note: Encryption and decryption can be executed in-place, i.e., `output` and `input` can point to the same memory.
+
+@param output Pointer to `input_len` bytes of memory where the ciphertext is written to.
+@param tag Pointer to 16 bytes of memory where the mac is written to.
+@param input Pointer to `input_len` bytes of memory where the message is read from.
+@param input_len Length of the message.
+@param data Pointer to `data_len` bytes of memory where the associated data is read from.
+@param data_len Length of the associated data.
+@param key Pointer to 16 bytes of memory where the AEAD key is read from.
+@param nonce Pointer to 16 bytes of memory where the AEAD nonce is read from.
+
+This function must only be called on CPUs supporting AES-NI.
+*/
+void
+Hacl_AEAD_AEGIS_NI_aegis128l_encrypt(
+  uint8_t *output,
+  uint8_t *tag,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *key,
+  uint8_t *nonce
+);
+
+/* SNIPPET_END: Hacl_AEAD_AEGIS_NI_aegis128l_encrypt */
+
+/* SNIPPET_START: Hacl_AEAD_AEGIS_NI_aegis128l_decrypt */
+
+/**
+Decrypt a ciphertext `input` with key `key` using AEGIS-128L.
+
+The arguments `key`, `nonce`, `data`, and `data_len` are same in encryption/decryption.
+Note: Encryption and decryption can be executed in-place, i.e., `output` and `input` can point to the same memory.
+
+If decryption succeeds, the resulting plaintext is stored in `output` and the function returns the success code 0.
+If decryption fails, the array `output` is zeroed and the function returns the error code 1.
+
+@param output Pointer to `input_len` bytes of memory where the message is written to.
+@param input Pointer to `input_len` bytes of memory where the ciphertext is read from.
+@param input_len Length of the ciphertext.
+@param data Pointer to `data_len` bytes of memory where the associated data is read from.
+@param data_len Length of the associated data.
+@param key Pointer to 16 bytes of memory where the AEAD key is read from.
+@param nonce Pointer to 16 bytes of memory where the AEAD nonce is read from.
+@param tag Pointer to 16 bytes of memory where the mac is read from.
+
+@returns 0 on succeess; 1 on failure.
+
+This function must only be called on CPUs supporting AES-NI.
+*/
+uint32_t
+Hacl_AEAD_AEGIS_NI_aegis128l_decrypt(
+  uint8_t *output,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *key,
+  uint8_t *nonce,
+  uint8_t *tag
+);
+
+/* SNIPPET_END: Hacl_AEAD_AEGIS_NI_aegis128l_decrypt */
+
+/* SNIPPET_START: Hacl_AEAD_AEGIS_NI_aegis256_encrypt */
+
+/**
+Encrypt a message `input` with key `key` using AEGIS-256.
+
+Same as `Hacl_AEAD_AEGIS_NI_aegis128l_encrypt`, except that `key` and `nonce` are 32 bytes long.
+*/
+void
+Hacl_AEAD_AEGIS_NI_aegis256_encrypt(
+  uint8_t *output,
+  uint8_t *tag,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *key,
+  uint8_t *nonce
+);
+
+/* SNIPPET_END: Hacl_AEAD_AEGIS_NI_aegis256_encrypt */
+
+/* SNIPPET_START: Hacl_AEAD_AEGIS_NI_aegis256_decrypt */
+
+/**
+Decrypt a ciphertext `input` with key `key` using AEGIS-256.
+
+Same as `Hacl_AEAD_AEGIS_NI_aegis128l_decrypt`, except that `key` and `nonce` are 32 bytes long.
+*/
+uint32_t
+Hacl_AEAD_AEGIS_NI_aegis256_decrypt(
+  uint8_t *output,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *key,
+  uint8_t *nonce,
+  uint8_t *tag
+);
+
+/* SNIPPET_END: Hacl_AEAD_AEGIS_NI_aegis256_decrypt */
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_AEAD_AEGIS_NI_H_DEFINED
+#endif
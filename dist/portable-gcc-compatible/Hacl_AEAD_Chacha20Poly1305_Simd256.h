@@ -36,6 +36,7 @@ extern "C" {
 #include "krml/internal/target.h"
 
 #include "Hacl_Chacha20_Vec256.h"
+#include "Hacl_AEAD_Chacha20Poly1305.h"
 
 /* SNIPPET_START: Hacl_AEAD_Chacha20Poly1305_Simd256_encrypt */
 
@@ -104,6 +105,49 @@ Hacl_AEAD_Chacha20Poly1305_Simd256_decrypt(
 
 /* SNIPPET_END: Hacl_AEAD_Chacha20Poly1305_Simd256_decrypt */
 
+/* SNIPPET_START: Hacl_AEAD_Chacha20Poly1305_Simd256_encrypt_batch */
+
+/**
+Encrypt `len` independent packets, eight at a time.
+
+The ChaCha20 keystream of eight packets is produced in a single vector pass (one 32-bit lane per
+packet) and their Poly1305 tags are computed four at a time (one 64-bit lane per packet).
+The result is identical to calling `Hacl_AEAD_Chacha20Poly1305_Simd256_encrypt` on each packet.
+
+@param len Number of packets.
+@param packets Pointer to `len` packet descriptors.
+*/
+void
+Hacl_AEAD_Chacha20Poly1305_Simd256_encrypt_batch(
+  uint32_t len,
+  Hacl_AEAD_Chacha20Poly1305_packet *packets
+);
+
+/* SNIPPET_END: Hacl_AEAD_Chacha20Poly1305_Simd256_encrypt_batch */
+
+/* SNIPPET_START: Hacl_AEAD_Chacha20Poly1305_Simd256_decrypt_batch */
+
+/**
+Decrypt `len` independent packets, eight at a time.
+
+Each packet is authenticated on its own: `res[i]` receives the result of decrypting `packets[i]`
+(0 on success, 1 on failure, in which case `packets[i].output` remains unchanged).
+
+@param len Number of packets.
+@param packets Pointer to `len` packet descriptors.
+@param res Pointer to `len` result codes.
+
+@returns The number of packets that failed to authenticate.
+*/
+uint32_t
+Hacl_AEAD_Chacha20Poly1305_Simd256_decrypt_batch(
+  uint32_t len,
+  Hacl_AEAD_Chacha20Poly1305_packet *packets,
+  uint32_t *res
+);
+
+/* SNIPPET_END: Hacl_AEAD_Chacha20Poly1305_Simd256_decrypt_batch */
+
 #if defined(__cplusplus)
 }
 #endif
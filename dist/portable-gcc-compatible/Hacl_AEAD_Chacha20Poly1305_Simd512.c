@@ -0,0 +1,152 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_AEAD_Chacha20Poly1305_Simd512.h"
+
+#include "internal/Hacl_MAC_Poly1305_Simd512.h"
+#include "internal/Hacl_Krmllib.h"
+#include "libintvector.h"
+
+/* SNIPPET_START: poly1305_do_512 */
+
+static inline void
+poly1305_do_512(
+  uint8_t *k,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *out
+)
+{
+  KRML_PRE_ALIGN(64) Lib_IntVector_Intrinsics_vec512 ctx[25U] KRML_POST_ALIGN(64) = { 0U };
+  uint8_t block[16U] = { 0U };
+  Hacl_MAC_Poly1305_Simd512_poly1305_init(ctx, k);
+  if (aadlen != 0U)
+  {
+    Hacl_MAC_Poly1305_Simd512_poly1305_update_padded(ctx, aadlen, aad);
+  }
+  if (mlen != 0U)
+  {
+    Hacl_MAC_Poly1305_Simd512_poly1305_update_padded(ctx, mlen, m);
+  }
+  store64_le(block, (uint64_t)aadlen);
+  store64_le(block + 8U, (uint64_t)mlen);
+  Hacl_MAC_Poly1305_Simd512_poly1305_update_padded(ctx, 16U, block);
+  Hacl_MAC_Poly1305_Simd512_poly1305_finish(out, k, ctx);
+}
+/**
+Encrypt a message `input` with key `key`.
+
+The arguments `key`, `nonce`, `data`, and `data_len` are same in encryption/decryption.
+Note: Encryption and decryption can be executed in-place, i.e., `input` and `output` can point to the same memory.
+
+@param output Pointer to `input_len` bytes of memory where the ciphertext is written to.
+@param tag Pointer to 16 bytes of memory where the mac is written to.
+@param input Pointer to `input_len` bytes of memory where the message is read from.
+@param input_len Length of the message.
+@param data Pointer to `data_len` bytes of memory where the associated data is read from.
+@param data_len Length of the associated data.
+@param key Pointer to 32 bytes of memory where the AEAD key is read from.
+@param nonce Pointer to 12 bytes of memory where the AEAD nonce is read from.
+*/
+void
+Hacl_AEAD_Chacha20Poly1305_Simd512_encrypt(
+  uint8_t *output,
+  uint8_t *tag,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *key,
+  uint8_t *nonce
+)
+{
+  Hacl_Chacha20_Vec512_chacha20_encrypt_512(input_len, output, input, key, nonce, 1U);
+  uint8_t tmp[64U] = { 0U };
+  Hacl_Chacha20_Vec512_chacha20_encrypt_512(64U, tmp, tmp, key, nonce, 0U);
+  uint8_t *key1 = tmp;
+  poly1305_do_512(key1, data_len, data, input_len, output, tag);
+}
+
+/* SNIPPET_END: poly1305_do_512 */
+
+/* SNIPPET_START: Hacl_AEAD_Chacha20Poly1305_Simd512_decrypt */
+
+/**
+Decrypt a ciphertext `input` with key `key`.
+
+The arguments `key`, `nonce`, `data`, and `data_len` are same in encryption/decryption.
+Note: Encryption and decryption can be executed in-place, i.e., `input` and `output` can point to the same memory.
+
+If decryption succeeds, the resulting plaintext is stored in `output` and the function returns the success code 0.
+If decryption fails, the array `output` remains unchanged and the function returns the error code 1.
+
+@param output Pointer to `input_len` bytes of memory where the message is written to.
+@param input Pointer to `input_len` bytes of memory where the ciphertext is read from.
+@param input_len Length of the ciphertext.
+@param data Pointer to `data_len` bytes of memory where the associated data is read from.
+@param data_len Length of the associated data.
+@param key Pointer to 32 bytes of memory where the AEAD key is read from.
+@param nonce Pointer to 12 bytes of memory where the AEAD nonce is read from.
+@param tag Pointer to 16 bytes of memory where the mac is read from.
+
+@returns 0 on succeess; 1 on failure.
+*/
+uint32_t
+Hacl_AEAD_Chacha20Poly1305_Simd512_decrypt(
+  uint8_t *output,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *key,
+  uint8_t *nonce,
+  uint8_t *tag
+)
+{
+  uint8_t computed_tag[16U] = { 0U };
+  uint8_t tmp[64U] = { 0U };
+  Hacl_Chacha20_Vec512_chacha20_encrypt_512(64U, tmp, tmp, key, nonce, 0U);
+  uint8_t *key1 = tmp;
+  poly1305_do_512(key1, data_len, data, input_len, input, computed_tag);
+  uint8_t res = 255U;
+  KRML_MAYBE_FOR16(i,
+    0U,
+    16U,
+    1U,
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed_tag[i], tag[i]);
+    res = (uint32_t)uu____0 & (uint32_t)res;);
+  uint8_t z = res;
+  if (z == 255U)
+  {
+    Hacl_Chacha20_Vec512_chacha20_encrypt_512(input_len, output, input, key, nonce, 1U);
+    return 0U;
+  }
+  return 1U;
+}
+
+/* SNIPPET_END: Hacl_AEAD_Chacha20Poly1305_Simd512_decrypt */
+
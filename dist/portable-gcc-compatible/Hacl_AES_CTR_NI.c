@@ -0,0 +1,145 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_AES_CTR_NI.h"
+
+#include "libintvector.h"
+
+/* SNIPPET_START: counter_block */
+
+static inline Lib_IntVector_Intrinsics_vec128 counter_block(uint64_t hi, uint64_t lo)
+{
+  return Lib_IntVector_Intrinsics_vec128_load64s(htobe64(hi), htobe64(lo));
+}
+
+/* SNIPPET_END: counter_block */
+
+/* SNIPPET_START: aes_enc_block */
+
+static inline Lib_IntVector_Intrinsics_vec128
+aes_enc_block(uint32_t nr, Lib_IntVector_Intrinsics_vec128 *k, Lib_IntVector_Intrinsics_vec128 b)
+{
+  Lib_IntVector_Intrinsics_vec128 st = Lib_IntVector_Intrinsics_vec128_xor(b, k[0U]);
+  for (uint32_t i = 1U; i < nr; i++)
+  {
+    st = Lib_IntVector_Intrinsics_ni_aes_enc(st, k[i]);
+  }
+  return Lib_IntVector_Intrinsics_ni_aes_enc_last(st, k[nr]);
+}
+
+/* SNIPPET_END: aes_enc_block */
+
+/* SNIPPET_START: Hacl_AES_CTR_NI_aes_ctr */
+
+void
+Hacl_AES_CTR_NI_aes_ctr(
+  uint32_t nr,
+  uint8_t *rk,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint8_t *iv,
+  uint64_t ctr
+)
+{
+  KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 k[15U] KRML_POST_ALIGN(16) = { 0U };
+  for (uint32_t i = 0U; i <= nr; i++)
+  {
+    k[i] = Lib_IntVector_Intrinsics_vec128_load32_le(rk + i * 16U);
+  }
+  uint64_t hi = load64_be(iv);
+  uint64_t lo0 = load64_be(iv + 8U);
+  uint64_t lo = lo0 + ctr;
+  if (lo < lo0)
+  {
+    hi = hi + 1ULL;
+  }
+  uint32_t nb = len / 128U;
+  for (uint32_t i0 = 0U; i0 < nb; i0++)
+  {
+    uint8_t *ib = text + i0 * 128U;
+    uint8_t *ob = out + i0 * 128U;
+    Lib_IntVector_Intrinsics_vec128 st[8U];
+    KRML_MAYBE_FOR8(i,
+      0U,
+      8U,
+      1U,
+      st[i] = counter_block(hi, lo);
+      lo = lo + 1ULL;
+      if (lo == 0ULL)
+      {
+        hi = hi + 1ULL;
+      }
+      st[i] = Lib_IntVector_Intrinsics_vec128_xor(st[i], k[0U]););
+    for (uint32_t j = 1U; j < nr; j++)
+    {
+      KRML_MAYBE_FOR8(i,
+        0U,
+        8U,
+        1U,
+        st[i] = Lib_IntVector_Intrinsics_ni_aes_enc(st[i], k[j]););
+    }
+    KRML_MAYBE_FOR8(i,
+      0U,
+      8U,
+      1U,
+      Lib_IntVector_Intrinsics_vec128
+      ks = Lib_IntVector_Intrinsics_ni_aes_enc_last(st[i], k[nr]);
+      Lib_IntVector_Intrinsics_vec128
+      x = Lib_IntVector_Intrinsics_vec128_load32_le(ib + i * 16U);
+      Lib_IntVector_Intrinsics_vec128_store32_le(ob + i * 16U,
+        Lib_IntVector_Intrinsics_vec128_xor(x, ks)););
+  }
+  uint32_t rem = len % 128U;
+  uint8_t *ib = text + nb * 128U;
+  uint8_t *ob = out + nb * 128U;
+  for (uint32_t i = 0U; i < rem / 16U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128 ks = aes_enc_block(nr, k, counter_block(hi, lo));
+    lo = lo + 1ULL;
+    if (lo == 0ULL)
+    {
+      hi = hi + 1ULL;
+    }
+    Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_load32_le(ib + i * 16U);
+    Lib_IntVector_Intrinsics_vec128_store32_le(ob + i * 16U,
+      Lib_IntVector_Intrinsics_vec128_xor(x, ks));
+  }
+  uint32_t last = rem % 16U;
+  if (last > 0U)
+  {
+    uint8_t *il = ib + rem - last;
+    uint8_t *ol = ob + rem - last;
+    uint8_t tmp[16U] = { 0U };
+    memcpy(tmp, il, last * sizeof (uint8_t));
+    Lib_IntVector_Intrinsics_vec128 ks = aes_enc_block(nr, k, counter_block(hi, lo));
+    Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_load32_le(tmp);
+    Lib_IntVector_Intrinsics_vec128_store32_le(tmp, Lib_IntVector_Intrinsics_vec128_xor(x, ks));
+    memcpy(ol, tmp, last * sizeof (uint8_t));
+  }
+}
+
+/* SNIPPET_END: Hacl_AES_CTR_NI_aes_ctr */
+
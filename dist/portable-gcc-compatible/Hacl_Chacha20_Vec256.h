@@ -63,6 +63,20 @@ Hacl_Chacha20_Vec256_chacha20_decrypt_256(
 
 /* SNIPPET_END: Hacl_Chacha20_Vec256_chacha20_decrypt_256 */
 
+/* SNIPPET_START: Hacl_Chacha20_Vec256_hchacha20_256 */
+
+/**
+Derive `len` independent HChaCha20 subkeys, eight at a time.
+
+@param len Number of subkeys.
+@param out Pointer to `32 * len` bytes of memory where the subkeys are written to.
+@param key Pointer to `32 * len` bytes of memory where the keys are read from.
+@param n Pointer to `16 * len` bytes of memory where the nonces are read from.
+*/
+void Hacl_Chacha20_Vec256_hchacha20_256(uint32_t len, uint8_t *out, uint8_t *key, uint8_t *n);
+
+/* SNIPPET_END: Hacl_Chacha20_Vec256_hchacha20_256 */
+
 #if defined(__cplusplus)
 }
 #endif
@@ -0,0 +1,62 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#ifndef __Hacl_Curve25519_Vec256_H
+#define __Hacl_Curve25519_Vec256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+/* SNIPPET_START: Hacl_Curve25519_Vec256_scalarmult4 */
+
+/**
+Compute four independent X25519 scalar multiplications at once, one per 64-bit lane of
+AVX2 vectors, with the constant-time Montgomery ladder of RFC 7748.
+
+@param out Pointer to 4 * 32 bytes of memory where the resulting points are written to.
+@param priv Pointer to 4 * 32 bytes of memory where the secret/private keys are read from.
+@param pub Pointer to 4 * 32 bytes of memory where the public points are read from.
+
+Lane k reads `priv + 32 k` and `pub + 32 k` and writes `out + 32 k`; the results are the
+same as four calls to `Hacl_Curve25519_51_scalarmult`.
+*/
+void Hacl_Curve25519_Vec256_scalarmult4(uint8_t *out, uint8_t *priv, uint8_t *pub);
+
+/* SNIPPET_END: Hacl_Curve25519_Vec256_scalarmult4 */
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Curve25519_Vec256_H_DEFINED
+#endif
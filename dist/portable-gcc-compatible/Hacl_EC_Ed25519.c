@@ -414,3 +414,142 @@ bool Hacl_EC_Ed25519_point_decompress(uint8_t *s, uint64_t *out)
 
 /* SNIPPET_END: Hacl_EC_Ed25519_point_decompress */
 
+/* SNIPPET_START: Hacl_EC_Ed25519_point_compress_batch */
+
+/**
+Compress `n` points in extended homogeneous coordinates with a single field inversion
+per 64 points (Montgomery's simultaneous-inversion trick).
+
+  The argument `p` points to `n` points of 20 limbs each, i.e., uint64_t[20 * n].
+  The outparam `out` points to 32 * `n` bytes of valid memory, i.e., uint8_t[32 * n].
+
+  The result is the same as `n` calls to `Hacl_EC_Ed25519_point_compress`, and the
+  function is constant-time in the points. Each inversion is replaced by three field
+  multiplications.
+
+  Before calling this function, the caller will need to ensure that the following
+  preconditions are observed.
+  • `p` and `out` are disjoint
+  • every point has a non-zero `Z` coordinate, as all points produced by this module do
+*/
+void Hacl_EC_Ed25519_point_compress_batch(uint32_t n, uint64_t *p, uint8_t *out)
+{
+  uint64_t acc[320U] = { 0U };
+  uint64_t inv[5U] = { 0U };
+  uint64_t zinv[5U] = { 0U };
+  uint64_t x[5U] = { 0U };
+  uint64_t y[5U] = { 0U };
+  uint8_t xb[32U] = { 0U };
+  for (uint32_t i0 = 0U; i0 < n; i0 = i0 + 64U)
+  {
+    uint32_t len;
+    if (n - i0 < 64U)
+    {
+      len = n - i0;
+    }
+    else
+    {
+      len = 64U;
+    }
+    uint64_t *pc = p + 20U * i0;
+    /* acc[i] = Z_0 * ... * Z_i */
+    memcpy(acc, pc + 10U, 5U * sizeof (uint64_t));
+    for (uint32_t i = 1U; i < len; i++)
+    {
+      Hacl_EC_Ed25519_felem_mul(acc + 5U * (i - 1U), pc + 20U * i + 10U, acc + 5U * i);
+    }
+    Hacl_Bignum25519_inverse(inv, acc + 5U * (len - 1U));
+    for (uint32_t i1 = 0U; i1 < len; i1++)
+    {
+      uint32_t i = len - i1 - 1U;
+      uint64_t *pi = pc + 20U * i;
+      /* inv = 1 / (Z_0 * ... * Z_i) */
+      if (i == 0U)
+      {
+        memcpy(zinv, inv, 5U * sizeof (uint64_t));
+      }
+      else
+      {
+        Hacl_EC_Ed25519_felem_mul(inv, acc + 5U * (i - 1U), zinv);
+        Hacl_EC_Ed25519_felem_mul(inv, pi + 10U, inv);
+      }
+      Hacl_EC_Ed25519_felem_mul(pi, zinv, x);
+      Hacl_EC_Ed25519_felem_mul(pi + 5U, zinv, y);
+      uint8_t *o = out + 32U * (i0 + i);
+      Hacl_Bignum25519_store_51(o, y);
+      Hacl_Bignum25519_store_51(xb, x);
+      o[31U] = (uint32_t)o[31U] + (((uint32_t)xb[0U] & 1U) << 7U);
+    }
+  }
+}
+
+/* SNIPPET_END: Hacl_EC_Ed25519_point_compress_batch */
+
+/* SNIPPET_START: Hacl_EC_Ed25519_point_mul_vartime */
+
+/**
+Write `[scalar]p` in `out`, in variable time.
+
+  The argument `p` and the outparam `out` are meant to be 20 limbs in size, i.e., uint64_t[20].
+  The argument `scalar` is meant to be 32 bytes in size, i.e., uint8_t[32].
+
+  The result is the same as `Hacl_EC_Ed25519_point_mul`, with a sliding window over odd
+  multiples of `p`. The running time depends on `scalar`: use it only when the scalar is
+  public, e.g., when verifying.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • `scalar`, `p`, and `out` are pairwise disjoint
+*/
+void Hacl_EC_Ed25519_point_mul_vartime(uint8_t *scalar, uint64_t *p, uint64_t *out)
+{
+  Hacl_Impl_Ed25519_Ladder_point_mul_vartime(out, scalar, p);
+}
+
+/* SNIPPET_END: Hacl_EC_Ed25519_point_mul_vartime */
+
+/* SNIPPET_START: Hacl_EC_Ed25519_point_mul_multi */
+
+/**
+Write `[scalars[0]]points[0] + ... + [scalars[n - 1]]points[n - 1]` in `out`, in variable
+time (multi-scalar multiplication).
+
+  The function returns `false`, leaving `out` untouched, if memory cannot be allocated,
+  and `true` otherwise.
+
+  The argument `scalars` points to `n` little-endian scalars of 32 bytes each, i.e., uint8_t[32 * n].
+  The argument `points` points to `n` points of 20 limbs each, i.e., uint64_t[20 * n].
+  The outparam `out` is meant to be 20 limbs in size, i.e., uint64_t[20].
+
+  The sum is computed with Pippenger's bucket method and signed digits, whose window
+  grows with `n`; for `n` in the hundreds it costs a small fraction of `n` calls to
+  `Hacl_EC_Ed25519_point_mul`. The running time depends on the scalars: use it only
+  when they are public.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • `out` is disjoint from `scalars` and `points`
+*/
+bool Hacl_EC_Ed25519_point_mul_multi(uint32_t n, uint8_t *scalars, uint64_t *points, uint64_t *out)
+{
+  if (n == 0U)
+  {
+    Hacl_Impl_Ed25519_PointConstants_make_point_inf(out);
+    return true;
+  }
+  uint64_t *words = (uint64_t *)KRML_HOST_CALLOC((size_t)n * 4U, sizeof (uint64_t));
+  if (words == NULL)
+  {
+    return false;
+  }
+  for (uint32_t i = 0U; i < 4U * n; i++)
+  {
+    words[i] = load64_le(scalars + 8U * i);
+  }
+  bool ok = Hacl_Impl_Ed25519_MultiScalarMul_point_mul_multi_vartime(out, n, words, points);
+  KRML_HOST_FREE(words);
+  return ok;
+}
+
+/* SNIPPET_END: Hacl_EC_Ed25519_point_mul_multi */
+
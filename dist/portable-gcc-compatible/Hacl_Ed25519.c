@@ -31,6 +31,9 @@
 #include "internal/Hacl_Curve25519_51.h"
 #include "internal/Hacl_Bignum_Base.h"
 #include "internal/Hacl_Bignum25519_51.h"
+#include "Hacl_SHA2_Vec256.h"
+
+#include "config.h"
 
 /* SNIPPET_START: fsum */
 
@@ -465,6 +468,42 @@ static inline void pow2_252m2(uint64_t *out, uint64_t *z)
 
 /* SNIPPET_END: pow2_252m2 */
 
+/* SNIPPET_START: pow2_252m3 */
+
+/* z^((p - 5) / 8), the exponent of the inverse square root. */
+static inline void pow2_252m3(uint64_t *out, uint64_t *z)
+{
+  uint64_t buf[20U] = { 0U };
+  uint64_t *a = buf;
+  uint64_t *t00 = buf + 5U;
+  uint64_t *b0 = buf + 10U;
+  uint64_t *c0 = buf + 15U;
+  fsquare_times(a, z, 1U);
+  fsquare_times(t00, a, 2U);
+  fmul0(b0, t00, z);
+  fmul0(a, b0, a);
+  fsquare_times(t00, a, 1U);
+  fmul0(b0, t00, b0);
+  fsquare_times(t00, b0, 5U);
+  fmul0(b0, t00, b0);
+  fsquare_times(t00, b0, 10U);
+  fmul0(c0, t00, b0);
+  fsquare_times(t00, c0, 20U);
+  fmul0(t00, t00, c0);
+  fsquare_times_inplace(t00, 10U);
+  fmul0(b0, t00, b0);
+  fsquare_times(t00, b0, 50U);
+  fmul0(c0, t00, b0);
+  fsquare_times(t00, c0, 100U);
+  fmul0(t00, t00, c0);
+  fsquare_times_inplace(t00, 50U);
+  fmul0(t00, t00, b0);
+  fsquare_times_inplace(t00, 2U);
+  fmul0(out, t00, z);
+}
+
+/* SNIPPET_END: pow2_252m3 */
+
 /* SNIPPET_START: is_0 */
 
 static inline bool is_0(uint64_t *x)
@@ -494,6 +533,87 @@ static inline void mul_modp_sqrt_m1(uint64_t *x)
 
 /* SNIPPET_END: mul_modp_sqrt_m1 */
 
+/* SNIPPET_START: felem_eq_mask */
+
+static inline uint64_t felem_eq_mask(uint64_t *a, uint64_t *b)
+{
+  uint64_t wa[4U] = { 0U };
+  uint64_t wb[4U] = { 0U };
+  Hacl_Impl_Curve25519_Field51_store_felem(wa, a);
+  Hacl_Impl_Curve25519_Field51_store_felem(wb, b);
+  uint64_t x = (((wa[0U] ^ wb[0U]) | (wa[1U] ^ wb[1U])) | (wa[2U] ^ wb[2U])) | (wa[3U] ^ wb[3U]);
+  return FStar_UInt64_eq_mask(x, 0ULL);
+}
+
+/* SNIPPET_END: felem_eq_mask */
+
+/* SNIPPET_START: felem_neg */
+
+static inline void felem_neg(uint64_t *out, uint64_t *a)
+{
+  uint64_t zero[5U] = { 0U };
+  fdifference(out, zero, a);
+  Hacl_Bignum25519_reduce_513(out);
+}
+
+/* SNIPPET_END: felem_neg */
+
+/* SNIPPET_START: felem_cmov */
+
+static inline void felem_cmov(uint64_t *out, uint64_t *a, uint64_t mask)
+{
+  KRML_MAYBE_FOR5(i, 0U, 5U, 1U, out[i] = (a[i] & mask) | (out[i] & ~mask););
+}
+
+/* SNIPPET_END: felem_cmov */
+
+/* SNIPPET_START: Hacl_Bignum25519_sqrt_ratio_m1 */
+
+/**
+The square root of a ratio, in constant time (SQRT_RATIO_M1 of RFC 9496).
+
+If `u / v` is a square, writes in `out` its non-negative square root and returns `true`;
+otherwise writes the non-negative square root of `sqrt(-1) * u / v` and returns `false`.
+A zero `u` gives 0 and `true`; a zero `v` with a non-zero `u` gives 0 and `false`. The
+candidate root is `u * v^3 * (u * v^7)^((p - 5) / 8)`, so one exponentiation replaces the
+inversion and the square root.
+*/
+bool Hacl_Bignum25519_sqrt_ratio_m1(uint64_t *out, uint64_t *u, uint64_t *v)
+{
+  uint64_t tmp[25U] = { 0U };
+  uint64_t *v3 = tmp;
+  uint64_t *uv7 = tmp + 5U;
+  uint64_t *r = tmp + 10U;
+  uint64_t *check = tmp + 15U;
+  uint64_t *nu = tmp + 20U;
+  fsquare(v3, v);
+  fmul0(v3, v3, v);
+  fsquare(uv7, v3);
+  fmul0(uv7, uv7, v);
+  fmul0(uv7, uv7, u);
+  pow2_252m3(r, uv7);
+  fmul0(r, r, v3);
+  fmul0(r, r, u);
+  fsquare(check, r);
+  fmul0(check, check, v);
+  felem_neg(nu, u);
+  uint64_t correct = felem_eq_mask(check, u);
+  uint64_t flipped = felem_eq_mask(check, nu);
+  mul_modp_sqrt_m1(nu);
+  uint64_t flipped_i = felem_eq_mask(check, nu);
+  memcpy(check, r, 5U * sizeof (uint64_t));
+  mul_modp_sqrt_m1(check);
+  felem_cmov(r, check, flipped | flipped_i);
+  uint64_t w[4U] = { 0U };
+  Hacl_Impl_Curve25519_Field51_store_felem(w, r);
+  felem_neg(check, r);
+  felem_cmov(r, check, 0ULL - (w[0U] & 1ULL));
+  memcpy(out, r, 5U * sizeof (uint64_t));
+  return (correct | flipped) == 0xFFFFFFFFFFFFFFFFULL;
+}
+
+/* SNIPPET_END: Hacl_Bignum25519_sqrt_ratio_m1 */
+
 /* SNIPPET_START: recover_x */
 
 static inline bool recover_x(uint64_t *x, uint64_t *y, uint64_t sign)
@@ -663,6 +783,90 @@ bool Hacl_Impl_Ed25519_PointDecompress_point_decompress(uint64_t *out, uint8_t *
 
 /* SNIPPET_END: Hacl_Impl_Ed25519_PointDecompress_point_decompress */
 
+/* SNIPPET_START: point_encoding_is_canonical */
+
+/*
+The checks of point decompression that need no field arithmetic: y is below p, and the
+encoding is not a negative zero, i.e., the sign bit set with y = 1 or y = p - 1, the
+two values of y for which x = 0. Encodings that pass decompress unless x^2 is not a
+square.
+*/
+static bool point_encoding_is_canonical(uint8_t *s)
+{
+  uint64_t w0 = load64_le(s);
+  uint64_t w1 = load64_le(s + 8U);
+  uint64_t w2 = load64_le(s + 16U);
+  uint64_t w3 = load64_le(s + 24U);
+  uint64_t sign = w3 >> 63U;
+  uint64_t y3 = w3 & 0x7fffffffffffffffULL;
+  bool
+  top =
+    w1
+    == 0xffffffffffffffffULL
+    && w2 == 0xffffffffffffffffULL
+    && y3 == 0x7fffffffffffffffULL;
+  if (top && w0 >= 0xffffffffffffffedULL)
+  {
+    return false;
+  }
+  if (sign == 1ULL)
+  {
+    if (w0 == 1ULL && w1 == 0ULL && w2 == 0ULL && y3 == 0ULL)
+    {
+      return false;
+    }
+    if (top && w0 == 0xffffffffffffffecULL)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* SNIPPET_END: point_encoding_is_canonical */
+
+/* SNIPPET_START: point_decompress_vartime */
+
+/*
+Point decompression for public encodings that passed `point_encoding_is_canonical`,
+with the same result as Hacl_Impl_Ed25519_PointDecompress_point_decompress: x is the
+square root of (y^2 - 1) / (d * y^2 + 1), computed by sqrt_ratio_m1 with a single
+exponentiation instead of an inversion followed by a second exponentiation.
+*/
+static bool point_decompress_vartime(uint64_t *out, uint8_t *s)
+{
+  uint64_t tmp[15U] = { 0U };
+  uint64_t *u = tmp;
+  uint64_t *v = tmp + 5U;
+  uint64_t *one = tmp + 10U;
+  uint64_t *x = out;
+  uint64_t *y = out + 5U;
+  uint64_t *z = out + 10U;
+  uint64_t *t = out + 15U;
+  one[0U] = 1ULL;
+  Hacl_Bignum25519_load_51(y, s);
+  fsquare(u, y);
+  times_d(v, u);
+  fsum(v, v, one);
+  Hacl_Bignum25519_reduce_513(v);
+  fdifference(u, u, one);
+  Hacl_Bignum25519_reduce_513(u);
+  if (!Hacl_Bignum25519_sqrt_ratio_m1(x, u, v))
+  {
+    return false;
+  }
+  /* x is the non-negative root; the canonical check has excluded a negative zero. */
+  if ((uint32_t)s[31U] >> 7U == 1U)
+  {
+    felem_neg(x, x);
+  }
+  memcpy(z, one, 5U * sizeof (uint64_t));
+  fmul0(t, x, y);
+  return true;
+}
+
+/* SNIPPET_END: point_decompress_vartime */
+
 /* SNIPPET_START: Hacl_Impl_Ed25519_PointCompress_point_compress */
 
 void Hacl_Impl_Ed25519_PointCompress_point_compress(uint8_t *z, uint64_t *p)
@@ -1416,6 +1620,86 @@ void Hacl_Impl_Ed25519_Ladder_point_mul(uint64_t *out, uint8_t *scalar, uint64_t
 
 /* SNIPPET_END: Hacl_Impl_Ed25519_Ladder_point_mul */
 
+/* SNIPPET_START: Hacl_Impl_Ed25519_Ladder_point_mul_vartime */
+
+/**
+Variable-time scalar multiplication out = [scalar]q with a sliding window over the odd
+multiples q, 3q, ..., 31q: 256 doublings and about 60 additions, 15 of them to build the
+table, against 64 additions and 64 table scans for the constant-time ladder. Only for
+public scalars.
+*/
+void Hacl_Impl_Ed25519_Ladder_point_mul_vartime(uint64_t *out, uint8_t *scalar, uint64_t *q)
+{
+  uint64_t bscalar[4U] = { 0U };
+  KRML_MAYBE_FOR4(i,
+    0U,
+    4U,
+    1U,
+    uint64_t *os = bscalar;
+    uint8_t *bj = scalar + i * 8U;
+    uint64_t u = load64_le(bj);
+    uint64_t r = u;
+    uint64_t x = r;
+    os[i] = x;);
+  uint64_t table[320U] = { 0U };
+  uint64_t q2[20U] = { 0U };
+  Hacl_Impl_Ed25519_PointDouble_point_double(q2, q);
+  memcpy(table, q, 20U * sizeof (uint64_t));
+  for (uint32_t i = 1U; i < 16U; i++)
+  {
+    Hacl_Impl_Ed25519_PointAdd_point_add(table + i * 20U, table + (i - 1U) * 20U, q2);
+  }
+  Hacl_Impl_Ed25519_PointConstants_make_point_inf(out);
+  bool is_inf = true;
+  uint32_t i = 256U;
+  while (i > 0U)
+  {
+    if (Hacl_Bignum_Lib_bn_get_bits_u64(4U, bscalar, i - 1U, 1U) == 0ULL)
+    {
+      if (!is_inf)
+      {
+        Hacl_Impl_Ed25519_PointDouble_point_double(out, out);
+      }
+      i--;
+    }
+    else
+    {
+      /* The longest window of at most 5 bits that ends at bit i - 1 and starts at a set bit. */
+      uint32_t j;
+      if (i >= 5U)
+      {
+        j = i - 5U;
+      }
+      else
+      {
+        j = 0U;
+      }
+      while (Hacl_Bignum_Lib_bn_get_bits_u64(4U, bscalar, j, 1U) == 0ULL)
+      {
+        j++;
+      }
+      uint64_t v = Hacl_Bignum_Lib_bn_get_bits_u64(4U, bscalar, j, i - j);
+      uint64_t *t = table + (uint32_t)(v >> 1U) * 20U;
+      if (is_inf)
+      {
+        memcpy(out, t, 20U * sizeof (uint64_t));
+        is_inf = false;
+      }
+      else
+      {
+        for (uint32_t k = 0U; k < i - j; k++)
+        {
+          Hacl_Impl_Ed25519_PointDouble_point_double(out, out);
+        }
+        Hacl_Impl_Ed25519_PointAdd_point_add(out, out, t);
+      }
+      i = j;
+    }
+  }
+}
+
+/* SNIPPET_END: Hacl_Impl_Ed25519_Ladder_point_mul_vartime */
+
 /* SNIPPET_START: precomp_get_consttime */
 
 static inline void precomp_get_consttime(const uint64_t *table, uint64_t bits_l, uint64_t *tmp)
@@ -1437,10 +1721,106 @@ static inline void precomp_get_consttime(const uint64_t *table, uint64_t bits_l,
 
 /* SNIPPET_END: precomp_get_consttime */
 
+/* SNIPPET_START: comb_table */
+
+/* Optional larger fixed-base tables, built once by `Hacl_Ed25519_precomp_tables_init` and
+   never freed, so that a concurrent signer cannot see them go away. The
+   scalar is cut into `comb_teeth` chunks of 256 / comb_teeth bits; table j holds
+   d 2^(256 j / comb_teeth) G for every digit d of `comb_window` bits. */
+static uint64_t *comb_table = NULL;
+
+/* SNIPPET_END: comb_table */
+
+/* SNIPPET_START: comb_teeth */
+
+static uint32_t comb_teeth = 0U;
+
+/* SNIPPET_END: comb_teeth */
+
+/* SNIPPET_START: comb_window */
+
+static uint32_t comb_window = 0U;
+
+/* SNIPPET_END: comb_window */
+
+/* SNIPPET_START: precomp_get_consttime_n */
+
+static inline void
+precomp_get_consttime_n(const uint64_t *table, uint32_t len, uint64_t bits_l, uint64_t *tmp)
+{
+  memcpy(tmp, (uint64_t *)table, 20U * sizeof (uint64_t));
+  for (uint32_t i0 = 1U; i0 < len; i0++)
+  {
+    uint64_t c = FStar_UInt64_eq_mask(bits_l, (uint64_t)i0);
+    const uint64_t *res_j = table + i0 * 20U;
+    for (uint32_t i = 0U; i < 20U; i++)
+    {
+      uint64_t *os = tmp;
+      uint64_t x = (c & res_j[i]) | (~c & tmp[i]);
+      os[i] = x;
+    }
+  }
+}
+
+/* SNIPPET_END: precomp_get_consttime_n */
+
+/* SNIPPET_START: point_mul_g_comb */
+
+/* The same comb as `point_mul_g`, with the selected number of tables and digit width:
+   256 / comb_teeth - comb_window doublings and 256 / comb_window table additions. */
+static void point_mul_g_comb(uint64_t *out, uint64_t *bscalar)
+{
+  uint32_t len = 1U << comb_window;
+  uint32_t chunk = 256U / comb_teeth;
+  uint64_t tmp[20U] = { 0U };
+  for (uint32_t i = 0U; i < chunk / comb_window; i++)
+  {
+    if (i > 0U)
+    {
+      for (uint32_t i0 = 0U; i0 < comb_window; i0++)
+      {
+        Hacl_Impl_Ed25519_PointDouble_point_double(out, out);
+      }
+    }
+    uint32_t k = chunk - comb_window * (i + 1U);
+    for (uint32_t j = 0U; j < comb_teeth; j++)
+    {
+      uint64_t bits_l = Hacl_Bignum_Lib_bn_get_bits_u64(4U, bscalar, j * chunk + k, comb_window);
+      precomp_get_consttime_n(comb_table + j * len * 20U, len, bits_l, tmp);
+      if (i == 0U && j == 0U)
+      {
+        memcpy(out, tmp, 20U * sizeof (uint64_t));
+      }
+      else
+      {
+        Hacl_Impl_Ed25519_PointAdd_point_add(out, out, tmp);
+      }
+    }
+  }
+}
+
+/* SNIPPET_END: point_mul_g_comb */
+
 /* SNIPPET_START: point_mul_g */
 
 static inline void point_mul_g(uint64_t *out, uint8_t *scalar)
 {
+  if (comb_table != NULL)
+  {
+    uint64_t bscalar0[4U] = { 0U };
+    KRML_MAYBE_FOR4(i,
+      0U,
+      4U,
+      1U,
+      uint64_t *os = bscalar0;
+      uint8_t *bj = scalar + i * 8U;
+      uint64_t u = load64_le(bj);
+      uint64_t r = u;
+      uint64_t x = r;
+      os[i] = x;);
+    point_mul_g_comb(out, bscalar0);
+    return;
+  }
   uint64_t bscalar[4U] = { 0U };
   KRML_MAYBE_FOR4(i,
     0U,
@@ -1661,78 +2041,394 @@ point_negate_mul_double_g_vartime(
 
 /* SNIPPET_END: point_negate_mul_double_g_vartime */
 
-/* SNIPPET_START: store_56 */
+/* SNIPPET_START: wnaf */
 
-static inline void store_56(uint8_t *out, uint64_t *b)
+/*
+Width-w non-adjacent form of a scalar below 2^255: naf[i] is zero or odd with
+|naf[i]| < 2^(w - 1), any w consecutive digits hold at most one non-zero digit, and
+the scalar is the sum of naf[i] * 2^i.
+*/
+static void wnaf(int8_t *naf, uint64_t *bscalar, uint32_t w)
 {
-  uint64_t b0 = b[0U];
-  uint64_t b1 = b[1U];
-  uint64_t b2 = b[2U];
-  uint64_t b3 = b[3U];
-  uint64_t b4 = b[4U];
-  uint32_t b4_ = (uint32_t)b4;
-  uint8_t *b8 = out;
-  store64_le(b8, b0);
-  uint8_t *b80 = out + 7U;
-  store64_le(b80, b1);
-  uint8_t *b81 = out + 14U;
-  store64_le(b81, b2);
-  uint8_t *b82 = out + 21U;
-  store64_le(b82, b3);
-  store32_le(out + 28U, b4_);
+  uint64_t width = 1ULL << w;
+  uint64_t carry = 0ULL;
+  uint32_t pos = 0U;
+  memset(naf, 0U, 256U * sizeof (int8_t));
+  while (pos < 256U)
+  {
+    uint32_t l;
+    if (256U - pos < w)
+    {
+      l = 256U - pos;
+    }
+    else
+    {
+      l = w;
+    }
+    uint64_t window = carry + Hacl_Bignum_Lib_bn_get_bits_u64(4U, bscalar, pos, l);
+    if ((window & 1ULL) == 0ULL)
+    {
+      pos++;
+    }
+    else
+    {
+      if (window < width / 2ULL)
+      {
+        carry = 0ULL;
+        naf[pos] = (int8_t)window;
+      }
+      else
+      {
+        carry = 1ULL;
+        naf[pos] = (int8_t)((int64_t)window - (int64_t)width);
+      }
+      pos = pos + w;
+    }
+  }
 }
 
-/* SNIPPET_END: store_56 */
+/* SNIPPET_END: wnaf */
 
-/* SNIPPET_START: load_64_bytes */
+/* SNIPPET_START: point_add_digit */
 
-static inline void load_64_bytes(uint64_t *out, uint8_t *b)
+static inline void point_add_digit(uint64_t *out, const uint64_t *table, int8_t digit)
 {
-  uint8_t *b80 = b;
-  uint64_t u = load64_le(b80);
-  uint64_t z = u;
-  uint64_t b0 = z & 0xffffffffffffffULL;
-  uint8_t *b81 = b + 7U;
-  uint64_t u0 = load64_le(b81);
-  uint64_t z0 = u0;
-  uint64_t b1 = z0 & 0xffffffffffffffULL;
-  uint8_t *b82 = b + 14U;
-  uint64_t u1 = load64_le(b82);
-  uint64_t z1 = u1;
-  uint64_t b2 = z1 & 0xffffffffffffffULL;
-  uint8_t *b83 = b + 21U;
-  uint64_t u2 = load64_le(b83);
-  uint64_t z2 = u2;
-  uint64_t b3 = z2 & 0xffffffffffffffULL;
-  uint8_t *b84 = b + 28U;
-  uint64_t u3 = load64_le(b84);
-  uint64_t z3 = u3;
-  uint64_t b4 = z3 & 0xffffffffffffffULL;
-  uint8_t *b85 = b + 35U;
-  uint64_t u4 = load64_le(b85);
-  uint64_t z4 = u4;
-  uint64_t b5 = z4 & 0xffffffffffffffULL;
-  uint8_t *b86 = b + 42U;
-  uint64_t u5 = load64_le(b86);
-  uint64_t z5 = u5;
-  uint64_t b6 = z5 & 0xffffffffffffffULL;
-  uint8_t *b87 = b + 49U;
-  uint64_t u6 = load64_le(b87);
-  uint64_t z6 = u6;
-  uint64_t b7 = z6 & 0xffffffffffffffULL;
-  uint8_t *b8 = b + 56U;
-  uint64_t u7 = load64_le(b8);
-  uint64_t z7 = u7;
-  uint64_t b88 = z7 & 0xffffffffffffffULL;
-  uint8_t b63 = b[63U];
-  uint64_t b9 = (uint64_t)b63;
-  out[0U] = b0;
-  out[1U] = b1;
-  out[2U] = b2;
-  out[3U] = b3;
-  out[4U] = b4;
-  out[5U] = b5;
-  out[6U] = b6;
+  uint64_t tmp[20U] = { 0U };
+  if (digit > 0)
+  {
+    memcpy(tmp, (uint64_t *)table + (uint32_t)digit * 20U, 20U * sizeof (uint64_t));
+  }
+  else
+  {
+    Hacl_Impl_Ed25519_PointNegate_point_negate((uint64_t *)table + (uint32_t)-digit * 20U, tmp);
+  }
+  Hacl_Impl_Ed25519_PointAdd_point_add(out, out, tmp);
+}
+
+/* SNIPPET_END: point_add_digit */
+
+/* SNIPPET_START: point_mul_g_double_wnaf */
+
+/*
+out = [scalar1]G + [scalar2]q2 for public scalars below 2^255, by a joint sliding
+window over signed digits (Straus-Shamir with wNAF): width 6 for G, whose odd
+multiples up to 31G are in basepoint_table_w5, and width 5 for q2, with a table of
+q2, 3q2, ..., 15q2. That is 8 additions to build the table, then about 37 and 43
+additions against 102 for fixed 5-bit windows, and doublings only from the top
+non-zero digit.
+*/
+static inline void
+point_mul_g_double_wnaf(uint64_t *out, uint8_t *scalar1, uint8_t *scalar2, uint64_t *q2)
+{
+  uint64_t bscalar1[4U] = { 0U };
+  uint64_t bscalar2[4U] = { 0U };
+  KRML_MAYBE_FOR4(i, 0U, 4U, 1U, bscalar1[i] = load64_le(scalar1 + i * 8U););
+  KRML_MAYBE_FOR4(i, 0U, 4U, 1U, bscalar2[i] = load64_le(scalar2 + i * 8U););
+  int8_t naf1[256U] = { 0U };
+  int8_t naf2[256U] = { 0U };
+  wnaf(naf1, bscalar1, 6U);
+  wnaf(naf2, bscalar2, 5U);
+  /* table2[k] = [k]q2 for odd k, at the same offsets as basepoint_table_w5. */
+  uint64_t table2[320U] = { 0U };
+  uint64_t q2_2[20U] = { 0U };
+  Hacl_Impl_Ed25519_PointDouble_point_double(q2_2, q2);
+  memcpy(table2 + 20U, q2, 20U * sizeof (uint64_t));
+  for (uint32_t k = 3U; k < 16U; k = k + 2U)
+  {
+    Hacl_Impl_Ed25519_PointAdd_point_add(table2 + k * 20U, table2 + (k - 2U) * 20U, q2_2);
+  }
+  Hacl_Impl_Ed25519_PointConstants_make_point_inf(out);
+  uint32_t i = 256U;
+  while (i > 0U && naf1[i - 1U] == 0 && naf2[i - 1U] == 0)
+  {
+    i--;
+  }
+  while (i > 0U)
+  {
+    i--;
+    Hacl_Impl_Ed25519_PointDouble_point_double(out, out);
+    if (naf1[i] != 0)
+    {
+      point_add_digit(out, Hacl_Ed25519_PrecompTable_precomp_basepoint_table_w5, naf1[i]);
+    }
+    if (naf2[i] != 0)
+    {
+      point_add_digit(out, table2, naf2[i]);
+    }
+  }
+}
+
+/* SNIPPET_END: point_mul_g_double_wnaf */
+
+/* SNIPPET_START: point_negate_mul_double_g_wnaf */
+
+static inline void
+point_negate_mul_double_g_wnaf(uint64_t *out, uint8_t *scalar1, uint8_t *scalar2, uint64_t *q2)
+{
+  uint64_t q2_neg[20U] = { 0U };
+  Hacl_Impl_Ed25519_PointNegate_point_negate(q2, q2_neg);
+  point_mul_g_double_wnaf(out, scalar1, scalar2, q2_neg);
+}
+
+/* SNIPPET_END: point_negate_mul_double_g_wnaf */
+
+/* SNIPPET_START: msm_window_bits */
+
+
+static uint32_t msm_window_bits(uint32_t len, uint32_t nbits)
+{
+  uint32_t best = 4U;
+  uint64_t best_cost = 0xFFFFFFFFFFFFFFFFULL;
+  for (uint32_t c = 4U; c <= 12U; c++)
+  {
+    uint64_t nw = (uint64_t)((nbits + c) / c);
+    uint64_t cost = nw * ((uint64_t)len + (1ULL << c));
+    if (cost < best_cost)
+    {
+      best_cost = cost;
+      best = c;
+    }
+  }
+  return best;
+}
+
+/* SNIPPET_END: msm_window_bits */
+
+/* SNIPPET_START: Hacl_Impl_Ed25519_MultiScalarMul_point_mul_multi_vartime */
+
+/**
+Variable-time multi-scalar multiplication: out = [scalars[0]]points[0] + ... +
+[scalars[len - 1]]points[len - 1], using Pippenger's bucket method with signed digits.
+
+Each scalar is 4 little-endian 64-bit words; each point is 20 limbs in extended
+coordinates. The number of windows follows the longest scalar. Returns `false`, leaving
+`out` untouched, if the bucket and digit buffers cannot be allocated.
+*/
+bool
+Hacl_Impl_Ed25519_MultiScalarMul_point_mul_multi_vartime(
+  uint64_t *out,
+  uint32_t len,
+  uint64_t *scalars,
+  uint64_t *points
+)
+{
+  uint32_t nbits = 0U;
+  for (uint32_t i = 0U; i < len; i++)
+  {
+    for (uint32_t j = 0U; j < 4U; j++)
+    {
+      uint64_t x = scalars[4U * i + j];
+      uint32_t b = 0U;
+      while (x != 0ULL)
+      {
+        x = x >> 1U;
+        b++;
+      }
+      if (b > 0U && 64U * j + b > nbits)
+      {
+        nbits = 64U * j + b;
+      }
+    }
+  }
+  uint32_t c = msm_window_bits(len, nbits);
+  /* One bit more than the longest scalar, for the carry out of the top digit. */
+  uint32_t nw = (nbits + c) / c;
+  uint32_t nb = 1U << (c - 1U);
+  int16_t *digits = (int16_t *)KRML_HOST_CALLOC((size_t)len * nw, sizeof (int16_t));
+  uint64_t *buckets = (uint64_t *)KRML_HOST_CALLOC((size_t)nb * 20U, sizeof (uint64_t));
+  bool *full = (bool *)KRML_HOST_CALLOC(nb, sizeof (bool));
+  if (digits == NULL || buckets == NULL || full == NULL)
+  {
+    KRML_HOST_FREE(digits);
+    KRML_HOST_FREE(buckets);
+    KRML_HOST_FREE(full);
+    return false;
+  }
+  /* Recode every scalar into digits in [-(2^(c-1) - 1), 2^(c-1)]. The top window reaches
+     past the longest scalar, so it absorbs the last carry. */
+  for (uint32_t i = 0U; i < len; i++)
+  {
+    uint64_t carry = 0ULL;
+    for (uint32_t w = 0U; w < nw; w++)
+    {
+      uint64_t d = carry;
+      if (w * c < 256U)
+      {
+        d = d + Hacl_Bignum_Lib_bn_get_bits_u64(4U, scalars + 4U * i, w * c, c);
+      }
+      if (d > (uint64_t)nb)
+      {
+        digits[i * nw + w] = (int16_t)((int64_t)d - (int64_t)(2U * nb));
+        carry = 1ULL;
+      }
+      else
+      {
+        digits[i * nw + w] = (int16_t)d;
+        carry = 0ULL;
+      }
+    }
+  }
+  uint64_t acc[20U] = { 0U };
+  uint64_t running[20U] = { 0U };
+  uint64_t total[20U] = { 0U };
+  uint64_t neg[20U] = { 0U };
+  Hacl_Impl_Ed25519_PointConstants_make_point_inf(acc);
+  for (uint32_t w0 = 0U; w0 < nw; w0++)
+  {
+    uint32_t w = nw - w0 - 1U;
+    if (w0 > 0U)
+    {
+      for (uint32_t j = 0U; j < c; j++)
+      {
+        Hacl_Impl_Ed25519_PointDouble_point_double(acc, acc);
+      }
+    }
+    memset(full, 0U, nb * sizeof (bool));
+    for (uint32_t i = 0U; i < len; i++)
+    {
+      int16_t d = digits[i * nw + w];
+      if (d != (int16_t)0)
+      {
+        uint64_t *p = points + 20U * i;
+        uint32_t b;
+        if (d < (int16_t)0)
+        {
+          Hacl_Impl_Ed25519_PointNegate_point_negate(p, neg);
+          p = neg;
+          b = (uint32_t)(-(int32_t)d) - 1U;
+        }
+        else
+        {
+          b = (uint32_t)d - 1U;
+        }
+        if (full[b])
+        {
+          Hacl_Impl_Ed25519_PointAdd_point_add(buckets + 20U * b, buckets + 20U * b, p);
+        }
+        else
+        {
+          memcpy(buckets + 20U * b, p, 20U * sizeof (uint64_t));
+          full[b] = true;
+        }
+      }
+    }
+    /* total = sum of (b + 1) * bucket[b], by running sums from the top bucket down. */
+    bool has_running = false;
+    bool has_total = false;
+    for (uint32_t b0 = 0U; b0 < nb; b0++)
+    {
+      uint32_t b = nb - b0 - 1U;
+      if (full[b])
+      {
+        if (has_running)
+        {
+          Hacl_Impl_Ed25519_PointAdd_point_add(running, running, buckets + 20U * b);
+        }
+        else
+        {
+          memcpy(running, buckets + 20U * b, 20U * sizeof (uint64_t));
+          has_running = true;
+        }
+      }
+      if (has_running)
+      {
+        if (has_total)
+        {
+          Hacl_Impl_Ed25519_PointAdd_point_add(total, total, running);
+        }
+        else
+        {
+          memcpy(total, running, 20U * sizeof (uint64_t));
+          has_total = true;
+        }
+      }
+    }
+    if (has_total)
+    {
+      Hacl_Impl_Ed25519_PointAdd_point_add(acc, acc, total);
+    }
+  }
+  memcpy(out, acc, 20U * sizeof (uint64_t));
+  KRML_HOST_FREE(digits);
+  KRML_HOST_FREE(buckets);
+  KRML_HOST_FREE(full);
+  return true;
+}
+
+/* SNIPPET_END: Hacl_Impl_Ed25519_MultiScalarMul_point_mul_multi_vartime */
+
+/* SNIPPET_START: store_56 */
+
+static inline void store_56(uint8_t *out, uint64_t *b)
+{
+  uint64_t b0 = b[0U];
+  uint64_t b1 = b[1U];
+  uint64_t b2 = b[2U];
+  uint64_t b3 = b[3U];
+  uint64_t b4 = b[4U];
+  uint32_t b4_ = (uint32_t)b4;
+  uint8_t *b8 = out;
+  store64_le(b8, b0);
+  uint8_t *b80 = out + 7U;
+  store64_le(b80, b1);
+  uint8_t *b81 = out + 14U;
+  store64_le(b81, b2);
+  uint8_t *b82 = out + 21U;
+  store64_le(b82, b3);
+  store32_le(out + 28U, b4_);
+}
+
+/* SNIPPET_END: store_56 */
+
+/* SNIPPET_START: load_64_bytes */
+
+static inline void load_64_bytes(uint64_t *out, uint8_t *b)
+{
+  uint8_t *b80 = b;
+  uint64_t u = load64_le(b80);
+  uint64_t z = u;
+  uint64_t b0 = z & 0xffffffffffffffULL;
+  uint8_t *b81 = b + 7U;
+  uint64_t u0 = load64_le(b81);
+  uint64_t z0 = u0;
+  uint64_t b1 = z0 & 0xffffffffffffffULL;
+  uint8_t *b82 = b + 14U;
+  uint64_t u1 = load64_le(b82);
+  uint64_t z1 = u1;
+  uint64_t b2 = z1 & 0xffffffffffffffULL;
+  uint8_t *b83 = b + 21U;
+  uint64_t u2 = load64_le(b83);
+  uint64_t z2 = u2;
+  uint64_t b3 = z2 & 0xffffffffffffffULL;
+  uint8_t *b84 = b + 28U;
+  uint64_t u3 = load64_le(b84);
+  uint64_t z3 = u3;
+  uint64_t b4 = z3 & 0xffffffffffffffULL;
+  uint8_t *b85 = b + 35U;
+  uint64_t u4 = load64_le(b85);
+  uint64_t z4 = u4;
+  uint64_t b5 = z4 & 0xffffffffffffffULL;
+  uint8_t *b86 = b + 42U;
+  uint64_t u5 = load64_le(b86);
+  uint64_t z5 = u5;
+  uint64_t b6 = z5 & 0xffffffffffffffULL;
+  uint8_t *b87 = b + 49U;
+  uint64_t u6 = load64_le(b87);
+  uint64_t z6 = u6;
+  uint64_t b7 = z6 & 0xffffffffffffffULL;
+  uint8_t *b8 = b + 56U;
+  uint64_t u7 = load64_le(b8);
+  uint64_t z7 = u7;
+  uint64_t b88 = z7 & 0xffffffffffffffULL;
+  uint8_t b63 = b[63U];
+  uint64_t b9 = (uint64_t)b63;
+  out[0U] = b0;
+  out[1U] = b1;
+  out[2U] = b2;
+  out[3U] = b3;
+  out[4U] = b4;
+  out[5U] = b5;
+  out[6U] = b6;
   out[7U] = b7;
   out[8U] = b88;
   out[9U] = b9;
@@ -1903,6 +2599,46 @@ void Hacl_Ed25519_secret_to_public(uint8_t *public_key, uint8_t *private_key)
 
 /* SNIPPET_END: Hacl_Ed25519_secret_to_public */
 
+/* SNIPPET_START: Hacl_Ed25519_x25519_secret_to_public */
+
+/**
+Compute the X25519 public key from the X25519 private key.
+
+  This gives the same result as `Hacl_Curve25519_51_secret_to_public`, but runs the
+  constant-time fixed-base comb of `Hacl_Ed25519_secret_to_public` on the birationally
+  equivalent edwards25519 curve and maps the result to u = (Z + Y) / (Z - Y), instead of
+  a Montgomery ladder from u = 9. It is hand-written rather than extracted from the
+  verified code.
+
+  @param[out] pub Points to 32 bytes of valid memory, i.e., `uint8_t[32]`.
+  @param[in] priv Points to 32 bytes of valid memory containing the private key, i.e., `uint8_t[32]`. It is clamped as in RFC 7748.
+*/
+void Hacl_Ed25519_x25519_secret_to_public(uint8_t *pub, uint8_t *priv)
+{
+  uint8_t s[32U] = { 0U };
+  memcpy(s, priv, 32U * sizeof (uint8_t));
+  s[0U] = (uint32_t)s[0U] & 0xf8U;
+  s[31U] = ((uint32_t)s[31U] & 127U) | 64U;
+  uint64_t p[20U] = { 0U };
+  point_mul_g(p, s);
+  uint64_t tmp[15U] = { 0U };
+  uint64_t *num = tmp;
+  uint64_t *den = tmp + 5U;
+  uint64_t *u = tmp + 10U;
+  uint64_t *py = p + 5U;
+  uint64_t *pz = p + 10U;
+  fsum(num, pz, py);
+  Hacl_Bignum25519_reduce_513(num);
+  fdifference(den, pz, py);
+  Hacl_Bignum25519_reduce_513(den);
+  Hacl_Bignum25519_inverse(u, den);
+  fmul0(u, num, u);
+  Hacl_Bignum25519_reduce_513(u);
+  Hacl_Bignum25519_store_51(pub, u);
+}
+
+/* SNIPPET_END: Hacl_Ed25519_x25519_secret_to_public */
+
 /* SNIPPET_START: Hacl_Ed25519_expand_keys */
 
 /**
@@ -1992,6 +2728,77 @@ Hacl_Ed25519_sign(uint8_t *signature, uint8_t *private_key, uint32_t msg_len, ui
 
 /* SNIPPET_END: Hacl_Ed25519_sign */
 
+/* SNIPPET_START: signature_is_canonical */
+
+/*
+The checks of verification that need no field arithmetic, so that malformed input is
+rejected for the cost of a few comparisons: S is below q, and R and, unless it is
+`NULL`, the public key pass point_encoding_is_canonical.
+*/
+static bool signature_is_canonical(uint8_t *public_key, uint8_t *signature)
+{
+  uint64_t tmp[5U] = { 0U };
+  load_32_bytes(tmp, signature + 32U);
+  if (gte_q(tmp) || !point_encoding_is_canonical(signature))
+  {
+    return false;
+  }
+  return public_key == NULL || point_encoding_is_canonical(public_key);
+}
+
+/* SNIPPET_END: signature_is_canonical */
+
+/* SNIPPET_START: verify_signature */
+
+/* Compare [S]B - [h]A with R, or, when `cofactored` holds, [8]([S]B - [h]A - R) with the
+   identity, which ignores any small-order component of A and R. */
+static inline bool
+verify_signature(
+  uint8_t *public_key,
+  uint32_t msg_len,
+  uint8_t *msg,
+  uint8_t *signature,
+  bool cofactored
+)
+{
+  uint64_t a_[20U] = { 0U };
+  uint64_t r_[20U] = { 0U };
+  if
+  (
+    !Hacl_Impl_Ed25519_PointDecompress_point_decompress(a_, public_key)
+    || !Hacl_Impl_Ed25519_PointDecompress_point_decompress(r_, signature)
+  )
+  {
+    return false;
+  }
+  uint8_t hb[32U] = { 0U };
+  uint8_t *sb = signature + 32U;
+  uint64_t tmp[5U] = { 0U };
+  load_32_bytes(tmp, sb);
+  if (gte_q(tmp))
+  {
+    return false;
+  }
+  uint64_t tmp0[5U] = { 0U };
+  sha512_modq_pre_pre2(tmp0, signature, public_key, msg_len, msg);
+  store_56(hb, tmp0);
+  uint64_t exp_d[20U] = { 0U };
+  point_negate_mul_double_g_vartime(exp_d, sb, hb, a_);
+  if (!cofactored)
+  {
+    return Hacl_Impl_Ed25519_PointEqual_point_equal(exp_d, r_);
+  }
+  uint64_t neg_r[20U] = { 0U };
+  uint64_t inf[20U] = { 0U };
+  Hacl_Impl_Ed25519_PointNegate_point_negate(r_, neg_r);
+  Hacl_Impl_Ed25519_PointAdd_point_add(exp_d, exp_d, neg_r);
+  KRML_MAYBE_FOR3(i, 0U, 3U, 1U, Hacl_Impl_Ed25519_PointDouble_point_double(exp_d, exp_d););
+  Hacl_Impl_Ed25519_PointConstants_make_point_inf(inf);
+  return Hacl_Impl_Ed25519_PointEqual_point_equal(exp_d, inf);
+}
+
+/* SNIPPET_END: verify_signature */
+
 /* SNIPPET_START: Hacl_Ed25519_verify */
 
 /**
@@ -2042,3 +2849,1279 @@ Hacl_Ed25519_verify(uint8_t *public_key, uint32_t msg_len, uint8_t *msg, uint8_t
 
 /* SNIPPET_END: Hacl_Ed25519_verify */
 
+/* SNIPPET_START: Hacl_Ed25519_verify_vartime */
+
+/**
+Verify an Ed25519 signature, accepting exactly the signatures that
+`Hacl_Ed25519_verify` accepts.
+
+  This function is hand-written rather than extracted from the verified code. It
+  rejects an `S` that is not below the group order, or an `R` or public key that is not a
+  canonical point encoding, before any field arithmetic, decompresses `R` before the
+  public key with a single exponentiation each, and computes the double scalar
+  multiplication with a wNAF chain. On this path a random 64-byte string is rejected
+  about five times faster, and a valid signature is accepted about a quarter faster.
+
+  @param public_key Points to 32 bytes of valid memory containing the public key, i.e., `uint8_t[32]`.
+  @param msg_len Length of `msg`.
+  @param msg Points to `msg_len` bytes of valid memory containing the message, i.e., `uint8_t[msg_len]`.
+  @param signature Points to 64 bytes of valid memory containing the signature, i.e., `uint8_t[64]`.
+
+  @return Returns `true` if the signature is valid and `false` otherwise.
+*/
+bool
+Hacl_Ed25519_verify_vartime(
+  uint8_t *public_key,
+  uint32_t msg_len,
+  uint8_t *msg,
+  uint8_t *signature
+)
+{
+  if (!signature_is_canonical(public_key, signature))
+  {
+    return false;
+  }
+  uint64_t r_[20U] = { 0U };
+  uint64_t a_[20U] = { 0U };
+  if (!point_decompress_vartime(r_, signature) || !point_decompress_vartime(a_, public_key))
+  {
+    return false;
+  }
+  uint8_t hb[32U] = { 0U };
+  uint64_t tmp[5U] = { 0U };
+  sha512_modq_pre_pre2(tmp, signature, public_key, msg_len, msg);
+  store_56(hb, tmp);
+  uint64_t exp_d[20U] = { 0U };
+  point_negate_mul_double_g_wnaf(exp_d, signature + 32U, hb, a_);
+  return Hacl_Impl_Ed25519_PointEqual_point_equal(exp_d, r_);
+}
+
+/* SNIPPET_END: Hacl_Ed25519_verify_vartime */
+
+/* SNIPPET_START: Hacl_Ed25519_verify_cofactored */
+
+/**
+Verify an Ed25519 signature with the cofactored equation [8][S]B = [8]R + [8][h]A.
+
+  This accepts every signature that `Hacl_Ed25519_verify` accepts, and also those whose
+  `R` or public key has a small-order component. It gives the same result as
+  `Hacl_Ed25519_verify_batch` on every input, so a caller that mixes single and batch
+  verification, e.g. to validate blocks, should use this function for single signatures.
+
+  @param public_key Points to 32 bytes of valid memory containing the public key, i.e., `uint8_t[32]`.
+  @param msg_len Length of `msg`.
+  @param msg Points to `msg_len` bytes of valid memory containing the message, i.e., `uint8_t[msg_len]`.
+  @param signature Points to 64 bytes of valid memory containing the signature, i.e., `uint8_t[64]`.
+
+  @return Returns `true` if the signature is valid and `false` otherwise.
+*/
+bool
+Hacl_Ed25519_verify_cofactored(
+  uint8_t *public_key,
+  uint32_t msg_len,
+  uint8_t *msg,
+  uint8_t *signature
+)
+{
+  return verify_signature(public_key, msg_len, msg, signature, true);
+}
+
+/* SNIPPET_END: Hacl_Ed25519_verify_cofactored */
+
+/* SNIPPET_START: scalar_to_words */
+
+static inline void scalar_to_words(uint64_t *out, uint64_t *s)
+{
+  uint8_t b[32U] = { 0U };
+  store_56(b, s);
+  KRML_MAYBE_FOR4(i, 0U, 4U, 1U, out[i] = load64_le(b + i * 8U););
+}
+
+/* SNIPPET_END: scalar_to_words */
+
+/* SNIPPET_START: verify_each */
+
+static bool
+verify_each(
+  uint32_t n,
+  uint8_t **public_keys,
+  uint8_t **msgs,
+  uint32_t *msg_lens,
+  uint8_t **signatures,
+  bool *results
+)
+{
+  bool all = true;
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    results[i] =
+      Hacl_Ed25519_verify_cofactored(public_keys[i], msg_lens[i], msgs[i], signatures[i]);
+    all = all && results[i];
+  }
+  return all;
+}
+
+/* SNIPPET_END: verify_each */
+
+/* SNIPPET_START: verify_batch_chunk */
+
+static bool
+verify_batch_chunk(
+  uint32_t n,
+  uint8_t **public_keys,
+  uint8_t **msgs,
+  uint32_t *msg_lens,
+  uint8_t **signatures,
+  bool *results
+)
+{
+  if (n < 8U)
+  {
+    return verify_each(n, public_keys, msgs, msg_lens, signatures, results);
+  }
+  uint64_t *points = (uint64_t *)KRML_HOST_CALLOC((size_t)n * 40U, sizeof (uint64_t));
+  uint64_t *scalars = (uint64_t *)KRML_HOST_CALLOC((size_t)n * 8U, sizeof (uint64_t));
+  uint64_t *hs = (uint64_t *)KRML_HOST_CALLOC((size_t)n * 10U, sizeof (uint64_t));
+  if (points == NULL || scalars == NULL || hs == NULL)
+  {
+    KRML_HOST_FREE(points);
+    KRML_HOST_FREE(scalars);
+    KRML_HOST_FREE(hs);
+    return verify_each(n, public_keys, msgs, msg_lens, signatures, results);
+  }
+  /* Decompress -A and -R, check S < q and compute h for every entry, and absorb the
+     whole batch into the transcript from which the randomizers are derived. */
+  uint8_t buf[128U] = { 0U };
+  uint64_t block_state[8U] = { 0U };
+  Hacl_Streaming_MD_state_64
+  s = { .block_state = block_state, .buf = buf, .total_len = (uint64_t)0U };
+  Hacl_Streaming_MD_state_64 *st = &s;
+  Hacl_Hash_SHA2_sha512_init(block_state);
+  uint32_t cnt = 0U;
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    uint8_t *sig = signatures[i];
+    uint64_t a_[20U] = { 0U };
+    uint64_t r_[20U] = { 0U };
+    uint64_t *h = hs + 10U * cnt;
+    uint64_t *sc = h + 5U;
+    bool ok =
+      Hacl_Impl_Ed25519_PointDecompress_point_decompress(a_, public_keys[i])
+      && Hacl_Impl_Ed25519_PointDecompress_point_decompress(r_, sig);
+    if (ok)
+    {
+      load_32_bytes(sc, sig + 32U);
+      ok = !gte_q(sc);
+    }
+    results[i] = ok;
+    if (ok)
+    {
+      uint8_t hb[32U] = { 0U };
+      sha512_modq_pre_pre2(h, sig, public_keys[i], msg_lens[i], msgs[i]);
+      store_56(hb, h);
+      Hacl_Streaming_Types_error_code err0 = Hacl_Hash_SHA2_update_512(st, sig, 64U);
+      Hacl_Streaming_Types_error_code
+      err1 = Hacl_Hash_SHA2_update_512(st, public_keys[i], 32U);
+      Hacl_Streaming_Types_error_code err2 = Hacl_Hash_SHA2_update_512(st, hb, 32U);
+      KRML_MAYBE_UNUSED_VAR(err0);
+      KRML_MAYBE_UNUSED_VAR(err1);
+      KRML_MAYBE_UNUSED_VAR(err2);
+      Hacl_Impl_Ed25519_PointNegate_point_negate(a_, points + 40U * cnt);
+      Hacl_Impl_Ed25519_PointNegate_point_negate(r_, points + 40U * cnt + 20U);
+      cnt++;
+    }
+  }
+  uint8_t seed[68U] = { 0U };
+  Hacl_Hash_SHA2_digest_512(st, seed);
+  /* With 128-bit randomizers z_i, check [8]([sum z_i S_i]B + sum [z_i h_i](-A_i) +
+     sum [z_i](-R_i)) = 0. */
+  uint8_t zs[64U] = { 0U };
+  uint64_t sacc[5U] = { 0U };
+  for (uint32_t j = 0U; j < cnt; j++)
+  {
+    if (j % 4U == 0U)
+    {
+      store32_le(seed + 64U, j / 4U);
+      Hacl_Hash_SHA2_hash_512(zs, seed, 68U);
+    }
+    uint8_t zb[32U] = { 0U };
+    memcpy(zb, zs + j % 4U * 16U, 16U * sizeof (uint8_t));
+    uint64_t z[5U] = { 0U };
+    uint64_t zh[5U] = { 0U };
+    uint64_t zsc[5U] = { 0U };
+    load_32_bytes(z, zb);
+    mul_modq(zh, z, hs + 10U * j);
+    mul_modq(zsc, z, hs + 10U * j + 5U);
+    add_modq(sacc, sacc, zsc);
+    scalar_to_words(scalars + 8U * j, zh);
+    scalar_to_words(scalars + 8U * j + 4U, z);
+  }
+  uint64_t sum[20U] = { 0U };
+  bool
+  ok = Hacl_Impl_Ed25519_MultiScalarMul_point_mul_multi_vartime(sum, 2U * cnt, scalars, points);
+  KRML_HOST_FREE(points);
+  KRML_HOST_FREE(scalars);
+  KRML_HOST_FREE(hs);
+  if (ok)
+  {
+    uint8_t sb[32U] = { 0U };
+    uint64_t sB[20U] = { 0U };
+    uint64_t inf[20U] = { 0U };
+    store_56(sb, sacc);
+    point_mul_g(sB, sb);
+    Hacl_Impl_Ed25519_PointAdd_point_add(sum, sum, sB);
+    KRML_MAYBE_FOR3(i, 0U, 3U, 1U, Hacl_Impl_Ed25519_PointDouble_point_double(sum, sum););
+    Hacl_Impl_Ed25519_PointConstants_make_point_inf(inf);
+    ok = Hacl_Impl_Ed25519_PointEqual_point_equal(sum, inf);
+  }
+  if (ok)
+  {
+    return cnt == n;
+  }
+  /* Some entry is bad: find it, and any other, by checking every candidate on its own. */
+  bool all = true;
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    if (results[i])
+    {
+      results[i] =
+        Hacl_Ed25519_verify_cofactored(public_keys[i], msg_lens[i], msgs[i], signatures[i]);
+    }
+    all = all && results[i];
+  }
+  return all;
+}
+
+/* SNIPPET_END: verify_batch_chunk */
+
+/* SNIPPET_START: Hacl_Ed25519_verify_batch */
+
+/**
+Verify a batch of Ed25519 signatures.
+
+  @param n Number of signatures.
+  @param public_keys Points to `n` pointers, each to a 32-byte public key.
+  @param msgs Points to `n` pointers, each to a message of `msg_lens[i]` bytes.
+  @param msg_lens Points to `n` message lengths.
+  @param signatures Points to `n` pointers, each to a 64-byte signature.
+  @param results Points to `n` booleans that receive the result for each signature.
+
+  @return Returns `true` if every signature is valid and `false` otherwise.
+
+  The signatures are checked together, in chunks of up to 2048, with a random linear
+  combination evaluated by a single multi-scalar multiplication. The 128-bit randomizers
+  are derived with SHA-512 from the whole chunk, so the result is deterministic and no
+  random number generator is needed.
+
+  Verification is cofactored: every entry, whatever the size of the batch and whether
+  or not other entries are invalid, gets the result of `Hacl_Ed25519_verify_cofactored`.
+  Unlike `Hacl_Ed25519_verify`, this accepts signatures whose `R` or public key has a
+  small-order component. Chunks of fewer than 8 signatures, and chunks whose combined
+  equation does not hold, are checked entry by entry with
+  `Hacl_Ed25519_verify_cofactored`, which identifies the invalid ones.
+*/
+bool
+Hacl_Ed25519_verify_batch(
+  uint32_t n,
+  uint8_t **public_keys,
+  uint8_t **msgs,
+  uint32_t *msg_lens,
+  uint8_t **signatures,
+  bool *results
+)
+{
+  bool all = true;
+  for (uint32_t i = 0U; i < n; i = i + 2048U)
+  {
+    uint32_t len;
+    if (n - i < 2048U)
+    {
+      len = n - i;
+    }
+    else
+    {
+      len = 2048U;
+    }
+    bool ok =
+      verify_batch_chunk(len,
+        public_keys + i,
+        msgs + i,
+        msg_lens + i,
+        signatures + i,
+        results + i);
+    all = ok && all;
+  }
+  return all;
+}
+
+/* SNIPPET_END: Hacl_Ed25519_verify_batch */
+
+/* SNIPPET_START: make_pk_table */
+
+static void make_pk_table(uint64_t *table, uint64_t *a)
+{
+  uint64_t base[20U] = { 0U };
+  Hacl_Impl_Ed25519_PointNegate_point_negate(a, base);
+  KRML_MAYBE_FOR4(i,
+    0U,
+    4U,
+    1U,
+    uint64_t *t = table + i * 320U;
+    if (i > 0U)
+    {
+      for (uint32_t j = 0U; j < 64U; j++)
+      {
+        Hacl_Impl_Ed25519_PointDouble_point_double(base, base);
+      }
+    }
+    Hacl_Impl_Ed25519_PointConstants_make_point_inf(t);
+    memcpy(t + 20U, base, 20U * sizeof (uint64_t));
+    KRML_MAYBE_FOR7(j,
+      0U,
+      7U,
+      1U,
+      Hacl_Impl_Ed25519_PointDouble_point_double(t + (2U * j + 2U) * 20U, t + (j + 1U) * 20U);
+      Hacl_Impl_Ed25519_PointAdd_point_add(t + (2U * j + 3U) * 20U,
+        t + (2U * j + 2U) * 20U,
+        base);););
+}
+
+/* SNIPPET_END: make_pk_table */
+
+/* SNIPPET_START: point_mul_g_double_comb_vartime */
+
+/* out = [s]G + [h](-A), with G and -A both split into four 64-bit combs of 4-bit
+   windows; zero windows are skipped. */
+static void
+point_mul_g_double_comb_vartime(uint64_t *out, uint8_t *s, uint8_t *h, uint64_t *table)
+{
+  const uint64_t *g_tables[4U] =
+    {
+      Hacl_Ed25519_PrecompTable_precomp_basepoint_table_w4,
+      Hacl_Ed25519_PrecompTable_precomp_g_pow2_64_table_w4,
+      Hacl_Ed25519_PrecompTable_precomp_g_pow2_128_table_w4,
+      Hacl_Ed25519_PrecompTable_precomp_g_pow2_192_table_w4
+    };
+  uint64_t sw[4U] = { 0U };
+  uint64_t hw[4U] = { 0U };
+  KRML_MAYBE_FOR4(i, 0U, 4U, 1U, sw[i] = load64_le(s + i * 8U); hw[i] = load64_le(h + i * 8U););
+  Hacl_Impl_Ed25519_PointConstants_make_point_inf(out);
+  for (uint32_t i = 0U; i < 16U; i++)
+  {
+    if (i > 0U)
+    {
+      KRML_MAYBE_FOR4(i0, 0U, 4U, 1U, Hacl_Impl_Ed25519_PointDouble_point_double(out, out););
+    }
+    uint32_t k = 64U - 4U * i - 4U;
+    KRML_MAYBE_FOR4(j,
+      0U,
+      4U,
+      1U,
+      uint32_t bits_s = (uint32_t)(sw[j] >> k & 15ULL);
+      uint32_t bits_h = (uint32_t)(hw[j] >> k & 15ULL);
+      if (bits_s != 0U)
+      {
+        Hacl_Impl_Ed25519_PointAdd_point_add(out, out, (uint64_t *)g_tables[j] + bits_s * 20U);
+      }
+      if (bits_h != 0U)
+      {
+        Hacl_Impl_Ed25519_PointAdd_point_add(out, out, table + j * 320U + bits_h * 20U);
+      });
+  }
+}
+
+/* SNIPPET_END: point_mul_g_double_comb_vartime */
+
+/* SNIPPET_START: Hacl_Ed25519_pk_ctx_init */
+
+/**
+Prepare a context for verifying signatures under one public key.
+
+  @param[out] ctx The context to initialize.
+  @param[in] public_key Points to 32 bytes of valid memory containing the public key, i.e., `uint8_t[32]`.
+
+  @return Returns `false` if the public key is not a valid point, in which case no
+  signature can be valid under it, and `true` otherwise.
+
+  The context holds the decompressed key and about 10 KiB of precomputed multiples of
+  it, so that `Hacl_Ed25519_verify_with_ctx` spends about a quarter of the point
+  doublings of `Hacl_Ed25519_verify`.
+*/
+bool Hacl_Ed25519_pk_ctx_init(Hacl_Ed25519_pk_ctx *ctx, uint8_t *public_key)
+{
+  uint64_t a_[20U] = { 0U };
+  bool b = Hacl_Impl_Ed25519_PointDecompress_point_decompress(a_, public_key);
+  memcpy((*ctx).public_key, public_key, 32U * sizeof (uint8_t));
+  (*ctx).valid = b;
+  if (b)
+  {
+    make_pk_table((*ctx).table, a_);
+  }
+  return b;
+}
+
+/* SNIPPET_END: Hacl_Ed25519_pk_ctx_init */
+
+/* SNIPPET_START: Hacl_Ed25519_verify_with_ctx */
+
+/**
+Verify an Ed25519 signature under the public key of a context.
+
+  @param[in] ctx A context initialized by `Hacl_Ed25519_pk_ctx_init`.
+  @param msg_len Length of `msg`.
+  @param msg Points to `msg_len` bytes of valid memory containing the message, i.e., `uint8_t[msg_len]`.
+  @param signature Points to 64 bytes of valid memory containing the signature, i.e., `uint8_t[64]`.
+
+  @return Returns `true` if the signature is valid and `false` otherwise, exactly as
+  `Hacl_Ed25519_verify` on the public key of the context.
+*/
+bool
+Hacl_Ed25519_verify_with_ctx(
+  Hacl_Ed25519_pk_ctx *ctx,
+  uint32_t msg_len,
+  uint8_t *msg,
+  uint8_t *signature
+)
+{
+  if (!(*ctx).valid)
+  {
+    return false;
+  }
+  uint64_t r_[20U] = { 0U };
+  bool b_ = Hacl_Impl_Ed25519_PointDecompress_point_decompress(r_, signature);
+  if (b_)
+  {
+    uint8_t hb[32U] = { 0U };
+    uint8_t *sb = signature + 32U;
+    uint64_t tmp[5U] = { 0U };
+    load_32_bytes(tmp, sb);
+    if (gte_q(tmp))
+    {
+      return false;
+    }
+    uint64_t tmp0[5U] = { 0U };
+    sha512_modq_pre_pre2(tmp0, signature, (*ctx).public_key, msg_len, msg);
+    store_56(hb, tmp0);
+    uint64_t exp_d[20U] = { 0U };
+    point_mul_g_double_comb_vartime(exp_d, sb, hb, (*ctx).table);
+    return Hacl_Impl_Ed25519_PointEqual_point_equal(exp_d, r_);
+  }
+  return false;
+}
+
+/* SNIPPET_END: Hacl_Ed25519_verify_with_ctx */
+
+/* SNIPPET_START: Hacl_Ed25519_pk_cache_malloc */
+
+/**
+Allocate a cache of verification contexts for up to `capacity` public keys, evicting
+the least recently used key when full. Returns `NULL` if `capacity` is zero or if
+allocation fails.
+
+The cache is not synchronized; threads must not share one without a lock.
+*/
+Hacl_Ed25519_pk_cache *Hacl_Ed25519_pk_cache_malloc(uint32_t capacity)
+{
+  if (capacity == 0U)
+  {
+    return NULL;
+  }
+  Hacl_Ed25519_pk_cache
+  *c = (Hacl_Ed25519_pk_cache *)KRML_HOST_MALLOC(sizeof (Hacl_Ed25519_pk_cache));
+  uint64_t *last_used = (uint64_t *)KRML_HOST_CALLOC(capacity, sizeof (uint64_t));
+  Hacl_Ed25519_pk_ctx
+  *entries = (Hacl_Ed25519_pk_ctx *)KRML_HOST_CALLOC(capacity, sizeof (Hacl_Ed25519_pk_ctx));
+  if (c == NULL || last_used == NULL || entries == NULL)
+  {
+    KRML_HOST_FREE(c);
+    KRML_HOST_FREE(last_used);
+    KRML_HOST_FREE(entries);
+    return NULL;
+  }
+  (*c).capacity = capacity;
+  (*c).len = 0U;
+  (*c).clock = 0ULL;
+  (*c).last_used = last_used;
+  (*c).entries = entries;
+  return c;
+}
+
+/* SNIPPET_END: Hacl_Ed25519_pk_cache_malloc */
+
+/* SNIPPET_START: Hacl_Ed25519_pk_cache_free */
+
+void Hacl_Ed25519_pk_cache_free(Hacl_Ed25519_pk_cache *c)
+{
+  if (c != NULL)
+  {
+    KRML_HOST_FREE((*c).last_used);
+    KRML_HOST_FREE((*c).entries);
+    KRML_HOST_FREE(c);
+  }
+}
+
+/* SNIPPET_END: Hacl_Ed25519_pk_cache_free */
+
+/* SNIPPET_START: Hacl_Ed25519_verify_cached */
+
+/**
+Verify an Ed25519 signature, reusing the context of `public_key` from the cache or
+adding one for it. Returns the same result as `Hacl_Ed25519_verify`.
+*/
+bool
+Hacl_Ed25519_verify_cached(
+  Hacl_Ed25519_pk_cache *c,
+  uint8_t *public_key,
+  uint32_t msg_len,
+  uint8_t *msg,
+  uint8_t *signature
+)
+{
+  (*c).clock = (*c).clock + 1ULL;
+  uint32_t slot = (*c).len;
+  for (uint32_t i = 0U; i < (*c).len; i++)
+  {
+    if (memcmp((*c).entries[i].public_key, public_key, 32U) == 0)
+    {
+      slot = i;
+      break;
+    }
+  }
+  if (slot == (*c).len)
+  {
+    if ((*c).len < (*c).capacity)
+    {
+      (*c).len = (*c).len + 1U;
+    }
+    else
+    {
+      slot = 0U;
+      for (uint32_t i = 1U; i < (*c).len; i++)
+      {
+        if ((*c).last_used[i] < (*c).last_used[slot])
+        {
+          slot = i;
+        }
+      }
+    }
+    Hacl_Ed25519_pk_ctx_init((*c).entries + slot, public_key);
+  }
+  (*c).last_used[slot] = (*c).clock;
+  return Hacl_Ed25519_verify_with_ctx((*c).entries + slot, msg_len, msg, signature);
+}
+
+/* SNIPPET_END: Hacl_Ed25519_verify_cached */
+
+/* SNIPPET_START: make_dom2 */
+
+/* dom2(flag, ctx) of RFC 8032, Section 5.1. Returns its length, or 0 if the context is
+   longer than 255 bytes. */
+static uint32_t make_dom2(uint8_t *dom, uint8_t flag, uint32_t ctx_len, uint8_t *ctx)
+{
+  if (ctx_len > 255U)
+  {
+    return 0U;
+  }
+  memcpy(dom, "SigEd25519 no Ed25519 collisions", 32U * sizeof (uint8_t));
+  dom[32U] = flag;
+  dom[33U] = (uint8_t)ctx_len;
+  if (ctx_len > 0U)
+  {
+    memcpy(dom + 34U, ctx, ctx_len * sizeof (uint8_t));
+  }
+  return 34U + ctx_len;
+}
+
+/* SNIPPET_END: make_dom2 */
+
+/* SNIPPET_START: sha512_modq_dom */
+
+static void
+sha512_modq_dom(
+  uint64_t *out,
+  uint8_t *dom,
+  uint32_t dom_len,
+  uint8_t *prefix,
+  uint8_t *prefix2,
+  uint32_t len,
+  uint8_t *input
+)
+{
+  uint8_t buf[128U] = { 0U };
+  uint64_t block_state[8U] = { 0U };
+  Hacl_Streaming_MD_state_64
+  s = { .block_state = block_state, .buf = buf, .total_len = (uint64_t)0U };
+  Hacl_Streaming_MD_state_64 *st = &s;
+  Hacl_Hash_SHA2_sha512_init(block_state);
+  Hacl_Streaming_Types_error_code err0 = Hacl_Hash_SHA2_update_512(st, dom, dom_len);
+  Hacl_Streaming_Types_error_code err1 = Hacl_Hash_SHA2_update_512(st, prefix, 32U);
+  KRML_MAYBE_UNUSED_VAR(err0);
+  KRML_MAYBE_UNUSED_VAR(err1);
+  if (prefix2 != NULL)
+  {
+    Hacl_Streaming_Types_error_code err2 = Hacl_Hash_SHA2_update_512(st, prefix2, 32U);
+    KRML_MAYBE_UNUSED_VAR(err2);
+  }
+  Hacl_Streaming_Types_error_code err3 = Hacl_Hash_SHA2_update_512(st, input, len);
+  KRML_MAYBE_UNUSED_VAR(err3);
+  uint8_t hash[64U] = { 0U };
+  uint64_t tmp[10U] = { 0U };
+  Hacl_Hash_SHA2_digest_512(st, hash);
+  load_64_bytes(tmp, hash);
+  barrett_reduction(out, tmp);
+}
+
+/* SNIPPET_END: sha512_modq_dom */
+
+/* SNIPPET_START: sign_dom */
+
+static void
+sign_dom(
+  uint8_t *signature,
+  uint8_t *private_key,
+  uint8_t *dom,
+  uint32_t dom_len,
+  uint32_t msg_len,
+  uint8_t *msg
+)
+{
+  uint8_t expanded_keys[96U] = { 0U };
+  Hacl_Ed25519_expand_keys(expanded_keys, private_key);
+  uint8_t *rs = signature;
+  uint8_t *ss = signature + 32U;
+  uint64_t rq[5U] = { 0U };
+  uint64_t hq[5U] = { 0U };
+  uint8_t rb[32U] = { 0U };
+  uint8_t *public_key = expanded_keys;
+  uint8_t *s = expanded_keys + 32U;
+  uint8_t *prefix = expanded_keys + 64U;
+  sha512_modq_dom(rq, dom, dom_len, prefix, NULL, msg_len, msg);
+  store_56(rb, rq);
+  point_mul_g_compress(rs, rb);
+  sha512_modq_dom(hq, dom, dom_len, rs, public_key, msg_len, msg);
+  uint64_t aq[5U] = { 0U };
+  load_32_bytes(aq, s);
+  mul_modq(aq, hq, aq);
+  add_modq(aq, rq, aq);
+  store_56(ss, aq);
+}
+
+/* SNIPPET_END: sign_dom */
+
+/* SNIPPET_START: verify_dom */
+
+static bool
+verify_dom(
+  uint8_t *public_key,
+  uint8_t *dom,
+  uint32_t dom_len,
+  uint32_t msg_len,
+  uint8_t *msg,
+  uint8_t *signature
+)
+{
+  uint64_t a_[20U] = { 0U };
+  bool b = Hacl_Impl_Ed25519_PointDecompress_point_decompress(a_, public_key);
+  if (b)
+  {
+    uint64_t r_[20U] = { 0U };
+    bool b_ = Hacl_Impl_Ed25519_PointDecompress_point_decompress(r_, signature);
+    if (b_)
+    {
+      uint8_t hb[32U] = { 0U };
+      uint8_t *sb = signature + 32U;
+      uint64_t tmp[5U] = { 0U };
+      load_32_bytes(tmp, sb);
+      if (gte_q(tmp))
+      {
+        return false;
+      }
+      uint64_t tmp0[5U] = { 0U };
+      sha512_modq_dom(tmp0, dom, dom_len, signature, public_key, msg_len, msg);
+      store_56(hb, tmp0);
+      uint64_t exp_d[20U] = { 0U };
+      point_negate_mul_double_g_vartime(exp_d, sb, hb, a_);
+      return Hacl_Impl_Ed25519_PointEqual_point_equal(exp_d, r_);
+    }
+    return false;
+  }
+  return false;
+}
+
+/* SNIPPET_END: verify_dom */
+
+/* SNIPPET_START: Hacl_Ed25519_sign_ctx */
+
+/**
+Create an Ed25519ctx signature (RFC 8032, Section 5.1).
+
+  @param[out] signature Points to 64 bytes of valid memory, i.e., `uint8_t[64]`.
+  @param[in] private_key Points to 32 bytes of valid memory containing the private key, i.e., `uint8_t[32]`.
+  @param ctx_len Length of `ctx`, between 1 and 255.
+  @param[in] ctx Points to `ctx_len` bytes of valid memory containing the context.
+  @param msg_len Length of `msg`.
+  @param[in] msg Points to `msg_len` bytes of valid memory containing the message, i.e., `uint8_t[msg_len]`.
+
+  @return Returns `false`, without writing `signature`, if `ctx_len` is out of range.
+*/
+bool
+Hacl_Ed25519_sign_ctx(
+  uint8_t *signature,
+  uint8_t *private_key,
+  uint32_t ctx_len,
+  uint8_t *ctx,
+  uint32_t msg_len,
+  uint8_t *msg
+)
+{
+  uint8_t dom[289U] = { 0U };
+  uint32_t dom_len = make_dom2(dom, 0U, ctx_len, ctx);
+  if (ctx_len == 0U || dom_len == 0U)
+  {
+    return false;
+  }
+  sign_dom(signature, private_key, dom, dom_len, msg_len, msg);
+  return true;
+}
+
+/* SNIPPET_END: Hacl_Ed25519_sign_ctx */
+
+/* SNIPPET_START: Hacl_Ed25519_verify_ctx */
+
+/**
+Verify an Ed25519ctx signature (RFC 8032, Section 5.1).
+
+  @return Returns `true` if the signature is valid for `ctx` and `false` otherwise,
+  including when `ctx_len` is not between 1 and 255.
+*/
+bool
+Hacl_Ed25519_verify_ctx(
+  uint8_t *public_key,
+  uint32_t ctx_len,
+  uint8_t *ctx,
+  uint32_t msg_len,
+  uint8_t *msg,
+  uint8_t *signature
+)
+{
+  uint8_t dom[289U] = { 0U };
+  uint32_t dom_len = make_dom2(dom, 0U, ctx_len, ctx);
+  if (ctx_len == 0U || dom_len == 0U)
+  {
+    return false;
+  }
+  return verify_dom(public_key, dom, dom_len, msg_len, msg, signature);
+}
+
+/* SNIPPET_END: Hacl_Ed25519_verify_ctx */
+
+/* SNIPPET_START: Hacl_Ed25519_sign_ph */
+
+/**
+Create an Ed25519ph signature (RFC 8032, Section 5.1) from the SHA-512 digest of the
+message.
+
+  @param[out] signature Points to 64 bytes of valid memory, i.e., `uint8_t[64]`.
+  @param[in] private_key Points to 32 bytes of valid memory containing the private key, i.e., `uint8_t[32]`.
+  @param ctx_len Length of `ctx`, at most 255.
+  @param[in] ctx Points to `ctx_len` bytes of valid memory containing the context.
+  @param[in] msg_hash Points to the 64-byte SHA-512 digest of the message.
+
+  @return Returns `false`, without writing `signature`, if `ctx_len` is out of range.
+*/
+bool
+Hacl_Ed25519_sign_ph(
+  uint8_t *signature,
+  uint8_t *private_key,
+  uint32_t ctx_len,
+  uint8_t *ctx,
+  uint8_t *msg_hash
+)
+{
+  uint8_t dom[289U] = { 0U };
+  uint32_t dom_len = make_dom2(dom, 1U, ctx_len, ctx);
+  if (dom_len == 0U)
+  {
+    return false;
+  }
+  sign_dom(signature, private_key, dom, dom_len, 64U, msg_hash);
+  return true;
+}
+
+/* SNIPPET_END: Hacl_Ed25519_sign_ph */
+
+/* SNIPPET_START: Hacl_Ed25519_verify_ph */
+
+/**
+Verify an Ed25519ph signature (RFC 8032, Section 5.1) given the SHA-512 digest of the
+message.
+
+  @return Returns `true` if the signature is valid and `false` otherwise, including
+  when `ctx_len` is larger than 255.
+*/
+bool
+Hacl_Ed25519_verify_ph(
+  uint8_t *public_key,
+  uint32_t ctx_len,
+  uint8_t *ctx,
+  uint8_t *msg_hash,
+  uint8_t *signature
+)
+{
+  uint8_t dom[289U] = { 0U };
+  uint32_t dom_len = make_dom2(dom, 1U, ctx_len, ctx);
+  if (dom_len == 0U)
+  {
+    return false;
+  }
+  return verify_dom(public_key, dom, dom_len, 64U, msg_hash, signature);
+}
+
+/* SNIPPET_END: Hacl_Ed25519_verify_ph */
+
+/* SNIPPET_START: Hacl_Ed25519_sign_ph_finish */
+
+/**
+Create an Ed25519ph signature of everything fed into a SHA-512 streaming state.
+
+  @param[in] state A state obtained from `Hacl_Hash_SHA2_malloc_512` and fed with the
+  message through `Hacl_Hash_SHA2_update_512`. It is left unchanged, so more data may
+  still be fed into it.
+
+The message is read once, in whatever pieces it arrives, and never needs to be held in
+memory as a whole.
+*/
+bool
+Hacl_Ed25519_sign_ph_finish(
+  uint8_t *signature,
+  uint8_t *private_key,
+  uint32_t ctx_len,
+  uint8_t *ctx,
+  Hacl_Streaming_MD_state_64 *state
+)
+{
+  uint8_t msg_hash[64U] = { 0U };
+  Hacl_Hash_SHA2_digest_512(state, msg_hash);
+  return Hacl_Ed25519_sign_ph(signature, private_key, ctx_len, ctx, msg_hash);
+}
+
+/* SNIPPET_END: Hacl_Ed25519_sign_ph_finish */
+
+/* SNIPPET_START: Hacl_Ed25519_verify_ph_finish */
+
+/**
+Verify an Ed25519ph signature of everything fed into a SHA-512 streaming state; see
+`Hacl_Ed25519_sign_ph_finish`.
+*/
+bool
+Hacl_Ed25519_verify_ph_finish(
+  uint8_t *public_key,
+  uint32_t ctx_len,
+  uint8_t *ctx,
+  Hacl_Streaming_MD_state_64 *state,
+  uint8_t *signature
+)
+{
+  uint8_t msg_hash[64U] = { 0U };
+  Hacl_Hash_SHA2_digest_512(state, msg_hash);
+  return Hacl_Ed25519_verify_ph(public_key, ctx_len, ctx, msg_hash, signature);
+}
+
+/* SNIPPET_END: Hacl_Ed25519_verify_ph_finish */
+
+/* SNIPPET_START: point_mul_g4 */
+
+/* Four fixed-base comb evaluations run in lockstep: every doubling and table addition is
+   issued for the four lanes in turn, so that their independent field operations overlap.
+   Each lane is constant-time, as in `point_mul_g`. */
+static void point_mul_g4(uint64_t *out, uint8_t *scalars)
+{
+  if (comb_table != NULL)
+  {
+    KRML_MAYBE_FOR4(l, 0U, 4U, 1U, point_mul_g(out + l * 20U, scalars + l * 32U););
+    return;
+  }
+  uint64_t bscalar[16U] = { 0U };
+  KRML_MAYBE_FOR16(i,
+    0U,
+    16U,
+    1U,
+    uint64_t *os = bscalar;
+    uint8_t *bj = scalars + i * 8U;
+    uint64_t u = load64_le(bj);
+    uint64_t r = u;
+    uint64_t x = r;
+    os[i] = x;);
+  KRML_MAYBE_FOR4(l, 0U, 4U, 1U, Hacl_Impl_Ed25519_PointConstants_make_point_inf(out + l * 20U););
+  uint64_t tmp[80U] = { 0U };
+  const uint64_t
+  *tables[4U] =
+    {
+      Hacl_Ed25519_PrecompTable_precomp_basepoint_table_w4,
+      Hacl_Ed25519_PrecompTable_precomp_g_pow2_64_table_w4,
+      Hacl_Ed25519_PrecompTable_precomp_g_pow2_128_table_w4,
+      Hacl_Ed25519_PrecompTable_precomp_g_pow2_192_table_w4
+    };
+  KRML_MAYBE_FOR16(i,
+    0U,
+    16U,
+    1U,
+    KRML_MAYBE_FOR4(i0,
+      0U,
+      4U,
+      1U,
+      KRML_MAYBE_FOR4(l,
+        0U,
+        4U,
+        1U,
+        Hacl_Impl_Ed25519_PointDouble_point_double(out + l * 20U, out + l * 20U);););
+    uint32_t k = 64U - 4U * i - 4U;
+    KRML_MAYBE_FOR4(j,
+      0U,
+      4U,
+      1U,
+      uint32_t w = 3U - j;
+      KRML_MAYBE_FOR4(l,
+        0U,
+        4U,
+        1U,
+        uint64_t bits_l = Hacl_Bignum_Lib_bn_get_bits_u64(1U, bscalar + l * 4U + w, k, 4U);
+        precomp_get_consttime(tables[w], bits_l, tmp + l * 20U););
+      KRML_MAYBE_FOR4(l,
+        0U,
+        4U,
+        1U,
+        Hacl_Impl_Ed25519_PointAdd_point_add(out + l * 20U, out + l * 20U, tmp + l * 20U););););
+}
+
+/* SNIPPET_END: point_mul_g4 */
+
+/* SNIPPET_START: point_compress4 */
+
+/* Compresses four points with a single field inversion (Montgomery's trick): the inverse
+   of Z0 Z1 Z2 Z3 yields each 1 / Zl with three multiplications. */
+static void point_compress4(uint8_t **out, uint64_t *p)
+{
+  uint64_t acc[20U] = { 0U };
+  uint64_t inv[5U] = { 0U };
+  uint64_t zinv[5U] = { 0U };
+  uint64_t tmp[10U] = { 0U };
+  uint64_t *x = tmp;
+  uint64_t *y = tmp + 5U;
+  memcpy(acc, p + 10U, 5U * sizeof (uint64_t));
+  KRML_MAYBE_FOR3(l,
+    1U,
+    4U,
+    1U,
+    fmul0(acc + l * 5U, acc + (l - 1U) * 5U, p + l * 20U + 10U););
+  Hacl_Bignum25519_inverse(inv, acc + 15U);
+  for (uint32_t l0 = 0U; l0 < 4U; l0++)
+  {
+    uint32_t l = 3U - l0;
+    uint64_t *pl = p + l * 20U;
+    if (l == 0U)
+    {
+      memcpy(zinv, inv, 5U * sizeof (uint64_t));
+    }
+    else
+    {
+      fmul0(zinv, inv, acc + (l - 1U) * 5U);
+      fmul0(inv, inv, pl + 10U);
+    }
+    fmul0(x, pl, zinv);
+    reduce(x);
+    fmul0(y, pl + 5U, zinv);
+    Hacl_Bignum25519_reduce_513(y);
+    uint8_t *z = out[l];
+    Hacl_Bignum25519_store_51(z, y);
+    z[31U] = (uint32_t)z[31U] + ((uint32_t)(uint8_t)(x[0U] & 1ULL) << 7U);
+  }
+}
+
+/* SNIPPET_END: point_compress4 */
+
+/* SNIPPET_START: sha512_modq4 */
+
+/* SHA-512 of four inputs of the same length, reduced modulo the group order. With
+   `sha512_lanes` = 4 the inputs are hashed together by the four-way AVX2 code; otherwise
+   they are hashed one after the other. */
+static void sha512_modq4(uint32_t sha512_lanes, uint64_t *out, uint32_t len, uint8_t **input)
+{
+  uint8_t hash[256U] = { 0U };
+  bool done = false;
+  KRML_MAYBE_UNUSED_VAR(sha512_lanes);
+  #if HACL_CAN_COMPILE_VEC256
+  if (sha512_lanes == 4U)
+  {
+    Hacl_SHA2_Vec256_sha512_4(hash,
+      hash + 64U,
+      hash + 128U,
+      hash + 192U,
+      len,
+      input[0U],
+      input[1U],
+      input[2U],
+      input[3U]);
+    done = true;
+  }
+  #endif
+  if (!done)
+  {
+    KRML_MAYBE_FOR4(l, 0U, 4U, 1U, Hacl_Hash_SHA2_hash_512(hash + l * 64U, input[l], len););
+  }
+  KRML_MAYBE_FOR4(l,
+    0U,
+    4U,
+    1U,
+    uint64_t tmp[10U] = { 0U };
+    load_64_bytes(tmp, hash + l * 64U);
+    barrett_reduction(out + l * 5U, tmp););
+}
+
+/* SNIPPET_END: sha512_modq4 */
+
+/* SNIPPET_START: sign4_same_len */
+
+/* Signs four messages of the same length, laid out in `buf` as four slots of
+   64 + msg_len bytes, each holding its message at offset 64. */
+static void
+sign4_same_len(
+  uint32_t sha512_lanes,
+  uint8_t **signatures,
+  uint8_t *expanded_keys,
+  uint32_t msg_len,
+  uint8_t *buf
+)
+{
+  uint8_t *public_key = expanded_keys;
+  uint8_t *s = expanded_keys + 32U;
+  uint8_t *prefix = expanded_keys + 64U;
+  uint32_t slot = 64U + msg_len;
+  uint8_t *input[4U] = { 0U };
+  uint64_t rq[20U] = { 0U };
+  uint64_t hq[20U] = { 0U };
+  uint8_t rb[128U] = { 0U };
+  uint64_t r[80U] = { 0U };
+  /* r = SHA-512(prefix || msg) */
+  KRML_MAYBE_FOR4(l,
+    0U,
+    4U,
+    1U,
+    memcpy(buf + l * slot + 32U, prefix, 32U * sizeof (uint8_t));
+    input[l] = buf + l * slot + 32U;);
+  sha512_modq4(sha512_lanes, rq, 32U + msg_len, input);
+  KRML_MAYBE_FOR4(l, 0U, 4U, 1U, store_56(rb + l * 32U, rq + l * 5U););
+  point_mul_g4(r, rb);
+  point_compress4(signatures, r);
+  /* h = SHA-512(R || A || msg) */
+  KRML_MAYBE_FOR4(l,
+    0U,
+    4U,
+    1U,
+    memcpy(buf + l * slot, signatures[l], 32U * sizeof (uint8_t));
+    memcpy(buf + l * slot + 32U, public_key, 32U * sizeof (uint8_t));
+    input[l] = buf + l * slot;);
+  sha512_modq4(sha512_lanes, hq, 64U + msg_len, input);
+  uint64_t aq[5U] = { 0U };
+  load_32_bytes(aq, s);
+  KRML_MAYBE_FOR4(l,
+    0U,
+    4U,
+    1U,
+    uint64_t sq[5U] = { 0U };
+    mul_modq(sq, hq + l * 5U, aq);
+    add_modq(sq, rq + l * 5U, sq);
+    store_56(signatures[l] + 32U, sq););
+}
+
+/* SNIPPET_END: sign4_same_len */
+
+/* SNIPPET_START: sign4 */
+
+/* Signs four messages of any lengths: the hashes are computed one at a time, and the
+   scalar multiplications and compressions are shared. */
+static void
+sign4(uint8_t **signatures, uint8_t *expanded_keys, uint8_t **msgs, uint32_t *msg_lens)
+{
+  uint8_t *public_key = expanded_keys;
+  uint8_t *s = expanded_keys + 32U;
+  uint8_t *prefix = expanded_keys + 64U;
+  uint64_t rq[20U] = { 0U };
+  uint8_t rb[128U] = { 0U };
+  uint64_t r[80U] = { 0U };
+  KRML_MAYBE_FOR4(l,
+    0U,
+    4U,
+    1U,
+    sha512_modq_pre(rq + l * 5U, prefix, msg_lens[l], msgs[l]);
+    store_56(rb + l * 32U, rq + l * 5U););
+  point_mul_g4(r, rb);
+  point_compress4(signatures, r);
+  uint64_t aq[5U] = { 0U };
+  load_32_bytes(aq, s);
+  KRML_MAYBE_FOR4(l,
+    0U,
+    4U,
+    1U,
+    uint64_t hq[5U] = { 0U };
+    sha512_modq_pre_pre2(hq, signatures[l], public_key, msg_lens[l], msgs[l]);
+    mul_modq(hq, hq, aq);
+    add_modq(hq, rq + l * 5U, hq);
+    store_56(signatures[l] + 32U, hq););
+}
+
+/* SNIPPET_END: sign4 */
+
+/* SNIPPET_START: Hacl_Ed25519_sign_batch */
+
+/**
+Create Ed25519 signatures of many messages under the same (precomputed) expanded keys.
+
+  @param[in] expanded_keys Points to 96 bytes of valid memory, i.e., `uint8_t[96]`, containing the expanded keys obtained by invoking `expand_keys`.
+  @param[in] n Number of messages.
+  @param[in] msgs Points to `n` pointers, each to a message of `msg_lens[i]` bytes.
+  @param[in] msg_lens Points to `n` message lengths.
+  @param[out] signatures Points to `n` pointers, each to 64 bytes of valid memory. Must not overlap the memory locations of `expanded_keys` nor any message.
+
+Every signature is byte-for-byte the one `Hacl_Ed25519_sign_expanded` produces. The
+messages are signed four at a time: the four fixed-base scalar multiplications are
+interleaved and share one field inversion. The hashes are computed one message at a time;
+see `Hacl_Ed25519_sign_batch_lanes`, or `EverCrypt_Ed25519_sign_batch`, to hash four
+messages at once.
+*/
+void
+Hacl_Ed25519_sign_batch(
+  uint8_t *expanded_keys,
+  uint32_t n,
+  uint8_t **msgs,
+  uint32_t *msg_lens,
+  uint8_t **signatures
+)
+{
+  Hacl_Ed25519_sign_batch_lanes(1U, expanded_keys, n, msgs, msg_lens, signatures);
+}
+
+/* SNIPPET_END: Hacl_Ed25519_sign_batch */
+
+/* SNIPPET_START: Hacl_Ed25519_sign_batch_lanes */
+
+/**
+Same as `Hacl_Ed25519_sign_batch`, with a choice of SHA-512 implementation.
+
+  @param[in] sha512_lanes Number of messages hashed at once: 4 selects the four-way AVX2
+  SHA-512, which the caller must only request on CPUs that support AVX2; any other value
+  selects the one-at-a-time SHA-512.
+
+With four lanes, when four consecutive messages have the same length, their nonce and
+challenge hashes are computed together.
+*/
+void
+Hacl_Ed25519_sign_batch_lanes(
+  uint32_t sha512_lanes,
+  uint8_t *expanded_keys,
+  uint32_t n,
+  uint8_t **msgs,
+  uint32_t *msg_lens,
+  uint8_t **signatures
+)
+{
+  uint32_t i = 0U;
+  for (; n - i >= 4U; i = i + 4U)
+  {
+    uint32_t len = msg_lens[i];
+    bool
+    same_len = msg_lens[i + 1U] == len && msg_lens[i + 2U] == len && msg_lens[i + 3U] == len;
+    uint8_t *buf = NULL;
+    if (sha512_lanes == 4U && same_len && len <= 0x3fffff00U - 64U)
+    {
+      buf = (uint8_t *)KRML_HOST_MALLOC(4U * (64U + len) * sizeof (uint8_t));
+    }
+    if (buf == NULL)
+    {
+      sign4(signatures + i, expanded_keys, msgs + i, msg_lens + i);
+    }
+    else
+    {
+      KRML_MAYBE_FOR4(l,
+        0U,
+        4U,
+        1U,
+        memcpy(buf + l * (64U + len) + 64U, msgs[i + l], len * sizeof (uint8_t)););
+      sign4_same_len(sha512_lanes, signatures + i, expanded_keys, len, buf);
+      KRML_HOST_FREE(buf);
+    }
+  }
+  for (; i < n; i++)
+  {
+    Hacl_Ed25519_sign_expanded(signatures[i], expanded_keys, msg_lens[i], msgs[i]);
+  }
+}
+
+/* SNIPPET_END: Hacl_Ed25519_sign_batch_lanes */
+
+/* SNIPPET_START: Hacl_Ed25519_precomp_tables_init */
+
+/**
+Build larger fixed-base tables for signing and public key computation, replacing the
+built-in 4-table comb with 4-bit digits.
+
+  @param teeth Number of tables; a power of two between 1 and 256.
+  @param window_bits Digit width; 1, 2, 4 or 8, and at most 256 / `teeth`.
+
+  @return Returns `false` if the tables were already built by an earlier call, the
+  parameters are out of range or memory cannot be allocated.
+
+  The tables take `teeth` * 2^`window_bits` * 160 bytes. A fixed-base scalar
+  multiplication then does 256 / `teeth` - `window_bits` doublings and 256 / `window_bits`
+  additions, each after a constant-time scan of 2^`window_bits` table entries. The built-in
+  comb corresponds to (4, 4); (32, 4) and (64, 4) leave almost only the additions and keep
+  the scans short.
+
+  The tables are global and are never freed, so only the first successful call takes
+  effect. Call this function before other threads use this module.
+*/
+bool Hacl_Ed25519_precomp_tables_init(uint32_t teeth, uint32_t window_bits)
+{
+  if
+  (
+    comb_table != NULL
+    || teeth == 0U
+    || teeth > 256U
+    || (teeth & (teeth - 1U)) != 0U
+    || !(window_bits == 1U || window_bits == 2U || window_bits == 4U || window_bits == 8U)
+    || window_bits > 256U / teeth
+  )
+  {
+    return false;
+  }
+  uint32_t len = 1U << window_bits;
+  uint32_t chunk = 256U / teeth;
+  uint64_t *table = (uint64_t *)KRML_HOST_CALLOC(teeth * len * 20U, sizeof (uint64_t));
+  if (table == NULL)
+  {
+    return false;
+  }
+  uint64_t base[20U] = { 0U };
+  memcpy(base, Hacl_Ed25519_PrecompTable_precomp_basepoint_table_w4 + 20U, 20U * sizeof (uint64_t));
+  for (uint32_t j = 0U; j < teeth; j++)
+  {
+    uint64_t *t = table + j * len * 20U;
+    Hacl_Impl_Ed25519_PointConstants_make_point_inf(t);
+    memcpy(t + 20U, base, 20U * sizeof (uint64_t));
+    for (uint32_t d = 2U; d < len; d++)
+    {
+      Hacl_Impl_Ed25519_PointAdd_point_add(t + d * 20U, t + (d - 1U) * 20U, base);
+    }
+    for (uint32_t i = 0U; i < chunk; i++)
+    {
+      Hacl_Impl_Ed25519_PointDouble_point_double(base, base);
+    }
+  }
+  comb_teeth = teeth;
+  comb_window = window_bits;
+  comb_table = table;
+  return true;
+}
+
+/* SNIPPET_END: Hacl_Ed25519_precomp_tables_init */
+
@@ -39,6 +39,32 @@ extern "C" {
 #include "Hacl_Krmllib.h"
 #include "Hacl_Hash_SHA2.h"
 
+/* SNIPPET_START: Hacl_Ed25519_pk_ctx */
+
+typedef struct Hacl_Ed25519_pk_ctx_s
+{
+  uint8_t public_key[32U];
+  bool valid;
+  uint64_t table[1280U];
+}
+Hacl_Ed25519_pk_ctx;
+
+/* SNIPPET_END: Hacl_Ed25519_pk_ctx */
+
+/* SNIPPET_START: Hacl_Ed25519_pk_cache */
+
+typedef struct Hacl_Ed25519_pk_cache_s
+{
+  uint32_t capacity;
+  uint32_t len;
+  uint64_t clock;
+  uint64_t *last_used;
+  Hacl_Ed25519_pk_ctx *entries;
+}
+Hacl_Ed25519_pk_cache;
+
+/* SNIPPET_END: Hacl_Ed25519_pk_cache */
+
 /* SNIPPET_START: Hacl_Ed25519_secret_to_public */
 
 /********************************************************************************
@@ -56,6 +82,24 @@ void Hacl_Ed25519_secret_to_public(uint8_t *public_key, uint8_t *private_key);
 
 /* SNIPPET_END: Hacl_Ed25519_secret_to_public */
 
+/* SNIPPET_START: Hacl_Ed25519_x25519_secret_to_public */
+
+/**
+Compute the X25519 public key from the X25519 private key.
+
+  This gives the same result as `Hacl_Curve25519_51_secret_to_public`, but runs the
+  constant-time fixed-base comb of `Hacl_Ed25519_secret_to_public` on the birationally
+  equivalent edwards25519 curve and maps the result to u = (Z + Y) / (Z - Y), instead of
+  a Montgomery ladder from u = 9. It is hand-written rather than extracted from the
+  verified code.
+
+  @param[out] pub Points to 32 bytes of valid memory, i.e., `uint8_t[32]`.
+  @param[in] priv Points to 32 bytes of valid memory containing the private key, i.e., `uint8_t[32]`. It is clamped as in RFC 7748.
+*/
+void Hacl_Ed25519_x25519_secret_to_public(uint8_t *pub, uint8_t *priv);
+
+/* SNIPPET_END: Hacl_Ed25519_x25519_secret_to_public */
+
 /* SNIPPET_START: Hacl_Ed25519_expand_keys */
 
 /**
@@ -131,6 +175,387 @@ Hacl_Ed25519_verify(uint8_t *public_key, uint32_t msg_len, uint8_t *msg, uint8_t
 
 /* SNIPPET_END: Hacl_Ed25519_verify */
 
+/* SNIPPET_START: Hacl_Ed25519_verify_vartime */
+
+/**
+Verify an Ed25519 signature, accepting exactly the signatures that
+`Hacl_Ed25519_verify` accepts.
+
+  This function is hand-written rather than extracted from the verified code. It
+  rejects an `S` that is not below the group order, or an `R` or public key that is not a
+  canonical point encoding, before any field arithmetic, decompresses `R` before the
+  public key with a single exponentiation each, and computes the double scalar
+  multiplication with a wNAF chain. On this path a random 64-byte string is rejected
+  about five times faster, and a valid signature is accepted about a quarter faster.
+
+  @param public_key Points to 32 bytes of valid memory containing the public key, i.e., `uint8_t[32]`.
+  @param msg_len Length of `msg`.
+  @param msg Points to `msg_len` bytes of valid memory containing the message, i.e., `uint8_t[msg_len]`.
+  @param signature Points to 64 bytes of valid memory containing the signature, i.e., `uint8_t[64]`.
+
+  @return Returns `true` if the signature is valid and `false` otherwise.
+*/
+bool
+Hacl_Ed25519_verify_vartime(
+  uint8_t *public_key,
+  uint32_t msg_len,
+  uint8_t *msg,
+  uint8_t *signature
+);
+
+/* SNIPPET_END: Hacl_Ed25519_verify_vartime */
+
+/* SNIPPET_START: Hacl_Ed25519_verify_cofactored */
+
+/**
+Verify an Ed25519 signature with the cofactored equation [8][S]B = [8]R + [8][h]A.
+
+  This accepts every signature that `Hacl_Ed25519_verify` accepts, and also those whose
+  `R` or public key has a small-order component. It gives the same result as
+  `Hacl_Ed25519_verify_batch` on every input, so a caller that mixes single and batch
+  verification, e.g. to validate blocks, should use this function for single signatures.
+
+  @param public_key Points to 32 bytes of valid memory containing the public key, i.e., `uint8_t[32]`.
+  @param msg_len Length of `msg`.
+  @param msg Points to `msg_len` bytes of valid memory containing the message, i.e., `uint8_t[msg_len]`.
+  @param signature Points to 64 bytes of valid memory containing the signature, i.e., `uint8_t[64]`.
+
+  @return Returns `true` if the signature is valid and `false` otherwise.
+*/
+bool
+Hacl_Ed25519_verify_cofactored(
+  uint8_t *public_key,
+  uint32_t msg_len,
+  uint8_t *msg,
+  uint8_t *signature
+);
+
+/* SNIPPET_END: Hacl_Ed25519_verify_cofactored */
+
+/* SNIPPET_START: Hacl_Ed25519_verify_batch */
+
+/**
+Verify a batch of Ed25519 signatures.
+
+  @param n Number of signatures.
+  @param public_keys Points to `n` pointers, each to a 32-byte public key.
+  @param msgs Points to `n` pointers, each to a message of `msg_lens[i]` bytes.
+  @param msg_lens Points to `n` message lengths.
+  @param signatures Points to `n` pointers, each to a 64-byte signature.
+  @param results Points to `n` booleans that receive the result for each signature.
+
+  @return Returns `true` if every signature is valid and `false` otherwise.
+
+  The signatures are checked together, in chunks of up to 2048, with a random linear
+  combination evaluated by a single multi-scalar multiplication. The 128-bit randomizers
+  are derived with SHA-512 from the whole chunk, so the result is deterministic and no
+  random number generator is needed.
+
+  Verification is cofactored: every entry, whatever the size of the batch and whether
+  or not other entries are invalid, gets the result of `Hacl_Ed25519_verify_cofactored`.
+  Unlike `Hacl_Ed25519_verify`, this accepts signatures whose `R` or public key has a
+  small-order component. Chunks of fewer than 8 signatures, and chunks whose combined
+  equation does not hold, are checked entry by entry with
+  `Hacl_Ed25519_verify_cofactored`, which identifies the invalid ones.
+*/
+bool
+Hacl_Ed25519_verify_batch(
+  uint32_t n,
+  uint8_t **public_keys,
+  uint8_t **msgs,
+  uint32_t *msg_lens,
+  uint8_t **signatures,
+  bool *results
+);
+
+/* SNIPPET_END: Hacl_Ed25519_verify_batch */
+
+/* SNIPPET_START: Hacl_Ed25519_pk_ctx_init */
+
+/**
+Prepare a context for verifying signatures under one public key.
+
+  @param[out] ctx The context to initialize.
+  @param[in] public_key Points to 32 bytes of valid memory containing the public key, i.e., `uint8_t[32]`.
+
+  @return Returns `false` if the public key is not a valid point, in which case no
+  signature can be valid under it, and `true` otherwise.
+
+  The context holds the decompressed key and about 10 KiB of precomputed multiples of
+  it, so that `Hacl_Ed25519_verify_with_ctx` spends about a quarter of the point
+  doublings of `Hacl_Ed25519_verify`.
+*/
+bool Hacl_Ed25519_pk_ctx_init(Hacl_Ed25519_pk_ctx *ctx, uint8_t *public_key);
+
+/* SNIPPET_END: Hacl_Ed25519_pk_ctx_init */
+
+/* SNIPPET_START: Hacl_Ed25519_verify_with_ctx */
+
+/**
+Verify an Ed25519 signature under the public key of a context.
+
+  @param[in] ctx A context initialized by `Hacl_Ed25519_pk_ctx_init`.
+  @param msg_len Length of `msg`.
+  @param msg Points to `msg_len` bytes of valid memory containing the message, i.e., `uint8_t[msg_len]`.
+  @param signature Points to 64 bytes of valid memory containing the signature, i.e., `uint8_t[64]`.
+
+  @return Returns `true` if the signature is valid and `false` otherwise, exactly as
+  `Hacl_Ed25519_verify` on the public key of the context.
+*/
+bool
+Hacl_Ed25519_verify_with_ctx(
+  Hacl_Ed25519_pk_ctx *ctx,
+  uint32_t msg_len,
+  uint8_t *msg,
+  uint8_t *signature
+);
+
+/* SNIPPET_END: Hacl_Ed25519_verify_with_ctx */
+
+/* SNIPPET_START: Hacl_Ed25519_pk_cache_malloc */
+
+/**
+Allocate a cache of verification contexts for up to `capacity` public keys, evicting
+the least recently used key when full. Returns `NULL` if `capacity` is zero or if
+allocation fails.
+
+The cache is not synchronized; threads must not share one without a lock.
+*/
+Hacl_Ed25519_pk_cache *Hacl_Ed25519_pk_cache_malloc(uint32_t capacity);
+
+/* SNIPPET_END: Hacl_Ed25519_pk_cache_malloc */
+
+/* SNIPPET_START: Hacl_Ed25519_pk_cache_free */
+
+void Hacl_Ed25519_pk_cache_free(Hacl_Ed25519_pk_cache *c);
+
+/* SNIPPET_END: Hacl_Ed25519_pk_cache_free */
+
+/* SNIPPET_START: Hacl_Ed25519_verify_cached */
+
+/**
+Verify an Ed25519 signature, reusing the context of `public_key` from the cache or
+adding one for it. Returns the same result as `Hacl_Ed25519_verify`.
+*/
+bool
+Hacl_Ed25519_verify_cached(
+  Hacl_Ed25519_pk_cache *c,
+  uint8_t *public_key,
+  uint32_t msg_len,
+  uint8_t *msg,
+  uint8_t *signature
+);
+
+/* SNIPPET_END: Hacl_Ed25519_verify_cached */
+
+/* SNIPPET_START: Hacl_Ed25519_sign_ctx */
+
+/**
+Create an Ed25519ctx signature (RFC 8032, Section 5.1).
+
+  @param[out] signature Points to 64 bytes of valid memory, i.e., `uint8_t[64]`.
+  @param[in] private_key Points to 32 bytes of valid memory containing the private key, i.e., `uint8_t[32]`.
+  @param ctx_len Length of `ctx`, between 1 and 255.
+  @param[in] ctx Points to `ctx_len` bytes of valid memory containing the context.
+  @param msg_len Length of `msg`.
+  @param[in] msg Points to `msg_len` bytes of valid memory containing the message, i.e., `uint8_t[msg_len]`.
+
+  @return Returns `false`, without writing `signature`, if `ctx_len` is out of range.
+*/
+bool
+Hacl_Ed25519_sign_ctx(
+  uint8_t *signature,
+  uint8_t *private_key,
+  uint32_t ctx_len,
+  uint8_t *ctx,
+  uint32_t msg_len,
+  uint8_t *msg
+);
+
+/* SNIPPET_END: Hacl_Ed25519_sign_ctx */
+
+/* SNIPPET_START: Hacl_Ed25519_verify_ctx */
+
+/**
+Verify an Ed25519ctx signature (RFC 8032, Section 5.1).
+
+  @return Returns `true` if the signature is valid for `ctx` and `false` otherwise,
+  including when `ctx_len` is not between 1 and 255.
+*/
+bool
+Hacl_Ed25519_verify_ctx(
+  uint8_t *public_key,
+  uint32_t ctx_len,
+  uint8_t *ctx,
+  uint32_t msg_len,
+  uint8_t *msg,
+  uint8_t *signature
+);
+
+/* SNIPPET_END: Hacl_Ed25519_verify_ctx */
+
+/* SNIPPET_START: Hacl_Ed25519_sign_ph */
+
+/**
+Create an Ed25519ph signature (RFC 8032, Section 5.1) from the SHA-512 digest of the
+message.
+
+  @param[out] signature Points to 64 bytes of valid memory, i.e., `uint8_t[64]`.
+  @param[in] private_key Points to 32 bytes of valid memory containing the private key, i.e., `uint8_t[32]`.
+  @param ctx_len Length of `ctx`, at most 255.
+  @param[in] ctx Points to `ctx_len` bytes of valid memory containing the context.
+  @param[in] msg_hash Points to the 64-byte SHA-512 digest of the message.
+
+  @return Returns `false`, without writing `signature`, if `ctx_len` is out of range.
+*/
+bool
+Hacl_Ed25519_sign_ph(
+  uint8_t *signature,
+  uint8_t *private_key,
+  uint32_t ctx_len,
+  uint8_t *ctx,
+  uint8_t *msg_hash
+);
+
+/* SNIPPET_END: Hacl_Ed25519_sign_ph */
+
+/* SNIPPET_START: Hacl_Ed25519_verify_ph */
+
+/**
+Verify an Ed25519ph signature (RFC 8032, Section 5.1) given the SHA-512 digest of the
+message.
+
+  @return Returns `true` if the signature is valid and `false` otherwise, including
+  when `ctx_len` is larger than 255.
+*/
+bool
+Hacl_Ed25519_verify_ph(
+  uint8_t *public_key,
+  uint32_t ctx_len,
+  uint8_t *ctx,
+  uint8_t *msg_hash,
+  uint8_t *signature
+);
+
+/* SNIPPET_END: Hacl_Ed25519_verify_ph */
+
+/* SNIPPET_START: Hacl_Ed25519_sign_ph_finish */
+
+/**
+Create an Ed25519ph signature of everything fed into a SHA-512 streaming state.
+
+  @param[in] state A state obtained from `Hacl_Hash_SHA2_malloc_512` and fed with the
+  message through `Hacl_Hash_SHA2_update_512`. It is left unchanged, so more data may
+  still be fed into it.
+
+The message is read once, in whatever pieces it arrives, and never needs to be held in
+memory as a whole.
+*/
+bool
+Hacl_Ed25519_sign_ph_finish(
+  uint8_t *signature,
+  uint8_t *private_key,
+  uint32_t ctx_len,
+  uint8_t *ctx,
+  Hacl_Streaming_MD_state_64 *state
+);
+
+/* SNIPPET_END: Hacl_Ed25519_sign_ph_finish */
+
+/* SNIPPET_START: Hacl_Ed25519_verify_ph_finish */
+
+/**
+Verify an Ed25519ph signature of everything fed into a SHA-512 streaming state; see
+`Hacl_Ed25519_sign_ph_finish`.
+*/
+bool
+Hacl_Ed25519_verify_ph_finish(
+  uint8_t *public_key,
+  uint32_t ctx_len,
+  uint8_t *ctx,
+  Hacl_Streaming_MD_state_64 *state,
+  uint8_t *signature
+);
+
+/* SNIPPET_END: Hacl_Ed25519_verify_ph_finish */
+
+/* SNIPPET_START: Hacl_Ed25519_sign_batch */
+
+/**
+Create Ed25519 signatures of many messages under the same (precomputed) expanded keys.
+
+  @param[in] expanded_keys Points to 96 bytes of valid memory, i.e., `uint8_t[96]`, containing the expanded keys obtained by invoking `expand_keys`.
+  @param[in] n Number of messages.
+  @param[in] msgs Points to `n` pointers, each to a message of `msg_lens[i]` bytes.
+  @param[in] msg_lens Points to `n` message lengths.
+  @param[out] signatures Points to `n` pointers, each to 64 bytes of valid memory. Must not overlap the memory locations of `expanded_keys` nor any message.
+
+Every signature is byte-for-byte the one `Hacl_Ed25519_sign_expanded` produces. The
+messages are signed four at a time: the four fixed-base scalar multiplications are
+interleaved and share one field inversion. The hashes are computed one message at a time;
+see `Hacl_Ed25519_sign_batch_lanes`, or `EverCrypt_Ed25519_sign_batch`, to hash four
+messages at once.
+*/
+void
+Hacl_Ed25519_sign_batch(
+  uint8_t *expanded_keys,
+  uint32_t n,
+  uint8_t **msgs,
+  uint32_t *msg_lens,
+  uint8_t **signatures
+);
+
+/* SNIPPET_END: Hacl_Ed25519_sign_batch */
+
+/* SNIPPET_START: Hacl_Ed25519_sign_batch_lanes */
+
+/**
+Same as `Hacl_Ed25519_sign_batch`, with a choice of SHA-512 implementation.
+
+  @param[in] sha512_lanes Number of messages hashed at once: 4 selects the four-way AVX2
+  SHA-512, which the caller must only request on CPUs that support AVX2; any other value
+  selects the one-at-a-time SHA-512.
+
+With four lanes, when four consecutive messages have the same length, their nonce and
+challenge hashes are computed together.
+*/
+void
+Hacl_Ed25519_sign_batch_lanes(
+  uint32_t sha512_lanes,
+  uint8_t *expanded_keys,
+  uint32_t n,
+  uint8_t **msgs,
+  uint32_t *msg_lens,
+  uint8_t **signatures
+);
+
+/* SNIPPET_END: Hacl_Ed25519_sign_batch_lanes */
+
+/* SNIPPET_START: Hacl_Ed25519_precomp_tables_init */
+
+/**
+Build larger fixed-base tables for signing and public key computation, replacing the
+built-in 4-table comb with 4-bit digits.
+
+  @param teeth Number of tables; a power of two between 1 and 256.
+  @param window_bits Digit width; 1, 2, 4 or 8, and at most 256 / `teeth`.
+
+  @return Returns `false` if the tables were already built by an earlier call, the
+  parameters are out of range or memory cannot be allocated.
+
+  The tables take `teeth` * 2^`window_bits` * 160 bytes. A fixed-base scalar
+  multiplication then does 256 / `teeth` - `window_bits` doublings and 256 / `window_bits`
+  additions, each after a constant-time scan of 2^`window_bits` table entries. The built-in
+  comb corresponds to (4, 4); (32, 4) and (64, 4) leave almost only the additions and keep
+  the scans short.
+
+  The tables are global and are never freed, so only the first successful call takes
+  effect. Call this function before other threads use this module.
+*/
+bool Hacl_Ed25519_precomp_tables_init(uint32_t teeth, uint32_t window_bits);
+
+/* SNIPPET_END: Hacl_Ed25519_precomp_tables_init */
+
 #if defined(__cplusplus)
 }
 #endif
@@ -0,0 +1,136 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_HMAC_DRBG_Vec256_H
+#define __Hacl_HMAC_DRBG_Vec256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "Hacl_SHA2_Vec256.h"
+#include "Hacl_HMAC_DRBG.h"
+
+/* SNIPPET_START: Hacl_HMAC_DRBG_Vec256_instantiate_sha2_256_8 */
+
+/**
+Instantiate up to 8 independent SHA2-256 HMAC-DRBGs in lockstep.
+
+Every array argument holds `lanes` entries; all lanes must use the same lengths. The states
+must have been created with `Hacl_HMAC_DRBG_create_in(Spec_Hash_Definitions_SHA2_256)`. Lane
+`i` ends up in the same state as `Hacl_HMAC_DRBG_instantiate` would produce on the inputs of
+lane `i`. Fewer than 8 lanes cost the same as 8: the missing lanes are computed on internal
+scratch states and thrown away. This function must only be called on CPUs supporting AVX2.
+
+@param lanes Number of DRBGs, between 1 and 8.
+@param st Array of `lanes` DRBG states.
+@param entropy_input_len Length of entropy input.
+@param entropy_input Array of `lanes` pointers to `entropy_input_len` bytes of entropy input.
+@param nonce_len Length of nonce.
+@param nonce Array of `lanes` pointers to `nonce_len` bytes of nonce.
+@param personalization_string_len Length of personalization string.
+@param personalization_string Array of `lanes` pointers to `personalization_string_len` bytes
+  of personalization string. May be `NULL` when `personalization_string_len` is 0.
+
+@return False, leaving every state untouched, if `lanes` is 0 or greater than 8, or if memory
+  cannot be allocated.
+*/
+bool
+Hacl_HMAC_DRBG_Vec256_instantiate_sha2_256_8(
+  uint32_t lanes,
+  Hacl_HMAC_DRBG_state *st,
+  uint32_t entropy_input_len,
+  uint8_t **entropy_input,
+  uint32_t nonce_len,
+  uint8_t **nonce,
+  uint32_t personalization_string_len,
+  uint8_t **personalization_string
+);
+
+/* SNIPPET_END: Hacl_HMAC_DRBG_Vec256_instantiate_sha2_256_8 */
+
+/* SNIPPET_START: Hacl_HMAC_DRBG_Vec256_reseed_sha2_256_8 */
+
+/**
+Reseed up to 8 independent SHA2-256 HMAC-DRBGs in lockstep. See
+`Hacl_HMAC_DRBG_Vec256_instantiate_sha2_256_8` for the lane conventions.
+
+@return False, leaving every state untouched, if `lanes` is 0 or greater than 8, or if memory
+  cannot be allocated.
+*/
+bool
+Hacl_HMAC_DRBG_Vec256_reseed_sha2_256_8(
+  uint32_t lanes,
+  Hacl_HMAC_DRBG_state *st,
+  uint32_t entropy_input_len,
+  uint8_t **entropy_input,
+  uint32_t additional_input_len,
+  uint8_t **additional_input
+);
+
+/* SNIPPET_END: Hacl_HMAC_DRBG_Vec256_reseed_sha2_256_8 */
+
+/* SNIPPET_START: Hacl_HMAC_DRBG_Vec256_generate_sha2_256_8 */
+
+/**
+Generate `n` bytes from each of up to 8 independent SHA2-256 HMAC-DRBGs in lockstep. Lane
+`i` produces exactly the output of `Hacl_HMAC_DRBG_generate` on state `i`. See
+`Hacl_HMAC_DRBG_Vec256_instantiate_sha2_256_8` for the lane conventions.
+
+@param lanes Number of DRBGs, between 1 and 8.
+@param output Array of `lanes` pointers to `n` bytes of memory where random output is written
+  to.
+@param st Array of `lanes` DRBG states.
+@param n Length of desired output, per lane.
+@param additional_input_len Length of additional input.
+@param additional_input Array of `lanes` pointers to `additional_input_len` bytes of
+  additional input. May be `NULL` when `additional_input_len` is 0.
+
+@return False, leaving every state untouched, if `lanes` is 0 or greater than 8, if any lane
+  needs to be reseeded, or if memory cannot be allocated.
+*/
+bool
+Hacl_HMAC_DRBG_Vec256_generate_sha2_256_8(
+  uint32_t lanes,
+  uint8_t **output,
+  Hacl_HMAC_DRBG_state *st,
+  uint32_t n,
+  uint32_t additional_input_len,
+  uint8_t **additional_input
+);
+
+/* SNIPPET_END: Hacl_HMAC_DRBG_Vec256_generate_sha2_256_8 */
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_HMAC_DRBG_Vec256_H_DEFINED
+#endif
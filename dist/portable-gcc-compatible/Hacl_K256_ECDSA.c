@@ -1352,10 +1352,96 @@ static inline void precomp_get_consttime(const uint64_t *table, uint64_t bits_l,
 
 /* SNIPPET_END: precomp_get_consttime */
 
+/* SNIPPET_START: comb_table */
+
+/* Optional larger fixed-base tables, built once by `Hacl_K256_ECDSA_precomp_tables_init` and
+   never freed, so that a concurrent signer cannot see them go away. The
+   scalar is cut into `comb_teeth` chunks of 256 / comb_teeth bits; table j holds
+   d 2^(256 j / comb_teeth) G for every digit d of `comb_window` bits. */
+static uint64_t *comb_table = NULL;
+
+/* SNIPPET_END: comb_table */
+
+/* SNIPPET_START: comb_teeth */
+
+static uint32_t comb_teeth = 0U;
+
+/* SNIPPET_END: comb_teeth */
+
+/* SNIPPET_START: comb_window */
+
+static uint32_t comb_window = 0U;
+
+/* SNIPPET_END: comb_window */
+
+/* SNIPPET_START: precomp_get_consttime_n */
+
+static inline void
+precomp_get_consttime_n(const uint64_t *table, uint32_t len, uint64_t bits_l, uint64_t *tmp)
+{
+  memcpy(tmp, (uint64_t *)table, 15U * sizeof (uint64_t));
+  for (uint32_t i0 = 1U; i0 < len; i0++)
+  {
+    uint64_t c = FStar_UInt64_eq_mask(bits_l, (uint64_t)i0);
+    const uint64_t *res_j = table + i0 * 15U;
+    KRML_MAYBE_FOR15(i,
+      0U,
+      15U,
+      1U,
+      uint64_t *os = tmp;
+      uint64_t x = (c & res_j[i]) | (~c & tmp[i]);
+      os[i] = x;);
+  }
+}
+
+/* SNIPPET_END: precomp_get_consttime_n */
+
+/* SNIPPET_START: point_mul_g_comb */
+
+/* The same comb as `point_mul_g`, with the selected number of tables and digit width:
+   256 / comb_teeth - comb_window doublings and 256 / comb_window table additions. */
+static void point_mul_g_comb(uint64_t *out, uint64_t *bscalar)
+{
+  uint32_t len = 1U << comb_window;
+  uint32_t chunk = 256U / comb_teeth;
+  uint64_t tmp[15U] = { 0U };
+  for (uint32_t i = 0U; i < chunk / comb_window; i++)
+  {
+    if (i > 0U)
+    {
+      for (uint32_t i0 = 0U; i0 < comb_window; i0++)
+      {
+        Hacl_Impl_K256_PointDouble_point_double(out, out);
+      }
+    }
+    uint32_t k = chunk - comb_window * (i + 1U);
+    for (uint32_t j = 0U; j < comb_teeth; j++)
+    {
+      uint64_t bits_l = Hacl_Bignum_Lib_bn_get_bits_u64(4U, bscalar, j * chunk + k, comb_window);
+      precomp_get_consttime_n(comb_table + j * len * 15U, len, bits_l, tmp);
+      if (i == 0U && j == 0U)
+      {
+        memcpy(out, tmp, 15U * sizeof (uint64_t));
+      }
+      else
+      {
+        Hacl_Impl_K256_PointAdd_point_add(out, out, tmp);
+      }
+    }
+  }
+}
+
+/* SNIPPET_END: point_mul_g_comb */
+
 /* SNIPPET_START: point_mul_g */
 
 static inline void point_mul_g(uint64_t *out, uint64_t *scalar)
 {
+  if (comb_table != NULL)
+  {
+    point_mul_g_comb(out, scalar);
+    return;
+  }
   uint64_t q1[15U] = { 0U };
   uint64_t *gx = q1;
   uint64_t *gy = q1 + 5U;
@@ -2383,3 +2469,69 @@ bool Hacl_K256_ECDSA_ecdh(uint8_t *shared_secret, uint8_t *their_pubkey, uint8_t
 
 /* SNIPPET_END: Hacl_K256_ECDSA_ecdh */
 
+/* SNIPPET_START: Hacl_K256_ECDSA_precomp_tables_init */
+
+/**
+Build larger fixed-base tables for signing and key generation, replacing the built-in 4-table comb
+with 4-bit digits.
+
+  @param teeth Number of tables; a power of two between 1 and 256.
+  @param window_bits Digit width; 1, 2, 4 or 8, and at most 256 / `teeth`.
+
+  @return Returns `false` if the tables were already built by an earlier call, the
+  parameters are out of range or memory cannot be allocated.
+
+  The tables take `teeth` * 2^`window_bits` * 120 bytes. A fixed-base scalar
+  multiplication then does 256 / `teeth` - `window_bits` doublings and 256 / `window_bits`
+  additions, each after a constant-time scan of 2^`window_bits` table entries. The built-in
+  comb corresponds to (4, 4); (32, 4) and (64, 4) leave almost only the additions and keep
+  the scans short.
+
+  The tables are global and are never freed, so only the first successful call takes
+  effect. Call this function before other threads use this module.
+*/
+bool Hacl_K256_ECDSA_precomp_tables_init(uint32_t teeth, uint32_t window_bits)
+{
+  if
+  (
+    comb_table != NULL
+    || teeth == 0U
+    || teeth > 256U
+    || (teeth & (teeth - 1U)) != 0U
+    || !(window_bits == 1U || window_bits == 2U || window_bits == 4U || window_bits == 8U)
+    || window_bits > 256U / teeth
+  )
+  {
+    return false;
+  }
+  uint32_t len = 1U << window_bits;
+  uint32_t chunk = 256U / teeth;
+  uint64_t *table = (uint64_t *)KRML_HOST_CALLOC(teeth * len * 15U, sizeof (uint64_t));
+  if (table == NULL)
+  {
+    return false;
+  }
+  uint64_t base[15U] = { 0U };
+  memcpy(base, Hacl_K256_PrecompTable_precomp_basepoint_table_w4 + 15U, 15U * sizeof (uint64_t));
+  for (uint32_t j = 0U; j < teeth; j++)
+  {
+    uint64_t *t = table + j * len * 15U;
+    Hacl_Impl_K256_Point_make_point_at_inf(t);
+    memcpy(t + 15U, base, 15U * sizeof (uint64_t));
+    for (uint32_t d = 2U; d < len; d++)
+    {
+      Hacl_Impl_K256_PointAdd_point_add(t + d * 15U, t + (d - 1U) * 15U, base);
+    }
+    for (uint32_t i = 0U; i < chunk; i++)
+    {
+      Hacl_Impl_K256_PointDouble_point_double(base, base);
+    }
+  }
+  comb_teeth = teeth;
+  comb_window = window_bits;
+  comb_table = table;
+  return true;
+}
+
+/* SNIPPET_END: Hacl_K256_ECDSA_precomp_tables_init */
+
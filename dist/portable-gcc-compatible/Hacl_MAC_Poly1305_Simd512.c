@@ -0,0 +1,497 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "internal/Hacl_MAC_Poly1305_Simd512.h"
+
+/* SNIPPET_START: fmul_r */
+
+static inline void
+fmul_r(
+  Lib_IntVector_Intrinsics_vec512 *out,
+  Lib_IntVector_Intrinsics_vec512 *f1,
+  Lib_IntVector_Intrinsics_vec512 *r,
+  Lib_IntVector_Intrinsics_vec512 *r5
+)
+{
+  Lib_IntVector_Intrinsics_vec512 a0 = f1[0U];
+  Lib_IntVector_Intrinsics_vec512 a1 = f1[1U];
+  Lib_IntVector_Intrinsics_vec512 a2 = f1[2U];
+  Lib_IntVector_Intrinsics_vec512 a3 = f1[3U];
+  Lib_IntVector_Intrinsics_vec512 a4 = f1[4U];
+  Lib_IntVector_Intrinsics_vec512 r0 = r[0U];
+  Lib_IntVector_Intrinsics_vec512 r1 = r[1U];
+  Lib_IntVector_Intrinsics_vec512 r2 = r[2U];
+  Lib_IntVector_Intrinsics_vec512 r3 = r[3U];
+  Lib_IntVector_Intrinsics_vec512 r4 = r[4U];
+  Lib_IntVector_Intrinsics_vec512 r51 = r5[1U];
+  Lib_IntVector_Intrinsics_vec512 r52 = r5[2U];
+  Lib_IntVector_Intrinsics_vec512 r53 = r5[3U];
+  Lib_IntVector_Intrinsics_vec512 r54 = r5[4U];
+  Lib_IntVector_Intrinsics_vec512 t0 = Lib_IntVector_Intrinsics_vec512_mul64(r0, a0);
+  Lib_IntVector_Intrinsics_vec512 t1 = Lib_IntVector_Intrinsics_vec512_mul64(r1, a0);
+  Lib_IntVector_Intrinsics_vec512 t2 = Lib_IntVector_Intrinsics_vec512_mul64(r2, a0);
+  Lib_IntVector_Intrinsics_vec512 t3 = Lib_IntVector_Intrinsics_vec512_mul64(r3, a0);
+  Lib_IntVector_Intrinsics_vec512 t4 = Lib_IntVector_Intrinsics_vec512_mul64(r4, a0);
+  t0 = Lib_IntVector_Intrinsics_vec512_add64(t0, Lib_IntVector_Intrinsics_vec512_mul64(r54, a1));
+  t1 = Lib_IntVector_Intrinsics_vec512_add64(t1, Lib_IntVector_Intrinsics_vec512_mul64(r0, a1));
+  t2 = Lib_IntVector_Intrinsics_vec512_add64(t2, Lib_IntVector_Intrinsics_vec512_mul64(r1, a1));
+  t3 = Lib_IntVector_Intrinsics_vec512_add64(t3, Lib_IntVector_Intrinsics_vec512_mul64(r2, a1));
+  t4 = Lib_IntVector_Intrinsics_vec512_add64(t4, Lib_IntVector_Intrinsics_vec512_mul64(r3, a1));
+  t0 = Lib_IntVector_Intrinsics_vec512_add64(t0, Lib_IntVector_Intrinsics_vec512_mul64(r53, a2));
+  t1 = Lib_IntVector_Intrinsics_vec512_add64(t1, Lib_IntVector_Intrinsics_vec512_mul64(r54, a2));
+  t2 = Lib_IntVector_Intrinsics_vec512_add64(t2, Lib_IntVector_Intrinsics_vec512_mul64(r0, a2));
+  t3 = Lib_IntVector_Intrinsics_vec512_add64(t3, Lib_IntVector_Intrinsics_vec512_mul64(r1, a2));
+  t4 = Lib_IntVector_Intrinsics_vec512_add64(t4, Lib_IntVector_Intrinsics_vec512_mul64(r2, a2));
+  t0 = Lib_IntVector_Intrinsics_vec512_add64(t0, Lib_IntVector_Intrinsics_vec512_mul64(r52, a3));
+  t1 = Lib_IntVector_Intrinsics_vec512_add64(t1, Lib_IntVector_Intrinsics_vec512_mul64(r53, a3));
+  t2 = Lib_IntVector_Intrinsics_vec512_add64(t2, Lib_IntVector_Intrinsics_vec512_mul64(r54, a3));
+  t3 = Lib_IntVector_Intrinsics_vec512_add64(t3, Lib_IntVector_Intrinsics_vec512_mul64(r0, a3));
+  t4 = Lib_IntVector_Intrinsics_vec512_add64(t4, Lib_IntVector_Intrinsics_vec512_mul64(r1, a3));
+  t0 = Lib_IntVector_Intrinsics_vec512_add64(t0, Lib_IntVector_Intrinsics_vec512_mul64(r51, a4));
+  t1 = Lib_IntVector_Intrinsics_vec512_add64(t1, Lib_IntVector_Intrinsics_vec512_mul64(r52, a4));
+  t2 = Lib_IntVector_Intrinsics_vec512_add64(t2, Lib_IntVector_Intrinsics_vec512_mul64(r53, a4));
+  t3 = Lib_IntVector_Intrinsics_vec512_add64(t3, Lib_IntVector_Intrinsics_vec512_mul64(r54, a4));
+  t4 = Lib_IntVector_Intrinsics_vec512_add64(t4, Lib_IntVector_Intrinsics_vec512_mul64(r0, a4));
+  Lib_IntVector_Intrinsics_vec512 mask26 = Lib_IntVector_Intrinsics_vec512_load64(0x3ffffffULL);
+  Lib_IntVector_Intrinsics_vec512 z0 = Lib_IntVector_Intrinsics_vec512_shift_right64(t0, 26U);
+  Lib_IntVector_Intrinsics_vec512 z1 = Lib_IntVector_Intrinsics_vec512_shift_right64(t3, 26U);
+  Lib_IntVector_Intrinsics_vec512 x0 = Lib_IntVector_Intrinsics_vec512_and(t0, mask26);
+  Lib_IntVector_Intrinsics_vec512 x3 = Lib_IntVector_Intrinsics_vec512_and(t3, mask26);
+  Lib_IntVector_Intrinsics_vec512 x1 = Lib_IntVector_Intrinsics_vec512_add64(t1, z0);
+  Lib_IntVector_Intrinsics_vec512 x4 = Lib_IntVector_Intrinsics_vec512_add64(t4, z1);
+  Lib_IntVector_Intrinsics_vec512 z01 = Lib_IntVector_Intrinsics_vec512_shift_right64(x1, 26U);
+  Lib_IntVector_Intrinsics_vec512 z11 = Lib_IntVector_Intrinsics_vec512_shift_right64(x4, 26U);
+  Lib_IntVector_Intrinsics_vec512 t = Lib_IntVector_Intrinsics_vec512_shift_left64(z11, 2U);
+  Lib_IntVector_Intrinsics_vec512 z12 = Lib_IntVector_Intrinsics_vec512_add64(z11, t);
+  Lib_IntVector_Intrinsics_vec512 x11 = Lib_IntVector_Intrinsics_vec512_and(x1, mask26);
+  Lib_IntVector_Intrinsics_vec512 x41 = Lib_IntVector_Intrinsics_vec512_and(x4, mask26);
+  Lib_IntVector_Intrinsics_vec512 x2 = Lib_IntVector_Intrinsics_vec512_add64(t2, z01);
+  Lib_IntVector_Intrinsics_vec512 x01 = Lib_IntVector_Intrinsics_vec512_add64(x0, z12);
+  Lib_IntVector_Intrinsics_vec512 z02 = Lib_IntVector_Intrinsics_vec512_shift_right64(x2, 26U);
+  Lib_IntVector_Intrinsics_vec512 z13 = Lib_IntVector_Intrinsics_vec512_shift_right64(x01, 26U);
+  Lib_IntVector_Intrinsics_vec512 x21 = Lib_IntVector_Intrinsics_vec512_and(x2, mask26);
+  Lib_IntVector_Intrinsics_vec512 x02 = Lib_IntVector_Intrinsics_vec512_and(x01, mask26);
+  Lib_IntVector_Intrinsics_vec512 x31 = Lib_IntVector_Intrinsics_vec512_add64(x3, z02);
+  Lib_IntVector_Intrinsics_vec512 x12 = Lib_IntVector_Intrinsics_vec512_add64(x11, z13);
+  Lib_IntVector_Intrinsics_vec512 z03 = Lib_IntVector_Intrinsics_vec512_shift_right64(x31, 26U);
+  Lib_IntVector_Intrinsics_vec512 x32 = Lib_IntVector_Intrinsics_vec512_and(x31, mask26);
+  Lib_IntVector_Intrinsics_vec512 x42 = Lib_IntVector_Intrinsics_vec512_add64(x41, z03);
+  out[0U] = x02;
+  out[1U] = x12;
+  out[2U] = x21;
+  out[3U] = x32;
+  out[4U] = x42;
+}
+
+/* SNIPPET_END: fmul_r */
+
+/* SNIPPET_START: fmul5 */
+
+static inline void
+fmul5(Lib_IntVector_Intrinsics_vec512 *out5, Lib_IntVector_Intrinsics_vec512 *f)
+{
+  KRML_MAYBE_FOR5(i,
+    0U,
+    5U,
+    1U,
+    out5[i] = Lib_IntVector_Intrinsics_vec512_smul64(f[i], 5ULL););
+}
+
+/* SNIPPET_END: fmul5 */
+
+/* SNIPPET_START: fadd */
+
+static inline void
+fadd(
+  Lib_IntVector_Intrinsics_vec512 *out,
+  Lib_IntVector_Intrinsics_vec512 *f1,
+  Lib_IntVector_Intrinsics_vec512 *f2
+)
+{
+  KRML_MAYBE_FOR5(i,
+    0U,
+    5U,
+    1U,
+    out[i] = Lib_IntVector_Intrinsics_vec512_add64(f1[i], f2[i]););
+}
+
+/* SNIPPET_END: fadd */
+
+/* SNIPPET_START: carry_full */
+
+static inline void carry_full(Lib_IntVector_Intrinsics_vec512 *f)
+{
+  Lib_IntVector_Intrinsics_vec512 mask26 = Lib_IntVector_Intrinsics_vec512_load64(0x3ffffffULL);
+  Lib_IntVector_Intrinsics_vec512 l = f[0U];
+  Lib_IntVector_Intrinsics_vec512 tmp0 = Lib_IntVector_Intrinsics_vec512_and(l, mask26);
+  Lib_IntVector_Intrinsics_vec512 c0 = Lib_IntVector_Intrinsics_vec512_shift_right64(l, 26U);
+  Lib_IntVector_Intrinsics_vec512 l0 = Lib_IntVector_Intrinsics_vec512_add64(f[1U], c0);
+  Lib_IntVector_Intrinsics_vec512 tmp1 = Lib_IntVector_Intrinsics_vec512_and(l0, mask26);
+  Lib_IntVector_Intrinsics_vec512 c1 = Lib_IntVector_Intrinsics_vec512_shift_right64(l0, 26U);
+  Lib_IntVector_Intrinsics_vec512 l1 = Lib_IntVector_Intrinsics_vec512_add64(f[2U], c1);
+  Lib_IntVector_Intrinsics_vec512 tmp2 = Lib_IntVector_Intrinsics_vec512_and(l1, mask26);
+  Lib_IntVector_Intrinsics_vec512 c2 = Lib_IntVector_Intrinsics_vec512_shift_right64(l1, 26U);
+  Lib_IntVector_Intrinsics_vec512 l2 = Lib_IntVector_Intrinsics_vec512_add64(f[3U], c2);
+  Lib_IntVector_Intrinsics_vec512 tmp3 = Lib_IntVector_Intrinsics_vec512_and(l2, mask26);
+  Lib_IntVector_Intrinsics_vec512 c3 = Lib_IntVector_Intrinsics_vec512_shift_right64(l2, 26U);
+  Lib_IntVector_Intrinsics_vec512 l3 = Lib_IntVector_Intrinsics_vec512_add64(f[4U], c3);
+  Lib_IntVector_Intrinsics_vec512 tmp4 = Lib_IntVector_Intrinsics_vec512_and(l3, mask26);
+  Lib_IntVector_Intrinsics_vec512 c4 = Lib_IntVector_Intrinsics_vec512_shift_right64(l3, 26U);
+  f[0U] =
+    Lib_IntVector_Intrinsics_vec512_add64(tmp0,
+      Lib_IntVector_Intrinsics_vec512_smul64(c4, 5ULL));
+  f[1U] = tmp1;
+  f[2U] = tmp2;
+  f[3U] = tmp3;
+  f[4U] = tmp4;
+}
+
+/* SNIPPET_END: carry_full */
+
+/* SNIPPET_START: load_felem1 */
+
+static inline void load_felem1(Lib_IntVector_Intrinsics_vec512 *e, uint8_t *b)
+{
+  uint64_t lo = load64_le(b);
+  uint64_t hi = load64_le(b + 8U);
+  Lib_IntVector_Intrinsics_vec512 f0 = Lib_IntVector_Intrinsics_vec512_load64(lo);
+  Lib_IntVector_Intrinsics_vec512 f1 = Lib_IntVector_Intrinsics_vec512_load64(hi);
+  Lib_IntVector_Intrinsics_vec512 mask26 = Lib_IntVector_Intrinsics_vec512_load64(0x3ffffffULL);
+  e[0U] = Lib_IntVector_Intrinsics_vec512_and(f0, mask26);
+  e[1U] =
+    Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_shift_right64(f0, 26U),
+      mask26);
+  e[2U] =
+    Lib_IntVector_Intrinsics_vec512_or(Lib_IntVector_Intrinsics_vec512_shift_right64(f0, 52U),
+      Lib_IntVector_Intrinsics_vec512_shift_left64(Lib_IntVector_Intrinsics_vec512_and(f1,
+          Lib_IntVector_Intrinsics_vec512_load64(0x3fffULL)),
+        12U));
+  e[3U] =
+    Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_shift_right64(f1, 14U),
+      mask26);
+  e[4U] = Lib_IntVector_Intrinsics_vec512_shift_right64(f1, 40U);
+}
+
+/* SNIPPET_END: load_felem1 */
+
+/* SNIPPET_START: load_felem8 */
+
+/* Loads eight consecutive blocks; lane j holds block [0; 4; 1; 5; 2; 6; 3; 7].[j]. */
+static inline void load_felem8(Lib_IntVector_Intrinsics_vec512 *e, uint8_t *b)
+{
+  Lib_IntVector_Intrinsics_vec512 lo = Lib_IntVector_Intrinsics_vec512_load64_le(b);
+  Lib_IntVector_Intrinsics_vec512 hi = Lib_IntVector_Intrinsics_vec512_load64_le(b + 64U);
+  Lib_IntVector_Intrinsics_vec512 mask26 = Lib_IntVector_Intrinsics_vec512_load64(0x3ffffffULL);
+  Lib_IntVector_Intrinsics_vec512 m0 = Lib_IntVector_Intrinsics_vec512_interleave_low64(lo, hi);
+  Lib_IntVector_Intrinsics_vec512 m1 = Lib_IntVector_Intrinsics_vec512_interleave_high64(lo, hi);
+  e[0U] = Lib_IntVector_Intrinsics_vec512_and(m0, mask26);
+  e[1U] =
+    Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_shift_right64(m0, 26U),
+      mask26);
+  e[2U] =
+    Lib_IntVector_Intrinsics_vec512_or(Lib_IntVector_Intrinsics_vec512_shift_right64(m0, 52U),
+      Lib_IntVector_Intrinsics_vec512_shift_left64(Lib_IntVector_Intrinsics_vec512_and(m1,
+          Lib_IntVector_Intrinsics_vec512_load64(0x3fffULL)),
+        12U));
+  e[3U] =
+    Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_shift_right64(m1, 14U),
+      mask26);
+  e[4U] =
+    Lib_IntVector_Intrinsics_vec512_or(Lib_IntVector_Intrinsics_vec512_shift_right64(m1, 40U),
+      Lib_IntVector_Intrinsics_vec512_load64(0x1000000ULL));
+}
+
+/* SNIPPET_END: load_felem8 */
+
+/* SNIPPET_START: Hacl_MAC_Poly1305_Simd512_load_acc8 */
+
+void Hacl_MAC_Poly1305_Simd512_load_acc8(Lib_IntVector_Intrinsics_vec512 *acc, uint8_t *b)
+{
+  KRML_PRE_ALIGN(64) Lib_IntVector_Intrinsics_vec512 e[5U] KRML_POST_ALIGN(64) = { 0U };
+  load_felem8(e, b);
+  Lib_IntVector_Intrinsics_vec512
+  lane0 =
+    Lib_IntVector_Intrinsics_vec512_load64s(0xffffffffffffffffULL,
+      0ULL,
+      0ULL,
+      0ULL,
+      0ULL,
+      0ULL,
+      0ULL,
+      0ULL);
+  KRML_MAYBE_FOR5(i,
+    0U,
+    5U,
+    1U,
+    acc[i] =
+      Lib_IntVector_Intrinsics_vec512_add64(Lib_IntVector_Intrinsics_vec512_and(acc[i], lane0),
+        e[i]););
+}
+
+/* SNIPPET_END: Hacl_MAC_Poly1305_Simd512_load_acc8 */
+
+/* SNIPPET_START: Hacl_MAC_Poly1305_Simd512_fmul_r8_normalize */
+
+void
+Hacl_MAC_Poly1305_Simd512_fmul_r8_normalize(
+  Lib_IntVector_Intrinsics_vec512 *out,
+  Lib_IntVector_Intrinsics_vec512 *p
+)
+{
+  Lib_IntVector_Intrinsics_vec512 *r = p;
+  Lib_IntVector_Intrinsics_vec512 *r5 = p + 5U;
+  Lib_IntVector_Intrinsics_vec512 *r8 = p + 10U;
+  KRML_PRE_ALIGN(64) Lib_IntVector_Intrinsics_vec512 rp[35U] KRML_POST_ALIGN(64) = { 0U };
+  Lib_IntVector_Intrinsics_vec512 *r2 = rp;
+  Lib_IntVector_Intrinsics_vec512 *r3 = rp + 5U;
+  Lib_IntVector_Intrinsics_vec512 *r4 = rp + 10U;
+  Lib_IntVector_Intrinsics_vec512 *r5_ = rp + 15U;
+  Lib_IntVector_Intrinsics_vec512 *r6 = rp + 20U;
+  Lib_IntVector_Intrinsics_vec512 *r7 = rp + 25U;
+  Lib_IntVector_Intrinsics_vec512 *rv5 = rp + 30U;
+  fmul_r(r2, r, r, r5);
+  fmul_r(r3, r2, r, r5);
+  fmul_r(r4, r3, r, r5);
+  fmul_r(r5_, r4, r, r5);
+  fmul_r(r6, r5_, r, r5);
+  fmul_r(r7, r6, r, r5);
+  KRML_PRE_ALIGN(64) Lib_IntVector_Intrinsics_vec512 rv[5U] KRML_POST_ALIGN(64) = { 0U };
+  KRML_MAYBE_FOR5(i,
+    0U,
+    5U,
+    1U,
+    Lib_IntVector_Intrinsics_vec512
+    v84 = Lib_IntVector_Intrinsics_vec512_interleave_low64(r8[i], r4[i]);
+    Lib_IntVector_Intrinsics_vec512
+    v73 = Lib_IntVector_Intrinsics_vec512_interleave_low64(r7[i], r3[i]);
+    Lib_IntVector_Intrinsics_vec512
+    v62 = Lib_IntVector_Intrinsics_vec512_interleave_low64(r6[i], r2[i]);
+    Lib_IntVector_Intrinsics_vec512
+    v51 = Lib_IntVector_Intrinsics_vec512_interleave_low64(r5_[i], r[i]);
+    Lib_IntVector_Intrinsics_vec512
+    v8473 = Lib_IntVector_Intrinsics_vec512_interleave_low128(v84, v73);
+    Lib_IntVector_Intrinsics_vec512
+    v6251 = Lib_IntVector_Intrinsics_vec512_interleave_low128(v62, v51);
+    rv[i] = Lib_IntVector_Intrinsics_vec512_interleave_low256(v8473, v6251););
+  fmul5(rv5, rv);
+  KRML_PRE_ALIGN(64) Lib_IntVector_Intrinsics_vec512 t[5U] KRML_POST_ALIGN(64) = { 0U };
+  fmul_r(t, out, rv, rv5);
+  KRML_MAYBE_FOR5(i,
+    0U,
+    5U,
+    1U,
+    uint64_t s = Lib_IntVector_Intrinsics_vec512_horizontal_add64(t[i]);
+    out[i] = Lib_IntVector_Intrinsics_vec512_load64(s););
+  carry_full(out);
+}
+
+/* SNIPPET_END: Hacl_MAC_Poly1305_Simd512_fmul_r8_normalize */
+
+/* SNIPPET_START: Hacl_MAC_Poly1305_Simd512_poly1305_init */
+
+void
+Hacl_MAC_Poly1305_Simd512_poly1305_init(Lib_IntVector_Intrinsics_vec512 *ctx, uint8_t *key)
+{
+  Lib_IntVector_Intrinsics_vec512 *acc = ctx;
+  Lib_IntVector_Intrinsics_vec512 *pre = ctx + 5U;
+  uint8_t *kr = key;
+  KRML_MAYBE_FOR5(i, 0U, 5U, 1U, acc[i] = Lib_IntVector_Intrinsics_vec512_zero;);
+  uint64_t u0 = load64_le(kr);
+  uint64_t lo = u0;
+  uint64_t u = load64_le(kr + 8U);
+  uint64_t hi = u;
+  uint64_t mask0 = 0x0ffffffc0fffffffULL;
+  uint64_t mask1 = 0x0ffffffc0ffffffcULL;
+  uint8_t rb[16U] = { 0U };
+  store64_le(rb, lo & mask0);
+  store64_le(rb + 8U, hi & mask1);
+  Lib_IntVector_Intrinsics_vec512 *r = pre;
+  Lib_IntVector_Intrinsics_vec512 *r5 = pre + 5U;
+  Lib_IntVector_Intrinsics_vec512 *rn = pre + 10U;
+  Lib_IntVector_Intrinsics_vec512 *rn_5 = pre + 15U;
+  load_felem1(r, rb);
+  fmul5(r5, r);
+  fmul_r(rn, r, r, r5);
+  fmul5(rn_5, rn);
+  fmul_r(rn, rn, rn, rn_5);
+  fmul5(rn_5, rn);
+  fmul_r(rn, rn, rn, rn_5);
+  fmul5(rn_5, rn);
+}
+
+/* SNIPPET_END: Hacl_MAC_Poly1305_Simd512_poly1305_init */
+
+/* SNIPPET_START: Hacl_MAC_Poly1305_Simd512_poly1305_update_padded */
+
+void
+Hacl_MAC_Poly1305_Simd512_poly1305_update_padded(
+  Lib_IntVector_Intrinsics_vec512 *ctx,
+  uint32_t len,
+  uint8_t *text
+)
+{
+  Lib_IntVector_Intrinsics_vec512 *acc = ctx;
+  Lib_IntVector_Intrinsics_vec512 *pre = ctx + 5U;
+  uint32_t n = len / 16U;
+  uint32_t rem = len % 16U;
+  uint32_t len0 = n * 16U / 128U * 128U;
+  if (len0 > 0U)
+  {
+    Hacl_MAC_Poly1305_Simd512_load_acc8(acc, text);
+    uint32_t nb = (len0 - 128U) / 128U;
+    for (uint32_t i = 0U; i < nb; i++)
+    {
+      uint8_t *block = text + 128U + i * 128U;
+      KRML_PRE_ALIGN(64) Lib_IntVector_Intrinsics_vec512 e[5U] KRML_POST_ALIGN(64) = { 0U };
+      load_felem8(e, block);
+      fmul_r(acc, acc, pre + 10U, pre + 15U);
+      fadd(acc, acc, e);
+    }
+    Hacl_MAC_Poly1305_Simd512_fmul_r8_normalize(acc, pre);
+  }
+  uint32_t nb = n - len0 / 16U;
+  for (uint32_t i = 0U; i < nb; i++)
+  {
+    uint8_t *block = text + len0 + i * 16U;
+    KRML_PRE_ALIGN(64) Lib_IntVector_Intrinsics_vec512 e[5U] KRML_POST_ALIGN(64) = { 0U };
+    load_felem1(e, block);
+    e[4U] =
+      Lib_IntVector_Intrinsics_vec512_or(e[4U],
+        Lib_IntVector_Intrinsics_vec512_load64(0x1000000ULL));
+    fadd(acc, acc, e);
+    fmul_r(acc, acc, pre, pre + 5U);
+  }
+  if (rem > 0U)
+  {
+    uint8_t tmp[16U] = { 0U };
+    memcpy(tmp, text + n * 16U, rem * sizeof (uint8_t));
+    KRML_PRE_ALIGN(64) Lib_IntVector_Intrinsics_vec512 e[5U] KRML_POST_ALIGN(64) = { 0U };
+    load_felem1(e, tmp);
+    e[4U] =
+      Lib_IntVector_Intrinsics_vec512_or(e[4U],
+        Lib_IntVector_Intrinsics_vec512_load64(0x1000000ULL));
+    fadd(acc, acc, e);
+    fmul_r(acc, acc, pre, pre + 5U);
+  }
+}
+
+/* SNIPPET_END: Hacl_MAC_Poly1305_Simd512_poly1305_update_padded */
+
+/* SNIPPET_START: Hacl_MAC_Poly1305_Simd512_poly1305_finish */
+
+void
+Hacl_MAC_Poly1305_Simd512_poly1305_finish(
+  uint8_t *tag,
+  uint8_t *key,
+  Lib_IntVector_Intrinsics_vec512 *ctx
+)
+{
+  Lib_IntVector_Intrinsics_vec512 *acc = ctx;
+  uint8_t *ks = key + 16U;
+  carry_full(acc);
+  carry_full(acc);
+  Lib_IntVector_Intrinsics_vec512 f0 = acc[0U];
+  Lib_IntVector_Intrinsics_vec512 f1 = acc[1U];
+  Lib_IntVector_Intrinsics_vec512 f2 = acc[2U];
+  Lib_IntVector_Intrinsics_vec512 f3 = acc[3U];
+  Lib_IntVector_Intrinsics_vec512 f4 = acc[4U];
+  Lib_IntVector_Intrinsics_vec512 mh = Lib_IntVector_Intrinsics_vec512_load64(0x3ffffffULL);
+  Lib_IntVector_Intrinsics_vec512 ml = Lib_IntVector_Intrinsics_vec512_load64(0x3fffffbULL);
+  Lib_IntVector_Intrinsics_vec512 mask = Lib_IntVector_Intrinsics_vec512_eq64(f4, mh);
+  Lib_IntVector_Intrinsics_vec512
+  mask1 =
+    Lib_IntVector_Intrinsics_vec512_and(mask,
+      Lib_IntVector_Intrinsics_vec512_eq64(f3, mh));
+  Lib_IntVector_Intrinsics_vec512
+  mask2 =
+    Lib_IntVector_Intrinsics_vec512_and(mask1,
+      Lib_IntVector_Intrinsics_vec512_eq64(f2, mh));
+  Lib_IntVector_Intrinsics_vec512
+  mask3 =
+    Lib_IntVector_Intrinsics_vec512_and(mask2,
+      Lib_IntVector_Intrinsics_vec512_eq64(f1, mh));
+  Lib_IntVector_Intrinsics_vec512
+  mask4 =
+    Lib_IntVector_Intrinsics_vec512_and(mask3,
+      Lib_IntVector_Intrinsics_vec512_lognot(Lib_IntVector_Intrinsics_vec512_gt64(ml, f0)));
+  Lib_IntVector_Intrinsics_vec512 ph = Lib_IntVector_Intrinsics_vec512_and(mask4, mh);
+  Lib_IntVector_Intrinsics_vec512 pl = Lib_IntVector_Intrinsics_vec512_and(mask4, ml);
+  uint64_t
+  f01 = Lib_IntVector_Intrinsics_vec512_extract64(Lib_IntVector_Intrinsics_vec512_sub64(f0, pl), 0U);
+  uint64_t
+  f11 = Lib_IntVector_Intrinsics_vec512_extract64(Lib_IntVector_Intrinsics_vec512_sub64(f1, ph), 0U);
+  uint64_t
+  f21 = Lib_IntVector_Intrinsics_vec512_extract64(Lib_IntVector_Intrinsics_vec512_sub64(f2, ph), 0U);
+  uint64_t
+  f31 = Lib_IntVector_Intrinsics_vec512_extract64(Lib_IntVector_Intrinsics_vec512_sub64(f3, ph), 0U);
+  uint64_t
+  f41 = Lib_IntVector_Intrinsics_vec512_extract64(Lib_IntVector_Intrinsics_vec512_sub64(f4, ph), 0U);
+  uint64_t lo = (f01 | f11 << 26U) | f21 << 52U;
+  uint64_t hi = (f21 >> 12U | f31 << 14U) | f41 << 40U;
+  uint64_t u0 = load64_le(ks);
+  uint64_t lo0 = u0;
+  uint64_t u = load64_le(ks + 8U);
+  uint64_t hi0 = u;
+  uint64_t r0 = lo + lo0;
+  uint64_t r1 = hi + hi0;
+  uint64_t c = (r0 ^ ((r0 ^ lo0) | ((r0 - lo0) ^ lo0))) >> 63U;
+  uint64_t r11 = r1 + c;
+  store64_le(tag, r0);
+  store64_le(tag + 8U, r11);
+}
+
+/* SNIPPET_END: Hacl_MAC_Poly1305_Simd512_poly1305_finish */
+
+/* SNIPPET_START: Hacl_MAC_Poly1305_Simd512_mac */
+
+void
+Hacl_MAC_Poly1305_Simd512_mac(
+  uint8_t *output,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *key
+)
+{
+  KRML_PRE_ALIGN(64) Lib_IntVector_Intrinsics_vec512 ctx[25U] KRML_POST_ALIGN(64) = { 0U };
+  Hacl_MAC_Poly1305_Simd512_poly1305_init(ctx, key);
+  uint32_t n = input_len / 16U;
+  uint32_t rem = input_len % 16U;
+  Hacl_MAC_Poly1305_Simd512_poly1305_update_padded(ctx, n * 16U, input);
+  if (rem > 0U)
+  {
+    Lib_IntVector_Intrinsics_vec512 *acc = ctx;
+    Lib_IntVector_Intrinsics_vec512 *pre = ctx + 5U;
+    uint8_t tmp[16U] = { 0U };
+    memcpy(tmp, input + n * 16U, rem * sizeof (uint8_t));
+    tmp[rem] = 1U;
+    KRML_PRE_ALIGN(64) Lib_IntVector_Intrinsics_vec512 e[5U] KRML_POST_ALIGN(64) = { 0U };
+    load_felem1(e, tmp);
+    fadd(acc, acc, e);
+    fmul_r(acc, acc, pre, pre + 5U);
+  }
+  Hacl_MAC_Poly1305_Simd512_poly1305_finish(output, key, ctx);
+}
+
+/* SNIPPET_END: Hacl_MAC_Poly1305_Simd512_mac */
@@ -0,0 +1,646 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#include "Hacl_Ristretto255.h"
+
+#include "internal/Hacl_Ed25519.h"
+#include "internal/Hacl_Bignum25519_51.h"
+
+/* SNIPPET_START: sqrt_m1 */
+
+static const
+uint64_t
+sqrt_m1[5U] =
+  {
+    0x00061b274a0ea0b0ULL, 0x0000d5a5fc8f189dULL, 0x0007ef5e9cbd0c60ULL, 0x00078595a6804c9eULL,
+    0x0002b8324804fc1dULL
+  };
+
+/* SNIPPET_END: sqrt_m1 */
+
+/* SNIPPET_START: d */
+
+static const
+uint64_t
+d[5U] =
+  {
+    0x00034dca135978a3ULL, 0x0001a8283b156ebdULL, 0x0005e7a26001c029ULL, 0x000739c663a03cbbULL,
+    0x00052036cee2b6ffULL
+  };
+
+/* SNIPPET_END: d */
+
+/* SNIPPET_START: invsqrt_a_minus_d */
+
+static const
+uint64_t
+invsqrt_a_minus_d[5U] =
+  {
+    0x0000fdaa805d40eaULL, 0x0002eb482e57d339ULL, 0x000007610274bc58ULL, 0x0006510b613dc8ffULL,
+    0x000786c8905cfaffULL
+  };
+
+/* SNIPPET_END: invsqrt_a_minus_d */
+
+/* SNIPPET_START: sqrt_ad_minus_one */
+
+static const
+uint64_t
+sqrt_ad_minus_one[5U] =
+  {
+    0x0007f6a0497b2e1bULL, 0x0001836f0a97afd2ULL, 0x0007d747f6be7638ULL, 0x000456079e7e6498ULL,
+    0x000376931bf2b834ULL
+  };
+
+/* SNIPPET_END: sqrt_ad_minus_one */
+
+/* SNIPPET_START: one_minus_d_sq */
+
+static const
+uint64_t
+one_minus_d_sq[5U] =
+  {
+    0x000409c1945fc176ULL, 0x000719abc6a1fc4fULL, 0x0001c37f90b20684ULL, 0x00006bccca55eedfULL,
+    0x000029072a8b2b3eULL
+  };
+
+/* SNIPPET_END: one_minus_d_sq */
+
+/* SNIPPET_START: d_minus_one_sq */
+
+static const
+uint64_t
+d_minus_one_sq[5U] =
+  {
+    0x00055aaa44ed4d20ULL, 0x00059603c3332635ULL, 0x00026d3baf4a7928ULL, 0x000120a66e6997a9ULL,
+    0x0005968b37af66c2ULL
+  };
+
+/* SNIPPET_END: d_minus_one_sq */
+
+/* SNIPPET_START: fmul */
+
+static inline void fmul(uint64_t *out, uint64_t *a, const uint64_t *b)
+{
+  FStar_UInt128_uint128 tmp[10U];
+  for (uint32_t _i = 0U; _i < 10U; ++_i)
+    tmp[_i] = FStar_UInt128_uint64_to_uint128(0ULL);
+  Hacl_Impl_Curve25519_Field51_fmul(out, a, (uint64_t *)b, tmp);
+}
+
+/* SNIPPET_END: fmul */
+
+/* SNIPPET_START: fsqr */
+
+static inline void fsqr(uint64_t *out, uint64_t *a)
+{
+  FStar_UInt128_uint128 tmp[5U];
+  for (uint32_t _i = 0U; _i < 5U; ++_i)
+    tmp[_i] = FStar_UInt128_uint64_to_uint128(0ULL);
+  Hacl_Impl_Curve25519_Field51_fsqr(out, a, tmp);
+}
+
+/* SNIPPET_END: fsqr */
+
+/* SNIPPET_START: fadd */
+
+static inline void fadd(uint64_t *out, uint64_t *a, uint64_t *b)
+{
+  Hacl_Impl_Curve25519_Field51_fadd(out, a, b);
+  Hacl_Bignum25519_reduce_513(out);
+}
+
+/* SNIPPET_END: fadd */
+
+/* SNIPPET_START: fsub */
+
+static inline void fsub(uint64_t *out, uint64_t *a, uint64_t *b)
+{
+  Hacl_Impl_Curve25519_Field51_fsub(out, a, b);
+  Hacl_Bignum25519_reduce_513(out);
+}
+
+/* SNIPPET_END: fsub */
+
+/* SNIPPET_START: fneg */
+
+static inline void fneg(uint64_t *out, uint64_t *a)
+{
+  uint64_t zero[5U] = { 0U };
+  fsub(out, zero, a);
+}
+
+/* SNIPPET_END: fneg */
+
+/* SNIPPET_START: fone */
+
+static inline void fone(uint64_t *out)
+{
+  out[0U] = 1ULL;
+  out[1U] = 0ULL;
+  out[2U] = 0ULL;
+  out[3U] = 0ULL;
+  out[4U] = 0ULL;
+}
+
+/* SNIPPET_END: fone */
+
+/* SNIPPET_START: is_negative_mask */
+
+/* All-ones if `a` is negative, i.e., odd once fully reduced. */
+static inline uint64_t is_negative_mask(uint64_t *a)
+{
+  uint64_t w[4U] = { 0U };
+  Hacl_Impl_Curve25519_Field51_store_felem(w, a);
+  return 0ULL - (w[0U] & 1ULL);
+}
+
+/* SNIPPET_END: is_negative_mask */
+
+/* SNIPPET_START: is_zero_mask */
+
+static inline uint64_t is_zero_mask(uint64_t *a)
+{
+  uint64_t w[4U] = { 0U };
+  Hacl_Impl_Curve25519_Field51_store_felem(w, a);
+  return FStar_UInt64_eq_mask(((w[0U] | w[1U]) | w[2U]) | w[3U], 0ULL);
+}
+
+/* SNIPPET_END: is_zero_mask */
+
+/* SNIPPET_START: fcmov */
+
+static inline void fcmov(uint64_t *out, uint64_t *a, uint64_t mask)
+{
+  KRML_MAYBE_FOR5(i, 0U, 5U, 1U, out[i] = (a[i] & mask) | (out[i] & ~mask););
+}
+
+/* SNIPPET_END: fcmov */
+
+/* SNIPPET_START: fcneg */
+
+static inline void fcneg(uint64_t *a, uint64_t mask)
+{
+  uint64_t na[5U] = { 0U };
+  fneg(na, a);
+  fcmov(a, na, mask);
+}
+
+/* SNIPPET_END: fcneg */
+
+/* SNIPPET_START: fabs_ */
+
+static inline void fabs_(uint64_t *a)
+{
+  fcneg(a, is_negative_mask(a));
+}
+
+/* SNIPPET_END: fabs_ */
+
+/* SNIPPET_START: Hacl_Ristretto255_encode */
+
+/**
+Encode the group element `p` as 32 bytes in `out`.
+
+  The argument `p` is meant to be 20 limbs in size, i.e., uint64_t[20].
+  The outparam `out` is meant to be 32 bytes in size, i.e., uint8_t[32].
+
+  The function is constant-time in `p`.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • `p` and `out` are disjoint
+*/
+void Hacl_Ristretto255_encode(uint64_t *p, uint8_t *out)
+{
+  uint64_t tmp[60U] = { 0U };
+  uint64_t *px = p;
+  uint64_t *py = p + 5U;
+  uint64_t *pz = p + 10U;
+  uint64_t *pt = p + 15U;
+  uint64_t *u1 = tmp;
+  uint64_t *u2 = tmp + 5U;
+  uint64_t *inv = tmp + 10U;
+  uint64_t *den1 = tmp + 15U;
+  uint64_t *den2 = tmp + 20U;
+  uint64_t *z_inv = tmp + 25U;
+  uint64_t *x = tmp + 30U;
+  uint64_t *y = tmp + 35U;
+  uint64_t *ix = tmp + 40U;
+  uint64_t *iy = tmp + 45U;
+  uint64_t *a = tmp + 50U;
+  uint64_t *s = tmp + 55U;
+  /* u1 = (Z + Y) * (Z - Y), u2 = X * Y, inv = 1 / sqrt(u1 * u2^2) */
+  fadd(a, pz, py);
+  fsub(u1, pz, py);
+  fmul(u1, u1, a);
+  fmul(u2, px, py);
+  fsqr(a, u2);
+  fmul(a, a, u1);
+  fone(s);
+  Hacl_Bignum25519_sqrt_ratio_m1(inv, s, a);
+  fmul(den1, inv, u1);
+  fmul(den2, inv, u2);
+  fmul(z_inv, den1, den2);
+  fmul(z_inv, z_inv, pt);
+  /* Rotate by sqrt(-1) when T * z_inv is negative. */
+  fmul(ix, px, sqrt_m1);
+  fmul(iy, py, sqrt_m1);
+  fmul(a, den1, invsqrt_a_minus_d);
+  fmul(s, pt, z_inv);
+  uint64_t rotate = is_negative_mask(s);
+  memcpy(x, px, 5U * sizeof (uint64_t));
+  memcpy(y, py, 5U * sizeof (uint64_t));
+  fcmov(x, iy, rotate);
+  fcmov(y, ix, rotate);
+  fcmov(den2, a, rotate);
+  fmul(s, x, z_inv);
+  fcneg(y, is_negative_mask(s));
+  fsub(a, pz, y);
+  fmul(s, den2, a);
+  fabs_(s);
+  Hacl_Bignum25519_store_51(out, s);
+}
+
+/* SNIPPET_END: Hacl_Ristretto255_encode */
+
+/* SNIPPET_START: Hacl_Ristretto255_decode */
+
+/**
+Decode 32 bytes `s` into a group element in `out`.
+
+  The function returns `true` if `s` is the canonical encoding of a group element and
+  `false` otherwise, in which case `out` holds an unspecified point.
+
+  The argument `s` is meant to be 32 bytes in size, i.e., uint8_t[32].
+  The outparam `out` is meant to be 20 limbs in size, i.e., uint64_t[20].
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • `s` and `out` are disjoint
+*/
+bool Hacl_Ristretto255_decode(uint8_t *s, uint64_t *out)
+{
+  uint64_t tmp[45U] = { 0U };
+  uint8_t back[32U] = { 0U };
+  uint64_t *f = tmp;
+  uint64_t *ss = tmp + 5U;
+  uint64_t *u1 = tmp + 10U;
+  uint64_t *u2 = tmp + 15U;
+  uint64_t *u2_sqr = tmp + 20U;
+  uint64_t *v = tmp + 25U;
+  uint64_t *inv = tmp + 30U;
+  uint64_t *den_x = tmp + 35U;
+  uint64_t *den_y = tmp + 40U;
+  uint64_t *x = out;
+  uint64_t *y = out + 5U;
+  uint64_t *z = out + 10U;
+  uint64_t *t = out + 15U;
+  /* Canonical: below p, which also clears the top bit, and non-negative. */
+  Hacl_Bignum25519_load_51(f, s);
+  Hacl_Bignum25519_store_51(back, f);
+  uint8_t diff = (uint32_t)s[0U] & 1U;
+  for (uint32_t i = 0U; i < 32U; i++)
+  {
+    diff = (uint32_t)diff | ((uint32_t)back[i] ^ (uint32_t)s[i]);
+  }
+  uint64_t ok = FStar_UInt64_eq_mask((uint64_t)diff, 0ULL);
+  /* u1 = 1 - s^2, u2 = 1 + s^2, v = -d * u1^2 - u2^2 */
+  fone(z);
+  fsqr(ss, f);
+  fsub(u1, z, ss);
+  fadd(u2, z, ss);
+  fsqr(u2_sqr, u2);
+  fsqr(v, u1);
+  fmul(v, v, d);
+  fneg(v, v);
+  fsub(v, v, u2_sqr);
+  fmul(ss, v, u2_sqr);
+  bool was_square = Hacl_Bignum25519_sqrt_ratio_m1(inv, z, ss);
+  uint64_t sq = FStar_UInt64_eq_mask((uint64_t)was_square, 1ULL);
+  fmul(den_x, inv, u2);
+  fmul(den_y, inv, den_x);
+  fmul(den_y, den_y, v);
+  /* x = |2 * s * den_x|, y = u1 * den_y, t = x * y */
+  fadd(x, f, f);
+  fmul(x, x, den_x);
+  fabs_(x);
+  fmul(y, u1, den_y);
+  fmul(t, x, y);
+  uint64_t valid = ((ok & sq) & ~is_negative_mask(t)) & ~is_zero_mask(y);
+  return valid == 0xFFFFFFFFFFFFFFFFULL;
+}
+
+/* SNIPPET_END: Hacl_Ristretto255_decode */
+
+/* SNIPPET_START: map */
+
+/* The Elligator map of RFC 9496, Section 4.3.4, from a field element to a point. */
+static void map(uint64_t *out, uint64_t *t)
+{
+  uint64_t tmp[50U] = { 0U };
+  uint64_t *r = tmp;
+  uint64_t *u = tmp + 5U;
+  uint64_t *v = tmp + 10U;
+  uint64_t *s = tmp + 15U;
+  uint64_t *s1 = tmp + 20U;
+  uint64_t *c = tmp + 25U;
+  uint64_t *n = tmp + 30U;
+  uint64_t *a = tmp + 35U;
+  uint64_t *one = tmp + 40U;
+  uint64_t *ss = tmp + 45U;
+  fone(one);
+  /* r = sqrt(-1) * t^2, u = (r + 1) * (1 - d^2), v = (-1 - r * d) * (r + d) */
+  fsqr(r, t);
+  fmul(r, r, sqrt_m1);
+  fadd(u, r, one);
+  fmul(u, u, one_minus_d_sq);
+  fmul(a, r, d);
+  fadd(a, a, one);
+  fneg(a, a);
+  fadd(v, r, (uint64_t *)d);
+  fmul(v, v, a);
+  bool was_square = Hacl_Bignum25519_sqrt_ratio_m1(s, u, v);
+  uint64_t sq = FStar_UInt64_eq_mask((uint64_t)was_square, 1ULL);
+  /* s = s if was_square, -|s * t| otherwise; c = -1 if was_square, r otherwise */
+  fmul(s1, s, t);
+  fabs_(s1);
+  fneg(s1, s1);
+  fcmov(s1, s, sq);
+  fneg(c, one);
+  memcpy(a, r, 5U * sizeof (uint64_t));
+  fcmov(a, c, sq);
+  /* n = c * (r - 1) * (d - 1)^2 - v */
+  fsub(n, r, one);
+  fmul(n, n, a);
+  fmul(n, n, d_minus_one_sq);
+  fsub(n, n, v);
+  /* w0 = 2 * s * v, w1 = n * sqrt(a * d - 1), w2 = 1 - s^2, w3 = 1 + s^2 */
+  uint64_t *w0 = r;
+  uint64_t *w1 = u;
+  uint64_t *w2 = c;
+  uint64_t *w3 = a;
+  fadd(w0, s1, s1);
+  fmul(w0, w0, v);
+  fmul(w1, n, sqrt_ad_minus_one);
+  fsqr(ss, s1);
+  fsub(w2, one, ss);
+  fadd(w3, one, ss);
+  fmul(out, w0, w3);
+  fmul(out + 5U, w2, w1);
+  fmul(out + 10U, w1, w3);
+  fmul(out + 15U, w0, w2);
+}
+
+/* SNIPPET_END: map */
+
+/* SNIPPET_START: Hacl_Ristretto255_from_uniform_bytes */
+
+/**
+Map 64 uniformly random bytes `b` to a group element in `out` (the one-way map of
+RFC 9496, Section 4.3.4).
+
+  The argument `b` is meant to be 64 bytes in size, i.e., uint8_t[64], e.g., the
+  output of SHA-512 for hash-to-group.
+  The outparam `out` is meant to be 20 limbs in size, i.e., uint64_t[20].
+
+  The function is constant-time in `b`.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • `b` and `out` are disjoint
+*/
+void Hacl_Ristretto255_from_uniform_bytes(uint8_t *b, uint64_t *out)
+{
+  uint64_t t[5U] = { 0U };
+  uint64_t p1[20U] = { 0U };
+  uint64_t p2[20U] = { 0U };
+  /* load_51 clears the top bit, as the map requires. */
+  Hacl_Bignum25519_load_51(t, b);
+  map(p1, t);
+  Hacl_Bignum25519_load_51(t, b + 32U);
+  map(p2, t);
+  Hacl_Impl_Ed25519_PointAdd_point_add(out, p1, p2);
+}
+
+/* SNIPPET_END: Hacl_Ristretto255_from_uniform_bytes */
+
+/* SNIPPET_START: Hacl_Ristretto255_equal */
+
+/**
+Return `true` if `p` and `q` are the same group element, in constant time.
+
+  The arguments `p` and `q` are meant to be 20 limbs in size, i.e., uint64_t[20].
+*/
+bool Hacl_Ristretto255_equal(uint64_t *p, uint64_t *q)
+{
+  uint64_t a[5U] = { 0U };
+  uint64_t b[5U] = { 0U };
+  /* X1 * Y2 = Y1 * X2 or Y1 * Y2 = X1 * X2 */
+  fmul(a, p, q + 5U);
+  fmul(b, p + 5U, q);
+  fsub(a, a, b);
+  uint64_t m1 = is_zero_mask(a);
+  fmul(a, p + 5U, q + 5U);
+  fmul(b, p, q);
+  fsub(a, a, b);
+  uint64_t m2 = is_zero_mask(a);
+  return (m1 | m2) == 0xFFFFFFFFFFFFFFFFULL;
+}
+
+/* SNIPPET_END: Hacl_Ristretto255_equal */
+
+/* SNIPPET_START: Hacl_Ristretto255_double_and_encode_batch */
+
+/**
+Encode the doubles of `n` group elements with a single field inversion per 64
+elements: the i-th 32 bytes of `out` are `Hacl_Ristretto255_encode` of `p_i + p_i`.
+
+  The argument `p` points to `n` elements of 20 limbs each, i.e., uint64_t[20 * n].
+  The outparam `out` points to 32 * `n` bytes of valid memory, i.e., uint8_t[32 * n].
+
+  Encoding an element takes an inverse square root, which cannot be shared between
+  elements; encoding its double only takes an inversion, which can. A caller that
+  computes `[k]P` and wants it encoded in a batch computes `[k / 2 mod l]P` instead.
+  The function is constant-time in the elements.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • `p` and `out` are disjoint
+*/
+void Hacl_Ristretto255_double_and_encode_batch(uint32_t n, uint64_t *p, uint8_t *out)
+{
+  /* Per element: e, f, g, h, e * g, f * h. */
+  uint64_t st[1920U] = { 0U };
+  uint64_t acc[320U] = { 0U };
+  uint64_t tmp[40U] = { 0U };
+  uint64_t *inv = tmp;
+  uint64_t *z_inv = tmp + 5U;
+  uint64_t *t_inv = tmp + 10U;
+  uint64_t *a = tmp + 15U;
+  uint64_t *b = tmp + 20U;
+  uint64_t *magic = tmp + 25U;
+  uint64_t *one = tmp + 30U;
+  uint64_t *s = tmp + 35U;
+  fone(one);
+  for (uint32_t i0 = 0U; i0 < n; i0 = i0 + 64U)
+  {
+    uint32_t len;
+    if (n - i0 < 64U)
+    {
+      len = n - i0;
+    }
+    else
+    {
+      len = 64U;
+    }
+    uint64_t zero = 0ULL;
+    for (uint32_t i = 0U; i < len; i++)
+    {
+      uint64_t *pi = p + 20U * (i0 + i);
+      uint64_t *e = st + 30U * i;
+      uint64_t *f = e + 5U;
+      uint64_t *g = e + 10U;
+      uint64_t *h = e + 15U;
+      uint64_t *eg = e + 20U;
+      uint64_t *fh = e + 25U;
+      /* e = 2XY, f = Z^2 + dT^2, g = Y^2 + X^2, h = Z^2 - dT^2 */
+      fmul(e, pi, pi + 5U);
+      fadd(e, e, e);
+      fsqr(a, pi + 15U);
+      fmul(a, a, d);
+      fsqr(b, pi + 10U);
+      fadd(f, b, a);
+      fsub(h, b, a);
+      fsqr(a, pi);
+      fsqr(b, pi + 5U);
+      fadd(g, b, a);
+      fmul(eg, e, g);
+      fmul(fh, f, h);
+      /* acc[i] = efgh_0 * ... * efgh_i, with 1 in place of a zero product (the
+         identity), which then encodes as zero. */
+      fmul(a, eg, fh);
+      zero = is_zero_mask(a);
+      fcmov(a, one, zero);
+      if (i == 0U)
+      {
+        memcpy(acc, a, 5U * sizeof (uint64_t));
+      }
+      else
+      {
+        fmul(acc + 5U * i, acc + 5U * (i - 1U), a);
+      }
+    }
+    Hacl_Bignum25519_inverse(inv, acc + 5U * (len - 1U));
+    for (uint32_t i1 = 0U; i1 < len; i1++)
+    {
+      uint32_t i = len - i1 - 1U;
+      uint64_t *e = st + 30U * i;
+      uint64_t *f = e + 5U;
+      uint64_t *g = e + 10U;
+      uint64_t *h = e + 15U;
+      uint64_t *eg = e + 20U;
+      uint64_t *fh = e + 25U;
+      /* inv = 1 / (efgh_0 * ... * efgh_i) */
+      fmul(a, eg, fh);
+      zero = is_zero_mask(a);
+      fcmov(a, one, zero);
+      if (i == 0U)
+      {
+        memcpy(b, inv, 5U * sizeof (uint64_t));
+      }
+      else
+      {
+        fmul(b, inv, acc + 5U * (i - 1U));
+        fmul(inv, inv, a);
+      }
+      /* b = 1 / (efgh), z_inv = 1 / (fh), t_inv = 1 / (eg) */
+      fmul(z_inv, eg, b);
+      fmul(t_inv, fh, b);
+      memcpy(magic, invsqrt_a_minus_d, 5U * sizeof (uint64_t));
+      fmul(a, eg, z_inv);
+      uint64_t rotate = is_negative_mask(a);
+      /* Rotated: e = g, g = -e, h = f * sqrt(-1), magic = sqrt(-1). */
+      fneg(a, e);
+      fcmov(e, g, rotate);
+      fcmov(g, a, rotate);
+      fmul(a, f, sqrt_m1);
+      fcmov(h, a, rotate);
+      memcpy(a, sqrt_m1, 5U * sizeof (uint64_t));
+      fcmov(magic, a, rotate);
+      fmul(a, h, e);
+      fmul(a, a, z_inv);
+      fcneg(g, is_negative_mask(a));
+      /* s = |(h - g) * magic * g * t_inv| */
+      fsub(s, h, g);
+      fmul(s, s, magic);
+      fmul(s, s, g);
+      fmul(s, s, t_inv);
+      fabs_(s);
+      memset(a, 0U, 5U * sizeof (uint64_t));
+      fcmov(s, a, zero);
+      Hacl_Bignum25519_store_51(out + 32U * (i0 + i), s);
+    }
+  }
+}
+
+/* SNIPPET_END: Hacl_Ristretto255_double_and_encode_batch */
+
+/* SNIPPET_START: Hacl_Ristretto255_mul_multi_vartime */
+
+/**
+Write `[scalars[0]]points[0] + ... + [scalars[n - 1]]points[n - 1]` in `out`, in variable
+time (multi-scalar multiplication).
+
+  The function returns `false`, leaving `out` untouched, if memory cannot be allocated,
+  and `true` otherwise.
+
+  The argument `scalars` points to `n` little-endian scalars of 32 bytes each, i.e., uint8_t[32 * n].
+  The argument `points` points to `n` elements of 20 limbs each, i.e., uint64_t[20 * n].
+  The outparam `out` is meant to be 20 limbs in size, i.e., uint64_t[20].
+
+  This is `Hacl_EC_Ed25519_point_mul_multi`, which applies unchanged to group elements.
+  The running time depends on the scalars: use it only when they are public, e.g., when
+  verifying a proof.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • `out` is disjoint from `scalars` and `points`
+*/
+bool
+Hacl_Ristretto255_mul_multi_vartime(
+  uint32_t n,
+  uint8_t *scalars,
+  uint64_t *points,
+  uint64_t *out
+)
+{
+  return Hacl_EC_Ed25519_point_mul_multi(n, scalars, points, out);
+}
+
+/* SNIPPET_END: Hacl_Ristretto255_mul_multi_vartime */
+
@@ -0,0 +1,181 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#ifndef __Hacl_Ristretto255_H
+#define __Hacl_Ristretto255_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "Hacl_Krmllib.h"
+#include "Hacl_EC_Ed25519.h"
+
+/* SNIPPET_START: Hacl_Ristretto255_encode */
+
+/*******************************************************************************
+  The ristretto255 prime-order group (RFC 9496).
+
+  A group element is represented by any of the points of its class on edwards25519,
+  in extended homogeneous coordinates, i.e., uint64_t[20], exactly as the points of
+  Hacl_EC_Ed25519. The group law and scalar multiplication are therefore those of
+  Hacl_EC_Ed25519 (`point_add`, `point_negate`, `point_mul`, ...), while equality and
+  the byte encoding must use the functions below, which do not depend on the
+  representative.
+*******************************************************************************/
+
+
+/**
+Encode the group element `p` as 32 bytes in `out`.
+
+  The argument `p` is meant to be 20 limbs in size, i.e., uint64_t[20].
+  The outparam `out` is meant to be 32 bytes in size, i.e., uint8_t[32].
+
+  The function is constant-time in `p`.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • `p` and `out` are disjoint
+*/
+void Hacl_Ristretto255_encode(uint64_t *p, uint8_t *out);
+
+/* SNIPPET_END: Hacl_Ristretto255_encode */
+
+/* SNIPPET_START: Hacl_Ristretto255_decode */
+
+/**
+Decode 32 bytes `s` into a group element in `out`.
+
+  The function returns `true` if `s` is the canonical encoding of a group element and
+  `false` otherwise, in which case `out` holds an unspecified point.
+
+  The argument `s` is meant to be 32 bytes in size, i.e., uint8_t[32].
+  The outparam `out` is meant to be 20 limbs in size, i.e., uint64_t[20].
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • `s` and `out` are disjoint
+*/
+bool Hacl_Ristretto255_decode(uint8_t *s, uint64_t *out);
+
+/* SNIPPET_END: Hacl_Ristretto255_decode */
+
+/* SNIPPET_START: Hacl_Ristretto255_from_uniform_bytes */
+
+/**
+Map 64 uniformly random bytes `b` to a group element in `out` (the one-way map of
+RFC 9496, Section 4.3.4).
+
+  The argument `b` is meant to be 64 bytes in size, i.e., uint8_t[64], e.g., the
+  output of SHA-512 for hash-to-group.
+  The outparam `out` is meant to be 20 limbs in size, i.e., uint64_t[20].
+
+  The function is constant-time in `b`.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • `b` and `out` are disjoint
+*/
+void Hacl_Ristretto255_from_uniform_bytes(uint8_t *b, uint64_t *out);
+
+/* SNIPPET_END: Hacl_Ristretto255_from_uniform_bytes */
+
+/* SNIPPET_START: Hacl_Ristretto255_equal */
+
+/**
+Return `true` if `p` and `q` are the same group element, in constant time.
+
+  The arguments `p` and `q` are meant to be 20 limbs in size, i.e., uint64_t[20].
+*/
+bool Hacl_Ristretto255_equal(uint64_t *p, uint64_t *q);
+
+/* SNIPPET_END: Hacl_Ristretto255_equal */
+
+/* SNIPPET_START: Hacl_Ristretto255_double_and_encode_batch */
+
+/**
+Encode the doubles of `n` group elements with a single field inversion per 64
+elements: the i-th 32 bytes of `out` are `Hacl_Ristretto255_encode` of `p_i + p_i`.
+
+  The argument `p` points to `n` elements of 20 limbs each, i.e., uint64_t[20 * n].
+  The outparam `out` points to 32 * `n` bytes of valid memory, i.e., uint8_t[32 * n].
+
+  Encoding an element takes an inverse square root, which cannot be shared between
+  elements; encoding its double only takes an inversion, which can. A caller that
+  computes `[k]P` and wants it encoded in a batch computes `[k / 2 mod l]P` instead.
+  The function is constant-time in the elements.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • `p` and `out` are disjoint
+*/
+void Hacl_Ristretto255_double_and_encode_batch(uint32_t n, uint64_t *p, uint8_t *out);
+
+/* SNIPPET_END: Hacl_Ristretto255_double_and_encode_batch */
+
+/* SNIPPET_START: Hacl_Ristretto255_mul_multi_vartime */
+
+/**
+Write `[scalars[0]]points[0] + ... + [scalars[n - 1]]points[n - 1]` in `out`, in variable
+time (multi-scalar multiplication).
+
+  The function returns `false`, leaving `out` untouched, if memory cannot be allocated,
+  and `true` otherwise.
+
+  The argument `scalars` points to `n` little-endian scalars of 32 bytes each, i.e., uint8_t[32 * n].
+  The argument `points` points to `n` elements of 20 limbs each, i.e., uint64_t[20 * n].
+  The outparam `out` is meant to be 20 limbs in size, i.e., uint64_t[20].
+
+  This is `Hacl_EC_Ed25519_point_mul_multi`, which applies unchanged to group elements.
+  The running time depends on the scalars: use it only when they are public, e.g., when
+  verifying a proof.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • `out` is disjoint from `scalars` and `points`
+*/
+bool
+Hacl_Ristretto255_mul_multi_vartime(
+  uint32_t n,
+  uint8_t *scalars,
+  uint64_t *points,
+  uint64_t *out
+);
+
+/* SNIPPET_END: Hacl_Ristretto255_mul_multi_vartime */
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Ristretto255_H_DEFINED
+#endif
@@ -47,6 +47,16 @@ extern "C" {
 
 typedef uint8_t Spec_FFDHE_ffdhe_alg;
 
+/* SNIPPET_START: Spec_Agile_Cipher_cipher_alg */
+
+#define Spec_Agile_Cipher_AES128 0
+#define Spec_Agile_Cipher_AES256 1
+#define Spec_Agile_Cipher_CHACHA20 2
+
+/* SNIPPET_END: Spec_Agile_Cipher_cipher_alg */
+
+typedef uint8_t Spec_Agile_Cipher_cipher_alg;
+
 /* SNIPPET_START: Spec_Agile_AEAD_alg */
 
 #define Spec_Agile_AEAD_AES128_GCM 0
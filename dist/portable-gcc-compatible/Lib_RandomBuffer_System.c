@@ -58,6 +58,113 @@ bool Lib_RandomBuffer_System_randombytes(uint8_t *x, uint32_t len) {
   return read_random_bytes(len, x);
 }
 
+/* Per-thread reservoir in front of the OS generator.
+ *
+ * Each thread holds a ChaCha20 key seeded from the OS and a buffer of
+ * RESERVOIR_LEN bytes of keystream. A refill computes 32 + RESERVOIR_LEN bytes
+ * of keystream under the current key: the first 32 bytes replace the key
+ * (fast key erasure) and the rest fill the buffer. Bytes are zeroed as they are
+ * handed out, so neither past outputs nor past keys can be recovered from the
+ * state. A fork bumps a generation counter in the child, which forces every
+ * reservoir to reseed from the OS before its next use. */
+
+#include "Hacl_Chacha20.h"
+#include "lib_memzero0.h"
+
+#define RESERVOIR_LEN 4096U
+
+#if (defined(_WIN32) || defined(_WIN64))
+#define RESERVOIR_THREAD_LOCAL __declspec(thread)
+#else
+#include <pthread.h>
+#define RESERVOIR_THREAD_LOCAL _Thread_local
+#endif
+
+typedef struct {
+  uint8_t key[32U];
+  uint8_t buf[RESERVOIR_LEN];
+  uint32_t avail;
+  uint64_t generation;
+  bool seeded;
+} reservoir;
+
+static RESERVOIR_THREAD_LOCAL reservoir thread_reservoir;
+
+/* Written only in a freshly forked (hence single-threaded) child. */
+static uint64_t fork_generation = 0;
+
+static void reservoir_wipe(reservoir *r) {
+  Lib_Memzero0_memzero(r, 1U, reservoir, void *);
+}
+
+#if (defined(_WIN32) || defined(_WIN64))
+
+static void reservoir_register(void) {}
+
+#else
+
+static pthread_once_t reservoir_once = PTHREAD_ONCE_INIT;
+static pthread_key_t reservoir_key;
+
+static void reservoir_on_fork_child(void) { fork_generation++; }
+
+static void reservoir_on_thread_exit(void *r) { reservoir_wipe((reservoir *)r); }
+
+static void reservoir_init(void) {
+  pthread_key_create(&reservoir_key, reservoir_on_thread_exit);
+  pthread_atfork(NULL, NULL, reservoir_on_fork_child);
+}
+
+static void reservoir_register(void) {
+  pthread_once(&reservoir_once, reservoir_init);
+  pthread_setspecific(reservoir_key, &thread_reservoir);
+}
+
+#endif
+
+/* Writes len bytes of ChaCha20 keystream under r->key to out, after replacing
+ * r->key with the first 32 bytes of that keystream. */
+static void reservoir_stream(reservoir *r, uint8_t *out, uint32_t len) {
+  uint8_t nonce[12U] = { 0U };
+  uint8_t next[32U] = { 0U };
+  Hacl_Chacha20_chacha20_encrypt(32U, next, next, r->key, nonce, 0U);
+  memset(out, 0, len);
+  Hacl_Chacha20_chacha20_encrypt(len, out, out, r->key, nonce, 1U);
+  memcpy(r->key, next, 32U);
+  Lib_Memzero0_memzero(next, 32U, uint8_t, void *);
+}
+
+static void reservoir_seed(reservoir *r) {
+  if (!r->seeded) {
+    reservoir_register();
+  }
+  while (!read_random_bytes(32U, r->key)) {}
+  r->avail = 0U;
+  r->generation = fork_generation;
+  r->seeded = true;
+}
+
 void Lib_RandomBuffer_System_crypto_random(uint8_t *x, uint32_t len) {
-    while(!read_random_bytes(len, x)) {}
+  reservoir *r = &thread_reservoir;
+  if (!r->seeded || r->generation != fork_generation) {
+    reservoir_seed(r);
+  }
+  if (len > RESERVOIR_LEN) {
+    /* Large requests bypass the buffer. */
+    reservoir_stream(r, x, len);
+    return;
+  }
+  while (len > 0U) {
+    if (r->avail == 0U) {
+      reservoir_stream(r, r->buf, RESERVOIR_LEN);
+      r->avail = RESERVOIR_LEN;
+    }
+    uint32_t n = len < r->avail ? len : r->avail;
+    uint8_t *src = r->buf + RESERVOIR_LEN - r->avail;
+    memcpy(x, src, n);
+    Lib_Memzero0_memzero(src, n, uint8_t, void *);
+    r->avail -= n;
+    x += n;
+    len -= n;
+  }
 }
@@ -53,4 +53,29 @@ static inline bool has_vec256_not_avx2 () {
 #endif
 }
 
+// VAES (CPUID.(EAX=07H,ECX=0):ECX[bit 9]) is not covered by vale's CPUID support
+// either. The caller is responsible for also checking AVX-512 OS support.
+#if (TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_X64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__GNUC__) || defined(__clang__)
+#include <cpuid.h>
+#endif
+#endif
+
+static inline bool has_vaes_cpuid () {
+#if (TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_X64) && defined(_MSC_VER)
+  int r[4];
+  __cpuidex(r, 7, 0);
+  return ((r[2] >> 9) & 1) != 0;
+#elif (TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_X64) && (defined(__GNUC__) || defined(__clang__))
+  unsigned int eax, ebx, ecx, edx;
+  if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+    return ((ecx >> 9) & 1) != 0;
+  return false;
+#else
+  return false;
+#endif
+}
+
 #endif
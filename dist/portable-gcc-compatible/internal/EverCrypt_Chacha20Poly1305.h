@@ -0,0 +1,107 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __internal_EverCrypt_Chacha20Poly1305_H
+#define __internal_EverCrypt_Chacha20Poly1305_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "../EverCrypt_Chacha20Poly1305.h"
+
+/* SNIPPET_START: EverCrypt_Chacha20Poly1305_max_width */
+
+/**
+Widest ChaCha20-Poly1305 implementation (32, 128, 256 or 512 bits) that is both compiled in
+and supported by this CPU.
+*/
+uint32_t EverCrypt_Chacha20Poly1305_max_width(void);
+
+/* SNIPPET_END: EverCrypt_Chacha20Poly1305_max_width */
+
+/* SNIPPET_START: EverCrypt_Chacha20Poly1305_select_width */
+
+/**
+Width of the implementation to use for a `len`-byte message, given the widest one available,
+according to the thresholds set by `EverCrypt_Chacha20Poly1305_set_thresholds`.
+*/
+uint32_t EverCrypt_Chacha20Poly1305_select_width(uint32_t max_width, uint32_t len);
+
+/* SNIPPET_END: EverCrypt_Chacha20Poly1305_select_width */
+
+/* SNIPPET_START: EverCrypt_Chacha20Poly1305_encrypt_width */
+
+/**
+`EverCrypt_Chacha20Poly1305_aead_encrypt` with the implementation chosen by the caller, which
+must be at most `EverCrypt_Chacha20Poly1305_max_width ()`.
+*/
+void
+EverCrypt_Chacha20Poly1305_encrypt_width(
+  uint32_t width,
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *tag
+);
+
+/* SNIPPET_END: EverCrypt_Chacha20Poly1305_encrypt_width */
+
+/* SNIPPET_START: EverCrypt_Chacha20Poly1305_decrypt_width */
+
+/**
+`EverCrypt_Chacha20Poly1305_aead_decrypt` with the implementation chosen by the caller, which
+must be at most `EverCrypt_Chacha20Poly1305_max_width ()`.
+*/
+uint32_t
+EverCrypt_Chacha20Poly1305_decrypt_width(
+  uint32_t width,
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *tag
+);
+
+/* SNIPPET_END: EverCrypt_Chacha20Poly1305_decrypt_width */
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_EverCrypt_Chacha20Poly1305_H_DEFINED
+#endif
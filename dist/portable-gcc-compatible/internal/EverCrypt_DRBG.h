@@ -0,0 +1,122 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __internal_EverCrypt_DRBG_H
+#define __internal_EverCrypt_DRBG_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "internal/EverCrypt_HMAC.h"
+#include "../EverCrypt_DRBG.h"
+
+/* SNIPPET_START: EverCrypt_DRBG_instantiate_with_entropy */
+
+/**
+Instantiate the DRBG from caller-supplied entropy instead of the system source.
+
+@param st Pointer to a CTR_DRBG or ChaCha20 DRBG state.
+@param entropy Pointer to `entropy_len` bytes of entropy input.
+@param entropy_len Length of entropy input: exactly 48 bytes for CTR_DRBG, at least 32 for ChaCha20.
+@param personalization_string Pointer to `personalization_string_len` bytes of memory where personalization string is read from.
+@param personalization_string_len Length of personalization string.
+
+@return True if and only if instantiation was successful. Always false for HMAC_DRBG states.
+*/
+bool
+EverCrypt_DRBG_instantiate_with_entropy(
+  EverCrypt_DRBG_state_s *st,
+  uint8_t *entropy,
+  uint32_t entropy_len,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+);
+
+/* SNIPPET_END: EverCrypt_DRBG_instantiate_with_entropy */
+
+/* SNIPPET_START: EverCrypt_DRBG_reseed_with_entropy */
+
+/**
+Reseed the DRBG from caller-supplied entropy instead of the system source.
+
+@param st Pointer to a CTR_DRBG or ChaCha20 DRBG state.
+@param entropy Pointer to `entropy_len` bytes of entropy input.
+@param entropy_len Length of entropy input: exactly 48 bytes for CTR_DRBG, at least 32 for ChaCha20.
+@param additional_input Pointer to `additional_input_len` bytes of memory where additional input is read from.
+@param additional_input_len Length of additional input.
+
+@return True if and only if reseed was successful. Always false for HMAC_DRBG states.
+*/
+bool
+EverCrypt_DRBG_reseed_with_entropy(
+  EverCrypt_DRBG_state_s *st,
+  uint8_t *entropy,
+  uint32_t entropy_len,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+);
+
+/* SNIPPET_END: EverCrypt_DRBG_reseed_with_entropy */
+
+/* SNIPPET_START: EverCrypt_DRBG_generate_no_reseed */
+
+/**
+Generate output without drawing fresh entropy. `EverCrypt_DRBG_generate` is a reseed from
+the system source followed by this function.
+
+@param output Pointer to `n` bytes of memory where random output is written to.
+@param st Pointer to a CTR_DRBG or ChaCha20 DRBG state.
+@param n Length of desired output.
+@param additional_input Pointer to `additional_input_len` bytes of memory where additional input is read from.
+@param additional_input_len Length of additional input.
+
+@return True if and only if generate was successful. Always false for HMAC_DRBG states.
+  CTR_DRBG states fail once the reseed interval is reached, and reject `n` above
+  `EverCrypt_DRBG_max_output_length` or more than 48 bytes of additional input.
+  ChaCha20 states reject any additional input.
+*/
+bool
+EverCrypt_DRBG_generate_no_reseed(
+  uint8_t *output,
+  EverCrypt_DRBG_state_s *st,
+  uint32_t n,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+);
+
+/* SNIPPET_END: EverCrypt_DRBG_generate_no_reseed */
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_EverCrypt_DRBG_H_DEFINED
+#endif
@@ -67,6 +67,12 @@ void Hacl_Bignum25519_store_51(uint8_t *output, uint64_t *input);
 
 /* SNIPPET_END: Hacl_Bignum25519_store_51 */
 
+/* SNIPPET_START: Hacl_Bignum25519_sqrt_ratio_m1 */
+
+bool Hacl_Bignum25519_sqrt_ratio_m1(uint64_t *out, uint64_t *u, uint64_t *v);
+
+/* SNIPPET_END: Hacl_Bignum25519_sqrt_ratio_m1 */
+
 /* SNIPPET_START: Hacl_Impl_Ed25519_PointDouble_point_double */
 
 void Hacl_Impl_Ed25519_PointDouble_point_double(uint64_t *out, uint64_t *p);
@@ -115,6 +121,24 @@ void Hacl_Impl_Ed25519_Ladder_point_mul(uint64_t *out, uint8_t *scalar, uint64_t
 
 /* SNIPPET_END: Hacl_Impl_Ed25519_Ladder_point_mul */
 
+/* SNIPPET_START: Hacl_Impl_Ed25519_Ladder_point_mul_vartime */
+
+void Hacl_Impl_Ed25519_Ladder_point_mul_vartime(uint64_t *out, uint8_t *scalar, uint64_t *q);
+
+/* SNIPPET_END: Hacl_Impl_Ed25519_Ladder_point_mul_vartime */
+
+/* SNIPPET_START: Hacl_Impl_Ed25519_MultiScalarMul_point_mul_multi_vartime */
+
+bool
+Hacl_Impl_Ed25519_MultiScalarMul_point_mul_multi_vartime(
+  uint64_t *out,
+  uint32_t len,
+  uint64_t *scalars,
+  uint64_t *points
+);
+
+/* SNIPPET_END: Hacl_Impl_Ed25519_MultiScalarMul_point_mul_multi_vartime */
+
 #if defined(__cplusplus)
 }
 #endif
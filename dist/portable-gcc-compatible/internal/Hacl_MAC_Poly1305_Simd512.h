@@ -0,0 +1,95 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __internal_Hacl_MAC_Poly1305_Simd512_H
+#define __internal_Hacl_MAC_Poly1305_Simd512_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "../Hacl_MAC_Poly1305_Simd512.h"
+#include "libintvector.h"
+
+/* SNIPPET_START: Hacl_MAC_Poly1305_Simd512_load_acc8 */
+
+void Hacl_MAC_Poly1305_Simd512_load_acc8(Lib_IntVector_Intrinsics_vec512 *acc, uint8_t *b);
+
+/* SNIPPET_END: Hacl_MAC_Poly1305_Simd512_load_acc8 */
+
+/* SNIPPET_START: Hacl_MAC_Poly1305_Simd512_fmul_r8_normalize */
+
+void
+Hacl_MAC_Poly1305_Simd512_fmul_r8_normalize(
+  Lib_IntVector_Intrinsics_vec512 *out,
+  Lib_IntVector_Intrinsics_vec512 *p
+);
+
+/* SNIPPET_END: Hacl_MAC_Poly1305_Simd512_fmul_r8_normalize */
+
+/* SNIPPET_START: Hacl_MAC_Poly1305_Simd512_poly1305_init */
+
+void
+Hacl_MAC_Poly1305_Simd512_poly1305_init(Lib_IntVector_Intrinsics_vec512 *ctx, uint8_t *key);
+
+/* SNIPPET_END: Hacl_MAC_Poly1305_Simd512_poly1305_init */
+
+/* SNIPPET_START: Hacl_MAC_Poly1305_Simd512_poly1305_update_padded */
+
+/**
+Absorbs `len` bytes of `text`, zero-padding a trailing partial block to 16 bytes
+(the padding used by the ChaCha20-Poly1305 AEAD construction).
+*/
+void
+Hacl_MAC_Poly1305_Simd512_poly1305_update_padded(
+  Lib_IntVector_Intrinsics_vec512 *ctx,
+  uint32_t len,
+  uint8_t *text
+);
+
+/* SNIPPET_END: Hacl_MAC_Poly1305_Simd512_poly1305_update_padded */
+
+/* SNIPPET_START: Hacl_MAC_Poly1305_Simd512_poly1305_finish */
+
+void
+Hacl_MAC_Poly1305_Simd512_poly1305_finish(
+  uint8_t *tag,
+  uint8_t *key,
+  Lib_IntVector_Intrinsics_vec512 *ctx
+);
+
+/* SNIPPET_END: Hacl_MAC_Poly1305_Simd512_poly1305_finish */
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_MAC_Poly1305_Simd512_H_DEFINED
+#endif
@@ -0,0 +1,86 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __internal_Hacl_NaCl_H
+#define __internal_Hacl_NaCl_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "internal/Hacl_Krmllib.h"
+#include "../Hacl_NaCl.h"
+
+/* SNIPPET_START: Hacl_NaCl_secretbox_detached */
+
+/**
+XSalsa20-Poly1305 encryption behind every secretbox and box function of this module.
+
+@param vec Width of the Salsa20 and Poly1305 code: 256 and 128 select the 8-lane and 4-lane SIMD
+  implementations, which the caller must only request on CPUs that support them; any other value
+  selects the portable one.
+*/
+void
+Hacl_NaCl_secretbox_detached(
+  uint32_t vec,
+  uint32_t mlen,
+  uint8_t *c,
+  uint8_t *tag,
+  uint8_t *k,
+  uint8_t *n,
+  uint8_t *m
+);
+
+/* SNIPPET_END: Hacl_NaCl_secretbox_detached */
+
+/* SNIPPET_START: Hacl_NaCl_secretbox_open_detached */
+
+/**
+Decryption counterpart of `Hacl_NaCl_secretbox_detached`, taking the same `vec` argument.
+*/
+uint32_t
+Hacl_NaCl_secretbox_open_detached(
+  uint32_t vec,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *k,
+  uint8_t *n,
+  uint8_t *c,
+  uint8_t *tag
+);
+
+/* SNIPPET_END: Hacl_NaCl_secretbox_open_detached */
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_NaCl_H_DEFINED
+#endif
@@ -0,0 +1,21 @@
+#ifndef __EVERCRYPT_AEAD_ALGS_H
+#define __EVERCRYPT_AEAD_ALGS_H
+
+// AEAD algorithms that EverCrypt_AEAD implements in hand-written C, and that
+// therefore have no constructor in Spec.Agile.AEAD.alg. They extend the
+// Spec_Agile_AEAD_alg enumeration of Hacl_Spec.h, whose last value is
+// Spec_Agile_AEAD_AES256_CCM8 (6); the values must stay past the extracted ones.
+#define Spec_Agile_AEAD_AEGIS128L 7
+#define Spec_Agile_AEAD_AEGIS256 8
+#define Spec_Agile_AEAD_AES128_GCM_SIV 9
+#define Spec_Agile_AEAD_AES256_GCM_SIV 10
+
+// The matching implementations, in the numbering of Spec_Cipher_Expansion_impl
+// (internal/Hacl_Spec.h), whose last extracted value is
+// Spec_Cipher_Expansion_Vale_AES256 (2). Only EverCrypt_AEAD.c uses these.
+#define Spec_Cipher_Expansion_Hacl_AEGIS128L 3
+#define Spec_Cipher_Expansion_Hacl_AEGIS256 4
+#define Spec_Cipher_Expansion_Hacl_AES128_GCM_SIV 5
+#define Spec_Cipher_Expansion_Hacl_AES256_GCM_SIV 6
+
+#endif
@@ -0,0 +1,173 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 1000000
+#define SIZE 80
+
+typedef struct
+{
+  const char* name;
+  Spec_Agile_AEAD_alg alg;
+  uint32_t iv_len;
+} aead_alg;
+
+static aead_alg algs[] = {
+  { "AES-128-GCM", Spec_Agile_AEAD_AES128_GCM, 12 },
+  { "AES-256-GCM", Spec_Agile_AEAD_AES256_GCM, 12 },
+  { "ChaCha20-Poly1305", Spec_Agile_AEAD_CHACHA20_POLY1305, 12 },
+  { "AEGIS-128L", Spec_Agile_AEAD_AEGIS128L, 16 },
+  { "AEGIS-256", Spec_Agile_AEAD_AEGIS256, 32 },
+  { "AES-128-GCM-SIV", Spec_Agile_AEAD_AES128_GCM_SIV, 12 },
+  { "AES-256-GCM-SIV", Spec_Agile_AEAD_AES256_GCM_SIV, 12 },
+};
+
+static EverCrypt_AEAD_RecordCtx sender __attribute__((aligned(64)));
+static EverCrypt_AEAD_RecordCtx receiver __attribute__((aligned(64)));
+
+// The nonce of record `seq`, computed the way RFC 8446 describes it.
+static void
+tls13_nonce(uint8_t* nonce, uint8_t* iv, uint32_t iv_len, uint64_t seq)
+{
+  memcpy(nonce, iv, iv_len);
+  for (int i = 0; i < 8; i++)
+    nonce[iv_len - 1 - i] ^= (uint8_t)(seq >> (8 * i));
+}
+
+// Records sealed by the context must match EverCrypt_AEAD_encrypt with explicit
+// nonces, and must open in order on a second context.
+static bool
+check_alg(aead_alg* a)
+{
+  uint8_t key[32], iv[32], ad[13], plain[300], cipher[300], expected[300], dst[300];
+  uint8_t tag[16], expected_tag[16], nonce[32];
+  for (int i = 0; i < 32; i++) {
+    key[i] = (uint8_t)(3 * i + 1);
+    iv[i] = (uint8_t)(0x5c ^ (7 * i));
+  }
+  for (int i = 0; i < 13; i++)
+    ad[i] = (uint8_t)i;
+  for (int i = 0; i < 300; i++)
+    plain[i] = (uint8_t)(11 * i);
+
+  EverCrypt_AEAD_state_s* s = NULL;
+  if (EverCrypt_AEAD_create_in(a->alg, &s, key) != EverCrypt_Error_Success) {
+    printf("%s: unsupported on this CPU, skipping\n", a->name);
+    return true;
+  }
+  bool ok =
+    EverCrypt_AEAD_RecordCtx_init(&sender, a->alg, key, iv, a->iv_len) == EverCrypt_Error_Success;
+  ok &=
+    EverCrypt_AEAD_RecordCtx_init(&receiver, a->alg, key, iv, a->iv_len) == EverCrypt_Error_Success;
+  ok &= EverCrypt_AEAD_RecordCtx_init(&receiver, a->alg, key, iv, a->iv_len + 1) ==
+        EverCrypt_Error_InvalidIVLength;
+  EverCrypt_AEAD_RecordCtx_init(&receiver, a->alg, key, iv, a->iv_len);
+
+  // Jump over the low 32 bits to check that all 8 bytes of the counter are mixed in.
+  for (uint64_t seq = 0; seq < 600; seq++) {
+    if (seq == 300) {
+      sender.seq = 0x00000000fffffff0ULL;
+      receiver.seq = sender.seq;
+    }
+    uint32_t len = (uint32_t)(seq % 300);
+    tls13_nonce(nonce, iv, a->iv_len, sender.seq);
+    EverCrypt_AEAD_encrypt(s, nonce, a->iv_len, ad, 13, plain, len, expected, expected_tag);
+    ok &= EverCrypt_AEAD_RecordCtx_seal_next(&sender, ad, 13, plain, len, cipher, tag) ==
+          EverCrypt_Error_Success;
+    ok &= memcmp(cipher, expected, len) == 0 && memcmp(tag, expected_tag, 16) == 0;
+
+    // A forged record is rejected without consuming a sequence number.
+    if (len > 0 && seq % 7 == 0) {
+      uint64_t before = receiver.seq;
+      cipher[0] ^= 1;
+      ok &= EverCrypt_AEAD_RecordCtx_open_next(&receiver, ad, 13, cipher, len, tag, dst) ==
+            EverCrypt_Error_AuthenticationFailure;
+      ok &= receiver.seq == before;
+      cipher[0] ^= 1;
+    }
+    ok &= EverCrypt_AEAD_RecordCtx_open_next(&receiver, ad, 13, cipher, len, tag, dst) ==
+          EverCrypt_Error_Success;
+    ok &= memcmp(dst, plain, len) == 0;
+  }
+  ok &= sender.seq == receiver.seq;
+
+  // Sequence numbers do not wrap.
+  sender.seq = 0xffffffffffffffffULL;
+  ok &= EverCrypt_AEAD_RecordCtx_seal_next(&sender, ad, 13, plain, 16, cipher, tag) ==
+        EverCrypt_Error_MaximumLengthExceeded;
+  ok &= sender.seq == 0xffffffffffffffffULL;
+
+  EverCrypt_AEAD_free(s);
+  printf("%s record context: %s\n", a->name, ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static void
+bench(aead_alg* a)
+{
+  uint8_t key[32], iv[32], nonce[32], tag[16];
+  memset(key, 'K', 32);
+  memset(iv, 'I', 32);
+  static uint8_t plain[SIZE], ad[5];
+  EverCrypt_AEAD_state_s* s = NULL;
+  if (EverCrypt_AEAD_create_in(a->alg, &s, key) != EverCrypt_Error_Success)
+    return;
+  EverCrypt_AEAD_RecordCtx_init(&sender, a->alg, key, iv, a->iv_len);
+  uint64_t count = (uint64_t)ROUNDS * SIZE;
+  cycles c0, c1;
+  clock_t t1, t2;
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (uint64_t j = 0; j < ROUNDS; j++) {
+    tls13_nonce(nonce, iv, a->iv_len, j);
+    EverCrypt_AEAD_encrypt(s, nonce, a->iv_len, ad, 5, plain, SIZE, plain, tag);
+  }
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("%s EverCrypt_AEAD_encrypt (%d-byte records):\n", a->name, SIZE);
+  print_time(count, t2 - t1, c1 - c0);
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    EverCrypt_AEAD_RecordCtx_seal_next(&sender, ad, 5, plain, SIZE, plain, tag);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("%s EverCrypt_AEAD_RecordCtx_seal_next (%d-byte records):\n", a->name, SIZE);
+  print_time(count, t2 - t1, c1 - c0);
+  EverCrypt_AEAD_free(s);
+}
+
+int
+main()
+{
+  EverCrypt_AutoConfig2_init();
+  bool ok = true;
+  for (size_t i = 0; i < sizeof(algs) / sizeof(aead_alg); ++i)
+    ok &= check_alg(&algs[i]);
+
+  uint8_t key[32] = { 0 };
+  ok &= EverCrypt_AEAD_RecordCtx_init(&sender, Spec_Agile_AEAD_AES128_CCM, key, key, 12) ==
+        EverCrypt_Error_UnsupportedAlgorithm;
+  // The layout documented for EverCrypt_AEAD_RecordCtx_init: the header and a 16-byte IV
+  // take 32 bytes, and the expanded key starts right after them.
+  ok &= offsetof(EverCrypt_AEAD_RecordCtx, ek) == 32;
+
+  bench(&algs[0]);
+  bench(&algs[2]);
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
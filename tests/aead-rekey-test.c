@@ -0,0 +1,157 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 100000
+
+typedef struct
+{
+  const char* name;
+  Spec_Agile_AEAD_alg alg;
+  uint32_t iv_len;
+} aead_alg;
+
+static aead_alg algs[] = {
+  { "AES-128-GCM", Spec_Agile_AEAD_AES128_GCM, 12 },
+  { "AES-256-GCM", Spec_Agile_AEAD_AES256_GCM, 12 },
+  { "ChaCha20-Poly1305", Spec_Agile_AEAD_CHACHA20_POLY1305, 12 },
+  { "AEGIS-128L", Spec_Agile_AEAD_AEGIS128L, 16 },
+  { "AEGIS-256", Spec_Agile_AEAD_AEGIS256, 32 },
+  { "AES-128-GCM-SIV", Spec_Agile_AEAD_AES128_GCM_SIV, 12 },
+  { "AES-256-GCM-SIV", Spec_Agile_AEAD_AES256_GCM_SIV, 12 },
+};
+
+// Arena large enough for any algorithm, aligned as create_in_place requires.
+static union
+{
+  uint8_t bytes[1024];
+  uint64_t align[2];
+} arena __attribute__((aligned(16)));
+
+static void
+seal(EverCrypt_AEAD_state_s* s, aead_alg* a, uint8_t* cipher, uint8_t* tag)
+{
+  uint8_t iv[32], ad[20], plain[77];
+  for (int i = 0; i < 32; i++)
+    iv[i] = (uint8_t)(7 * i);
+  for (int i = 0; i < 20; i++)
+    ad[i] = (uint8_t)(3 * i + 1);
+  for (int i = 0; i < 77; i++)
+    plain[i] = (uint8_t)(13 * i + 5);
+  EverCrypt_AEAD_encrypt(s, iv, a->iv_len, ad, 20, plain, 77, cipher, tag);
+}
+
+// A state created with k1 and rekeyed to k2, and a state created in place with
+// k2, must both agree with a fresh heap state created with k2.
+static bool
+check_alg(aead_alg* a)
+{
+  uint8_t k1[32], k2[32];
+  for (int i = 0; i < 32; i++) {
+    k1[i] = (uint8_t)i;
+    k2[i] = (uint8_t)(0xa5 ^ (17 * i));
+  }
+  EverCrypt_AEAD_state_s* fresh = NULL;
+  if (EverCrypt_AEAD_create_in(a->alg, &fresh, k2) != EverCrypt_Error_Success) {
+    printf("%s: unsupported on this CPU, skipping\n", a->name);
+    return true;
+  }
+  uint8_t c0[77], t0[16], c1[77], t1[16], c2[77], t2[16];
+  seal(fresh, a, c0, t0);
+
+  EverCrypt_AEAD_state_s* s = NULL;
+  EverCrypt_AEAD_create_in(a->alg, &s, k1);
+  seal(s, a, c1, t1);
+  bool ok = memcmp(c0, c1, 77) != 0;
+  ok &= EverCrypt_AEAD_rekey(s, k2) == EverCrypt_Error_Success;
+  seal(s, a, c1, t1);
+  ok &= compare_and_print(77, c1, c0);
+  ok &= compare_and_print(16, t1, t0);
+
+  uint32_t size = EverCrypt_AEAD_state_size(a->alg);
+  ok &= size > 0 && size <= sizeof(arena.bytes);
+  ok &= EverCrypt_AEAD_create_in_place(arena.bytes, a->alg, k1) == EverCrypt_Error_Success;
+  EverCrypt_AEAD_state_s* p = (EverCrypt_AEAD_state_s*)arena.bytes;
+  ok &= EverCrypt_AEAD_alg_of_state(p) == a->alg;
+  ok &= EverCrypt_AEAD_rekey(p, k2) == EverCrypt_Error_Success;
+  seal(p, a, c2, t2);
+  ok &= compare_and_print(77, c2, c0);
+  ok &= compare_and_print(16, t2, t0);
+  ok &= EverCrypt_AEAD_create_in_place(arena.bytes, a->alg, k2) == EverCrypt_Error_Success;
+  seal(p, a, c2, t2);
+  ok &= memcmp(c2, c0, 77) == 0 && memcmp(t2, t0, 16) == 0;
+
+  EverCrypt_AEAD_free(s);
+  EverCrypt_AEAD_free(fresh);
+  printf("%s rekey and in-place state: %s\n", a->name, ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static void
+bench(aead_alg* a)
+{
+  uint8_t key[32];
+  memset(key, 'K', 32);
+  EverCrypt_AEAD_state_s* s = NULL;
+  if (EverCrypt_AEAD_create_in(a->alg, &s, key) != EverCrypt_Error_Success)
+    return;
+  EverCrypt_AEAD_free(s);
+  cycles c0, c1;
+  clock_t t1, t2;
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    key[0] = (uint8_t)j;
+    EverCrypt_AEAD_create_in(a->alg, &s, key);
+    EverCrypt_AEAD_free(s);
+  }
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("%s create_in + free:\n", a->name);
+  print_time(ROUNDS, t2 - t1, c1 - c0);
+
+  EverCrypt_AEAD_create_in_place(arena.bytes, a->alg, key);
+  s = (EverCrypt_AEAD_state_s*)arena.bytes;
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    key[0] = (uint8_t)j;
+    EverCrypt_AEAD_rekey(s, key);
+  }
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("%s rekey:\n", a->name);
+  print_time(ROUNDS, t2 - t1, c1 - c0);
+}
+
+int
+main()
+{
+  EverCrypt_AutoConfig2_init();
+  bool ok = true;
+  for (size_t i = 0; i < sizeof(algs) / sizeof(aead_alg); ++i)
+    ok &= check_alg(&algs[i]);
+
+  uint8_t key[32] = { 0 };
+  ok &= EverCrypt_AEAD_state_size(Spec_Agile_AEAD_AES128_CCM) == 0;
+  ok &= EverCrypt_AEAD_create_in_place(arena.bytes, Spec_Agile_AEAD_AES128_CCM, key) ==
+        EverCrypt_Error_UnsupportedAlgorithm;
+  ok &= EverCrypt_AEAD_rekey(NULL, key) == EverCrypt_Error_InvalidKey;
+
+  bench(&algs[0]);
+  bench(&algs[1]);
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,244 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 16384
+#define SIZE 16384
+#define BATCH 4
+#define PACKET 1024
+
+// Test vectors from draft-irtf-cfrg-aegis-aead (key and nonce are zero-padded
+// to 32 bytes for AEGIS-256).
+static uint8_t key[32] = { 0x10, 0x01 };
+static uint8_t nonce[32] = { 0x10, 0x00, 0x02 };
+static uint8_t ad[8] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 };
+
+static uint8_t c128l_zero[16] = { 0xc1, 0xc0, 0xe5, 0x8b, 0xd9, 0x13, 0x00, 0x6f,
+                                  0xeb, 0xa0, 0x0f, 0x4b, 0x3c, 0xc3, 0x59, 0x4e };
+static uint8_t t128l_zero[16] = { 0xab, 0xe0, 0xec, 0xe8, 0x0c, 0x24, 0x86, 0x8a,
+                                  0x22, 0x6a, 0x35, 0xd1, 0x6b, 0xda, 0xe3, 0x7a };
+static uint8_t t128l_empty[16] = { 0xc2, 0xb8, 0x79, 0xa6, 0x7d, 0xef, 0x9d, 0x74,
+                                   0xe6, 0xc1, 0x4f, 0x70, 0x8b, 0xbc, 0xc9, 0xb4 };
+static uint8_t c128l_ad[32] = { 0x79, 0xd9, 0x45, 0x93, 0xd8, 0xc2, 0x11, 0x9d,
+                                0x7e, 0x8f, 0xd9, 0xb8, 0xfc, 0x77, 0x84, 0x5c,
+                                0x5c, 0x07, 0x7a, 0x05, 0xb2, 0x52, 0x8b, 0x6a,
+                                0xc5, 0x4b, 0x56, 0x3a, 0xed, 0x8e, 0xfe, 0x84 };
+static uint8_t t128l_ad[16] = { 0xcc, 0x6f, 0x33, 0x72, 0xf6, 0xaa, 0x1b, 0xb8,
+                                0x23, 0x88, 0xd6, 0x95, 0xc3, 0x96, 0x2d, 0x9a };
+
+static uint8_t c256_zero[16] = { 0x75, 0x4f, 0xc3, 0xd8, 0xc9, 0x73, 0x24, 0x6d,
+                                 0xcc, 0x6d, 0x74, 0x14, 0x12, 0xa4, 0xb2, 0x36 };
+static uint8_t t256_zero[16] = { 0x3f, 0xe9, 0x19, 0x94, 0x76, 0x8b, 0x33, 0x2e,
+                                 0xd7, 0xf5, 0x70, 0xa1, 0x9e, 0xc5, 0x89, 0x6e };
+static uint8_t t256_empty[16] = { 0xe3, 0xde, 0xf9, 0x78, 0xa0, 0xf0, 0x54, 0xaf,
+                                  0xd1, 0xe7, 0x61, 0xd7, 0x55, 0x3a, 0xfb, 0xa3 };
+static uint8_t c256_ad[32] = { 0xf3, 0x73, 0x07, 0x9e, 0xd8, 0x4b, 0x27, 0x09,
+                               0xfa, 0xee, 0x37, 0x35, 0x84, 0x58, 0x5d, 0x60,
+                               0xac, 0xcd, 0x19, 0x1d, 0xb3, 0x10, 0xef, 0x5d,
+                               0x8b, 0x11, 0x83, 0x3d, 0xf9, 0xde, 0xc7, 0x11 };
+static uint8_t t256_ad[16] = { 0x8d, 0x86, 0xf9, 0x1e, 0xe6, 0x06, 0xe9, 0xff,
+                               0x26, 0xa0, 0x1b, 0x64, 0xcc, 0xbd, 0xd9, 0x1d };
+
+static void
+fill(uint8_t* b, int len, uint8_t seed)
+{
+  for (int i = 0; i < len; i++)
+    b[i] = (uint8_t)(seed + 7 * i);
+}
+
+static bool
+check_vector(EverCrypt_AEAD_state_s* s,
+             uint32_t iv_len,
+             uint32_t ad_len,
+             uint32_t len,
+             uint8_t* exp_cipher,
+             uint8_t* exp_tag)
+{
+  uint8_t plain[32], cipher[32], tag[16], dec[32];
+  for (uint32_t i = 0; i < 32; i++)
+    plain[i] = len == 16 ? 0 : (uint8_t)i;
+  bool ok = EverCrypt_AEAD_encrypt(s, nonce, iv_len, ad, ad_len, plain, len, cipher, tag) ==
+            EverCrypt_Error_Success;
+  ok &= compare_and_print(len, cipher, exp_cipher);
+  ok &= compare_and_print(16, tag, exp_tag);
+  ok &= EverCrypt_AEAD_decrypt(s, nonce, iv_len, ad, ad_len, cipher, len, tag, dec) ==
+        EverCrypt_Error_Success;
+  ok &= memcmp(dec, plain, len) == 0;
+  // Any flipped tag bit must be rejected.
+  tag[15] ^= 0x80;
+  ok &= EverCrypt_AEAD_decrypt(s, nonce, iv_len, ad, ad_len, cipher, len, tag, dec) ==
+        EverCrypt_Error_AuthenticationFailure;
+  return ok;
+}
+
+static bool
+test_vectors(Spec_Agile_AEAD_alg a)
+{
+  EverCrypt_AEAD_state_s* s = NULL;
+  if (EverCrypt_AEAD_create_in(a, &s, key) != EverCrypt_Error_Success) {
+    printf("AEGIS: unsupported on this CPU, skipping\n");
+    return true;
+  }
+  bool is128l = a == Spec_Agile_AEAD_AEGIS128L;
+  uint32_t iv_len = is128l ? 16U : 32U;
+  bool ok = true;
+  ok &= check_vector(s, iv_len, 0, 16, is128l ? c128l_zero : c256_zero,
+                     is128l ? t128l_zero : t256_zero);
+  ok &= check_vector(s, iv_len, 0, 0, NULL, is128l ? t128l_empty : t256_empty);
+  ok &= check_vector(s, iv_len, 8, 32, is128l ? c128l_ad : c256_ad,
+                     is128l ? t128l_ad : t256_ad);
+  uint8_t tag[16];
+  ok &= EverCrypt_AEAD_encrypt(s, nonce, 12, ad, 0, NULL, 0, NULL, tag) ==
+        EverCrypt_Error_InvalidIVLength;
+  EverCrypt_AEAD_free(s);
+  printf("%s vectors: %s\n", is128l ? "AEGIS-128L" : "AEGIS-256", ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+// Batches of every size up to 7 with mixed lengths (including partial blocks
+// and empty messages) must agree with the single-packet functions.
+static bool
+test_batch(Spec_Agile_AEAD_alg a)
+{
+  static const uint32_t msg_lens[] = { 0, 1, 15, 16, 31, 32, 33, 100, 255, 1000 };
+  static const uint32_t ad_lens[] = { 0, 3, 16, 17, 40 };
+  bool is128l = a == Spec_Agile_AEAD_AEGIS128L;
+  uint8_t keys[7][32], nonces[7][32], ads[7][64], ins[7][1024], outs[7][1024], tags[7][16];
+  uint8_t exp[7][1024], exp_tags[7][16], decs[7][1024];
+  Hacl_AEAD_AEGIS_NI_packet p[7];
+  bool ok = true;
+  for (uint32_t n = 1; n <= 7; n++) {
+    for (uint32_t j = 0; j < n; j++) {
+      uint32_t len = msg_lens[(n * 3 + j) % 10];
+      uint32_t ad_len = ad_lens[(n + j) % 5];
+      fill(keys[j], 32, (uint8_t)(n + j));
+      fill(nonces[j], 32, (uint8_t)(2 * n + j));
+      fill(ads[j], 64, (uint8_t)(3 * n + j));
+      fill(ins[j], 1024, (uint8_t)(4 * n + j));
+      p[j] = (Hacl_AEAD_AEGIS_NI_packet){ keys[j], nonces[j], ads[j], ad_len,
+                                          ins[j], len, outs[j], tags[j] };
+      if (is128l)
+        Hacl_AEAD_AEGIS_NI_aegis128l_encrypt(
+          exp[j], exp_tags[j], ins[j], len, ads[j], ad_len, keys[j], nonces[j]);
+      else
+        Hacl_AEAD_AEGIS_NI_aegis256_encrypt(
+          exp[j], exp_tags[j], ins[j], len, ads[j], ad_len, keys[j], nonces[j]);
+    }
+    ok &= EverCrypt_AEAD_aegis_encrypt_batch(a, n, p) == EverCrypt_Error_Success;
+    for (uint32_t j = 0; j < n; j++) {
+      ok &= memcmp(outs[j], exp[j], p[j].input_len) == 0;
+      ok &= memcmp(tags[j], exp_tags[j], 16) == 0;
+      p[j].input = outs[j];
+      p[j].output = decs[j];
+    }
+    // Corrupt the last packet's tag: only that packet must fail.
+    tags[n - 1][0] ^= 1;
+    uint32_t res[7];
+    ok &= EverCrypt_AEAD_aegis_decrypt_batch(a, n, p, res) ==
+          EverCrypt_Error_AuthenticationFailure;
+    for (uint32_t j = 0; j < n; j++) {
+      if (j == n - 1)
+        ok &= res[j] == 1U;
+      else
+        ok &= res[j] == 0U && memcmp(decs[j], ins[j], p[j].input_len) == 0;
+    }
+  }
+  printf("%s batch: %s\n", is128l ? "AEGIS-128L" : "AEGIS-256", ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static void
+bench(const char* name, Spec_Agile_AEAD_alg a, uint32_t iv_len)
+{
+  EverCrypt_AEAD_state_s* s = NULL;
+  if (EverCrypt_AEAD_create_in(a, &s, key) != EverCrypt_Error_Success)
+    return;
+  static uint8_t plain[SIZE];
+  uint8_t tag[16];
+  memset(plain, 'P', SIZE);
+  uint64_t count = ROUNDS * SIZE;
+  cycles c0, c1;
+  clock_t t1, t2;
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    EverCrypt_AEAD_encrypt(s, nonce, iv_len, ad, 8, plain, SIZE, plain, tag);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("EverCrypt %s:\n", name);
+  print_time(count, t2 - t1, c1 - c0);
+  EverCrypt_AEAD_free(s);
+}
+
+static void
+bench_batch(void)
+{
+  static uint8_t bufs[BATCH][PACKET];
+  uint8_t tags[BATCH][16];
+  Hacl_AEAD_AEGIS_NI_packet p[BATCH];
+  for (int j = 0; j < BATCH; j++)
+    p[j] = (Hacl_AEAD_AEGIS_NI_packet){ key, nonce, ad, 8, bufs[j], PACKET, bufs[j], tags[j] };
+  if (EverCrypt_AEAD_aegis_encrypt_batch(Spec_Agile_AEAD_AEGIS128L, BATCH, p) !=
+      EverCrypt_Error_Success)
+    return;
+  uint64_t count = (uint64_t)ROUNDS * BATCH * PACKET;
+  cycles c0, c1;
+  clock_t t1, t2;
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    for (int i = 0; i < BATCH; i++)
+      Hacl_AEAD_AEGIS_NI_aegis128l_encrypt(bufs[i], tags[i], bufs[i], PACKET, ad, 8, key, nonce);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("AEGIS-128L %d x %d bytes, one packet at a time:\n", BATCH, PACKET);
+  print_time(count, t2 - t1, c1 - c0);
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    EverCrypt_AEAD_aegis_encrypt_batch(Spec_Agile_AEAD_AEGIS128L, BATCH, p);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("AEGIS-128L %d x %d bytes, batched:\n", BATCH, PACKET);
+  print_time(count, t2 - t1, c1 - c0);
+}
+
+int
+main()
+{
+  EverCrypt_AutoConfig2_init();
+  if (!EverCrypt_AutoConfig2_has_aesni()) {
+    printf("AEGIS: no AES-NI on this CPU, skipping\n");
+    return EXIT_SUCCESS;
+  }
+  bool ok = true;
+  ok &= test_vectors(Spec_Agile_AEAD_AEGIS128L);
+  ok &= test_vectors(Spec_Agile_AEAD_AEGIS256);
+  ok &= test_batch(Spec_Agile_AEAD_AEGIS128L);
+  ok &= test_batch(Spec_Agile_AEAD_AEGIS256);
+  if (EverCrypt_AutoConfig2_has_vaes()) {
+    // Same batches again through the AES-NI fallback.
+    EverCrypt_AutoConfig2_disable_vaes();
+    ok &= test_batch(Spec_Agile_AEAD_AEGIS128L);
+    ok &= test_batch(Spec_Agile_AEAD_AEGIS256);
+    EverCrypt_AutoConfig2_init();
+  }
+
+  bench("AEGIS-128L", Spec_Agile_AEAD_AEGIS128L, 16);
+  bench("AEGIS-256", Spec_Agile_AEAD_AEGIS256, 32);
+  bench("AES-128-GCM", Spec_Agile_AEAD_AES128_GCM, 12);
+  bench_batch();
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,179 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "aes_gcm_siv_vectors.h"
+#include "test_helpers.h"
+
+#define ROUNDS 16384
+#define SIZE 16384
+
+static Spec_Agile_AEAD_alg
+alg_of_key_len(size_t key_len)
+{
+  return key_len == 16 ? Spec_Agile_AEAD_AES128_GCM_SIV : Spec_Agile_AEAD_AES256_GCM_SIV;
+}
+
+static bool
+check_vector(aes_gcm_siv_test_vector* v)
+{
+  EverCrypt_AEAD_state_s* s = NULL;
+  EverCrypt_AEAD_create_in(alg_of_key_len(v->key_len), &s, v->key);
+  uint32_t len = (uint32_t)v->input_len;
+  uint8_t cipher[len + 1], plain[len + 1], tag[16];
+  bool ok = EverCrypt_AEAD_encrypt(s,
+                                   v->nonce,
+                                   12,
+                                   v->aad,
+                                   (uint32_t)v->aad_len,
+                                   v->input,
+                                   len,
+                                   cipher,
+                                   tag) == EverCrypt_Error_Success;
+  ok &= compare_and_print(len, cipher, v->cipher);
+  ok &= compare_and_print(16, tag, v->tag);
+  ok &= EverCrypt_AEAD_decrypt(
+          s, v->nonce, 12, v->aad, (uint32_t)v->aad_len, cipher, len, tag, plain) ==
+        EverCrypt_Error_Success;
+  ok &= memcmp(plain, v->input, len) == 0;
+
+  // The one-shot variants expand the key on the stack.
+  ok &= EverCrypt_AEAD_encrypt_expand(alg_of_key_len(v->key_len),
+                                      v->key,
+                                      v->nonce,
+                                      12,
+                                      v->aad,
+                                      (uint32_t)v->aad_len,
+                                      v->input,
+                                      len,
+                                      cipher,
+                                      tag) == EverCrypt_Error_Success;
+  ok &= memcmp(cipher, v->cipher, len) == 0 && memcmp(tag, v->tag, 16) == 0;
+  ok &= EverCrypt_AEAD_decrypt_expand(alg_of_key_len(v->key_len),
+                                      v->key,
+                                      v->nonce,
+                                      12,
+                                      v->aad,
+                                      (uint32_t)v->aad_len,
+                                      cipher,
+                                      len,
+                                      tag,
+                                      plain) == EverCrypt_Error_Success;
+  ok &= memcmp(plain, v->input, len) == 0;
+
+  // A forged tag is rejected and no plaintext is released.
+  tag[0] ^= 1;
+  ok &= EverCrypt_AEAD_decrypt(
+          s, v->nonce, 12, v->aad, (uint32_t)v->aad_len, cipher, len, tag, plain) ==
+        EverCrypt_Error_AuthenticationFailure;
+  for (uint32_t i = 0; i < len; i++)
+    ok &= plain[i] == 0;
+  EverCrypt_AEAD_free(s);
+  return ok;
+}
+
+// In-place round trips across the 8-block boundaries, with the last byte of
+// the ciphertext flipped to check rejection.
+static bool
+test_round_trip(Spec_Agile_AEAD_alg a)
+{
+  uint8_t key[32], nonce[12], ad[100], buf[1200], orig[1200], tag[16];
+  for (int i = 0; i < 32; i++)
+    key[i] = (uint8_t)(5 * i + 1);
+  for (int i = 0; i < 12; i++)
+    nonce[i] = (uint8_t)(9 * i);
+  for (int i = 0; i < 100; i++)
+    ad[i] = (uint8_t)(3 * i);
+  for (int i = 0; i < 1200; i++)
+    orig[i] = (uint8_t)(11 * i + 7);
+  EverCrypt_AEAD_state_s* s = NULL;
+  EverCrypt_AEAD_create_in(a, &s, key);
+  bool ok = true;
+  for (uint32_t len = 0; len < 1200; len += 37) {
+    uint32_t ad_len = len % 100;
+    memcpy(buf, orig, len);
+    EverCrypt_AEAD_encrypt(s, nonce, 12, ad, ad_len, buf, len, buf, tag);
+    ok &= EverCrypt_AEAD_decrypt(s, nonce, 12, ad, ad_len, buf, len, tag, buf) ==
+          EverCrypt_Error_Success;
+    ok &= memcmp(buf, orig, len) == 0;
+    if (len > 0) {
+      EverCrypt_AEAD_encrypt(s, nonce, 12, ad, ad_len, buf, len, buf, tag);
+      buf[len - 1] ^= 0x80;
+      ok &= EverCrypt_AEAD_decrypt(s, nonce, 12, ad, ad_len, buf, len, tag, buf) ==
+            EverCrypt_Error_AuthenticationFailure;
+    }
+  }
+  ok &= EverCrypt_AEAD_encrypt(s, nonce, 16, ad, 0, buf, 0, buf, tag) ==
+        EverCrypt_Error_InvalidIVLength;
+  EverCrypt_AEAD_free(s);
+  printf("AES-%d-GCM-SIV round trips: %s\n",
+         a == Spec_Agile_AEAD_AES128_GCM_SIV ? 128 : 256,
+         ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static void
+bench(const char* name, Spec_Agile_AEAD_alg a, bool decrypt)
+{
+  uint8_t key[32], nonce[12], tag[16];
+  memset(key, 'K', 32);
+  memset(nonce, 'N', 12);
+  EverCrypt_AEAD_state_s* s = NULL;
+  if (EverCrypt_AEAD_create_in(a, &s, key) != EverCrypt_Error_Success)
+    return;
+  static uint8_t plain[SIZE];
+  memset(plain, 'P', SIZE);
+  EverCrypt_AEAD_encrypt(s, nonce, 12, NULL, 0, plain, SIZE, plain, tag);
+  uint64_t count = ROUNDS * SIZE;
+  cycles c0, c1;
+  clock_t t1, t2;
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    if (decrypt)
+      EverCrypt_AEAD_decrypt(s, nonce, 12, NULL, 0, plain, SIZE, tag, plain);
+    else
+      EverCrypt_AEAD_encrypt(s, nonce, 12, NULL, 0, plain, SIZE, plain, tag);
+  }
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("EverCrypt %s:\n", name);
+  print_time(count, t2 - t1, c1 - c0);
+  EverCrypt_AEAD_free(s);
+}
+
+int
+main()
+{
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_AEAD_state_s* s = NULL;
+  uint8_t key[16] = { 0 };
+  if (EverCrypt_AEAD_create_in(Spec_Agile_AEAD_AES128_GCM_SIV, &s, key) !=
+      EverCrypt_Error_Success) {
+    printf("AES-GCM-SIV: unsupported on this CPU, skipping\n");
+    return EXIT_SUCCESS;
+  }
+  EverCrypt_AEAD_free(s);
+
+  bool ok = true;
+  for (size_t i = 0; i < sizeof(vectors) / sizeof(aes_gcm_siv_test_vector); ++i)
+    ok &= check_vector(&vectors[i]);
+  ok &= test_round_trip(Spec_Agile_AEAD_AES128_GCM_SIV);
+  ok &= test_round_trip(Spec_Agile_AEAD_AES256_GCM_SIV);
+
+  bench("AES-128-GCM-SIV encrypt", Spec_Agile_AEAD_AES128_GCM_SIV, false);
+  bench("AES-128-GCM-SIV decrypt", Spec_Agile_AEAD_AES128_GCM_SIV, true);
+  bench("AES-256-GCM-SIV encrypt", Spec_Agile_AEAD_AES256_GCM_SIV, false);
+  bench("AES-128-GCM encrypt", Spec_Agile_AEAD_AES128_GCM, false);
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
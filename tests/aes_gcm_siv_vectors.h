@@ -0,0 +1,619 @@
+#pragma once
+
+typedef struct
+{
+  uint8_t* key;
+  size_t key_len;
+  uint8_t nonce[12];
+  uint8_t* aad;
+  size_t aad_len;
+  uint8_t* input;
+  size_t input_len;
+  uint8_t* cipher;
+  uint8_t tag[16];
+} aes_gcm_siv_test_vector;
+
+static uint8_t key1[16] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t key2[16] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t input2[8] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t cipher2[8] = {
+  0xb5, 0xd8, 0x39, 0x33, 0x0a, 0xc7, 0xb7, 0x86
+};
+
+static uint8_t key3[16] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t input3[16] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t cipher3[16] = {
+  0x74, 0x3f, 0x7c, 0x80, 0x77, 0xab, 0x25, 0xf8, 0x62, 0x4e, 0x2e, 0x94,
+  0x85, 0x79, 0xcf, 0x77
+};
+
+static uint8_t key4[16] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t input4[64] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t cipher4[64] = {
+  0x24, 0x33, 0x66, 0x8f, 0x10, 0x58, 0x19, 0x0f, 0x6d, 0x43, 0xe3, 0x60,
+  0xf4, 0xf3, 0x5c, 0xd8, 0xe4, 0x75, 0x12, 0x7c, 0xfc, 0xa7, 0x02, 0x8e,
+  0xa8, 0xab, 0x5c, 0x20, 0xf7, 0xab, 0x2a, 0xf0, 0x25, 0x16, 0xa2, 0xbd,
+  0xcb, 0xc0, 0x8d, 0x52, 0x1b, 0xe3, 0x7f, 0xf2, 0x8c, 0x15, 0x2b, 0xba,
+  0x36, 0x69, 0x7f, 0x25, 0xb4, 0xcd, 0x16, 0x9c, 0x65, 0x90, 0xd1, 0xdd,
+  0x39, 0x56, 0x6d, 0x3f
+};
+
+static uint8_t key5[16] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t aad5[1] = {
+  0x01
+};
+
+static uint8_t input5[8] = {
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t cipher5[8] = {
+  0x1e, 0x6d, 0xab, 0xa3, 0x56, 0x69, 0xf4, 0x27
+};
+
+static uint8_t key6[16] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t aad6[1] = {
+  0x01
+};
+
+static uint8_t input6[32] = {
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t cipher6[32] = {
+  0x62, 0x00, 0x48, 0xef, 0x3c, 0x1e, 0x73, 0xe5, 0x7e, 0x02, 0xbb, 0x85,
+  0x62, 0xc4, 0x16, 0xa3, 0x19, 0xe7, 0x3e, 0x4c, 0xaa, 0xc8, 0xe9, 0x6a,
+  0x1e, 0xcb, 0x29, 0x33, 0x14, 0x5a, 0x1d, 0x71
+};
+
+static uint8_t key7[16] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t aad7[12] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t input7[4] = {
+  0x02, 0x00, 0x00, 0x00
+};
+
+static uint8_t cipher7[4] = {
+  0xa8, 0xfe, 0x3e, 0x87
+};
+
+static uint8_t key8[32] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t key9[32] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t input9[8] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t cipher9[8] = {
+  0xc2, 0xef, 0x32, 0x8e, 0x5c, 0x71, 0xc8, 0x3b
+};
+
+static uint8_t key10[32] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t input10[16] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t cipher10[16] = {
+  0x85, 0xa0, 0x1b, 0x63, 0x02, 0x5b, 0xa1, 0x9b, 0x7f, 0xd3, 0xdd, 0xfc,
+  0x03, 0x3b, 0x3e, 0x76
+};
+
+static uint8_t key11[32] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t input11[64] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t cipher11[64] = {
+  0xc2, 0xd5, 0x16, 0x0a, 0x1f, 0x86, 0x83, 0x83, 0x49, 0x10, 0xac, 0xda,
+  0xfc, 0x41, 0xfb, 0xb1, 0x63, 0x2d, 0x4a, 0x35, 0x3e, 0x8b, 0x90, 0x5e,
+  0xc9, 0xa5, 0x49, 0x9a, 0xc3, 0x4f, 0x96, 0xc7, 0xe1, 0x04, 0x9e, 0xb0,
+  0x80, 0x88, 0x38, 0x91, 0xa4, 0xdb, 0x8c, 0xaa, 0xa1, 0xf9, 0x9d, 0xd0,
+  0x04, 0xd8, 0x04, 0x87, 0x54, 0x07, 0x35, 0x23, 0x4e, 0x37, 0x44, 0x51,
+  0x2c, 0x6f, 0x90, 0xce
+};
+
+static uint8_t key12[32] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t aad12[1] = {
+  0x01
+};
+
+static uint8_t input12[8] = {
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t cipher12[8] = {
+  0x1d, 0xe2, 0x29, 0x67, 0x23, 0x7a, 0x81, 0x32
+};
+
+static uint8_t key13[32] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t aad13[1] = {
+  0x01
+};
+
+static uint8_t input13[32] = {
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t cipher13[32] = {
+  0x07, 0xda, 0xd3, 0x64, 0xbf, 0xc2, 0xb9, 0xda, 0x89, 0x11, 0x6d, 0x7b,
+  0xef, 0x6d, 0xaa, 0xaf, 0x6f, 0x25, 0x55, 0x10, 0xaa, 0x65, 0x4f, 0x92,
+  0x0a, 0xc8, 0x1b, 0x94, 0xe8, 0xba, 0xd3, 0x65
+};
+
+static uint8_t key14[32] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t aad14[12] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t input14[4] = {
+  0x02, 0x00, 0x00, 0x00
+};
+
+static uint8_t cipher14[4] = {
+  0x22, 0xb3, 0xf4, 0xcd
+};
+
+static uint8_t key15[32] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t input15[32] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4d, 0xb9, 0x23, 0xdc, 0x79, 0x3e, 0xe6, 0x49,
+  0x7c, 0x76, 0xdc, 0xc0, 0x3a, 0x98, 0xe1, 0x08
+};
+
+static uint8_t cipher15[32] = {
+  0xf3, 0xf8, 0x0f, 0x2c, 0xf0, 0xcb, 0x2d, 0xd9, 0xc5, 0x98, 0x4f, 0xcd,
+  0xa9, 0x08, 0x45, 0x6c, 0xc5, 0x37, 0x70, 0x3b, 0x5b, 0xa7, 0x03, 0x24,
+  0xa6, 0x79, 0x3a, 0x7b, 0xf2, 0x18, 0xd3, 0xea
+};
+
+static uint8_t key16[32] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t input16[24] = {
+  0xeb, 0x36, 0x40, 0x27, 0x7c, 0x7f, 0xfd, 0x13, 0x03, 0xc7, 0xa5, 0x42,
+  0xd0, 0x2d, 0x3e, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static uint8_t cipher16[24] = {
+  0x18, 0xce, 0x4f, 0x0b, 0x8c, 0xb4, 0xd0, 0xca, 0xc6, 0x5f, 0xea, 0x8f,
+  0x79, 0x25, 0x7b, 0x20, 0x88, 0x8e, 0x53, 0xe7, 0x22, 0x99, 0xe5, 0x6d
+};
+
+static uint8_t key17[16] = {
+  0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b,
+  0x4c, 0x4d, 0x4e, 0x4f
+};
+
+static uint8_t aad17[70] = {
+  0x01, 0x08, 0x0f, 0x16, 0x1d, 0x24, 0x2b, 0x32, 0x39, 0x40, 0x47, 0x4e,
+  0x55, 0x5c, 0x63, 0x6a, 0x71, 0x78, 0x7f, 0x86, 0x8d, 0x94, 0x9b, 0xa2,
+  0xa9, 0xb0, 0xb7, 0xbe, 0xc5, 0xcc, 0xd3, 0xda, 0xe1, 0xe8, 0xef, 0xf6,
+  0xfd, 0x04, 0x0b, 0x12, 0x19, 0x20, 0x27, 0x2e, 0x35, 0x3c, 0x43, 0x4a,
+  0x51, 0x58, 0x5f, 0x66, 0x6d, 0x74, 0x7b, 0x82, 0x89, 0x90, 0x97, 0x9e,
+  0xa5, 0xac, 0xb3, 0xba, 0xc1, 0xc8, 0xcf, 0xd6, 0xdd, 0xe4
+};
+
+static uint8_t input17[300] = {
+  0x05, 0x12, 0x1f, 0x2c, 0x39, 0x46, 0x53, 0x60, 0x6d, 0x7a, 0x87, 0x94,
+  0xa1, 0xae, 0xbb, 0xc8, 0xd5, 0xe2, 0xef, 0xfc, 0x09, 0x16, 0x23, 0x30,
+  0x3d, 0x4a, 0x57, 0x64, 0x71, 0x7e, 0x8b, 0x98, 0xa5, 0xb2, 0xbf, 0xcc,
+  0xd9, 0xe6, 0xf3, 0x00, 0x0d, 0x1a, 0x27, 0x34, 0x41, 0x4e, 0x5b, 0x68,
+  0x75, 0x82, 0x8f, 0x9c, 0xa9, 0xb6, 0xc3, 0xd0, 0xdd, 0xea, 0xf7, 0x04,
+  0x11, 0x1e, 0x2b, 0x38, 0x45, 0x52, 0x5f, 0x6c, 0x79, 0x86, 0x93, 0xa0,
+  0xad, 0xba, 0xc7, 0xd4, 0xe1, 0xee, 0xfb, 0x08, 0x15, 0x22, 0x2f, 0x3c,
+  0x49, 0x56, 0x63, 0x70, 0x7d, 0x8a, 0x97, 0xa4, 0xb1, 0xbe, 0xcb, 0xd8,
+  0xe5, 0xf2, 0xff, 0x0c, 0x19, 0x26, 0x33, 0x40, 0x4d, 0x5a, 0x67, 0x74,
+  0x81, 0x8e, 0x9b, 0xa8, 0xb5, 0xc2, 0xcf, 0xdc, 0xe9, 0xf6, 0x03, 0x10,
+  0x1d, 0x2a, 0x37, 0x44, 0x51, 0x5e, 0x6b, 0x78, 0x85, 0x92, 0x9f, 0xac,
+  0xb9, 0xc6, 0xd3, 0xe0, 0xed, 0xfa, 0x07, 0x14, 0x21, 0x2e, 0x3b, 0x48,
+  0x55, 0x62, 0x6f, 0x7c, 0x89, 0x96, 0xa3, 0xb0, 0xbd, 0xca, 0xd7, 0xe4,
+  0xf1, 0xfe, 0x0b, 0x18, 0x25, 0x32, 0x3f, 0x4c, 0x59, 0x66, 0x73, 0x80,
+  0x8d, 0x9a, 0xa7, 0xb4, 0xc1, 0xce, 0xdb, 0xe8, 0xf5, 0x02, 0x0f, 0x1c,
+  0x29, 0x36, 0x43, 0x50, 0x5d, 0x6a, 0x77, 0x84, 0x91, 0x9e, 0xab, 0xb8,
+  0xc5, 0xd2, 0xdf, 0xec, 0xf9, 0x06, 0x13, 0x20, 0x2d, 0x3a, 0x47, 0x54,
+  0x61, 0x6e, 0x7b, 0x88, 0x95, 0xa2, 0xaf, 0xbc, 0xc9, 0xd6, 0xe3, 0xf0,
+  0xfd, 0x0a, 0x17, 0x24, 0x31, 0x3e, 0x4b, 0x58, 0x65, 0x72, 0x7f, 0x8c,
+  0x99, 0xa6, 0xb3, 0xc0, 0xcd, 0xda, 0xe7, 0xf4, 0x01, 0x0e, 0x1b, 0x28,
+  0x35, 0x42, 0x4f, 0x5c, 0x69, 0x76, 0x83, 0x90, 0x9d, 0xaa, 0xb7, 0xc4,
+  0xd1, 0xde, 0xeb, 0xf8, 0x05, 0x12, 0x1f, 0x2c, 0x39, 0x46, 0x53, 0x60,
+  0x6d, 0x7a, 0x87, 0x94, 0xa1, 0xae, 0xbb, 0xc8, 0xd5, 0xe2, 0xef, 0xfc,
+  0x09, 0x16, 0x23, 0x30, 0x3d, 0x4a, 0x57, 0x64, 0x71, 0x7e, 0x8b, 0x98,
+  0xa5, 0xb2, 0xbf, 0xcc, 0xd9, 0xe6, 0xf3, 0x00, 0x0d, 0x1a, 0x27, 0x34
+};
+
+static uint8_t cipher17[300] = {
+  0x56, 0xdb, 0x9c, 0xa3, 0xca, 0x1a, 0x4c, 0xf3, 0x54, 0xe0, 0xdb, 0x18,
+  0x86, 0xbd, 0x85, 0x1b, 0x65, 0xfd, 0x51, 0xcb, 0x7d, 0x3f, 0x40, 0x0a,
+  0x1a, 0x4c, 0x11, 0x4d, 0xde, 0x49, 0xda, 0x11, 0x89, 0x52, 0x7e, 0xdf,
+  0x85, 0xf4, 0xcc, 0x3a, 0xbd, 0xc5, 0x73, 0xea, 0xba, 0xbe, 0xfd, 0x56,
+  0x0b, 0xc0, 0x3e, 0x8e, 0xcb, 0x3c, 0xe6, 0x99, 0x61, 0x89, 0x41, 0x8a,
+  0x3e, 0x2a, 0x19, 0x56, 0x04, 0x93, 0x41, 0x6c, 0xbd, 0xe7, 0x78, 0xb0,
+  0xa5, 0x66, 0xd6, 0x6c, 0xeb, 0x16, 0x58, 0x50, 0x0f, 0x2a, 0x70, 0x97,
+  0x79, 0xbb, 0xd9, 0x1c, 0x63, 0x77, 0xc7, 0x47, 0x45, 0xc0, 0x70, 0xa5,
+  0xe5, 0x0d, 0x75, 0xd4, 0xc5, 0xf0, 0x16, 0x29, 0xda, 0x43, 0x1b, 0x25,
+  0x24, 0x63, 0xc1, 0xcd, 0xe3, 0x36, 0x59, 0x3b, 0x98, 0xb7, 0x43, 0x5f,
+  0x6b, 0x34, 0x3f, 0xad, 0x68, 0xe2, 0x8d, 0x2f, 0x3b, 0x37, 0x39, 0x3f,
+  0xdb, 0x9c, 0xa0, 0x7a, 0x10, 0x16, 0xfa, 0x47, 0x69, 0x74, 0x17, 0xf5,
+  0x4b, 0x29, 0x3a, 0xcb, 0x77, 0x88, 0x0d, 0x23, 0xba, 0xd4, 0xe9, 0x6c,
+  0x87, 0xa6, 0xe8, 0xc2, 0x07, 0xe2, 0x99, 0x2e, 0x78, 0xed, 0x7d, 0xc9,
+  0x79, 0xa8, 0x4d, 0xb4, 0xd4, 0xf7, 0x17, 0xf4, 0x0f, 0x9d, 0xb5, 0x9f,
+  0xa1, 0x3c, 0x1f, 0x92, 0xec, 0xdb, 0x82, 0x17, 0xa8, 0x89, 0xb5, 0x3b,
+  0xaf, 0xcc, 0x09, 0xea, 0x7d, 0x37, 0x96, 0x64, 0x4c, 0x71, 0x20, 0x02,
+  0x6c, 0x83, 0x04, 0x60, 0xa6, 0xfa, 0x2b, 0xab, 0x6d, 0xe2, 0x01, 0xc8,
+  0x82, 0x7c, 0xf2, 0x5c, 0x57, 0x4b, 0x4c, 0x3c, 0x2e, 0x29, 0x85, 0xf4,
+  0x10, 0xf7, 0x2d, 0xd6, 0x54, 0xb1, 0xa3, 0xf5, 0xce, 0xf9, 0x3c, 0x1f,
+  0x34, 0xa9, 0xdc, 0x48, 0xb7, 0x64, 0xca, 0x3e, 0xdd, 0x4e, 0x5e, 0x34,
+  0x54, 0xd2, 0x0b, 0xf9, 0x10, 0xe6, 0x68, 0x92, 0xa6, 0x18, 0xf1, 0x35,
+  0x85, 0x9e, 0xa1, 0x07, 0x57, 0x69, 0x9a, 0x87, 0x6e, 0x9e, 0x54, 0x46,
+  0xf3, 0xac, 0x75, 0xd4, 0x23, 0xf8, 0x77, 0xaa, 0x66, 0x4f, 0x02, 0x90,
+  0x1d, 0x7d, 0xf4, 0x49, 0x15, 0x75, 0x4c, 0xa8, 0x59, 0xce, 0x0d, 0x9d
+};
+
+static uint8_t key18[32] = {
+  0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b,
+  0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+  0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f
+};
+
+static uint8_t aad18[70] = {
+  0x01, 0x08, 0x0f, 0x16, 0x1d, 0x24, 0x2b, 0x32, 0x39, 0x40, 0x47, 0x4e,
+  0x55, 0x5c, 0x63, 0x6a, 0x71, 0x78, 0x7f, 0x86, 0x8d, 0x94, 0x9b, 0xa2,
+  0xa9, 0xb0, 0xb7, 0xbe, 0xc5, 0xcc, 0xd3, 0xda, 0xe1, 0xe8, 0xef, 0xf6,
+  0xfd, 0x04, 0x0b, 0x12, 0x19, 0x20, 0x27, 0x2e, 0x35, 0x3c, 0x43, 0x4a,
+  0x51, 0x58, 0x5f, 0x66, 0x6d, 0x74, 0x7b, 0x82, 0x89, 0x90, 0x97, 0x9e,
+  0xa5, 0xac, 0xb3, 0xba, 0xc1, 0xc8, 0xcf, 0xd6, 0xdd, 0xe4
+};
+
+static uint8_t input18[300] = {
+  0x05, 0x12, 0x1f, 0x2c, 0x39, 0x46, 0x53, 0x60, 0x6d, 0x7a, 0x87, 0x94,
+  0xa1, 0xae, 0xbb, 0xc8, 0xd5, 0xe2, 0xef, 0xfc, 0x09, 0x16, 0x23, 0x30,
+  0x3d, 0x4a, 0x57, 0x64, 0x71, 0x7e, 0x8b, 0x98, 0xa5, 0xb2, 0xbf, 0xcc,
+  0xd9, 0xe6, 0xf3, 0x00, 0x0d, 0x1a, 0x27, 0x34, 0x41, 0x4e, 0x5b, 0x68,
+  0x75, 0x82, 0x8f, 0x9c, 0xa9, 0xb6, 0xc3, 0xd0, 0xdd, 0xea, 0xf7, 0x04,
+  0x11, 0x1e, 0x2b, 0x38, 0x45, 0x52, 0x5f, 0x6c, 0x79, 0x86, 0x93, 0xa0,
+  0xad, 0xba, 0xc7, 0xd4, 0xe1, 0xee, 0xfb, 0x08, 0x15, 0x22, 0x2f, 0x3c,
+  0x49, 0x56, 0x63, 0x70, 0x7d, 0x8a, 0x97, 0xa4, 0xb1, 0xbe, 0xcb, 0xd8,
+  0xe5, 0xf2, 0xff, 0x0c, 0x19, 0x26, 0x33, 0x40, 0x4d, 0x5a, 0x67, 0x74,
+  0x81, 0x8e, 0x9b, 0xa8, 0xb5, 0xc2, 0xcf, 0xdc, 0xe9, 0xf6, 0x03, 0x10,
+  0x1d, 0x2a, 0x37, 0x44, 0x51, 0x5e, 0x6b, 0x78, 0x85, 0x92, 0x9f, 0xac,
+  0xb9, 0xc6, 0xd3, 0xe0, 0xed, 0xfa, 0x07, 0x14, 0x21, 0x2e, 0x3b, 0x48,
+  0x55, 0x62, 0x6f, 0x7c, 0x89, 0x96, 0xa3, 0xb0, 0xbd, 0xca, 0xd7, 0xe4,
+  0xf1, 0xfe, 0x0b, 0x18, 0x25, 0x32, 0x3f, 0x4c, 0x59, 0x66, 0x73, 0x80,
+  0x8d, 0x9a, 0xa7, 0xb4, 0xc1, 0xce, 0xdb, 0xe8, 0xf5, 0x02, 0x0f, 0x1c,
+  0x29, 0x36, 0x43, 0x50, 0x5d, 0x6a, 0x77, 0x84, 0x91, 0x9e, 0xab, 0xb8,
+  0xc5, 0xd2, 0xdf, 0xec, 0xf9, 0x06, 0x13, 0x20, 0x2d, 0x3a, 0x47, 0x54,
+  0x61, 0x6e, 0x7b, 0x88, 0x95, 0xa2, 0xaf, 0xbc, 0xc9, 0xd6, 0xe3, 0xf0,
+  0xfd, 0x0a, 0x17, 0x24, 0x31, 0x3e, 0x4b, 0x58, 0x65, 0x72, 0x7f, 0x8c,
+  0x99, 0xa6, 0xb3, 0xc0, 0xcd, 0xda, 0xe7, 0xf4, 0x01, 0x0e, 0x1b, 0x28,
+  0x35, 0x42, 0x4f, 0x5c, 0x69, 0x76, 0x83, 0x90, 0x9d, 0xaa, 0xb7, 0xc4,
+  0xd1, 0xde, 0xeb, 0xf8, 0x05, 0x12, 0x1f, 0x2c, 0x39, 0x46, 0x53, 0x60,
+  0x6d, 0x7a, 0x87, 0x94, 0xa1, 0xae, 0xbb, 0xc8, 0xd5, 0xe2, 0xef, 0xfc,
+  0x09, 0x16, 0x23, 0x30, 0x3d, 0x4a, 0x57, 0x64, 0x71, 0x7e, 0x8b, 0x98,
+  0xa5, 0xb2, 0xbf, 0xcc, 0xd9, 0xe6, 0xf3, 0x00, 0x0d, 0x1a, 0x27, 0x34
+};
+
+static uint8_t cipher18[300] = {
+  0x4e, 0xcd, 0x02, 0xe1, 0xf0, 0x6b, 0x3b, 0xb3, 0xa5, 0x4c, 0x06, 0xb4,
+  0x84, 0x2b, 0x1c, 0x45, 0x9d, 0x82, 0xab, 0xed, 0x9f, 0xa8, 0x3e, 0xee,
+  0x11, 0x3c, 0x91, 0xce, 0x27, 0xd8, 0x10, 0xea, 0xf4, 0x6e, 0x65, 0x92,
+  0x18, 0x31, 0xff, 0x87, 0xaa, 0xae, 0x28, 0x4d, 0x92, 0xf1, 0x92, 0x56,
+  0x21, 0xe0, 0x7c, 0x78, 0x90, 0x13, 0x9d, 0x93, 0xf4, 0x43, 0x6d, 0x66,
+  0xf5, 0xef, 0xc7, 0x78, 0xba, 0xb9, 0x43, 0xeb, 0xce, 0x09, 0x2b, 0x8b,
+  0x38, 0x8d, 0xb2, 0x7c, 0xc5, 0xfc, 0xb7, 0x7a, 0x6f, 0x74, 0xb1, 0xbc,
+  0xd6, 0xf2, 0x67, 0xd9, 0xe0, 0xbe, 0xc9, 0x80, 0xf5, 0x8d, 0x0a, 0x72,
+  0x2b, 0x14, 0x64, 0x88, 0x9b, 0x28, 0x57, 0xa4, 0xbd, 0x64, 0x15, 0xf1,
+  0x40, 0x2d, 0x50, 0x8b, 0xfd, 0x8a, 0xac, 0x04, 0x18, 0xd1, 0x25, 0x41,
+  0x49, 0x8c, 0x1a, 0x76, 0x77, 0x28, 0x2c, 0x84, 0x2c, 0x91, 0x8a, 0x31,
+  0x85, 0x49, 0x84, 0x37, 0xee, 0x2d, 0x57, 0xed, 0x47, 0x3f, 0xea, 0x69,
+  0x05, 0x23, 0x96, 0x9d, 0xaf, 0x0b, 0x60, 0x7b, 0x55, 0xe8, 0x32, 0x3c,
+  0x40, 0xbe, 0x68, 0xeb, 0xd0, 0xbb, 0x54, 0x87, 0xb7, 0xa5, 0x8a, 0x87,
+  0x0a, 0x85, 0xbc, 0xa6, 0x0c, 0x21, 0xc0, 0x86, 0x96, 0x5c, 0x8b, 0xd2,
+  0x1b, 0x1b, 0x13, 0xdc, 0x3b, 0x97, 0x8d, 0xe6, 0xff, 0x56, 0xce, 0x31,
+  0xea, 0x4d, 0xc6, 0xb3, 0xec, 0xaa, 0xe1, 0x83, 0xcc, 0x9d, 0xca, 0x77,
+  0xd2, 0x2e, 0xd8, 0x9b, 0xa7, 0x91, 0x0f, 0x79, 0xce, 0x5d, 0xba, 0x68,
+  0xfd, 0xd7, 0x87, 0xfa, 0x12, 0x2c, 0x60, 0xdf, 0x97, 0x66, 0x60, 0x25,
+  0x90, 0x7b, 0x74, 0xbf, 0x4f, 0x61, 0xa6, 0x51, 0x71, 0xc9, 0x25, 0xab,
+  0xf4, 0xa7, 0x92, 0xab, 0xdf, 0x44, 0xc6, 0xad, 0x50, 0xe5, 0xcd, 0xea,
+  0xb7, 0x24, 0x48, 0x33, 0xfe, 0xf6, 0x1f, 0x6d, 0xe3, 0xb2, 0x73, 0xd9,
+  0x79, 0x07, 0x30, 0x65, 0xa7, 0x1b, 0x50, 0x66, 0x29, 0x21, 0x34, 0xcd,
+  0x29, 0xa3, 0xda, 0x15, 0xbb, 0x79, 0xe7, 0xb1, 0x13, 0x56, 0x68, 0xea,
+  0x6b, 0xdf, 0x36, 0xc7, 0xbf, 0xee, 0xdd, 0xac, 0xec, 0x4a, 0x1c, 0x67
+};
+
+static aes_gcm_siv_test_vector vectors[] = {
+  { .key = key1,
+    .key_len = 16,
+    .nonce = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+               0x00, 0x00, 0x00, 0x00 },
+    .aad = NULL,
+    .aad_len = 0,
+    .input = NULL,
+    .input_len = 0,
+    .cipher = NULL,
+    .tag = { 0xdc, 0x20, 0xe2, 0xd8, 0x3f, 0x25, 0x70, 0x5b,
+             0xb4, 0x9e, 0x43, 0x9e, 0xca, 0x56, 0xde, 0x25 } },
+  { .key = key2,
+    .key_len = 16,
+    .nonce = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+               0x00, 0x00, 0x00, 0x00 },
+    .aad = NULL,
+    .aad_len = 0,
+    .input = input2,
+    .input_len = 8,
+    .cipher = cipher2,
+    .tag = { 0x57, 0x87, 0x82, 0xff, 0xf6, 0x01, 0x3b, 0x81,
+             0x5b, 0x28, 0x7c, 0x22, 0x49, 0x3a, 0x36, 0x4c } },
+  { .key = key3,
+    .key_len = 16,
+    .nonce = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+               0x00, 0x00, 0x00, 0x00 },
+    .aad = NULL,
+    .aad_len = 0,
+    .input = input3,
+    .input_len = 16,
+    .cipher = cipher3,
+    .tag = { 0x30, 0x3a, 0xaf, 0x90, 0xf6, 0xfe, 0x21, 0x19,
+             0x9c, 0x60, 0x68, 0x57, 0x74, 0x37, 0xa0, 0xc4 } },
+  { .key = key4,
+    .key_len = 16,
+    .nonce = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+               0x00, 0x00, 0x00, 0x00 },
+    .aad = NULL,
+    .aad_len = 0,
+    .input = input4,
+    .input_len = 64,
+    .cipher = cipher4,
+    .tag = { 0x8a, 0x26, 0x3d, 0xd3, 0x17, 0xaa, 0x88, 0xd5,
+             0x6b, 0xdf, 0x39, 0x36, 0xdb, 0xa7, 0x5b, 0xb8 } },
+  { .key = key5,
+    .key_len = 16,
+    .nonce = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+               0x00, 0x00, 0x00, 0x00 },
+    .aad = aad5,
+    .aad_len = 1,
+    .input = input5,
+    .input_len = 8,
+    .cipher = cipher5,
+    .tag = { 0x3b, 0x0a, 0x1a, 0x25, 0x60, 0x96, 0x9c, 0xdf,
+             0x79, 0x0d, 0x99, 0x75, 0x9a, 0xbd, 0x15, 0x08 } },
+  { .key = key6,
+    .key_len = 16,
+    .nonce = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+               0x00, 0x00, 0x00, 0x00 },
+    .aad = aad6,
+    .aad_len = 1,
+    .input = input6,
+    .input_len = 32,
+    .cipher = cipher6,
+    .tag = { 0xe6, 0xaf, 0x6a, 0x7f, 0x87, 0x28, 0x7d, 0xa0,
+             0x59, 0xa7, 0x16, 0x84, 0xed, 0x34, 0x98, 0xe1 } },
+  { .key = key7,
+    .key_len = 16,
+    .nonce = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+               0x00, 0x00, 0x00, 0x00 },
+    .aad = aad7,
+    .aad_len = 12,
+    .input = input7,
+    .input_len = 4,
+    .cipher = cipher7,
+    .tag = { 0x07, 0xeb, 0x1f, 0x84, 0xfb, 0x28, 0xf8, 0xcb,
+             0x73, 0xde, 0x8e, 0x99, 0xe2, 0xf4, 0x8a, 0x14 } },
+  { .key = key8,
+    .key_len = 32,
+    .nonce = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+               0x00, 0x00, 0x00, 0x00 },
+    .aad = NULL,
+    .aad_len = 0,
+    .input = NULL,
+    .input_len = 0,
+    .cipher = NULL,
+    .tag = { 0x07, 0xf5, 0xf4, 0x16, 0x9b, 0xbf, 0x55, 0xa8,
+             0x40, 0x0c, 0xd4, 0x7e, 0xa6, 0xfd, 0x40, 0x0f } },
+  { .key = key9,
+    .key_len = 32,
+    .nonce = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+               0x00, 0x00, 0x00, 0x00 },
+    .aad = NULL,
+    .aad_len = 0,
+    .input = input9,
+    .input_len = 8,
+    .cipher = cipher9,
+    .tag = { 0x84, 0x31, 0x22, 0x13, 0x0f, 0x73, 0x64, 0xb7,
+             0x61, 0xe0, 0xb9, 0x74, 0x27, 0xe3, 0xdf, 0x28 } },
+  { .key = key10,
+    .key_len = 32,
+    .nonce = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+               0x00, 0x00, 0x00, 0x00 },
+    .aad = NULL,
+    .aad_len = 0,
+    .input = input10,
+    .input_len = 16,
+    .cipher = cipher10,
+    .tag = { 0xc9, 0xea, 0xc6, 0xfa, 0x70, 0x09, 0x42, 0x70,
+             0x2e, 0x90, 0x86, 0x23, 0x83, 0xc6, 0xc3, 0x66 } },
+  { .key = key11,
+    .key_len = 32,
+    .nonce = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+               0x00, 0x00, 0x00, 0x00 },
+    .aad = NULL,
+    .aad_len = 0,
+    .input = input11,
+    .input_len = 64,
+    .cipher = cipher11,
+    .tag = { 0x11, 0x28, 0x64, 0xc2, 0x69, 0xfc, 0x0d, 0x9d,
+             0x88, 0xc6, 0x1f, 0xa4, 0x7e, 0x39, 0xaa, 0x08 } },
+  { .key = key12,
+    .key_len = 32,
+    .nonce = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+               0x00, 0x00, 0x00, 0x00 },
+    .aad = aad12,
+    .aad_len = 1,
+    .input = input12,
+    .input_len = 8,
+    .cipher = cipher12,
+    .tag = { 0x91, 0x21, 0x3f, 0x26, 0x7e, 0x3b, 0x45, 0x2f,
+             0x02, 0xd0, 0x1a, 0xe3, 0x3e, 0x4e, 0xc8, 0x54 } },
+  { .key = key13,
+    .key_len = 32,
+    .nonce = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+               0x00, 0x00, 0x00, 0x00 },
+    .aad = aad13,
+    .aad_len = 1,
+    .input = input13,
+    .input_len = 32,
+    .cipher = cipher13,
+    .tag = { 0xae, 0xa1, 0xba, 0xd1, 0x27, 0x02, 0xe1, 0x96,
+             0x56, 0x04, 0x37, 0x4a, 0xab, 0x96, 0xdb, 0xbc } },
+  { .key = key14,
+    .key_len = 32,
+    .nonce = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+               0x00, 0x00, 0x00, 0x00 },
+    .aad = aad14,
+    .aad_len = 12,
+    .input = input14,
+    .input_len = 4,
+    .cipher = cipher14,
+    .tag = { 0x18, 0x35, 0xe5, 0x17, 0x74, 0x1d, 0xfd, 0xdc,
+             0xcf, 0xa0, 0x7f, 0xa4, 0x66, 0x1b, 0x74, 0xcf } },
+  { .key = key15,
+    .key_len = 32,
+    .nonce = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+               0x00, 0x00, 0x00, 0x00 },
+    .aad = NULL,
+    .aad_len = 0,
+    .input = input15,
+    .input_len = 32,
+    .cipher = cipher15,
+    .tag = { 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+  { .key = key16,
+    .key_len = 32,
+    .nonce = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+               0x00, 0x00, 0x00, 0x00 },
+    .aad = NULL,
+    .aad_len = 0,
+    .input = input16,
+    .input_len = 24,
+    .cipher = cipher16,
+    .tag = { 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+  { .key = key17,
+    .key_len = 16,
+    .nonce = { 0x20, 0x23, 0x26, 0x29, 0x2c, 0x2f, 0x32, 0x35,
+               0x38, 0x3b, 0x3e, 0x41 },
+    .aad = aad17,
+    .aad_len = 70,
+    .input = input17,
+    .input_len = 300,
+    .cipher = cipher17,
+    .tag = { 0x13, 0x73, 0xe2, 0xc8, 0xab, 0x02, 0x22, 0x39,
+             0xfe, 0x31, 0xfe, 0xe2, 0xeb, 0xdb, 0xd4, 0xe6 } },
+  { .key = key18,
+    .key_len = 32,
+    .nonce = { 0x20, 0x23, 0x26, 0x29, 0x2c, 0x2f, 0x32, 0x35,
+               0x38, 0x3b, 0x3e, 0x41 },
+    .aad = aad18,
+    .aad_len = 70,
+    .input = input18,
+    .input_len = 300,
+    .cipher = cipher18,
+    .tag = { 0x0d, 0x31, 0xff, 0xc9, 0x2e, 0xfb, 0x37, 0x2d,
+             0x14, 0x46, 0x2a, 0xb6, 0xc3, 0xf5, 0x87, 0xe4 } }
+};
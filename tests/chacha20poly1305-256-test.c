@@ -12,6 +12,7 @@
 #include "test_helpers.h"
 
 #include "Hacl_AEAD_Chacha20Poly1305_Simd256.h"
+#include "Hacl_AEAD_Chacha20Poly1305.h"
 
 #include "EverCrypt_AutoConfig2.h"
 
@@ -61,6 +62,86 @@ print_test(int in_len,
   return ok;
 }
 
+#define BATCH 19
+#define BATCH_MAX 1500
+
+// Cross-checks the multi-packet API against the single-packet portable
+// implementation, over packets of different lengths and keys.
+bool
+print_batch_test()
+{
+  static uint8_t keys[BATCH][32];
+  static uint8_t nonces[BATCH][12];
+  static uint8_t aads[BATCH][64];
+  static uint8_t plain[BATCH][BATCH_MAX];
+  static uint8_t cipher[BATCH][BATCH_MAX];
+  static uint8_t exp_cipher[BATCH][BATCH_MAX];
+  static uint8_t decrypted[BATCH][BATCH_MAX];
+  uint8_t tags[BATCH][16];
+  uint8_t exp_tags[BATCH][16];
+  uint32_t res[BATCH];
+  Hacl_AEAD_Chacha20Poly1305_packet packets[BATCH];
+  bool ok = true;
+
+  for (int i = 0; i < BATCH; i++) {
+    for (int j = 0; j < 32; j++)
+      keys[i][j] = (uint8_t)(i * 31 + j);
+    for (int j = 0; j < 12; j++)
+      nonces[i][j] = (uint8_t)(i + 7 * j);
+    for (int j = 0; j < 64; j++)
+      aads[i][j] = (uint8_t)(i ^ j);
+    for (int j = 0; j < BATCH_MAX; j++)
+      plain[i][j] = (uint8_t)(i * 13 + j * 5);
+    uint32_t len = (uint32_t)(i * 83) % (BATCH_MAX + 1);
+    uint32_t aad_len = (uint32_t)(i * 11) % 64;
+    Hacl_AEAD_Chacha20Poly1305_encrypt(exp_cipher[i], exp_tags[i], plain[i],
+                                       len, aads[i], aad_len, keys[i],
+                                       nonces[i]);
+    packets[i] = (Hacl_AEAD_Chacha20Poly1305_packet){
+      .key = keys[i],
+      .nonce = nonces[i],
+      .data = aads[i],
+      .data_len = aad_len,
+      .input = plain[i],
+      .input_len = len,
+      .output = cipher[i],
+      .tag = tags[i]
+    };
+  }
+
+  Hacl_AEAD_Chacha20Poly1305_Simd256_encrypt_batch(BATCH, packets);
+  printf("Chacha20Poly1305 (256-bit) batch encrypt:\n");
+  for (int i = 0; i < BATCH; i++) {
+    ok &= print_result(packets[i].input_len, cipher[i], exp_cipher[i]);
+    ok &= print_result(16, tags[i], exp_tags[i]);
+  }
+
+  tags[5][3] ^= 1;
+  for (int i = 0; i < BATCH; i++) {
+    packets[i].input = cipher[i];
+    packets[i].output = decrypted[i];
+  }
+  memset(decrypted, 0, sizeof decrypted);
+  uint32_t failed =
+    Hacl_AEAD_Chacha20Poly1305_Simd256_decrypt_batch(BATCH, packets, res);
+  printf("Chacha20Poly1305 (256-bit) batch decrypt:\n");
+  ok &= failed == 1;
+  for (int i = 0; i < BATCH; i++) {
+    if (i == 5) {
+      ok &= res[i] == 1;
+    } else {
+      ok &= res[i] == 0;
+      ok &= print_result(packets[i].input_len, decrypted[i], plain[i]);
+    }
+  }
+  uint8_t zeros[BATCH_MAX] = { 0 };
+  ok &= memcmp(decrypted[5], zeros, BATCH_MAX) == 0;
+  if (!ok)
+    printf("Batch test failed\n");
+
+  return ok;
+}
+
 int
 main()
 {
@@ -84,6 +165,7 @@ main()
                      vectors[i].tag,
                      vectors[i].cipher);
   }
+  ok &= print_batch_test();
 
   uint8_t plain[SIZE];
   uint8_t cipher[SIZE];
@@ -0,0 +1,182 @@
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "test_helpers.h"
+
+#include "Hacl_AEAD_Chacha20Poly1305_Simd512.h"
+#include "Hacl_AEAD_Chacha20Poly1305.h"
+
+#include "EverCrypt_AutoConfig2.h"
+
+#include "chacha20poly1305_vectors.h"
+
+#define ROUNDS 100000
+#define SIZE 16384
+
+bool
+print_result(int in_len, uint8_t* comp, uint8_t* exp)
+{
+  return compare_and_print(in_len, comp, exp);
+}
+
+bool
+print_test(int in_len,
+           uint8_t* in,
+           uint8_t* key,
+           uint8_t* nonce,
+           int aad_len,
+           uint8_t* aad,
+           uint8_t* exp_mac,
+           uint8_t* exp_cipher)
+{
+  uint8_t plaintext[in_len];
+  memset(plaintext, 0, in_len * sizeof plaintext[0]);
+  uint8_t ciphertext[in_len];
+  memset(ciphertext, 0, in_len * sizeof ciphertext[0]);
+  uint8_t mac[16] = { 0 };
+  bool ok = true;
+  int res = 0;
+
+  Hacl_AEAD_Chacha20Poly1305_Simd512_encrypt(
+    ciphertext, mac, in, in_len, aad, aad_len, key, nonce);
+  printf("Chacha20Poly1305 (512-bit) Result (chacha20):\n");
+  ok = print_result(in_len, ciphertext, exp_cipher);
+  printf("(poly1305):\n");
+  ok = ok && print_result(16, mac, exp_mac);
+
+  res = Hacl_AEAD_Chacha20Poly1305_Simd512_decrypt(
+    plaintext, exp_cipher, in_len, aad, aad_len, key, nonce, exp_mac);
+  if (res != 0)
+    printf("AEAD Decrypt (Chacha20/Poly1305) failed \n.");
+  ok = ok && (res == 0);
+  ok = ok && print_result(in_len, plaintext, in);
+
+  return ok;
+}
+
+int
+main()
+{
+  EverCrypt_AutoConfig2_init();
+  if (!EverCrypt_AutoConfig2_has_avx512()) {
+    printf("The current hardware doesn't support avx512: aborting\n");
+    return EXIT_SUCCESS;
+  } else {
+    printf("The current hardware supports avx512: performing the tests\n");
+  }
+
+  bool ok = true;
+  for (size_t i = 0; i < sizeof(vectors) / sizeof(chacha20poly1305_test_vector);
+       ++i) {
+    ok &= print_test(vectors[i].input_len,
+                     vectors[i].input,
+                     vectors[i].key,
+                     vectors[i].nonce,
+                     vectors[i].aad_len,
+                     vectors[i].aad,
+                     vectors[i].tag,
+                     vectors[i].cipher);
+  }
+
+  // Cross-check against the portable implementation across the 1024-byte
+  // ChaCha20 stride and the 128-byte Poly1305 stride.
+  uint8_t msg[2100];
+  uint8_t c0[2100];
+  uint8_t c1[2100];
+  uint8_t ad[40];
+  uint8_t k[32];
+  uint8_t n[12];
+  for (int i = 0; i < 2100; i++)
+    msg[i] = (uint8_t)(i * 13 + 1);
+  for (int i = 0; i < 40; i++)
+    ad[i] = (uint8_t)(i ^ 0x5a);
+  for (int i = 0; i < 32; i++)
+    k[i] = (uint8_t)(i * 3);
+  for (int i = 0; i < 12; i++)
+    n[i] = (uint8_t)(0x80 + i);
+  for (int len = 0; len <= 2100; len += 7) {
+    uint8_t t0[16] = { 0 };
+    uint8_t t1[16] = { 0 };
+    uint32_t adlen = (uint32_t)(len % 41);
+    Hacl_AEAD_Chacha20Poly1305_encrypt(c0, t0, msg, len, ad, adlen, k, n);
+    Hacl_AEAD_Chacha20Poly1305_Simd512_encrypt(c1, t1, msg, len, ad, adlen, k, n);
+    if (memcmp(c0, c1, len) != 0 || memcmp(t0, t1, 16) != 0) {
+      printf("Chacha20Poly1305 (512-bit) mismatch at length %d\n", len);
+      ok = false;
+    }
+  }
+
+  uint8_t plain[SIZE];
+  uint8_t cipher[SIZE];
+  uint8_t aead_key[32];
+  uint8_t aead_nonce[12];
+  int aad_len = 12;
+  uint8_t aead_aad[aad_len];
+
+  int res = 0;
+  uint8_t tag[16];
+  cycles a, b;
+  clock_t t1, t2;
+
+  memset(plain, 'P', SIZE);
+  memset(aead_key, 'K', 32);
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_AEAD_Chacha20Poly1305_Simd512_encrypt(
+      cipher, tag, plain, SIZE, aead_aad, aad_len, aead_key, aead_nonce);
+  }
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_AEAD_Chacha20Poly1305_Simd512_encrypt(
+      cipher, tag, plain, SIZE, aead_aad, aad_len, aead_key, aead_nonce);
+    res ^= tag[0] ^ tag[15];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff1 = t2 - t1;
+  cycles cdiff1 = b - a;
+
+  int res1 = 0;
+  for (int j = 0; j < ROUNDS; j++) {
+    res1 = Hacl_AEAD_Chacha20Poly1305_Simd512_decrypt(
+      plain, cipher, SIZE, aead_aad, aad_len, aead_key, aead_nonce, tag);
+    res1 ^= res1;
+  }
+
+  res1 = 0;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_AEAD_Chacha20Poly1305_Simd512_decrypt(
+      plain, cipher, SIZE, aead_aad, aad_len, aead_key, aead_nonce, tag);
+    res1 ^= res1;
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff2 = t2 - t1;
+  cycles cdiff2 = b - a;
+
+  // JP: I don't understand what this does since this variable is almost always
+  // zeroed-out.
+  printf("\n res1: %i \n", res1);
+
+  uint64_t count = ROUNDS * SIZE;
+  printf("Chacha20Poly1305 Encrypt (512-bit) PERF:\n");
+  print_time(count, tdiff1, cdiff1);
+  printf("Chacha20Poly1305 Decrypt (512-bit) PERF:\n");
+  print_time(count, tdiff2, cdiff2);
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,119 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "test_helpers.h"
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Chacha20Poly1305.h"
+#include "EverCrypt_Poly1305.h"
+
+#define ROUNDS 1000000
+#define SIZE 80
+#define MAX_LEN 1600
+
+static uint8_t key[32], nonce[12], aad[13], plain[MAX_LEN];
+
+// Whatever implementation the thresholds pick, the EverCrypt entry points must agree
+// with the portable code at every length.
+static bool
+check_lengths(const char* name)
+{
+  static uint8_t cipher[MAX_LEN], expected[MAX_LEN], decrypted[MAX_LEN];
+  uint8_t tag[16], expected_tag[16];
+  bool ok = true;
+  for (uint32_t len = 0; len < MAX_LEN; len += (len < 600 ? 1 : 29)) {
+    Hacl_AEAD_Chacha20Poly1305_encrypt(expected, expected_tag, plain, len, aad, 13, key, nonce);
+    EverCrypt_Chacha20Poly1305_aead_encrypt(key, nonce, 13, aad, len, plain, cipher, tag);
+    ok &= memcmp(cipher, expected, len) == 0 && memcmp(tag, expected_tag, 16) == 0;
+    ok &= EverCrypt_Chacha20Poly1305_aead_decrypt(
+            key, nonce, 13, aad, len, decrypted, cipher, tag) == 0;
+    ok &= memcmp(decrypted, plain, len) == 0;
+    tag[len % 16] ^= 1;
+    ok &= EverCrypt_Chacha20Poly1305_aead_decrypt(
+            key, nonce, 13, aad, len, decrypted, cipher, tag) == 1;
+
+    Hacl_MAC_Poly1305_mac(expected_tag, plain, len, key);
+    EverCrypt_Poly1305_mac(tag, plain, len, key);
+    ok &= memcmp(tag, expected_tag, 16) == 0;
+  }
+  printf("ChaCha20-Poly1305 and Poly1305 dispatch (%s): %s\n", name, ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static void
+bench(const char* name)
+{
+  static uint8_t buf[SIZE];
+  uint8_t tag[16];
+  uint64_t count = (uint64_t)ROUNDS * SIZE;
+  cycles c0, c1;
+  clock_t t1, t2;
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    EverCrypt_Chacha20Poly1305_aead_encrypt(key, nonce, 13, aad, SIZE, buf, buf, tag);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("EverCrypt ChaCha20-Poly1305 encrypt, %d bytes (%s):\n", SIZE, name);
+  print_time(count, t2 - t1, c1 - c0);
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    EverCrypt_Poly1305_mac(tag, buf, SIZE, key);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("EverCrypt Poly1305, %d bytes (%s):\n", SIZE, name);
+  print_time(count, t2 - t1, c1 - c0);
+}
+
+int
+main()
+{
+  EverCrypt_AutoConfig2_init();
+  for (int i = 0; i < 32; i++)
+    key[i] = (uint8_t)(i * 7 + 3);
+  for (int i = 0; i < 12; i++)
+    nonce[i] = (uint8_t)i;
+  for (int i = 0; i < 13; i++)
+    aad[i] = (uint8_t)(0xa0 + i);
+  for (int i = 0; i < MAX_LEN; i++)
+    plain[i] = (uint8_t)(i * 13);
+
+  bool ok = check_lengths("default thresholds");
+  bench("default thresholds");
+
+  // The defaults depend on the feature level; check each of them.
+  EverCrypt_AutoConfig2_disable_avx512();
+  ok &= check_lengths("default thresholds, AVX2");
+  EverCrypt_AutoConfig2_disable_avx2();
+  ok &= check_lengths("default thresholds, 128-bit vectors");
+  EverCrypt_AutoConfig2_init();
+
+  // Always the widest implementation, as before length-based selection.
+  EverCrypt_Chacha20Poly1305_set_thresholds(0, 0, 0);
+  EverCrypt_Poly1305_set_thresholds(0, 0, 0);
+  ok &= check_lengths("widest");
+  bench("widest");
+
+  // Every width in turn, including the scalar code.
+  EverCrypt_Chacha20Poly1305_set_thresholds(0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU);
+  EverCrypt_Poly1305_set_thresholds(0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU);
+  ok &= check_lengths("scalar");
+  EverCrypt_Chacha20Poly1305_set_thresholds(0, 0xFFFFFFFFU, 0xFFFFFFFFU);
+  EverCrypt_Poly1305_set_thresholds(0, 0xFFFFFFFFU, 0xFFFFFFFFU);
+  ok &= check_lengths("128-bit");
+  EverCrypt_Chacha20Poly1305_set_thresholds(0xFFFFFFFFU, 0, 0xFFFFFFFFU);
+  EverCrypt_Poly1305_set_thresholds(0xFFFFFFFFU, 0, 0xFFFFFFFFU);
+  ok &= check_lengths("256-bit");
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,194 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <openssl/evp.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Cipher.h"
+
+#include "chacha20_vectors.h"
+#include "test_helpers.h"
+
+#define ROUNDS 16384
+#define SIZE 81920
+#define STREAM 4099
+
+static void
+openssl_xor(const EVP_CIPHER* c,
+            uint8_t* key,
+            uint8_t* iv,
+            int len,
+            uint8_t* in,
+            uint8_t* out)
+{
+  int olen;
+  EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
+  EVP_EncryptInit_ex(ctx, c, NULL, key, iv);
+  EVP_EncryptUpdate(ctx, out, &olen, in, len);
+  EVP_EncryptFinal_ex(ctx, out + olen, &olen);
+  EVP_CIPHER_CTX_free(ctx);
+}
+
+static void
+fill(uint8_t* b, int len, uint8_t seed)
+{
+  for (int i = 0; i < len; i++)
+    b[i] = (uint8_t)(seed + 7 * i);
+}
+
+// Every (offset, len) window of the stream must match the corresponding slice
+// of the full-stream output.
+static const uint32_t offsets[] = { 0, 1, 15, 16, 17, 63, 64, 65, 127, 200, 1000, 4000 };
+static const uint32_t lens[] = { 0, 1, 5, 16, 31, 64, 99, 128, 257, 1024 };
+
+#define FOR_WINDOWS(off, l)                                                    \
+  for (size_t _i = 0; _i < sizeof(offsets) / sizeof(offsets[0]); _i++)         \
+    for (size_t _j = 0; _j < sizeof(lens) / sizeof(lens[0]); _j++)             \
+      if (offsets[_i] + lens[_j] <= STREAM &&                                  \
+          ((off = offsets[_i]), (l = lens[_j]), true))
+
+static bool
+test_chacha20_seek(void)
+{
+  uint8_t key[32], iv[12], in[STREAM], full[STREAM], part[STREAM];
+  fill(key, 32, 1);
+  fill(iv, 12, 2);
+  fill(in, STREAM, 3);
+  EverCrypt_Cipher_chacha20(STREAM, full, in, key, iv, 5U);
+  bool ok = true;
+  uint32_t off, l;
+  FOR_WINDOWS(off, l)
+  {
+    EverCrypt_Cipher_chacha20_seek(l, part, in + off, key, iv, 5U, off);
+    ok &= memcmp(part, full + off, l) == 0;
+  }
+  printf("ChaCha20 seek: %s\n", ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static bool
+test_chacha20_ctr64(uint64_t ctr)
+{
+  // OpenSSL's EVP_chacha20 takes a 16-byte IV (le64 counter || 8-byte nonce)
+  // and carries the counter across the 32-bit boundary.
+  uint8_t key[32], nonce[8], iv[16], in[STREAM], exp[STREAM], full[STREAM],
+    part[STREAM];
+  fill(key, 32, 4);
+  fill(nonce, 8, 5);
+  fill(in, STREAM, 6);
+  for (int i = 0; i < 8; i++)
+    iv[i] = (uint8_t)(ctr >> (8 * i));
+  memcpy(iv + 8, nonce, 8);
+  openssl_xor(EVP_chacha20(), key, iv, STREAM, in, exp);
+  EverCrypt_Cipher_chacha20_ctr64(STREAM, full, in, key, nonce, ctr);
+  bool ok = memcmp(full, exp, STREAM) == 0;
+  uint32_t off, l;
+  FOR_WINDOWS(off, l)
+  {
+    EverCrypt_Cipher_chacha20_ctr64_seek(l, part, in + off, key, nonce, ctr, off);
+    ok &= memcmp(part, exp + off, l) == 0;
+  }
+  printf("ChaCha20 ctr64 (ctr=0x%016" PRIx64 "): %s\n", ctr, ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static bool
+test_aes_ctr(Spec_Agile_Cipher_cipher_alg a, const EVP_CIPHER* c, uint8_t iv_last)
+{
+  uint8_t key[32], iv[16], in[STREAM], exp[STREAM], part[STREAM];
+  fill(key, 32, 7);
+  fill(in, STREAM, 8);
+  // Make the low 64 bits of the counter block wrap within the stream.
+  memset(iv, 0xff, 16);
+  iv[0] = 0x12;
+  iv[15] = iv_last;
+  openssl_xor(c, key, iv, STREAM, in, exp);
+
+  EverCrypt_Cipher_aes_ctr_state_s* s = NULL;
+  if (EverCrypt_Cipher_aes_ctr_create_in(a, &s, key) != EverCrypt_Error_Success) {
+    printf("AES-CTR: unsupported on this CPU, skipping\n");
+    return true;
+  }
+  bool ok = true;
+  uint32_t off, l;
+  FOR_WINDOWS(off, l)
+  {
+    EverCrypt_Cipher_aes_ctr(s, l, part, in + off, iv, off);
+    ok &= memcmp(part, exp + off, l) == 0;
+  }
+  EverCrypt_Cipher_aes_ctr(s, STREAM, part, in, iv, 0);
+  ok &= memcmp(part, exp, STREAM) == 0;
+  EverCrypt_Cipher_aes_ctr_free(s);
+  printf("AES-%d-CTR: %s\n",
+         a == Spec_Agile_Cipher_AES128 ? 128 : 256,
+         ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+int
+main()
+{
+  EverCrypt_AutoConfig2_init();
+  bool ok = true;
+  for (size_t i = 0; i < sizeof(vectors) / sizeof(chacha20_test_vector); ++i) {
+    uint8_t comp[vectors[i].input_len];
+    EverCrypt_Cipher_chacha20(vectors[i].input_len,
+                              comp,
+                              vectors[i].input,
+                              vectors[i].key,
+                              vectors[i].nonce,
+                              1U);
+    ok &= compare_and_print(vectors[i].input_len, comp, vectors[i].cipher);
+  }
+  ok &= test_chacha20_seek();
+  ok &= test_chacha20_ctr64(0ULL);
+  ok &= test_chacha20_ctr64(0xfffffff0ULL);
+  ok &= test_chacha20_ctr64(0x1fffffffbULL);
+  ok &= test_aes_ctr(Spec_Agile_Cipher_AES128, EVP_aes_128_ctr(), 0xf0);
+  ok &= test_aes_ctr(Spec_Agile_Cipher_AES256, EVP_aes_256_ctr(), 0xf0);
+  ok &= test_aes_ctr(Spec_Agile_Cipher_AES128, EVP_aes_128_ctr(), 0x00);
+
+  uint8_t plain[SIZE];
+  uint8_t key[32];
+  uint8_t nonce[16];
+  memset(plain, 'P', SIZE);
+  memset(key, 'K', 32);
+  memset(nonce, 'N', 16);
+  uint64_t count = ROUNDS * SIZE;
+
+  cycles a, b;
+  clock_t t1, t2;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_Cipher_chacha20(SIZE, plain, plain, key, nonce, 1U);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  printf("EverCrypt ChaCha20:\n");
+  print_time(count, t2 - t1, b - a);
+
+  EverCrypt_Cipher_aes_ctr_state_s* s = NULL;
+  if (EverCrypt_Cipher_aes_ctr_create_in(Spec_Agile_Cipher_AES128, &s, key) ==
+      EverCrypt_Error_Success) {
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      EverCrypt_Cipher_aes_ctr(s, SIZE, plain, plain, nonce, (uint64_t)j * SIZE);
+    }
+    b = cpucycles_end();
+    t2 = clock();
+    printf("EverCrypt AES-128-CTR:\n");
+    print_time(count, t2 - t1, b - a);
+    EverCrypt_Cipher_aes_ctr_free(s);
+  }
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,107 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Curve25519.h"
+#include "Hacl_Curve25519_51.h"
+#include "Hacl_Curve25519_64.h"
+#include "Hacl_Ed25519.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 100000
+#define KEYS 2000
+
+static uint8_t basepoint[32] = { 9 };
+
+// The Edwards fixed-base path must agree with the Montgomery ladder from u = 9 on every
+// scalar, including the bits that clamping discards.
+static bool
+check_keys(bool has_64)
+{
+  bool ok = true;
+  uint8_t priv[32], expected[32], pub[32];
+  for (int i = 0; i < KEYS; i++) {
+    for (int j = 0; j < 32; j++)
+      priv[j] = (uint8_t)(i * 73 + j * (i | 1) + (i >> 3));
+    if (i == 0)
+      memset(priv, 0, 32);
+    if (i == 1)
+      memset(priv, 0xff, 32);
+    Hacl_Curve25519_51_scalarmult(expected, priv, basepoint);
+    Hacl_Ed25519_x25519_secret_to_public(pub, priv);
+    ok &= memcmp(pub, expected, 32) == 0;
+    Hacl_Curve25519_51_secret_to_public(pub, priv);
+    ok &= memcmp(pub, expected, 32) == 0;
+    EverCrypt_Curve25519_secret_to_public(pub, priv);
+    ok &= memcmp(pub, expected, 32) == 0;
+    if (has_64) {
+      Hacl_Curve25519_64_secret_to_public(pub, priv);
+      ok &= memcmp(pub, expected, 32) == 0;
+    }
+  }
+  printf("X25519 secret_to_public against the ladder: %s\n", ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static void
+bench(bool has_64)
+{
+  uint8_t priv[32], pub[32];
+  memset(priv, 'S', 32);
+  cycles a, b;
+  clock_t t1, t2;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    priv[0] = (uint8_t)j;
+    Hacl_Curve25519_51_scalarmult(pub, priv, basepoint);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  printf("X25519 51-bit ladder from the base point:\n");
+  print_time(ROUNDS, t2 - t1, b - a);
+
+  if (has_64) {
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      priv[0] = (uint8_t)j;
+      Hacl_Curve25519_64_scalarmult(pub, priv, basepoint);
+    }
+    b = cpucycles_end();
+    t2 = clock();
+    printf("X25519 64-bit ladder from the base point:\n");
+    print_time(ROUNDS, t2 - t1, b - a);
+  }
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    priv[0] = (uint8_t)j;
+    Hacl_Ed25519_x25519_secret_to_public(pub, priv);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  printf("Hacl_Ed25519_x25519_secret_to_public:\n");
+  print_time(ROUNDS, t2 - t1, b - a);
+}
+
+int
+main()
+{
+  EverCrypt_AutoConfig2_init();
+  bool has_64 = EverCrypt_AutoConfig2_has_adx() && EverCrypt_AutoConfig2_has_bmi2();
+  bool ok = check_keys(has_64);
+  bench(has_64);
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
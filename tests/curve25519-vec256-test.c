@@ -0,0 +1,124 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Curve25519.h"
+#include "Hacl_Curve25519_51.h"
+#include "Hacl_Curve25519_Vec256.h"
+
+#include "test_helpers.h"
+
+#define KEYS 1002
+#define ROUNDS 20000
+
+static uint8_t privs[KEYS * 32], pubs[KEYS * 32], shared[KEYS * 32], expected[KEYS * 32];
+static bool results[KEYS];
+
+// Ordinary points, plus encodings the ladder must treat like the scalar code: the top bit
+// set, u >= p, and u = 0 and u = 1, whose shared secrets are all zero.
+static void
+make_inputs(void)
+{
+  for (int i = 0; i < KEYS; i++) {
+    uint8_t* priv = privs + 32 * i;
+    uint8_t* pub = pubs + 32 * i;
+    for (int j = 0; j < 32; j++) {
+      priv[j] = (uint8_t)(i * 37 + j * 11 + (i >> 2));
+      pub[j] = (uint8_t)(i * 101 + j * (i | 3));
+    }
+    if (i % 9 == 1)
+      pub[31] |= 0x80;
+    if (i % 31 == 2) {
+      memset(pub, 0xff, 32);
+      pub[0] = (uint8_t)(0xed + i % 0x12);
+      pub[31] = 0x7f;
+    }
+    if (i % 97 == 5)
+      memset(pub, 0, 32);
+    if (i % 101 == 6) {
+      memset(pub, 0, 32);
+      pub[0] = 1;
+    }
+  }
+}
+
+static bool
+check_batch(bool has_avx2)
+{
+  bool ok = true;
+  bool expected_all = true;
+  for (int i = 0; i < KEYS; i++) {
+    bool r = Hacl_Curve25519_51_ecdh(expected + 32 * i, privs + 32 * i, pubs + 32 * i);
+    results[i] = !r;
+    expected_all &= r;
+  }
+
+  if (has_avx2) {
+    for (int i = 0; i + 4 <= KEYS; i += 4)
+      Hacl_Curve25519_Vec256_scalarmult4(shared + 32 * i, privs + 32 * i, pubs + 32 * i);
+    ok &= memcmp(shared, expected, 32 * (KEYS / 4 * 4)) == 0;
+    printf("X25519 4-lane ladder against the 51-bit ladder: %s\n", ok ? "Success!" : "FAILURE");
+  }
+
+  // KEYS is not a multiple of four, so the last two go through the scalar code.
+  memset(shared, 0, sizeof(shared));
+  bool all = EverCrypt_Curve25519_ecdh_batch(KEYS, shared, privs, pubs, results);
+  ok &= all == expected_all && !all;
+  ok &= memcmp(shared, expected, sizeof(shared)) == 0;
+  for (int i = 0; i < KEYS; i++) {
+    uint8_t tmp[32];
+    ok &= results[i] == Hacl_Curve25519_51_ecdh(tmp, privs + 32 * i, pubs + 32 * i);
+  }
+  ok &= EverCrypt_Curve25519_ecdh_batch(0, shared, privs, pubs, results);
+  printf("EverCrypt_Curve25519_ecdh_batch: %s\n", ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static void
+bench(bool has_avx2)
+{
+  cycles a, b;
+  clock_t t1, t2;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    EverCrypt_Curve25519_scalarmult(shared, privs + 32 * (j % KEYS), pubs);
+  b = cpucycles_end();
+  t2 = clock();
+  printf("EverCrypt_Curve25519_scalarmult, per key exchange:\n");
+  print_time(ROUNDS, t2 - t1, b - a);
+
+  if (has_avx2) {
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS / 4; j++)
+      Hacl_Curve25519_Vec256_scalarmult4(shared, privs + 32 * (j % 64), pubs);
+    b = cpucycles_end();
+    t2 = clock();
+    printf("X25519 4-lane ladder, per key exchange:\n");
+    print_time(ROUNDS, t2 - t1, b - a);
+  }
+}
+
+int
+main()
+{
+  EverCrypt_AutoConfig2_init();
+  bool has_avx2 = false;
+#if HACL_CAN_COMPILE_VEC256
+  has_avx2 = EverCrypt_AutoConfig2_has_avx2();
+#endif
+  make_inputs();
+  bool ok = check_batch(has_avx2);
+  bench(has_avx2);
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,120 @@
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "EverCrypt_DRBG_Pool.h"
+
+#include "test_helpers.h"
+
+#define THREADS 8
+#define CALLS 4096
+#define OUT 32
+#define ROUNDS 100000
+
+static uint8_t outputs[THREADS][OUT];
+static bool thread_ok[THREADS];
+
+static void*
+worker(void* arg)
+{
+  size_t t = (size_t)arg;
+  uint8_t buf[OUT];
+  bool ok = true;
+  // Runs past EverCrypt_DRBG_reseed_interval to exercise reseeding.
+  for (int i = 0; i < CALLS; i++)
+    ok &= EverCrypt_DRBG_Pool_generate(buf, OUT);
+  memcpy(outputs[t], buf, OUT);
+  thread_ok[t] = ok;
+  return NULL;
+}
+
+static bool
+test_threads(void)
+{
+  pthread_t th[THREADS];
+  for (size_t t = 0; t < THREADS; t++)
+    pthread_create(&th[t], NULL, worker, (void*)t);
+  for (size_t t = 0; t < THREADS; t++)
+    pthread_join(th[t], NULL);
+  bool ok = true;
+  for (size_t t = 0; t < THREADS; t++) {
+    ok &= thread_ok[t];
+    for (size_t u = t + 1; u < THREADS; u++)
+      ok &= memcmp(outputs[t], outputs[u], OUT) != 0;
+  }
+  printf("DRBG pool threads: %s\n", ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static bool
+test_large(void)
+{
+  // Longer than EverCrypt_DRBG_max_output_length.
+  uint32_t len = 3 * 65536 + 17;
+  uint8_t* buf = calloc(len, 1);
+  bool ok = EverCrypt_DRBG_Pool_generate(buf, len);
+  uint8_t zero[64] = { 0 };
+  ok &= memcmp(buf + len - 64, zero, 64) != 0;
+  free(buf);
+  printf("DRBG pool large output: %s\n", ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static bool
+test_fork(void)
+{
+  uint8_t before[OUT], parent[OUT], child[OUT];
+  int fds[2];
+  EverCrypt_DRBG_Pool_generate(before, OUT);
+  if (pipe(fds) != 0)
+    return false;
+  pid_t pid = fork();
+  if (pid == 0) {
+    EverCrypt_DRBG_Pool_generate(child, OUT);
+    ssize_t w = write(fds[1], child, OUT);
+    _exit(w == OUT ? 0 : 1);
+  }
+  EverCrypt_DRBG_Pool_generate(parent, OUT);
+  int status;
+  waitpid(pid, &status, 0);
+  bool ok = read(fds[0], child, OUT) == OUT;
+  close(fds[0]);
+  close(fds[1]);
+  ok &= WIFEXITED(status) && WEXITSTATUS(status) == 0;
+  ok &= memcmp(parent, child, OUT) != 0;
+  printf("DRBG pool fork: %s\n", ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+int
+main()
+{
+  bool ok = true;
+  ok &= test_threads();
+  ok &= test_large();
+  ok &= test_fork();
+
+  uint8_t buf[OUT];
+  cycles a, b;
+  clock_t t1, t2;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    EverCrypt_DRBG_Pool_generate(buf, OUT);
+  b = cpucycles_end();
+  t2 = clock();
+  printf("EverCrypt_DRBG_Pool_generate (%d bytes):\n", OUT);
+  print_time((uint64_t)ROUNDS * OUT, t2 - t1, b - a);
+
+  EverCrypt_DRBG_Pool_thread_free();
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
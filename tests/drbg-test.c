@@ -0,0 +1,148 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_DRBG.h"
+#include "internal/EverCrypt_DRBG.h"
+
+#include "drbg_vectors.h"
+#include "test_helpers.h"
+
+#define ROUNDS 256
+#define SIZE (1 << 20)
+
+static const char* names[] = { "HMAC_DRBG-SHA2-256", "CTR_DRBG-AES256", "ChaCha20-DRBG" };
+
+static bool
+test_alg(EverCrypt_DRBG_state_s* st, const char* name, uint32_t max_n)
+{
+  uint8_t pers[16] = "drbg-test";
+  if (!EverCrypt_DRBG_instantiate(st, pers, sizeof(pers))) {
+    printf("%s: not available, skipping\n", name);
+    EverCrypt_DRBG_uninstantiate(st);
+    return true;
+  }
+  bool ok = true;
+  uint8_t* out1 = calloc(max_n, 1);
+  uint8_t* out2 = calloc(max_n, 1);
+  uint8_t zero[64] = { 0 };
+  uint8_t ai[32] = { 1, 2, 3 };
+  uint32_t lens[] = { 1, 17, 64, 1000, max_n };
+  for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+    uint32_t n = lens[i];
+    ok &= EverCrypt_DRBG_generate(out1, st, n, NULL, 0);
+    ok &= EverCrypt_DRBG_generate(out2, st, n, ai, sizeof(ai));
+    ok &= memcmp(out1, out2, n) != 0;
+    if (n >= 64)
+      ok &= memcmp(out1 + n - 64, zero, 64) != 0;
+  }
+  ok &= EverCrypt_DRBG_reseed(st, ai, sizeof(ai));
+  ok &= EverCrypt_DRBG_generate(out1, st, 32, NULL, 0);
+  printf("%s: %s\n", name, ok ? "Success!" : "FAILURE");
+
+  cycles c0, c1;
+  clock_t t1, t2;
+  uint32_t n = max_n < SIZE ? max_n : SIZE;
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_DRBG_generate(out1, st, n, NULL, 0);
+  }
+  c1 = cpucycles_end();
+  t2 = clock();
+  print_time((uint64_t)ROUNDS * n, t2 - t1, c1 - c0);
+
+  free(out1);
+  free(out2);
+  EverCrypt_DRBG_uninstantiate(st);
+  return ok;
+}
+
+static bool
+test_ctr_kat(ctr_drbg_test_vector* v)
+{
+  uint8_t out[64];
+  EverCrypt_DRBG_state_s* st = EverCrypt_DRBG_create_ctr_aes256();
+  if (!EverCrypt_DRBG_instantiate_with_entropy(
+        st, v->entropy, 48, v->pers, v->pers_len)) {
+    EverCrypt_DRBG_uninstantiate(st);
+    return false;
+  }
+  bool ok = true;
+  if (v->entropy_reseed != NULL)
+    ok &= EverCrypt_DRBG_reseed_with_entropy(
+      st, v->entropy_reseed, 48, v->add_reseed, v->add_reseed_len);
+  ok &= EverCrypt_DRBG_generate_no_reseed(out, st, 64, v->add1, v->add_len);
+  ok &= EverCrypt_DRBG_generate_no_reseed(out, st, 64, v->add2, v->add_len);
+  ok &= compare_and_print(64, out, v->returned);
+  EverCrypt_DRBG_uninstantiate(st);
+  return ok;
+}
+
+static bool
+test_chacha20_kat()
+{
+  uint8_t pers[17] = "chacha20-drbg-kat";
+  uint8_t out1[sizeof(chacha_out1)];
+  uint8_t out2[sizeof(chacha_out2)];
+  EverCrypt_DRBG_state_s* st = EverCrypt_DRBG_create_chacha20();
+  bool ok = true;
+  ok &= EverCrypt_DRBG_instantiate_with_entropy(
+    st, chacha_entropy, sizeof(chacha_entropy), pers, sizeof(pers));
+  ok &= EverCrypt_DRBG_generate_no_reseed(out1, st, sizeof(out1), NULL, 0);
+  ok &= EverCrypt_DRBG_reseed_with_entropy(st,
+                                           chacha_entropy_reseed,
+                                           sizeof(chacha_entropy_reseed),
+                                           chacha_add,
+                                           sizeof(chacha_add));
+  ok &= EverCrypt_DRBG_generate_no_reseed(out2, st, sizeof(out2), NULL, 0);
+  ok &= compare_and_print(sizeof(out1), out1, chacha_out1);
+  ok &= compare_and_print(sizeof(out2), out2, chacha_out2);
+  EverCrypt_DRBG_uninstantiate(st);
+  return ok;
+}
+
+int
+main()
+{
+  EverCrypt_AutoConfig2_init();
+  bool ok = true;
+  if (EverCrypt_AutoConfig2_has_aesni() && EverCrypt_AutoConfig2_has_pclmulqdq() &&
+      EverCrypt_AutoConfig2_has_avx() && EverCrypt_AutoConfig2_has_sse()) {
+    bool kat = true;
+    for (size_t i = 0; i < sizeof(ctr_drbg_vectors) / sizeof(ctr_drbg_vectors[0]); i++)
+      kat &= test_ctr_kat(&ctr_drbg_vectors[i]);
+    printf("CTR_DRBG-AES256 KAT: %s\n", kat ? "Success!" : "FAILURE");
+    ok &= kat;
+  }
+  bool kat = test_chacha20_kat();
+  printf("ChaCha20-DRBG KAT: %s\n", kat ? "Success!" : "FAILURE");
+  ok &= kat;
+
+  ok &= test_alg(
+    EverCrypt_DRBG_create(Spec_Hash_Definitions_SHA2_256), names[0], 65536);
+  ok &= test_alg(EverCrypt_DRBG_create_ctr_aes256(), names[1], 3 * 65536 + 5);
+  ok &= test_alg(EverCrypt_DRBG_create_chacha20(), names[2], 3 * 65536 + 5);
+
+  // HMAC_DRBG keeps its per-request limit; CTR_DRBG rejects long inputs since
+  // it runs without a derivation function.
+  uint8_t big[65537];
+  uint8_t pers[49] = { 0 };
+  EverCrypt_DRBG_state_s* st = EverCrypt_DRBG_create(Spec_Hash_Definitions_SHA2_256);
+  ok &= EverCrypt_DRBG_instantiate(st, NULL, 0);
+  ok &= !EverCrypt_DRBG_generate(big, st, sizeof(big), NULL, 0);
+  EverCrypt_DRBG_uninstantiate(st);
+  st = EverCrypt_DRBG_create_ctr_aes256();
+  ok &= !EverCrypt_DRBG_instantiate(st, pers, sizeof(pers));
+  EverCrypt_DRBG_uninstantiate(st);
+  printf("Limits: %s\n", ok ? "Success!" : "FAILURE");
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+// CTR_DRBG with AES-256 and no derivation function (SP 800-90A, 10.2.1), in the
+// layout of the NIST CAVP drbgvectors_pr_false files: instantiate, optionally
+// reseed, then generate twice and compare the second output.
+typedef struct
+{
+  uint8_t* entropy;
+  uint8_t* pers;
+  size_t pers_len;
+  uint8_t* entropy_reseed;
+  uint8_t* add_reseed;
+  size_t add_reseed_len;
+  uint8_t* add1;
+  uint8_t* add2;
+  size_t add_len;
+  uint8_t returned[64];
+} ctr_drbg_test_vector;
+
+// CAVP AES-256 no df, no personalization string, no additional input, COUNT = 0.
+static uint8_t ctr_entropy0[48] = {
+  0xdf, 0x5d, 0x73, 0xfa, 0xa4, 0x68, 0x64, 0x9e, 0xdd, 0xa3, 0x3b, 0x5c,
+  0xca, 0x79, 0xb0, 0xb0, 0x56, 0x00, 0x41, 0x9c, 0xcb, 0x7a, 0x87, 0x9d,
+  0xdf, 0xec, 0x9d, 0xb3, 0x2e, 0xe4, 0x94, 0xe5, 0x53, 0x1b, 0x51, 0xde,
+  0x16, 0xa3, 0x0f, 0x76, 0x92, 0x62, 0x47, 0x4c, 0x73, 0xbe, 0xc0, 0x10
+};
+
+// Personalization string, reseed and additional input. Produced by an independent
+// implementation of SP 800-90A and cross-checked against OpenSSL's CTR-DRBG.
+static uint8_t ctr_entropy1[48] = {
+  0xf5, 0xfe, 0x2b, 0x81, 0xc9, 0xb5, 0x9e, 0x4a, 0xe2, 0xdd, 0x44, 0x86,
+  0xba, 0x7f, 0x39, 0x90, 0x0a, 0x87, 0xaf, 0x0a, 0xa9, 0x0d, 0x95, 0xf6,
+  0x42, 0x04, 0x79, 0x43, 0xf7, 0x30, 0x25, 0x60, 0x90, 0x15, 0x19, 0x35,
+  0xcc, 0x54, 0xda, 0x8d, 0x81, 0xb6, 0x9b, 0x4e, 0x52, 0xac, 0xed, 0xfa
+};
+
+static uint8_t ctr_pers1[48] = {
+  0x47, 0x26, 0xaa, 0x00, 0xea, 0xab, 0x43, 0xa6, 0x60, 0xab, 0x8e, 0x6b,
+  0xc4, 0xd4, 0x0a, 0x53, 0x7e, 0xe4, 0xa8, 0x81, 0xab, 0xd8, 0x7f, 0x58,
+  0x16, 0xac, 0xd9, 0x2e, 0xb2, 0xb3, 0x47, 0x17, 0xa7, 0xe5, 0x9f, 0xe8,
+  0x5f, 0xa5, 0x27, 0x61, 0x50, 0x70, 0xc8, 0xff, 0xcd, 0xfd, 0xe8, 0x5a
+};
+
+static uint8_t ctr_entropy_reseed1[48] = {
+  0xe1, 0x6a, 0x09, 0xea, 0x86, 0xc4, 0xc4, 0xc1, 0xef, 0x67, 0x60, 0x3e,
+  0xc8, 0x37, 0x1b, 0x79, 0x99, 0xb2, 0x97, 0xa2, 0xb2, 0x59, 0x62, 0x6b,
+  0xda, 0xac, 0xc6, 0xd8, 0xc0, 0xed, 0x6d, 0x07, 0x58, 0x78, 0xa9, 0x9c,
+  0x43, 0x63, 0xcb, 0xa0, 0x39, 0x37, 0xa7, 0xef, 0xf7, 0x1e, 0x41, 0x06
+};
+
+static uint8_t ctr_add_reseed1[48] = {
+  0x0d, 0xe4, 0xbf, 0x8e, 0xd5, 0x4b, 0xbd, 0x16, 0x74, 0x95, 0x52, 0x2b,
+  0x71, 0xb4, 0x8a, 0x7e, 0x37, 0xb0, 0xd9, 0x33, 0x3b, 0xf7, 0x0f, 0xfa,
+  0x52, 0xda, 0xfa, 0x5b, 0x1d, 0xef, 0x9c, 0x55, 0xae, 0x2f, 0x40, 0x2b,
+  0x5b, 0xb9, 0xa3, 0x2b, 0x53, 0x06, 0xf9, 0xce, 0xb5, 0x78, 0xf3, 0x0e
+};
+
+static uint8_t ctr_add1[48] = {
+  0xee, 0x8f, 0xab, 0x1b, 0xc8, 0xc5, 0x58, 0x46, 0x5b, 0x14, 0xb2, 0x8a,
+  0xa3, 0xdf, 0x0f, 0xa9, 0x4a, 0xc2, 0x7a, 0xe4, 0x51, 0x90, 0x0f, 0xbf,
+  0xab, 0x74, 0xb8, 0xd9, 0x5e, 0x10, 0x9c, 0x46, 0xc1, 0xf6, 0x65, 0x84,
+  0x90, 0x94, 0x0a, 0xda, 0xda, 0x34, 0x09, 0x8a, 0xa6, 0xf3, 0x33, 0xbf
+};
+
+static uint8_t ctr_add2[48] = {
+  0xce, 0x8a, 0x89, 0x3d, 0xf4, 0x56, 0xd9, 0x50, 0x9d, 0xf7, 0x66, 0xaf,
+  0x55, 0x3d, 0x11, 0xdf, 0x9f, 0x87, 0x49, 0xa8, 0x5c, 0xce, 0xfa, 0xdd,
+  0xb6, 0xae, 0x95, 0x0b, 0x6e, 0xd8, 0xfe, 0x16, 0xa1, 0x7f, 0x6a, 0xaa,
+  0x63, 0x50, 0x22, 0x65, 0x14, 0x83, 0x3c, 0xf2, 0x65, 0xf2, 0xb9, 0xef
+};
+
+static ctr_drbg_test_vector ctr_drbg_vectors[3] = {
+  { ctr_entropy0, NULL, 0, NULL, NULL, 0, NULL, NULL, 0,
+    {
+      0xd1, 0xc0, 0x7c, 0xd9, 0x5a, 0xf8, 0xa7, 0xf1, 0x10, 0x12, 0xc8, 0x4c,
+      0xe4, 0x8b, 0xb8, 0xcb, 0x87, 0x18, 0x9e, 0x99, 0xd4, 0x0f, 0xcc, 0xb1,
+      0x77, 0x1c, 0x61, 0x9b, 0xdf, 0x82, 0xab, 0x22, 0x80, 0xb1, 0xdc, 0x2f,
+      0x25, 0x81, 0xf3, 0x91, 0x64, 0xf7, 0xac, 0x0c, 0x51, 0x04, 0x94, 0xb3,
+      0xa4, 0x3c, 0x41, 0xb7, 0xdb, 0x17, 0x51, 0x4c, 0x87, 0xb1, 0x07, 0xae,
+      0x79, 0x3e, 0x01, 0xc5 } },
+  { ctr_entropy1, ctr_pers1, 48, NULL, NULL, 0, ctr_add1, ctr_add2, 48,
+    {
+      0x4b, 0x2b, 0xd7, 0x17, 0x80, 0x2e, 0x0f, 0xc2, 0xc7, 0x84, 0xa4, 0xac,
+      0x16, 0xab, 0x72, 0x99, 0x41, 0x5c, 0x80, 0x7a, 0x9e, 0x31, 0x10, 0xff,
+      0xf7, 0x3b, 0x60, 0x06, 0x65, 0xbb, 0xa0, 0x7d, 0x91, 0x5d, 0x00, 0x41,
+      0x28, 0xac, 0xc5, 0xb0, 0xd7, 0x57, 0x5f, 0x94, 0x0b, 0x8e, 0x8b, 0x28,
+      0x60, 0x15, 0xa9, 0xd1, 0x77, 0x90, 0xd9, 0x9a, 0x3d, 0x16, 0x7d, 0xce,
+      0x50, 0x97, 0xba, 0xcb } },
+  { ctr_entropy1, ctr_pers1, 48, ctr_entropy_reseed1, ctr_add_reseed1, 48,
+    ctr_add1, ctr_add2, 48,
+    {
+      0x2d, 0x03, 0x73, 0x15, 0x58, 0xf3, 0x58, 0x3d, 0x04, 0x47, 0xb9, 0xa1,
+      0x58, 0xe4, 0x49, 0x8e, 0x29, 0xc4, 0x51, 0x17, 0xed, 0xf8, 0x32, 0xa9,
+      0xc9, 0x2e, 0x8c, 0xb7, 0x0f, 0x1f, 0x25, 0x03, 0x82, 0x1b, 0x80, 0x01,
+      0x04, 0x1e, 0xa7, 0x96, 0x3c, 0xff, 0x72, 0x78, 0x67, 0x41, 0xa6, 0xcc,
+      0x6e, 0xe9, 0xcf, 0x33, 0x06, 0x0e, 0xd7, 0x37, 0x01, 0x0d, 0x26, 0x25,
+      0x20, 0x88, 0x04, 0xfe } },
+};
+
+// ChaCha20 DRBG regression vector: instantiate with chacha_entropy and the
+// personalization string "chacha20-drbg-kat", generate chacha_out1, reseed with
+// chacha_entropy_reseed and chacha_add, then generate chacha_out2.
+static uint8_t chacha_entropy[48] = {
+  0xa5, 0xfd, 0x49, 0xdc, 0x2c, 0x86, 0x89, 0xd2, 0xf0, 0xee, 0x87, 0x0b,
+  0x0d, 0xbe, 0x0b, 0xe5, 0xcf, 0x22, 0x24, 0xf0, 0xc7, 0xc8, 0x98, 0x7b,
+  0x1f, 0x61, 0x62, 0x1c, 0x90, 0xc8, 0x81, 0xff, 0xfe, 0xb3, 0xd7, 0xb5,
+  0x7b, 0x78, 0x02, 0x8f, 0xc1, 0x25, 0xcb, 0xc6, 0xf7, 0xd8, 0x1d, 0x86
+};
+
+static uint8_t chacha_entropy_reseed[32] = {
+  0x9d, 0x14, 0x15, 0x76, 0xd9, 0x88, 0xa4, 0x99, 0x29, 0xaf, 0xd3, 0x58,
+  0x2c, 0x6f, 0xc0, 0xa5, 0x72, 0x7d, 0x16, 0xa2, 0x09, 0x73, 0xa3, 0x96,
+  0x23, 0x04, 0xb5, 0xc5, 0x98, 0xea, 0x69, 0xad
+};
+
+static uint8_t chacha_add[20] = {
+  0x76, 0x28, 0xa4, 0x8d, 0xcc, 0xe6, 0xd9, 0x58, 0x8e, 0xda, 0x7b, 0x57,
+  0xfe, 0xed, 0x72, 0xca, 0x5a, 0xde, 0x61, 0xa4
+};
+
+static uint8_t chacha_out1[100] = {
+  0xfe, 0x50, 0xbe, 0x20, 0x6d, 0x31, 0x06, 0x67, 0x47, 0xa6, 0x3a, 0x82,
+  0x18, 0x84, 0xdf, 0x2e, 0x11, 0xac, 0xa8, 0xf8, 0x26, 0x50, 0xf8, 0xfe,
+  0xca, 0x4c, 0xa8, 0x38, 0xa0, 0x94, 0xb0, 0x92, 0xb3, 0xf0, 0x19, 0xa8,
+  0x43, 0x87, 0x3d, 0x94, 0x79, 0x06, 0x2c, 0x4a, 0x1b, 0x8f, 0xaf, 0x8c,
+  0xae, 0x7f, 0xaa, 0x46, 0xd8, 0xd7, 0x44, 0xb4, 0xaf, 0x75, 0x24, 0xe6,
+  0xe0, 0x99, 0x23, 0xd8, 0xf7, 0x5f, 0x3d, 0x59, 0x0d, 0xd0, 0x0c, 0x29,
+  0xaa, 0xe4, 0x52, 0x07, 0xcf, 0xbc, 0xa8, 0x0c, 0x0b, 0xb4, 0x5e, 0x7f,
+  0xf4, 0x9a, 0x58, 0x4c, 0xc2, 0x68, 0x45, 0x12, 0xdf, 0xb3, 0x19, 0xcf,
+  0x69, 0x77, 0x8a, 0x68
+};
+
+static uint8_t chacha_out2[64] = {
+  0x54, 0xa3, 0x9c, 0x42, 0x08, 0xe2, 0x64, 0xce, 0x6a, 0xf4, 0xd2, 0xab,
+  0xf0, 0xef, 0x9a, 0x54, 0x73, 0xfa, 0x6c, 0x71, 0xce, 0x72, 0x6b, 0xe5,
+  0x67, 0x3b, 0xe5, 0xae, 0xa1, 0x5a, 0x6b, 0xbb, 0x12, 0xfc, 0x1e, 0xba,
+  0x9a, 0x87, 0x64, 0x30, 0xe1, 0xda, 0x2b, 0x8f, 0x30, 0xb1, 0xa0, 0xf8,
+  0x6c, 0xc3, 0x39, 0x4a, 0x18, 0x00, 0x5a, 0x35, 0xf9, 0x62, 0x37, 0xd5,
+  0x0f, 0x8b, 0xfe, 0xe5
+};
@@ -0,0 +1,149 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "Hacl_EC_Ed25519.h"
+
+#include "test_helpers.h"
+
+#define N 300
+#define ROUNDS 2000
+
+static uint8_t scalars[N][32], compressed[N][32], expected[N][32];
+static uint64_t points[N][20];
+
+// Points [k]B for assorted k, so that their Z coordinates differ.
+static void
+make_points(void)
+{
+  uint64_t b[20];
+  Hacl_EC_Ed25519_mk_base_point(b);
+  for (int i = 0; i < N; i++) {
+    uint8_t k[32];
+    for (int j = 0; j < 32; j++) {
+      k[j] = (uint8_t)(i * 19 + j * 3 + 7);
+      scalars[i][j] = (uint8_t)(i * 53 + j * 29 + (i >> 2));
+    }
+    Hacl_EC_Ed25519_point_mul(k, b, points[i]);
+  }
+  // Edge cases: the identity, a zero scalar, and scalars with the top bits set.
+  Hacl_EC_Ed25519_mk_point_at_inf(points[5]);
+  memset(scalars[6], 0, 32);
+  memset(scalars[7], 0xff, 32);
+  scalars[8][31] = 0x80;
+}
+
+static bool
+check_compress_batch(void)
+{
+  bool ok = true;
+  uint32_t ns[4] = { 0, 1, 64, N };
+  for (int k = 0; k < 4; k++) {
+    memset(compressed, 0, sizeof(compressed));
+    Hacl_EC_Ed25519_point_compress_batch(ns[k], (uint64_t*)points, (uint8_t*)compressed);
+    for (uint32_t i = 0; i < ns[k]; i++) {
+      Hacl_EC_Ed25519_point_compress(points[i], expected[i]);
+      ok &= memcmp(compressed[i], expected[i], 32) == 0;
+    }
+  }
+  printf("Hacl_EC_Ed25519_point_compress_batch: %s\n", ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static bool
+check_mul(void)
+{
+  bool ok = true;
+  uint64_t r1[20], r2[20], sum[20], tmp[20], msm[20];
+  Hacl_EC_Ed25519_mk_point_at_inf(sum);
+  for (int i = 0; i < N; i++) {
+    Hacl_EC_Ed25519_point_mul(scalars[i], points[i], r1);
+    Hacl_EC_Ed25519_point_mul_vartime(scalars[i], points[i], r2);
+    ok &= Hacl_EC_Ed25519_point_eq(r1, r2);
+    Hacl_EC_Ed25519_point_add(sum, r1, tmp);
+    memcpy(sum, tmp, sizeof(sum));
+    // Every prefix of a few sizes, including the smallest.
+    if (i == 0 || i == 1 || i == 17 || i == N - 1) {
+      uint32_t n = (uint32_t)i + 1;
+      ok &= Hacl_EC_Ed25519_point_mul_multi(n, (uint8_t*)scalars, (uint64_t*)points, msm);
+      ok &= Hacl_EC_Ed25519_point_eq(msm, sum);
+    }
+  }
+  uint64_t inf[20];
+  Hacl_EC_Ed25519_mk_point_at_inf(inf);
+  ok &= Hacl_EC_Ed25519_point_mul_multi(0, NULL, NULL, msm);
+  ok &= Hacl_EC_Ed25519_point_eq(msm, inf);
+  printf("Hacl_EC_Ed25519_point_mul_vartime and point_mul_multi: %s\n",
+         ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static void
+bench(void)
+{
+  uint64_t r[20];
+  cycles c0, c1;
+  clock_t t1, t2;
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_EC_Ed25519_point_compress(points[j % N], compressed[j % N]);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("Hacl_EC_Ed25519_point_compress, per point:\n");
+  print_time(ROUNDS, t2 - t1, c1 - c0);
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS / N; j++)
+    Hacl_EC_Ed25519_point_compress_batch(N, (uint64_t*)points, (uint8_t*)compressed);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("Hacl_EC_Ed25519_point_compress_batch, per point:\n");
+  print_time(ROUNDS / N * N, t2 - t1, c1 - c0);
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_EC_Ed25519_point_mul(scalars[j % N], points[j % N], r);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("Hacl_EC_Ed25519_point_mul:\n");
+  print_time(ROUNDS, t2 - t1, c1 - c0);
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_EC_Ed25519_point_mul_vartime(scalars[j % N], points[j % N], r);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("Hacl_EC_Ed25519_point_mul_vartime:\n");
+  print_time(ROUNDS, t2 - t1, c1 - c0);
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS / N; j++)
+    Hacl_EC_Ed25519_point_mul_multi(N, (uint8_t*)scalars, (uint64_t*)points, r);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("Hacl_EC_Ed25519_point_mul_multi (%d points), per point:\n", N);
+  print_time(ROUNDS / N * N, t2 - t1, c1 - c0);
+}
+
+int
+main()
+{
+  make_points();
+  bool ok = check_compress_batch();
+  ok &= check_mul();
+  bench();
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
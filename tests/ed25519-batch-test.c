@@ -0,0 +1,165 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "Hacl_Ed25519.h"
+
+#include "test_helpers.h"
+
+#define MAX_SIGS 2100
+#define MSG_LEN 64
+#define ROUNDS 16
+#define BENCH_SIGS 1024
+
+static uint8_t pks[MAX_SIGS][32], sigs[MAX_SIGS][64], msgs[MAX_SIGS][MSG_LEN];
+static uint8_t *pk_ptrs[MAX_SIGS], *sig_ptrs[MAX_SIGS], *msg_ptrs[MAX_SIGS];
+static uint32_t msg_lens[MAX_SIGS];
+static bool results[MAX_SIGS];
+
+// A signature whose R has a component of order 8: it fails the plain equation but holds
+// with the cofactor.
+static uint8_t tors_pk[32] = { 0x29, 0xac, 0xba, 0xe1, 0x41, 0xbc, 0xca, 0xf0, 0xb2, 0x2e, 0x1a,
+                               0x94, 0xd3, 0x4d, 0x0b, 0xc7, 0x36, 0x1e, 0x52, 0x6d, 0x0b, 0xfe,
+                               0x12, 0xc8, 0x97, 0x94, 0xbc, 0x93, 0x22, 0x96, 0x6d, 0xd7 };
+static uint8_t tors_msg[22] = "torsion component in R";
+static uint8_t tors_sig[64] = { 0x58, 0x68, 0xf2, 0x07, 0x8c, 0x9f, 0xf5, 0x51, 0x1c, 0xe2, 0x33,
+                                0xd9, 0x3a, 0x40, 0x99, 0x58, 0x68, 0x2f, 0x8f, 0x81, 0x61, 0x3b,
+                                0xe5, 0x4f, 0xaf, 0x17, 0x5b, 0xe4, 0x15, 0x20, 0x33, 0x4d, 0xa3,
+                                0xfb, 0x52, 0x69, 0x12, 0x3c, 0xbb, 0xa3, 0x50, 0x13, 0xe7, 0x48,
+                                0x53, 0xd2, 0xae, 0x39, 0xe7, 0x20, 0x0c, 0x99, 0x4c, 0xf9, 0x91,
+                                0x3a, 0xed, 0x3a, 0x7a, 0x6a, 0xfc, 0x97, 0x4b, 0x08 };
+
+// A few keys shared by many signatures, as in a block of transactions.
+static void
+make_sigs(uint32_t n)
+{
+  for (uint32_t i = 0; i < n; i++) {
+    uint8_t sk[32];
+    for (int j = 0; j < 32; j++)
+      sk[j] = (uint8_t)(i % 37 + 11 * j);
+    msg_lens[i] = i % MSG_LEN;
+    for (uint32_t j = 0; j < msg_lens[i]; j++)
+      msgs[i][j] = (uint8_t)(i + 3 * j);
+    Hacl_Ed25519_secret_to_public(pks[i], sk);
+    Hacl_Ed25519_sign(sigs[i], sk, msg_lens[i], msgs[i]);
+    pk_ptrs[i] = pks[i];
+    sig_ptrs[i] = sigs[i];
+    msg_ptrs[i] = msgs[i];
+  }
+}
+
+// The batch result and every per-entry result must agree with
+// Hacl_Ed25519_verify_cofactored.
+static bool
+check_batch(const char* name, uint32_t n)
+{
+  bool expected_all = true;
+  bool ok = true;
+  memset(results, 0, sizeof(results));
+  bool all = Hacl_Ed25519_verify_batch(n, pk_ptrs, msg_ptrs, msg_lens, sig_ptrs, results);
+  for (uint32_t i = 0; i < n; i++) {
+    bool expected = Hacl_Ed25519_verify_cofactored(pks[i], msg_lens[i], msgs[i], sigs[i]);
+    expected_all &= expected;
+    ok &= results[i] == expected;
+  }
+  ok &= all == expected_all;
+  printf("Ed25519 verify_batch (%s, %" PRIu32 " signatures): %s\n",
+         name,
+         n,
+         ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+// The torsion signature is accepted by the batch on both sides of the 8-entry threshold,
+// and whether or not another entry of the chunk is invalid.
+static bool
+check_torsion(void)
+{
+  bool ok = !Hacl_Ed25519_verify(tors_pk, 22, tors_msg, tors_sig);
+  ok &= Hacl_Ed25519_verify_cofactored(tors_pk, 22, tors_msg, tors_sig);
+  make_sigs(16);
+  memcpy(pks[3], tors_pk, 32);
+  memcpy(msgs[3], tors_msg, 22);
+  msg_lens[3] = 22;
+  memcpy(sigs[3], tors_sig, 64);
+  ok &= check_batch("torsion R", 4);
+  ok &= results[3];
+  ok &= check_batch("torsion R", 16);
+  ok &= results[3];
+  sigs[10][40] ^= 1;
+  ok &= check_batch("torsion R and an invalid entry", 16);
+  ok &= results[3] && !results[10];
+  return ok;
+}
+
+static void
+bench(void)
+{
+  cycles c0, c1;
+  clock_t t1, t2;
+  make_sigs(BENCH_SIGS);
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    for (uint32_t i = 0; i < BENCH_SIGS; i++)
+      Hacl_Ed25519_verify(pks[i], msg_lens[i], msgs[i], sigs[i]);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("Ed25519 verify, per signature:\n");
+  print_time(ROUNDS * BENCH_SIGS, t2 - t1, c1 - c0);
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_Ed25519_verify_batch(BENCH_SIGS, pk_ptrs, msg_ptrs, msg_lens, sig_ptrs, results);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("Ed25519 verify_batch (%d signatures), per signature:\n", BENCH_SIGS);
+  print_time(ROUNDS * BENCH_SIGS, t2 - t1, c1 - c0);
+}
+
+int
+main()
+{
+  bool ok = true;
+  make_sigs(MAX_SIGS);
+  ok &= check_batch("empty", 0);
+  ok &= check_batch("valid", 1);
+  ok &= check_batch("valid", 7);
+  ok &= check_batch("valid", 8);
+  ok &= check_batch("valid", 300);
+  // Spans two chunks.
+  ok &= check_batch("valid", MAX_SIGS);
+
+  // A forged message, a flipped bit of S, a signature under the wrong key, an R that
+  // does not decompress, an S that is not reduced and a public key that does not
+  // decompress.
+  msgs[3][0] ^= 1;
+  sigs[40][33] ^= 4;
+  memcpy(pks[77], pks[78], 32);
+  memset(sigs[150], 0xff, 31);
+  sigs[150][31] = 0x7f;
+  sigs[201][63] |= 0xf0;
+  pks[299][0] = 2;
+  memset(pks[299] + 1, 0, 31);
+  ok &= check_batch("invalid entries", 300);
+  ok &= check_batch("invalid entries", 8);
+
+  // One bad entry in the second chunk only.
+  make_sigs(MAX_SIGS);
+  sigs[2080][40] ^= 1;
+  ok &= check_batch("invalid in second chunk", MAX_SIGS);
+
+  ok &= check_torsion();
+
+  bench();
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,136 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "Hacl_Ed25519.h"
+
+#include "test_helpers.h"
+
+#define KEYS 10
+#define SIGS 400
+#define MSG_LEN 48
+#define ROUNDS 16384
+
+static uint8_t pks[KEYS][32], sigs[SIGS][64], msgs[SIGS][MSG_LEN];
+static Hacl_Ed25519_pk_ctx ctxs[KEYS];
+
+static void
+make_sigs(void)
+{
+  for (int k = 0; k < KEYS; k++) {
+    uint8_t sk[32];
+    for (int j = 0; j < 32; j++)
+      sk[j] = (uint8_t)(k * 29 + 5 * j);
+    Hacl_Ed25519_secret_to_public(pks[k], sk);
+  }
+  for (int i = 0; i < SIGS; i++) {
+    uint8_t sk[32];
+    for (int j = 0; j < 32; j++)
+      sk[j] = (uint8_t)(i % KEYS * 29 + 5 * j);
+    for (int j = 0; j < MSG_LEN; j++)
+      msgs[i][j] = (uint8_t)(i * 7 + j);
+    Hacl_Ed25519_sign(sigs[i], sk, MSG_LEN, msgs[i]);
+    // Corrupt some entries: the message, S, R, and S out of range.
+    if (i % 11 == 3)
+      msgs[i][i % MSG_LEN] ^= 1;
+    if (i % 13 == 5)
+      sigs[i][32 + i % 32] ^= 0x10;
+    if (i % 17 == 7)
+      sigs[i][i % 32] ^= 0x01;
+    if (i % 19 == 9)
+      sigs[i][63] |= 0xe0;
+  }
+}
+
+// Every signature is checked against every key, so most pairs are invalid, and the
+// context and cache paths must agree with Hacl_Ed25519_verify on all of them.
+static bool
+check_all(void)
+{
+  bool ok = true;
+  int valid = 0;
+  // Fewer slots than keys, so entries are evicted and rebuilt.
+  Hacl_Ed25519_pk_cache* c = Hacl_Ed25519_pk_cache_malloc(4);
+  ok &= c != NULL;
+  for (int k = 0; k < KEYS; k++)
+    ok &= Hacl_Ed25519_pk_ctx_init(&ctxs[k], pks[k]);
+  for (int i = 0; i < SIGS; i++) {
+    for (int k0 = 0; k0 < KEYS; k0++) {
+      int k = (k0 + i) % KEYS;
+      bool expected = Hacl_Ed25519_verify(pks[k], MSG_LEN, msgs[i], sigs[i]);
+      valid += expected;
+      ok &= Hacl_Ed25519_verify_with_ctx(&ctxs[k], MSG_LEN, msgs[i], sigs[i]) == expected;
+      ok &= Hacl_Ed25519_verify_cached(c, pks[k], MSG_LEN, msgs[i], sigs[i]) == expected;
+    }
+  }
+  ok &= valid > SIGS / 2;
+
+  // A public key that does not decompress.
+  uint8_t bad_pk[32];
+  memset(bad_pk, 0xff, 32);
+  bad_pk[31] = 0x7f;
+  Hacl_Ed25519_pk_ctx bad;
+  ok &= !Hacl_Ed25519_pk_ctx_init(&bad, bad_pk);
+  ok &= !Hacl_Ed25519_verify_with_ctx(&bad, MSG_LEN, msgs[0], sigs[0]);
+  ok &= !Hacl_Ed25519_verify_cached(c, bad_pk, MSG_LEN, msgs[0], sigs[0]);
+  ok &= Hacl_Ed25519_pk_cache_malloc(0) == NULL;
+  Hacl_Ed25519_pk_cache_free(c);
+
+  printf("Ed25519 verify_with_ctx and verify_cached: %s\n", ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static void
+bench(void)
+{
+  // A valid signature under key 0.
+  int i = 10;
+  Hacl_Ed25519_pk_cache* c = Hacl_Ed25519_pk_cache_malloc(64);
+  cycles c0, c1;
+  clock_t t1, t2;
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_Ed25519_verify(pks[0], MSG_LEN, msgs[i], sigs[i]);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("Ed25519 verify:\n");
+  print_time(ROUNDS, t2 - t1, c1 - c0);
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_Ed25519_verify_with_ctx(&ctxs[0], MSG_LEN, msgs[i], sigs[i]);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("Ed25519 verify_with_ctx:\n");
+  print_time(ROUNDS, t2 - t1, c1 - c0);
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_Ed25519_verify_cached(c, pks[j % KEYS], MSG_LEN, msgs[i], sigs[i]);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("Ed25519 verify_cached (%d keys):\n", KEYS);
+  print_time(ROUNDS, t2 - t1, c1 - c0);
+  Hacl_Ed25519_pk_cache_free(c);
+}
+
+int
+main()
+{
+  make_sigs();
+  bool ok = check_all();
+  ok &= Hacl_Ed25519_verify(pks[0], MSG_LEN, msgs[10], sigs[10]);
+  bench();
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
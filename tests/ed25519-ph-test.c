@@ -0,0 +1,146 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "Hacl_Ed25519.h"
+#include "Hacl_Hash_SHA2.h"
+
+#include "test_helpers.h"
+
+#define SIZE (16 * 1024 * 1024)
+#define CHUNK 4096
+
+// RFC 8032, Section 7.2, test "foo".
+static uint8_t ctx_sk[32] = { 0x03, 0x05, 0x33, 0x4e, 0x38, 0x1a, 0xf7, 0x8f, 0x14, 0x1c, 0xb6,
+                              0x66, 0xf6, 0x19, 0x9f, 0x57, 0xbc, 0x34, 0x95, 0x33, 0x5a, 0x25,
+                              0x6a, 0x95, 0xbd, 0x2a, 0x55, 0xbf, 0x54, 0x66, 0x63, 0xf6 };
+static uint8_t ctx_pk[32] = { 0xdf, 0xc9, 0x42, 0x5e, 0x4f, 0x96, 0x8f, 0x7f, 0x0c, 0x29, 0xf0,
+                              0x25, 0x9c, 0xf5, 0xf9, 0xae, 0xd6, 0x85, 0x1c, 0x2b, 0xb4, 0xad,
+                              0x8b, 0xfb, 0x86, 0x0c, 0xfe, 0xe0, 0xab, 0x24, 0x82, 0x92 };
+static uint8_t ctx_msg[16] = { 0xf7, 0x26, 0x93, 0x6d, 0x19, 0xc8, 0x00, 0x49,
+                               0x4e, 0x3f, 0xda, 0xff, 0x20, 0xb2, 0x76, 0xa8 };
+static uint8_t ctx_sig[64] = { 0x55, 0xa4, 0xcc, 0x2f, 0x70, 0xa5, 0x4e, 0x04, 0x28, 0x8c, 0x5f,
+                               0x4c, 0xd1, 0xe4, 0x5a, 0x7b, 0xb5, 0x20, 0xb3, 0x62, 0x92, 0x91,
+                               0x18, 0x76, 0xca, 0xda, 0x73, 0x23, 0x19, 0x8d, 0xd8, 0x7a, 0x8b,
+                               0x36, 0x95, 0x0b, 0x95, 0x13, 0x00, 0x22, 0x90, 0x7a, 0x7f, 0xb7,
+                               0xc4, 0xe9, 0xb2, 0xd5, 0xf6, 0xcc, 0xa6, 0x85, 0xa5, 0x87, 0xb4,
+                               0xb2, 0x1f, 0x4b, 0x88, 0x8e, 0x4e, 0x7e, 0xdb, 0x0d };
+
+// RFC 8032, Section 7.3, test "abc".
+static uint8_t ph_sk[32] = { 0x83, 0x3f, 0xe6, 0x24, 0x09, 0x23, 0x7b, 0x9d, 0x62, 0xec, 0x77,
+                             0x58, 0x75, 0x20, 0x91, 0x1e, 0x9a, 0x75, 0x9c, 0xec, 0x1d, 0x19,
+                             0x75, 0x5b, 0x7d, 0xa9, 0x01, 0xb9, 0x6d, 0xca, 0x3d, 0x42 };
+static uint8_t ph_pk[32] = { 0xec, 0x17, 0x2b, 0x93, 0xad, 0x5e, 0x56, 0x3b, 0xf4, 0x93, 0x2c,
+                             0x70, 0xe1, 0x24, 0x50, 0x34, 0xc3, 0x54, 0x67, 0xef, 0x2e, 0xfd,
+                             0x4d, 0x64, 0xeb, 0xf8, 0x19, 0x68, 0x34, 0x67, 0xe2, 0xbf };
+static uint8_t ph_sig[64] = { 0x98, 0xa7, 0x02, 0x22, 0xf0, 0xb8, 0x12, 0x1a, 0xa9, 0xd3, 0x0f,
+                              0x81, 0x3d, 0x68, 0x3f, 0x80, 0x9e, 0x46, 0x2b, 0x46, 0x9c, 0x7f,
+                              0xf8, 0x76, 0x39, 0x49, 0x9b, 0xb9, 0x4e, 0x6d, 0xae, 0x41, 0x31,
+                              0xf8, 0x50, 0x42, 0x46, 0x3c, 0x2a, 0x35, 0x5a, 0x20, 0x03, 0xd0,
+                              0x62, 0xad, 0xf5, 0xaa, 0xa1, 0x0b, 0x8c, 0x61, 0xe6, 0x36, 0x06,
+                              0x2a, 0xaa, 0xd1, 0x1c, 0x2a, 0x26, 0x08, 0x34, 0x06 };
+
+static bool
+check_vectors(void)
+{
+  uint8_t sig[64], pk[32], hash[64], ctx[256];
+  uint8_t foo[3] = { 'f', 'o', 'o' }, bar[3] = { 'b', 'a', 'r' }, abc[3] = { 'a', 'b', 'c' };
+  memset(ctx, 'c', 256);
+
+  Hacl_Ed25519_secret_to_public(pk, ctx_sk);
+  bool ok = compare_and_print(32, pk, ctx_pk);
+  ok &= Hacl_Ed25519_sign_ctx(sig, ctx_sk, 3, foo, 16, ctx_msg);
+  ok &= compare_and_print(64, sig, ctx_sig);
+  ok &= Hacl_Ed25519_verify_ctx(ctx_pk, 3, foo, 16, ctx_msg, ctx_sig);
+  ok &= !Hacl_Ed25519_verify_ctx(ctx_pk, 3, bar, 16, ctx_msg, ctx_sig);
+  ok &= !Hacl_Ed25519_verify(ctx_pk, 16, ctx_msg, ctx_sig);
+  ok &= !Hacl_Ed25519_sign_ctx(sig, ctx_sk, 0, foo, 16, ctx_msg);
+  ok &= !Hacl_Ed25519_sign_ctx(sig, ctx_sk, 256, ctx, 16, ctx_msg);
+  ok &= Hacl_Ed25519_sign_ctx(sig, ctx_sk, 255, ctx, 16, ctx_msg);
+  ok &= Hacl_Ed25519_verify_ctx(ctx_pk, 255, ctx, 16, ctx_msg, sig);
+
+  Hacl_Hash_SHA2_hash_512(hash, abc, 3);
+  ok &= Hacl_Ed25519_sign_ph(sig, ph_sk, 0, NULL, hash);
+  ok &= compare_and_print(64, sig, ph_sig);
+  ok &= Hacl_Ed25519_verify_ph(ph_pk, 0, NULL, hash, ph_sig);
+  ok &= !Hacl_Ed25519_verify_ph(ph_pk, 3, foo, hash, ph_sig);
+  ok &= !Hacl_Ed25519_verify_ph(ph_pk, 256, ctx, hash, ph_sig);
+  ok &= !Hacl_Ed25519_sign_ph(sig, ph_sk, 256, ctx, hash);
+  printf("Ed25519ctx and Ed25519ph RFC 8032 vectors: %s\n", ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+// Signing a large message fed in uneven pieces must match the one-shot prehash.
+static bool
+check_streaming(uint8_t* msg)
+{
+  uint8_t sig[64], expected[64], hash[64];
+  uint8_t ctx[4] = { 'f', 'i', 'l', 'e' };
+  Hacl_Hash_SHA2_hash_512(hash, msg, SIZE);
+  Hacl_Ed25519_sign_ph(expected, ph_sk, 4, ctx, hash);
+
+  Hacl_Streaming_MD_state_64* st = Hacl_Hash_SHA2_malloc_512();
+  uint32_t pos = 0;
+  for (uint32_t i = 1; pos < SIZE; i = i * 3 % 10007) {
+    uint32_t len = SIZE - pos < i ? SIZE - pos : i;
+    Hacl_Hash_SHA2_update_512(st, msg + pos, len);
+    pos += len;
+  }
+  bool ok = Hacl_Ed25519_sign_ph_finish(sig, ph_sk, 4, ctx, st);
+  ok &= compare_and_print(64, sig, expected);
+  ok &= Hacl_Ed25519_verify_ph_finish(ph_pk, 4, ctx, st, sig);
+  // The state is still usable: more data makes it a different message.
+  Hacl_Hash_SHA2_update_512(st, msg, 1);
+  ok &= !Hacl_Ed25519_verify_ph_finish(ph_pk, 4, ctx, st, sig);
+  Hacl_Hash_SHA2_free_512(st);
+  printf("Ed25519ph streaming, %d bytes: %s\n", SIZE, ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static void
+bench(uint8_t* msg)
+{
+  uint8_t sig[64];
+  cycles c0, c1;
+  clock_t t1, t2;
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  Hacl_Ed25519_sign(sig, ph_sk, SIZE, msg);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("Ed25519 sign (message hashed twice):\n");
+  print_time(SIZE, t2 - t1, c1 - c0);
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  Hacl_Streaming_MD_state_64* st = Hacl_Hash_SHA2_malloc_512();
+  for (uint32_t pos = 0; pos < SIZE; pos += CHUNK)
+    Hacl_Hash_SHA2_update_512(st, msg + pos, CHUNK);
+  Hacl_Ed25519_sign_ph_finish(sig, ph_sk, 0, NULL, st);
+  Hacl_Hash_SHA2_free_512(st);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("Ed25519ph streaming sign (message hashed once):\n");
+  print_time(SIZE, t2 - t1, c1 - c0);
+}
+
+int
+main()
+{
+  uint8_t* msg = malloc(SIZE);
+  for (uint32_t i = 0; i < SIZE; i++)
+    msg[i] = (uint8_t)(i * 31 + (i >> 13));
+  bool ok = check_vectors();
+  ok &= check_streaming(msg);
+  bench(msg);
+  free(msg);
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,132 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Ed25519.h"
+#include "Hacl_Ed25519.h"
+
+#include "test_helpers.h"
+
+#define MAX_SIGS 1030
+#define MAX_LEN 300
+#define ROUNDS 16
+#define BENCH_SIGS 1024
+#define BENCH_LEN 64
+
+static uint8_t expanded[96], msgs[MAX_SIGS][MAX_LEN], sigs[MAX_SIGS][64];
+static uint8_t *msg_ptrs[MAX_SIGS], *sig_ptrs[MAX_SIGS];
+static uint32_t msg_lens[MAX_SIGS];
+
+// Every signature must be the one sign_expanded produces, whether its group of four has
+// equal lengths (hashed four-way) or not. Variant 0 is Hacl_Ed25519_sign_batch, 1 and 4 are
+// Hacl_Ed25519_sign_batch_lanes with that many SHA-512 lanes, and 2 is the EverCrypt wrapper.
+static bool
+check_batch_variant(const char* name, uint32_t n, uint32_t variant)
+{
+  bool ok = true;
+  memset(sigs, 0, sizeof(sigs));
+  if (variant == 0)
+    Hacl_Ed25519_sign_batch(expanded, n, msg_ptrs, msg_lens, sig_ptrs);
+  else if (variant == 2)
+    EverCrypt_Ed25519_sign_batch(expanded, n, msg_ptrs, msg_lens, sig_ptrs);
+  else
+    Hacl_Ed25519_sign_batch_lanes(
+      variant, expanded, n, msg_ptrs, msg_lens, sig_ptrs);
+  for (uint32_t i = 0; i < n; i++) {
+    uint8_t expected[64];
+    Hacl_Ed25519_sign_expanded(expected, expanded, msg_lens[i], msgs[i]);
+    ok &= memcmp(sigs[i], expected, 64) == 0;
+  }
+  for (uint32_t i = n; i < MAX_SIGS; i++) {
+    uint8_t zero[64] = { 0 };
+    ok &= memcmp(sigs[i], zero, 64) == 0;
+  }
+  printf("Ed25519 sign_batch variant %" PRIu32 " (%s, %" PRIu32 " messages): %s\n",
+         variant,
+         name,
+         n,
+         ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static bool
+check_batch(const char* name, uint32_t n)
+{
+  bool ok = check_batch_variant(name, n, 0);
+  ok &= check_batch_variant(name, n, 1);
+  ok &= check_batch_variant(name, n, 2);
+  if (EverCrypt_AutoConfig2_has_avx2())
+    ok &= check_batch_variant(name, n, 4);
+  return ok;
+}
+
+static void
+bench(void)
+{
+  cycles c0, c1;
+  clock_t t1, t2;
+  for (uint32_t i = 0; i < BENCH_SIGS; i++)
+    msg_lens[i] = BENCH_LEN;
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    for (uint32_t i = 0; i < BENCH_SIGS; i++)
+      Hacl_Ed25519_sign_expanded(sigs[i], expanded, BENCH_LEN, msgs[i]);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("Ed25519 sign_expanded, %d bytes, per signature:\n", BENCH_LEN);
+  print_time(ROUNDS * BENCH_SIGS, t2 - t1, c1 - c0);
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    EverCrypt_Ed25519_sign_batch(
+      expanded, BENCH_SIGS, msg_ptrs, msg_lens, sig_ptrs);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("Ed25519 sign_batch, %d bytes, per signature:\n", BENCH_LEN);
+  print_time(ROUNDS * BENCH_SIGS, t2 - t1, c1 - c0);
+}
+
+int
+main()
+{
+  EverCrypt_AutoConfig2_init();
+  uint8_t sk[32];
+  for (int j = 0; j < 32; j++)
+    sk[j] = (uint8_t)(j * 13 + 1);
+  Hacl_Ed25519_expand_keys(expanded, sk);
+  for (uint32_t i = 0; i < MAX_SIGS; i++) {
+    for (uint32_t j = 0; j < MAX_LEN; j++)
+      msgs[i][j] = (uint8_t)(i * 5 + j);
+    msg_ptrs[i] = msgs[i];
+    sig_ptrs[i] = sigs[i];
+  }
+
+  bool ok = true;
+  // Equal lengths, including the empty message and lengths around the SHA-512 block size.
+  uint32_t lens[7] = { 0, 1, 63, 64, 65, 128, MAX_LEN };
+  for (int k = 0; k < 7; k++) {
+    for (uint32_t i = 0; i < MAX_SIGS; i++)
+      msg_lens[i] = lens[k];
+    ok &= check_batch("equal lengths", k == 6 ? MAX_SIGS : 4 * (uint32_t)k + 9);
+  }
+  ok &= check_batch("empty", 0);
+  ok &= check_batch("fewer than four", 3);
+  // Mixed lengths, with some runs of four equal lengths.
+  for (uint32_t i = 0; i < MAX_SIGS; i++)
+    msg_lens[i] = (i / 8) % 2 == 0 ? 40 : (i * 37) % MAX_LEN;
+  ok &= check_batch("mixed lengths", MAX_SIGS);
+
+  bench();
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,160 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "Hacl_Ed25519.h"
+
+#include "test_helpers.h"
+
+#define SIGS 256
+#define MSG_LEN 32
+#define ROUNDS 8192
+
+static uint8_t pks[SIGS][32], sigs[SIGS][64], msgs[SIGS][MSG_LEN], garbage[SIGS][64];
+
+// q = 2^252 + 27742317777372353535851937790883648493, little-endian.
+static uint8_t q[32] = { 0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7,
+                         0xa2, 0xde, 0xf9, 0xde, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10 };
+
+static void
+make_sigs(void)
+{
+  for (int i = 0; i < SIGS; i++) {
+    uint8_t sk[32];
+    for (int j = 0; j < 32; j++)
+      sk[j] = (uint8_t)(i * 13 + 7 * j);
+    for (int j = 0; j < MSG_LEN; j++)
+      msgs[i][j] = (uint8_t)(i + 5 * j);
+    for (int j = 0; j < 64; j++)
+      garbage[i][j] = (uint8_t)(i * 101 + j * 59 + (i >> 2) * j);
+    Hacl_Ed25519_secret_to_public(pks[i], sk);
+    Hacl_Ed25519_sign(sigs[i], sk, MSG_LEN, msgs[i]);
+  }
+}
+
+typedef bool (*verify_fn)(uint8_t*, uint32_t, uint8_t*, uint8_t*);
+
+// Each way of malforming a valid signature or key must be rejected, whichever check
+// catches it first.
+static bool
+check_rejections(verify_fn verify, const char* name)
+{
+  bool ok = true;
+  uint8_t sig[64], pk[32];
+  for (int i = 0; i < SIGS; i++) {
+    ok &= verify(pks[i], MSG_LEN, msgs[i], sigs[i]);
+    ok &= !verify(pks[i], MSG_LEN, msgs[i], garbage[i]);
+    ok &= !verify(pks[(i + 1) % SIGS], MSG_LEN, msgs[i], sigs[i]);
+
+    // S + q: the same scalar, not reduced.
+    memcpy(sig, sigs[i], 64);
+    unsigned int c = 0;
+    for (int j = 0; j < 32; j++) {
+      c += (unsigned int)sig[32 + j] + q[j];
+      sig[32 + j] = (uint8_t)c;
+      c >>= 8;
+    }
+    ok &= !verify(pks[i], MSG_LEN, msgs[i], sig);
+
+    // The sign bit of R, and a flipped bit of R.
+    memcpy(sig, sigs[i], 64);
+    sig[31] ^= 0x80;
+    ok &= !verify(pks[i], MSG_LEN, msgs[i], sig);
+    sig[31] ^= 0x80;
+    sig[i % 31] ^= (uint8_t)(1 << (i % 8));
+    ok &= !verify(pks[i], MSG_LEN, msgs[i], sig);
+
+    // A flipped bit of the public key.
+    memcpy(pk, pks[i], 32);
+    pk[i % 32] ^= (uint8_t)(1 << (i % 7));
+    ok &= !verify(pk, MSG_LEN, msgs[i], sigs[i]);
+  }
+
+  // y = p + 1 encodes the identity non-canonically; y = 1 with the sign bit set is a
+  // negative zero. Both are rejected as R and as public key, although [S]B = R + [h]A
+  // holds for R = [S]B and A the identity.
+  uint8_t ident[32], p1[32], negzero[32];
+  memset(ident, 0, 32);
+  ident[0] = 1;
+  memset(p1, 0xff, 32);
+  p1[0] = 0xee;
+  p1[31] = 0x7f;
+  memcpy(negzero, ident, 32);
+  negzero[31] = 0x80;
+  // (R, S) = (B, 1) under the identity.
+  memset(sig, 0x66, 32);
+  sig[0] = 0x58;
+  memset(sig + 32, 0, 32);
+  sig[32] = 1;
+  ok &= verify(ident, MSG_LEN, msgs[0], sig);
+  ok &= !verify(p1, MSG_LEN, msgs[0], sig);
+  ok &= !verify(negzero, MSG_LEN, msgs[0], sig);
+  memcpy(sig, ident, 32);
+  memset(sig + 32, 0, 32);
+  ok &= verify(ident, MSG_LEN, msgs[0], sig);
+  memcpy(sig, p1, 32);
+  ok &= !verify(ident, MSG_LEN, msgs[0], sig);
+  memcpy(sig, negzero, 32);
+  ok &= !verify(ident, MSG_LEN, msgs[0], sig);
+
+  printf("%s, valid and malformed signatures: %s\n", name, ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static void
+bench(verify_fn verify, const char* name)
+{
+  cycles c0, c1;
+  clock_t t1, t2;
+  // Garbage that passes the range check on S but whose R does not decompress.
+  uint8_t bad_r[64];
+  memcpy(bad_r, sigs[0], 64);
+  memset(bad_r, 0, 32);
+  bad_r[0] = 2;
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    verify(pks[j % SIGS], MSG_LEN, msgs[j % SIGS], sigs[j % SIGS]);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("%s, valid signatures:\n", name);
+  print_time(ROUNDS, t2 - t1, c1 - c0);
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    verify(pks[j % SIGS], MSG_LEN, msgs[j % SIGS], garbage[j % SIGS]);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("%s, random 64-byte signatures:\n", name);
+  print_time(ROUNDS, t2 - t1, c1 - c0);
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    verify(pks[j % SIGS], MSG_LEN, msgs[0], bad_r);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("%s, R not on the curve:\n", name);
+  print_time(ROUNDS, t2 - t1, c1 - c0);
+}
+
+int
+main()
+{
+  make_sigs();
+  bool ok = check_rejections(Hacl_Ed25519_verify, "Hacl_Ed25519_verify");
+  ok &= check_rejections(Hacl_Ed25519_verify_vartime, "Hacl_Ed25519_verify_vartime");
+  bench(Hacl_Ed25519_verify, "Hacl_Ed25519_verify");
+  bench(Hacl_Ed25519_verify_vartime, "Hacl_Ed25519_verify_vartime");
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
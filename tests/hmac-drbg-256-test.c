@@ -0,0 +1,161 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "Hacl_HMAC_DRBG.h"
+#include "Hacl_HMAC_DRBG_Vec256.h"
+
+#include "test_helpers.h"
+
+#define LANES 8
+#define ROUNDS 20000
+#define OUT 32
+
+static void
+fill(uint8_t* b, uint32_t len, uint8_t seed)
+{
+  for (uint32_t i = 0; i < len; i++)
+    b[i] = (uint8_t)(seed * 31 + 7 * i);
+}
+
+static Hacl_HMAC_DRBG_state
+create(void)
+{
+  return Hacl_HMAC_DRBG_create_in(Spec_Hash_Definitions_SHA2_256);
+}
+
+// Runs the same sequence on `lanes` scalar DRBGs and one batch of `lanes`
+// lanes, comparing every output.
+static bool
+test_lockstep(uint32_t lanes, uint32_t pers_len, uint32_t ai_len, uint32_t n)
+{
+  Hacl_HMAC_DRBG_state s[LANES], b[LANES];
+  uint8_t ent[LANES][48], non[LANES][16], pers[LANES][200], ai[LANES][200];
+  uint8_t *ent_p[LANES], *non_p[LANES], *pers_p[LANES], *ai_p[LANES];
+  uint8_t out_s[LANES][300], out_b[LANES][300];
+  uint8_t* out_p[LANES];
+  for (int l = 0; l < (int)lanes; l++) {
+    s[l] = create();
+    b[l] = create();
+    fill(ent[l], 48, l + 1);
+    fill(non[l], 16, l + 20);
+    fill(pers[l], 200, l + 40);
+    fill(ai[l], 200, l + 60);
+    ent_p[l] = ent[l];
+    non_p[l] = non[l];
+    pers_p[l] = pers[l];
+    ai_p[l] = ai[l];
+    out_p[l] = out_b[l];
+    Hacl_HMAC_DRBG_instantiate(Spec_Hash_Definitions_SHA2_256,
+                               s[l], 32, ent[l], 16, non[l], pers_len, pers[l]);
+  }
+  bool ok = Hacl_HMAC_DRBG_Vec256_instantiate_sha2_256_8(
+    lanes, b, 32, ent_p, 16, non_p, pers_len, pers_p);
+  for (int r = 0; r < 3; r++) {
+    uint32_t a = r == 1 ? ai_len : 0;
+    for (int l = 0; l < (int)lanes; l++)
+      ok &= Hacl_HMAC_DRBG_generate(
+        Spec_Hash_Definitions_SHA2_256, out_s[l], s[l], n, a, ai[l]);
+    ok &= Hacl_HMAC_DRBG_Vec256_generate_sha2_256_8(lanes, out_p, b, n, a, ai_p);
+    for (int l = 0; l < (int)lanes; l++)
+      ok &= memcmp(out_s[l], out_b[l], n) == 0;
+    if (r == 1) {
+      for (int l = 0; l < (int)lanes; l++)
+        Hacl_HMAC_DRBG_reseed(
+          Spec_Hash_Definitions_SHA2_256, s[l], 48, ent[l], ai_len, ai[l]);
+      ok &= Hacl_HMAC_DRBG_Vec256_reseed_sha2_256_8(lanes, b, 48, ent_p, ai_len, ai_p);
+    }
+  }
+  for (int l = 0; l < (int)lanes; l++) {
+    ok &= memcmp(s[l].k, b[l].k, 32) == 0 && memcmp(s[l].v, b[l].v, 32) == 0;
+    ok &= s[l].reseed_counter[0] == b[l].reseed_counter[0];
+    Hacl_HMAC_DRBG_free(Spec_Hash_Definitions_SHA2_256, s[l]);
+    Hacl_HMAC_DRBG_free(Spec_Hash_Definitions_SHA2_256, b[l]);
+  }
+  printf("HMAC_DRBG x%u (pers=%u, ai=%u, n=%u): %s\n",
+         lanes, pers_len, ai_len, n, ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+int
+main()
+{
+  EverCrypt_AutoConfig2_init();
+  if (!EverCrypt_AutoConfig2_has_avx2()) {
+    printf("No AVX2, skipping\n");
+    return EXIT_SUCCESS;
+  }
+  bool ok = true;
+  ok &= test_lockstep(LANES, 0, 0, 32);
+  ok &= test_lockstep(LANES, 16, 32, 1);
+  ok &= test_lockstep(LANES, 200, 7, 100);
+  ok &= test_lockstep(LANES, 31, 200, 300);
+  ok &= test_lockstep(1, 0, 0, 32);
+  ok &= test_lockstep(3, 16, 32, 100);
+  ok &= test_lockstep(7, 200, 7, 300);
+
+  // Out-of-range lane counts are rejected without touching anything.
+  {
+    Hacl_HMAC_DRBG_state s0 = create();
+    uint8_t out0[32];
+    uint8_t* out0_p[1] = { out0 };
+    uint8_t* ent0_p[1] = { out0 };
+    ok &= !Hacl_HMAC_DRBG_Vec256_instantiate_sha2_256_8(0, &s0, 32, ent0_p, 0, NULL, 0, NULL);
+    ok &= !Hacl_HMAC_DRBG_Vec256_reseed_sha2_256_8(9, &s0, 32, ent0_p, 0, NULL);
+    ok &= !Hacl_HMAC_DRBG_Vec256_generate_sha2_256_8(0, out0_p, &s0, 32, 0, NULL);
+    ok &= !Hacl_HMAC_DRBG_Vec256_generate_sha2_256_8(9, out0_p, &s0, 32, 0, NULL);
+    Hacl_HMAC_DRBG_free(Spec_Hash_Definitions_SHA2_256, s0);
+  }
+
+  Hacl_HMAC_DRBG_state s[LANES];
+  uint8_t ent[48] = { 0 }, non[16] = { 0 };
+  uint8_t out[LANES][OUT];
+  uint8_t *ent_p[LANES], *non_p[LANES], *out_p[LANES];
+  for (int l = 0; l < LANES; l++) {
+    s[l] = create();
+    ent_p[l] = ent;
+    non_p[l] = non;
+    out_p[l] = out[l];
+    Hacl_HMAC_DRBG_instantiate(
+      Spec_Hash_Definitions_SHA2_256, s[l], 32, ent, 16, non, 0, NULL);
+  }
+
+  cycles a, b;
+  clock_t t1, t2;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    for (int l = 0; l < LANES; l++) {
+      s[l].reseed_counter[0] = 1;
+      Hacl_HMAC_DRBG_generate(
+        Spec_Hash_Definitions_SHA2_256, out[l], s[l], OUT, 0, NULL);
+    }
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  printf("8 x Hacl_HMAC_DRBG_generate (%d bytes):\n", OUT);
+  print_time((uint64_t)ROUNDS * LANES * OUT, t2 - t1, b - a);
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    for (int l = 0; l < LANES; l++)
+      s[l].reseed_counter[0] = 1;
+    Hacl_HMAC_DRBG_Vec256_generate_sha2_256_8(LANES, out_p, s, OUT, 0, NULL);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  printf("Hacl_HMAC_DRBG_Vec256_generate_sha2_256_8 (%d bytes):\n", OUT);
+  print_time((uint64_t)ROUNDS * LANES * OUT, t2 - t1, b - a);
+
+  for (int l = 0; l < LANES; l++)
+    Hacl_HMAC_DRBG_free(Spec_Hash_Definitions_SHA2_256, s[l]);
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
@@ -4,6 +4,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_NaCl.h"
 #include "Hacl_NaCl.h"
 
 #include "naclbox_vectors.h"
@@ -84,13 +86,124 @@ print_test(int in_len,
   ok = (res == 0) && ok && print_result(in_len, in, decrypted);
   memset(decrypted, 0, in_len);
 
+  /* Testing the EverCrypt interface, which uses the SIMD Salsa20 and Poly1305 code when the CPU
+     supports it */
+  i = EverCrypt_NaCl_crypto_box_detached(
+    ciphertext, mac, in, in_len, nonce, pk1, sk2);
+  ok = ok && print_result(in_len, ciphertext, cipher);
+  ok = ok && print_result(MACBYTES, mac, mac_exp);
+  i = EverCrypt_NaCl_crypto_box_easy(ciphertext1, in, in_len, nonce, pk1, sk2);
+  res = EverCrypt_NaCl_crypto_box_open_easy(
+    decrypted, ciphertext1, in_len + MACBYTES, nonce, pk2, sk1);
+  printf("Decryption of EverCrypt box_easy was a %s.\n",
+         res == 0 ? "success" : "failure");
+  ok = (res == 0) && ok && print_result(in_len, in, decrypted);
+  memset(decrypted, 0, in_len);
+
+  /* Testing the shared-key cache: the sender side caches (sk2, pks[p]) and the receiver side
+     (sks[p], pk2), each with a capacity of 2 for 3 peers, so the access order below forces
+     evictions; every result must match the uncached interface. Each secret key has its own
+     sk_id. */
+  EverCrypt_NaCl_box_cache* cache = EverCrypt_NaCl_box_cache_create(2);
+  EverCrypt_NaCl_box_cache* open_cache = EverCrypt_NaCl_box_cache_create(2);
+  uint8_t sks[3][KEYBYTES];
+  uint8_t pks[3][KEYBYTES];
+  uint8_t ciphertext2[in_len + MACBYTES];
+  for (int j = 0; j < 3; j++) {
+    memcpy(sks[j], sk1, KEYBYTES);
+    sks[j][1] ^= (uint8_t)(j + 1);
+    Hacl_Curve25519_51_secret_to_public(pks[j], sks[j]);
+  }
+  ok = ok && memcmp(pks[0], pks[1], KEYBYTES) != 0 &&
+       memcmp(pks[0], pks[2], KEYBYTES) != 0 &&
+       memcmp(pks[1], pks[2], KEYBYTES) != 0;
+  int order[8] = { 0, 1, 0, 2, 1, 0, 0, 2 };
+  for (int j = 0; j < 8; j++) {
+    int p = order[j];
+    Hacl_NaCl_crypto_box_easy(ciphertext1, in, in_len, nonce, pks[p], sk2);
+    res = EverCrypt_NaCl_crypto_box_easy_cached(
+      cache, ciphertext2, in, in_len, nonce, 2, pks[p], sk2);
+    ok = (res == 0) && ok &&
+         memcmp(ciphertext1, ciphertext2, in_len + MACBYTES) == 0;
+    res = EverCrypt_NaCl_crypto_box_open_easy_cached(
+      open_cache, decrypted, ciphertext2, in_len + MACBYTES, nonce, 10 + p, pk2, sks[p]);
+    ok = (res == 0) && ok && memcmp(in, decrypted, in_len) == 0;
+    memset(decrypted, 0, in_len);
+  }
+  /* With LRU order: 0 miss, 1 miss, 0 hit, 2 miss (evicts 1), 1 miss (evicts 0), 0 miss
+     (evicts 2), 0 hit, 2 miss (evicts 1). */
+  uint64_t hits, misses, evictions;
+  EverCrypt_NaCl_box_cache_stats(cache, &hits, &misses, &evictions);
+  ok = ok && hits == 2 && misses == 6 && evictions == 4;
+  EverCrypt_NaCl_box_cache_stats(open_cache, &hits, &misses, &evictions);
+  ok = ok && hits == 2 && misses == 6 && evictions == 4;
+  EverCrypt_NaCl_box_cache_free(open_cache);
+
+  /* A sharded cache with fewer slots than peers. */
+  EverCrypt_NaCl_box_cache* big = EverCrypt_NaCl_box_cache_create(256);
+  uint8_t peer_sk[KEYBYTES], peer_pk[KEYBYTES], k_cached[KEYBYTES];
+  memcpy(peer_sk, sk1, KEYBYTES);
+  for (int round = 0; round < 2; round++) {
+    for (int j = 0; j < 300; j++) {
+      peer_sk[1] = (uint8_t)j;
+      peer_sk[2] = (uint8_t)(j >> 8);
+      Hacl_Curve25519_51_secret_to_public(peer_pk, peer_sk);
+      Hacl_NaCl_crypto_box_beforenm(k, peer_pk, sk2);
+      res = EverCrypt_NaCl_box_cache_beforenm(big, k_cached, 2, peer_pk, sk2);
+      ok = (res == 0) && ok && memcmp(k, k_cached, KEYBYTES) == 0;
+    }
+  }
+  EverCrypt_NaCl_box_cache_stats(big, &hits, &misses, &evictions);
+  /* Keys spread over the shards at random, so only bounds are known: every key misses once, and
+     each miss beyond the 256 slots evicts. */
+  ok = ok && hits + misses == 600 && misses >= 300 && evictions + 256 >= misses;
+  EverCrypt_NaCl_box_cache_free(big);
+
+  uint8_t zero_pk[KEYBYTES] = { 0 };
+  res = EverCrypt_NaCl_crypto_box_easy_cached(
+    cache, ciphertext2, in, in_len, nonce, 2, zero_pk, sk2);
+  ok = ok && (res != 0);
+  printf("EverCrypt box_easy_cached %s.\n", ok ? "matches box_easy" : "failed");
+  EverCrypt_NaCl_box_cache_free(cache);
+
+  return ok;
+}
+
+/* EverCrypt_NaCl and Hacl_NaCl must agree on every length, including the partial blocks left
+   over by the SIMD code. */
+bool
+test_secretbox_dispatch()
+{
+  uint8_t key[32], nonce[24];
+  uint8_t msg[1100], c1[1100 + MACBYTES], c2[1100 + MACBYTES], dec[1100];
+  for (int j = 0; j < 32; j++)
+    key[j] = (uint8_t)(3 * j + 1);
+  for (int j = 0; j < 24; j++)
+    nonce[j] = (uint8_t)(5 * j + 2);
+  for (int j = 0; j < 1100; j++)
+    msg[j] = (uint8_t)(7 * j);
+  bool ok = true;
+  for (uint32_t len = 0; len <= 1100; len++) {
+    Hacl_NaCl_crypto_secretbox_easy(c1, msg, len, nonce, key);
+    EverCrypt_NaCl_crypto_secretbox_easy(c2, msg, len, nonce, key);
+    ok = ok && memcmp(c1, c2, len + MACBYTES) == 0;
+    ok = ok && EverCrypt_NaCl_crypto_secretbox_open_easy(
+                 dec, c1, len + MACBYTES, nonce, key) == 0;
+    ok = ok && memcmp(dec, msg, len) == 0;
+    c1[len / 2] ^= 1;
+    ok = ok && EverCrypt_NaCl_crypto_secretbox_open_easy(
+                 dec, c1, len + MACBYTES, nonce, key) != 0;
+  }
+  printf("EverCrypt secretbox %s.\n",
+         ok ? "matches Hacl secretbox" : "failed");
   return ok;
 }
 
 int
 main()
 {
-  bool ok = true;
+  EverCrypt_AutoConfig2_init();
+  bool ok = test_secretbox_dispatch();
   for (size_t i = 0; i < sizeof(vectors) / sizeof(naclbox_test_vector); ++i) {
     ok &= print_test(vectors[i].input_len,
                      vectors[i].input,
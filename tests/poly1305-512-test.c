@@ -0,0 +1,111 @@
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "test_helpers.h"
+
+#include "Hacl_MAC_Poly1305_Simd512.h"
+#include "Hacl_MAC_Poly1305.h"
+
+#include "EverCrypt_AutoConfig2.h"
+
+#include "poly1305_vectors.h"
+
+#define ROUNDS 100000
+#define SIZE 16384
+
+bool
+print_result(uint8_t* comp, uint8_t* exp)
+{
+  return compare_and_print(16, comp, exp);
+}
+
+bool
+print_test(int in_len, uint8_t* in, uint8_t* key, uint8_t* exp)
+{
+  uint8_t comp[16] = { 0 };
+  bool ok = true;
+
+  Hacl_MAC_Poly1305_Simd512_mac(comp, in, in_len, key);
+  printf("Poly1305 (512-bit) Result:\n");
+  ok = ok && print_result(comp, exp);
+
+  return ok;
+}
+
+int
+main()
+{
+  EverCrypt_AutoConfig2_init();
+  if (!EverCrypt_AutoConfig2_has_avx512()) {
+    printf("The current hardware doesn't support avx512: aborting\n");
+    return EXIT_SUCCESS;
+  } else {
+    printf("The current hardware supports avx512: performing the tests\n");
+  }
+
+  bool ok = true;
+  for (size_t i = 0; i < sizeof(vectors) / sizeof(poly1305_test_vector); ++i) {
+    ok &= print_test(
+      vectors[i].input_len, vectors[i].input, vectors[i].key, vectors[i].tag);
+  }
+
+  // Cross-check against the portable implementation on every length that
+  // exercises a different mix of 8-way chunks, single blocks and a partial tail.
+  uint8_t msg[1100];
+  uint8_t k[32];
+  for (int i = 0; i < 1100; i++)
+    msg[i] = (uint8_t)(i * 7 + 3);
+  for (int i = 0; i < 32; i++)
+    k[i] = (uint8_t)(0xff - i * 5);
+  for (int len = 0; len <= 1100; len++) {
+    uint8_t t0[16] = { 0 };
+    uint8_t t1[16] = { 0 };
+    Hacl_MAC_Poly1305_mac(t0, msg, len, k);
+    Hacl_MAC_Poly1305_Simd512_mac(t1, msg, len, k);
+    if (memcmp(t0, t1, 16) != 0) {
+      printf("Poly1305 (512-bit) mismatch at length %d\n", len);
+      ok = false;
+    }
+  }
+
+  uint8_t plain[SIZE];
+  uint8_t key[32];
+  uint64_t res = 0;
+  uint8_t tag[16];
+  cycles a, b;
+  clock_t t1, t2;
+
+  memset(plain, 'P', SIZE);
+  memset(key, 'K', 16);
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_MAC_Poly1305_Simd512_mac(plain, plain, SIZE, key);
+  }
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_MAC_Poly1305_Simd512_mac(tag, plain, SIZE, key);
+    res ^= tag[0] ^ tag[15];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff1 = t2 - t1;
+  cycles cdiff1 = b - a;
+
+  uint64_t count = ROUNDS * SIZE;
+  printf("Poly1305 (512-bit) PERF: %"PRIu64"\n", res);
+  print_time(count, tdiff1, cdiff1);
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
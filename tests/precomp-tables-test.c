@@ -0,0 +1,151 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "Hacl_Ed25519.h"
+#include "Hacl_K256_ECDSA.h"
+#include "Hacl_P256.h"
+
+#include "test_helpers.h"
+
+#define KEYS 64
+#define ROUNDS 4000
+
+typedef struct
+{
+  const char* name;
+  uint32_t entry_bytes;
+  bool (*init)(uint32_t teeth, uint32_t window_bits);
+  bool (*pub)(uint8_t* pk, uint8_t* sk);
+  uint32_t pk_len;
+} curve;
+
+static bool
+ed25519_pub(uint8_t* pk, uint8_t* sk)
+{
+  Hacl_Ed25519_secret_to_public(pk, sk);
+  return true;
+}
+
+static curve curves[3] = {
+  { "Ed25519",
+    160,
+    Hacl_Ed25519_precomp_tables_init,
+    ed25519_pub,
+    32 },
+  { "P-256",
+    96,
+    Hacl_P256_precomp_tables_init,
+    Hacl_P256_dh_initiator,
+    64 },
+  { "secp256k1",
+    120,
+    Hacl_K256_ECDSA_precomp_tables_init,
+    Hacl_K256_ECDSA_secret_to_public,
+    64 },
+};
+
+// (teeth, window bits); (4, 4) is the shape of the built-in tables.
+static uint32_t configs[8][2] = { { 4, 4 },  { 8, 4 },  { 16, 4 }, { 32, 4 },
+                                  { 64, 4 }, { 16, 8 }, { 32, 8 }, { 256, 1 } };
+
+static uint8_t sks[KEYS][32], expected[KEYS][64];
+
+// Checks every key against the built-in tables, then times fixed-base multiplications. Uses
+// the built-in tables if teeth is 0, and otherwise builds tables of the given shape first.
+static bool
+check_and_bench(curve* c, uint32_t teeth, uint32_t w)
+{
+  bool ok = true;
+  uint8_t pk[64];
+  if (teeth > 0) {
+    ok &= c->init(teeth, w);
+    // The tables are never freed, so later calls must fail and keep them.
+    ok &= !c->init(4, 4);
+  }
+  for (int i = 0; i < KEYS; i++) {
+    ok &= c->pub(pk, sks[i]);
+    ok &= memcmp(pk, expected[i], c->pk_len) == 0;
+  }
+
+  cycles a, b;
+  clock_t t1, t2;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    c->pub(pk, sks[j % KEYS]);
+  b = cpucycles_end();
+  t2 = clock();
+  if (teeth == 0)
+    printf("%s fixed-base multiplication, built-in tables:\n", c->name);
+  else
+    printf("%s fixed-base multiplication, %" PRIu32 " tables of 2^%" PRIu32
+           " entries (%" PRIu32 " KB, %" PRIu32 " entries scanned):\n",
+           c->name,
+           teeth,
+           w,
+           (teeth << w) * c->entry_bytes / 1024,
+           (256 / w) << w);
+  print_time(ROUNDS, t2 - t1, b - a);
+  return ok;
+}
+
+// Tables can only be built once per process, so each shape is tried in a child process.
+static bool
+check_and_bench_forked(curve* c, uint32_t teeth, uint32_t w)
+{
+  fflush(stdout);
+  pid_t pid = fork();
+  if (pid == 0) {
+    bool ok = check_and_bench(c, teeth, w);
+    fflush(stdout);
+    _exit(ok ? 0 : 1);
+  }
+  int status;
+  if (pid < 0 || waitpid(pid, &status, 0) != pid)
+    return false;
+  return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+static bool
+check_curve(curve* c)
+{
+  bool ok = true;
+  for (int i = 0; i < KEYS; i++) {
+    for (int j = 0; j < 32; j++)
+      sks[i][j] = (uint8_t)(i * 41 + j * 7 + 1);
+    // Scalars with long runs of zero and one bits.
+    if (i == 1)
+      memset(sks[i] + 1, 0, 31);
+    if (i == 2)
+      memset(sks[i], 0x3f, 32);
+    ok &= c->pub(expected[i], sks[i]);
+  }
+
+  ok &= !c->init(0, 4) && !c->init(12, 4) && !c->init(512, 1) && !c->init(4, 3) &&
+        !c->init(4, 16) && !c->init(128, 4);
+
+  ok &= check_and_bench(c, 0, 0);
+  for (int k = 0; k < 8; k++)
+    ok &= check_and_bench_forked(c, configs[k][0], configs[k][1]);
+  printf("%s larger fixed-base tables: %s\n", c->name, ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+int
+main()
+{
+  bool ok = true;
+  for (int i = 0; i < 3; i++)
+    ok &= check_curve(&curves[i]);
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
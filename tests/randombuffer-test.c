@@ -0,0 +1,123 @@
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "Lib_RandomBuffer_System.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 100000
+#define OUT 32
+
+static uint8_t thread_out[2][OUT];
+
+static void*
+worker(void* arg)
+{
+  size_t t = (size_t)arg;
+  Lib_RandomBuffer_System_crypto_random(thread_out[t], OUT);
+  return NULL;
+}
+
+static bool
+test_sizes(void)
+{
+  // Crosses the reservoir boundary and exercises the large-request path.
+  uint32_t lens[] = { 1, 31, 32, 4095, 4096, 4097, 10000 };
+  uint8_t zero[64] = { 0 };
+  bool ok = true;
+  for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+    uint32_t n = lens[i];
+    uint8_t* a = calloc(n, 1);
+    uint8_t* b = calloc(n, 1);
+    Lib_RandomBuffer_System_crypto_random(a, n);
+    Lib_RandomBuffer_System_crypto_random(b, n);
+    ok &= memcmp(a, b, n) != 0;
+    if (n >= 64)
+      ok &= memcmp(a + n - 64, zero, 64) != 0;
+    free(a);
+    free(b);
+  }
+  printf("crypto_random sizes: %s\n", ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static bool
+test_threads(void)
+{
+  pthread_t th[2];
+  for (size_t t = 0; t < 2; t++)
+    pthread_create(&th[t], NULL, worker, (void*)t);
+  for (size_t t = 0; t < 2; t++)
+    pthread_join(th[t], NULL);
+  bool ok = memcmp(thread_out[0], thread_out[1], OUT) != 0;
+  printf("crypto_random threads: %s\n", ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static bool
+test_fork(void)
+{
+  uint8_t parent[OUT], child[OUT];
+  int fds[2];
+  Lib_RandomBuffer_System_crypto_random(parent, OUT);
+  if (pipe(fds) != 0)
+    return false;
+  pid_t pid = fork();
+  if (pid == 0) {
+    Lib_RandomBuffer_System_crypto_random(child, OUT);
+    ssize_t w = write(fds[1], child, OUT);
+    _exit(w == OUT ? 0 : 1);
+  }
+  Lib_RandomBuffer_System_crypto_random(parent, OUT);
+  int status;
+  waitpid(pid, &status, 0);
+  bool ok = read(fds[0], child, OUT) == OUT;
+  close(fds[0]);
+  close(fds[1]);
+  ok &= WIFEXITED(status) && WEXITSTATUS(status) == 0;
+  ok &= memcmp(parent, child, OUT) != 0;
+  printf("crypto_random fork: %s\n", ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+int
+main()
+{
+  bool ok = true;
+  ok &= test_sizes();
+  ok &= test_threads();
+  ok &= test_fork();
+
+  uint8_t buf[OUT];
+  cycles a, b;
+  clock_t t1, t2;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Lib_RandomBuffer_System_crypto_random(buf, OUT);
+  b = cpucycles_end();
+  t2 = clock();
+  printf("Lib_RandomBuffer_System_crypto_random (%d bytes):\n", OUT);
+  print_time((uint64_t)ROUNDS * OUT, t2 - t1, b - a);
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Lib_RandomBuffer_System_randombytes(buf, OUT);
+  b = cpucycles_end();
+  t2 = clock();
+  printf("Lib_RandomBuffer_System_randombytes (%d bytes):\n", OUT);
+  print_time((uint64_t)ROUNDS * OUT, t2 - t1, b - a);
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,259 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "Hacl_EC_Ed25519.h"
+#include "Hacl_Ristretto255.h"
+
+#include "test_helpers.h"
+
+#define N 150
+#define ROUNDS 20000
+
+// RFC 9496, Appendix A.1: [0]B, [1]B, ..., [15]B.
+static const char* multiples[16] = {
+  "0000000000000000000000000000000000000000000000000000000000000000",
+  "e2f2ae0a6abc4e71a884a961c500515f58e30b6aa582dd8db6a65945e08d2d76",
+  "6a493210f7499cd17fecb510ae0cea23a110e8d5b901f8acadd3095c73a3b919",
+  "94741f5d5d52755ece4f23f044ee27d5d1ea1e2bd196b462166b16152a9d0259",
+  "da80862773358b466ffadfe0b3293ab3d9fd53c5ea6c955358f568322daf6a57",
+  "e882b131016b52c1d3337080187cf768423efccbb517bb495ab812c4160ff44e",
+  "f64746d3c92b13050ed8d80236a7f0007c3b3f962f5ba793d19a601ebb1df403",
+  "44f53520926ec81fbd5a387845beb7df85a96a24ece18738bdcfa6a7822a176d",
+  "903293d8f2287ebe10e2374dc1a53e0bc887e592699f02d077d5263cdd55601c",
+  "02622ace8f7303a31cafc63f8fc48fdc16e1c8c8d234b2f0d6685282a9076031",
+  "20706fd788b2720a1ed2a5dad4952b01f413bcf0e7564de8cdc816689e2db95f",
+  "bce83f8ba5dd2fa572864c24ba1810f9522bc6004afe95877ac73241cafdab42",
+  "e4549ee16b9aa03099ca208c67adafcafa4c3f3e4e5303de6026e3ca8ff84460",
+  "aa52e000df2e16f55fb1032fc33bc42742dad6bd5a8fc0be0167436c5948501f",
+  "46376b80f409b29dc2b5f6f0c52591990896e5716f41477cd30085ab7f10301e",
+  "e0c418f7c8d9c4cdd7395b93ea124f3ad99021bb681dfc3302a9d99a2e53e64e"
+};
+
+// Not below p, negative, top bit set, no square root, negative t, and y = 0.
+static const char* invalid[8] = {
+  "edffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f",
+  "f3ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f",
+  "0100000000000000000000000000000000000000000000000000000000000000",
+  "0000000000000000000000000000000000000000000000000000000000000080",
+  "e2f2ae0a6abc4e71a884a961c500515f58e30b6aa582dd8db6a65945e08d2df6",
+  "bc94e3829212c8ce5a6fb70c17650baed780780b712d23c23a3266bc422fa346",
+  "fc4e1f11e9002658e747ca698331eeeeca094a1c1595d05273608ac0a43aea0d",
+  "ecffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f"
+};
+
+// RFC 9496, Appendix A.3, first vector, then inputs b[j] = 37 * i + 11 * j for i = 0, 1, 2
+// and all-ones, checked against a Python transcription of the RFC.
+static const char* map_input =
+  "5d1be09e3d0c82fc538112490e35701979d99e06ca3e2b5b54bffe8b4dc772c1"
+  "4d98b696a1bbfb5ca32c436cc61c16563790306c79eaca7705668b47dffe5bb6";
+static const char* map_outputs[5] = {
+  "3066f82a1a747d45120d1740f14358531a8f04bbffe6a819f86dfe50f44a0a46",
+  "345dfe7f86a6a5d31c938b77b87df05de47cedf51aec57c4345e61bc1077a515",
+  "4821097905ddf017fe67b0a5fd97c7822fe1528a87d3fdb4ff54f149aed85d38",
+  "60d3f13b4ecff6a7e643f115678899eb7d214e6b99bca3f770161d0d0f4acd68",
+  "a64d86820abd393c6a5feef95b64945bc0c570adebae17a99882216945fbd37a"
+};
+
+static uint64_t points[N][20], torsion[20];
+static uint8_t scalars[N][32], encoded[N][32], expected[N][32];
+
+static void
+from_hex(uint8_t* out, const char* hex, size_t len)
+{
+  for (size_t i = 0; i < len; i++) {
+    unsigned int b;
+    sscanf(hex + 2 * i, "%2x", &b);
+    out[i] = (uint8_t)b;
+  }
+}
+
+static bool
+check_multiples(void)
+{
+  uint64_t b[20], p[20], q[20], r[20];
+  uint8_t s[32], e[32];
+  bool ok = true;
+  Hacl_EC_Ed25519_mk_base_point(b);
+  Hacl_EC_Ed25519_mk_point_at_inf(p);
+  for (int i = 0; i < 16; i++) {
+    from_hex(e, multiples[i], 32);
+    Hacl_Ristretto255_encode(p, s);
+    ok &= memcmp(s, e, 32) == 0;
+    ok &= Hacl_Ristretto255_decode(e, q);
+    ok &= Hacl_Ristretto255_equal(p, q);
+    Hacl_Ristretto255_encode(q, s);
+    ok &= memcmp(s, e, 32) == 0;
+    Hacl_EC_Ed25519_point_add(p, b, r);
+    memcpy(p, r, sizeof(r));
+  }
+  for (int i = 0; i < 8; i++) {
+    from_hex(e, invalid[i], 32);
+    ok &= !Hacl_Ristretto255_decode(e, q);
+  }
+  printf("Ristretto255 encode and decode (RFC 9496): %s\n", ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static bool
+check_map(void)
+{
+  uint8_t in[64], s[32], e[32];
+  uint64_t p[20];
+  bool ok = true;
+  for (int i = 0; i < 5; i++) {
+    if (i == 0)
+      from_hex(in, map_input, 64);
+    else if (i == 4)
+      memset(in, 0xff, 64);
+    else
+      for (int j = 0; j < 64; j++)
+        in[j] = (uint8_t)(37 * (i - 1) + 11 * j);
+    Hacl_Ristretto255_from_uniform_bytes(in, p);
+    Hacl_Ristretto255_encode(p, s);
+    from_hex(e, map_outputs[i], 32);
+    ok &= memcmp(s, e, 32) == 0;
+  }
+  printf("Ristretto255 from_uniform_bytes: %s\n", ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+// Elements [k]B for assorted k, some moved to another representative of their class by
+// adding the 2-torsion point (0, -1), which Hacl_EC_Ed25519_point_eq tells apart.
+static void
+make_points(void)
+{
+  uint64_t b[20], q[20];
+  torsion[5] = 0x7ffffffffffecULL;
+  torsion[6] = torsion[7] = torsion[8] = torsion[9] = 0x7ffffffffffffULL;
+  torsion[10] = 1;
+  Hacl_EC_Ed25519_mk_base_point(b);
+  for (int i = 0; i < N; i++) {
+    uint8_t k[32];
+    for (int j = 0; j < 32; j++) {
+      k[j] = (uint8_t)(i * 23 + j * 5 + 1);
+      scalars[i][j] = (uint8_t)(i * 41 + j * 17 + (i >> 3));
+    }
+    scalars[i][31] &= 0x0f;
+    Hacl_EC_Ed25519_point_mul(k, b, points[i]);
+    if (i % 3 == 1) {
+      Hacl_EC_Ed25519_point_add(points[i], torsion, q);
+      memcpy(points[i], q, sizeof(q));
+    }
+  }
+  Hacl_EC_Ed25519_mk_point_at_inf(points[4]);
+  memcpy(points[7], torsion, sizeof(torsion));
+}
+
+static bool
+check_equal_and_batch(void)
+{
+  uint64_t p[20], q[20];
+  bool ok = true;
+  for (int i = 0; i < N; i++) {
+    Hacl_EC_Ed25519_point_double(points[i], p);
+    Hacl_Ristretto255_encode(p, expected[i]);
+    Hacl_Ristretto255_decode(expected[i], q);
+    ok &= Hacl_Ristretto255_equal(p, q);
+    ok &= !Hacl_Ristretto255_equal(points[i], points[(i + 1) % N]);
+    Hacl_Ristretto255_encode(points[i], encoded[i]);
+    Hacl_Ristretto255_decode(encoded[i], q);
+    ok &= Hacl_Ristretto255_equal(points[i], q);
+    Hacl_EC_Ed25519_point_add(points[i], torsion, q);
+    ok &= Hacl_Ristretto255_equal(points[i], q) && !Hacl_EC_Ed25519_point_eq(points[i], q);
+  }
+  // The identity and the 2-torsion point are the same element.
+  ok &= Hacl_Ristretto255_equal(points[4], points[7]);
+  ok &= memcmp(encoded[4], encoded[7], 32) == 0;
+  ok &= memcmp(expected[4], expected[7], 32) == 0;
+  memset(encoded, 0, sizeof(encoded));
+  Hacl_Ristretto255_double_and_encode_batch(N, (uint64_t*)points, (uint8_t*)encoded);
+  ok &= memcmp(encoded, expected, sizeof(expected)) == 0;
+  Hacl_Ristretto255_double_and_encode_batch(1, points[1], encoded[0]);
+  ok &= memcmp(encoded[0], expected[1], 32) == 0;
+  printf("Ristretto255 equal and double_and_encode_batch: %s\n", ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static bool
+check_msm(void)
+{
+  uint64_t acc[20], p[20], q[20];
+  Hacl_EC_Ed25519_mk_point_at_inf(acc);
+  for (int i = 0; i < N; i++) {
+    Hacl_EC_Ed25519_point_mul(scalars[i], points[i], p);
+    Hacl_EC_Ed25519_point_add(acc, p, q);
+    memcpy(acc, q, sizeof(q));
+  }
+  bool ok = Hacl_Ristretto255_mul_multi_vartime(N, (uint8_t*)scalars, (uint64_t*)points, p);
+  ok &= Hacl_Ristretto255_equal(acc, p);
+  printf("Ristretto255 mul_multi_vartime: %s\n", ok ? "Success!" : "FAILURE");
+  return ok;
+}
+
+static void
+bench(void)
+{
+  uint8_t s[32], in[64];
+  uint64_t p[20];
+  cycles c0, c1;
+  clock_t t1, t2;
+  memset(in, 'r', 64);
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_Ristretto255_encode(points[j % N], s);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("Ristretto255 encode:\n");
+  print_time(ROUNDS, t2 - t1, c1 - c0);
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS / N; j++)
+    Hacl_Ristretto255_double_and_encode_batch(N, (uint64_t*)points, (uint8_t*)encoded);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("Ristretto255 double_and_encode_batch (%d elements), per element:\n", N);
+  print_time(ROUNDS / N * N, t2 - t1, c1 - c0);
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_Ristretto255_decode(expected[j % N], p);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("Ristretto255 decode:\n");
+  print_time(ROUNDS, t2 - t1, c1 - c0);
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    in[0] = (uint8_t)j;
+    Hacl_Ristretto255_from_uniform_bytes(in, p);
+  }
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("Ristretto255 from_uniform_bytes:\n");
+  print_time(ROUNDS, t2 - t1, c1 - c0);
+}
+
+int
+main()
+{
+  bool ok = check_multiples();
+  ok &= check_map();
+  make_points();
+  ok &= check_equal_and_batch();
+  ok &= check_msm();
+  bench();
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,101 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test_helpers.h"
+
+#include "Hacl_AEAD_XChacha20Poly1305_Simd128.h"
+#include "Hacl_Chacha20.h"
+#include "Hacl_Chacha20_Vec128.h"
+
+#include "EverCrypt_AutoConfig2.h"
+
+#include "xchacha20poly1305_vectors.h"
+
+bool
+print_result(int in_len, uint8_t* comp, uint8_t* exp)
+{
+  return compare_and_print(in_len, comp, exp);
+}
+
+int
+main()
+{
+  EverCrypt_AutoConfig2_init();
+  if (!EverCrypt_AutoConfig2_has_vec128()) {
+    printf("The current hardware doesn't support vec128: aborting\n");
+    return EXIT_SUCCESS;
+  } else {
+    printf("The current hardware supports vec128: performing the tests\n");
+  }
+
+  int len = sizeof xchacha20poly1305_input;
+  uint8_t subkey[32] = { 0 };
+  uint8_t cipher[len];
+  uint8_t plain[len];
+  uint8_t tag[16] = { 0 };
+  bool ok = true;
+
+  // Batch derivation, cross-checked against the scalar HChacha20 on a number
+  // of subkeys that is not a multiple of the number of lanes.
+  uint8_t keys[11 * 32];
+  uint8_t nonces[11 * 16];
+  uint8_t subkeys[11 * 32];
+  for (int i = 0; i < 11 * 32; i++)
+    keys[i] = (uint8_t)(i * 7 + 1);
+  for (int i = 0; i < 11 * 16; i++)
+    nonces[i] = (uint8_t)(i * 3);
+  memcpy(keys + 32, hchacha20_key, 32);
+  memcpy(nonces + 16, hchacha20_nonce, 16);
+  Hacl_Chacha20_Vec128_hchacha20_128(11, subkeys, keys, nonces);
+  printf("HChacha20 (128-bit) Result:\n");
+  ok &= print_result(32, subkeys + 32, hchacha20_subkey);
+  for (int i = 0; i < 11; i++) {
+    Hacl_Chacha20_hchacha20(subkey, keys + 32 * i, nonces + 16 * i);
+    ok &= memcmp(subkey, subkeys + 32 * i, 32) == 0;
+  }
+
+  Hacl_AEAD_XChacha20Poly1305_Simd128_encrypt(cipher,
+                                tag,
+                                xchacha20poly1305_input,
+                                len,
+                                xchacha20poly1305_aad,
+                                sizeof xchacha20poly1305_aad,
+                                xchacha20poly1305_key,
+                                xchacha20poly1305_nonce);
+  printf("XChacha20Poly1305 (128-bit) Result (chacha20):\n");
+  ok &= print_result(len, cipher, xchacha20poly1305_cipher);
+  printf("(poly1305):\n");
+  ok &= print_result(16, tag, xchacha20poly1305_tag);
+
+  uint32_t res = Hacl_AEAD_XChacha20Poly1305_Simd128_decrypt(plain,
+                                xchacha20poly1305_cipher,
+                                len,
+                                xchacha20poly1305_aad,
+                                sizeof xchacha20poly1305_aad,
+                                xchacha20poly1305_key,
+                                xchacha20poly1305_nonce,
+                                xchacha20poly1305_tag);
+  ok &= res == 0;
+  ok &= print_result(len, plain, xchacha20poly1305_input);
+
+  tag[0] ^= 0x80;
+  res = Hacl_AEAD_XChacha20Poly1305_Simd128_decrypt(plain,
+                                xchacha20poly1305_cipher,
+                                len,
+                                xchacha20poly1305_aad,
+                                sizeof xchacha20poly1305_aad,
+                                xchacha20poly1305_key,
+                                xchacha20poly1305_nonce,
+                                tag);
+  if (res != 1)
+    printf("XChacha20Poly1305 (128-bit) accepted a forged tag\n");
+  ok &= res == 1;
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,79 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test_helpers.h"
+
+#include "Hacl_AEAD_XChacha20Poly1305.h"
+#include "Hacl_Chacha20.h"
+
+#include "EverCrypt_AutoConfig2.h"
+
+#include "xchacha20poly1305_vectors.h"
+
+bool
+print_result(int in_len, uint8_t* comp, uint8_t* exp)
+{
+  return compare_and_print(in_len, comp, exp);
+}
+
+int
+main()
+{
+  EverCrypt_AutoConfig2_init();
+
+  int len = sizeof xchacha20poly1305_input;
+  uint8_t subkey[32] = { 0 };
+  uint8_t cipher[len];
+  uint8_t plain[len];
+  uint8_t tag[16] = { 0 };
+  bool ok = true;
+
+  Hacl_Chacha20_hchacha20(subkey, hchacha20_key, hchacha20_nonce);
+  printf("HChacha20 Result:\n");
+  ok &= print_result(32, subkey, hchacha20_subkey);
+
+  Hacl_AEAD_XChacha20Poly1305_encrypt(cipher,
+                                tag,
+                                xchacha20poly1305_input,
+                                len,
+                                xchacha20poly1305_aad,
+                                sizeof xchacha20poly1305_aad,
+                                xchacha20poly1305_key,
+                                xchacha20poly1305_nonce);
+  printf("XChacha20Poly1305 (32-bit) Result (chacha20):\n");
+  ok &= print_result(len, cipher, xchacha20poly1305_cipher);
+  printf("(poly1305):\n");
+  ok &= print_result(16, tag, xchacha20poly1305_tag);
+
+  uint32_t res = Hacl_AEAD_XChacha20Poly1305_decrypt(plain,
+                                xchacha20poly1305_cipher,
+                                len,
+                                xchacha20poly1305_aad,
+                                sizeof xchacha20poly1305_aad,
+                                xchacha20poly1305_key,
+                                xchacha20poly1305_nonce,
+                                xchacha20poly1305_tag);
+  ok &= res == 0;
+  ok &= print_result(len, plain, xchacha20poly1305_input);
+
+  tag[0] ^= 0x80;
+  res = Hacl_AEAD_XChacha20Poly1305_decrypt(plain,
+                                xchacha20poly1305_cipher,
+                                len,
+                                xchacha20poly1305_aad,
+                                sizeof xchacha20poly1305_aad,
+                                xchacha20poly1305_key,
+                                xchacha20poly1305_nonce,
+                                tag);
+  if (res != 1)
+    printf("XChacha20Poly1305 (32-bit) accepted a forged tag\n");
+  ok &= res == 1;
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}